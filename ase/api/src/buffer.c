@@ -38,6 +38,7 @@
 #include <sys/stat.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <unistd.h>
@@ -58,6 +59,10 @@
 
 #define MAP_1G_HUGEPAGE	(0x1e << MAP_HUGE_SHIFT) /* 2 ^ 0x1e = 1G */
 
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
 #ifdef __ia64__
 #define ADDR (void *)(0x8000000000000000UL)
 #define FLAGS_4K (MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED)
@@ -161,6 +166,38 @@ static fpga_result buffer_allocate(void **addr, uint64_t len, int flags)
 	return FPGA_OK;
 }
 
+/*
+ * Replace the pages of a newly allocated buffer with a memfd mapping, so
+ * that the simulator can map the same pages and access them without a
+ * round trip through the application. Returns the memfd, or -1 when the
+ * buffer stays private. Private buffers still work; every access is
+ * then serviced by the application.
+ */
+static int buffer_share(void *addr, uint64_t len)
+{
+#ifdef SYS_memfd_create
+	int fd = (int) syscall(SYS_memfd_create, "ase_host_buffer",
+			       MFD_CLOEXEC);
+	if (fd < 0)
+		return -1;
+
+	if (ftruncate(fd, (off_t) len) ||
+	    (mmap(addr, len, PROTECTION, MAP_SHARED | MAP_FIXED, fd, 0) ==
+	     MAP_FAILED)) {
+		FPGA_MSG("Could not share buffer with the simulator: %s",
+			 strerror(errno));
+		close(fd);
+		return -1;
+	}
+
+	return fd;
+#else
+	UNUSED_PARAM(addr);
+	UNUSED_PARAM(len);
+	return -1;
+#endif
+}
+
 /*
  * Release (unmap) allocated buffer
  */
@@ -205,6 +242,7 @@ fpga_result __FPGA_API__ fpgaPrepareBuffer(fpga_handle handle, uint64_t len,
 
 	bool preallocated = (flags & FPGA_BUF_PREALLOCATED);
 	bool quiet = (flags & FPGA_BUF_QUIET);
+	int share_fd = -1;
 
 	uint64_t pg_size;
 
@@ -277,12 +315,17 @@ fpga_result __FPGA_API__ fpgaPrepareBuffer(fpga_handle handle, uint64_t len,
 		if (result != FPGA_OK) {
 			goto out_unlock;
 		}
+
+		share_fd = buffer_share(addr, len);
 	}
 
 	/* Simulated equivalent of pinning the page */
 	uint64_t dma_map_iova;
 
 	if (ase_host_memory_pin(addr, &dma_map_iova, len) != 0) {
+		if (share_fd >= 0) {
+			close(share_fd);
+		}
 		if (!preallocated) {
 			buffer_release(addr, len);
 		}
@@ -296,6 +339,13 @@ fpga_result __FPGA_API__ fpgaPrepareBuffer(fpga_handle handle, uint64_t len,
 		goto out_unlock;
 	}
 
+	/* The simulator keeps its own reference to the pages */
+	if (share_fd >= 0) {
+		if (share_host_memory(share_fd, dma_map_iova, len))
+			FPGA_MSG("Could not share buffer with the simulator");
+		close(share_fd);
+	}
+
 	/* Generate unique workspace ID */
 	*wsid = wsid_gen();
 
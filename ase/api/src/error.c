@@ -39,6 +39,17 @@ fpga_result __FPGA_API__ fpgaReadError(fpga_token token, uint32_t error_num, uin
 	return FPGA_NOT_SUPPORTED;
 }
 
+fpga_result __FPGA_API__ fpgaReadAllErrors(fpga_token token, uint64_t *values,
+					   uint32_t max_values,
+					   uint32_t *num_errors)
+{
+	UNUSED_PARAM(token);
+	UNUSED_PARAM(values);
+	UNUSED_PARAM(max_values);
+	UNUSED_PARAM(num_errors);
+	return FPGA_NOT_SUPPORTED;
+}
+
 fpga_result __FPGA_API__ fpgaClearError(fpga_token token, uint32_t error_num)
 {
 	UNUSED_PARAM(token);
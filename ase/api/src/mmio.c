@@ -149,6 +149,50 @@ fpga_result __FPGA_API__ fpgaWriteMMIO64(fpga_handle handle,
 
 }
 
+/*
+ * The simulator has no wide MMIO path: blocks are sent as 64-bit writes,
+ * in ascending address order.
+ */
+fpga_result __FPGA_API__ fpgaWriteMMIOBlock(fpga_handle handle,
+					    uint32_t mmio_num,
+					    uint64_t offset, const void *src,
+					    size_t len)
+{
+	const uint8_t *p = (const uint8_t *) src;
+	fpga_result result = FPGA_OK;
+	uint64_t value;
+	size_t i;
+
+	if (NULL == src) {
+		FPGA_MSG("src is NULL");
+		return FPGA_INVALID_PARAM;
+	}
+
+	if (len % sizeof(uint64_t) != 0) {
+		FPGA_MSG("Misaligned MMIO access");
+		return FPGA_INVALID_PARAM;
+	}
+
+	for (i = 0; i < len && result == FPGA_OK; i += sizeof(uint64_t)) {
+		memcpy(&value, p + i, sizeof(value));
+		result = fpgaWriteMMIO64(handle, mmio_num, offset + i, value);
+	}
+
+	return result;
+}
+
+fpga_result __FPGA_API__ fpgaWriteMMIO512(fpga_handle handle,
+					  uint32_t mmio_num,
+					  uint64_t offset, const void *value)
+{
+	if (offset % 64 != 0) {
+		FPGA_MSG("Misaligned MMIO access");
+		return FPGA_INVALID_PARAM;
+	}
+
+	return fpgaWriteMMIOBlock(handle, mmio_num, offset, value, 64);
+}
+
 fpga_result __FPGA_API__ fpgaReadMMIO64(fpga_handle handle,
 					uint32_t mmio_num, uint64_t offset,
 					uint64_t *value)
@@ -26,6 +26,7 @@
 
 #include <opae/access.h>
 #include <opae/utils.h>
+#include <opae/umsg.h>
 #include "common_int.h"
 #include "ase_common.h"
 
@@ -113,3 +114,33 @@ fpga_result fpgaTriggerUmsg(fpga_handle handle, uint64_t value)
 
 	return result;
 }
+
+// Get a pre-validated UMsg doorbell
+fpga_result __FPGA_API__ fpgaGetUmsgDoorbell(fpga_handle handle,
+					     uint32_t first_slot,
+					     uint32_t num_slots, int flags,
+					     fpga_umsg_doorbell *doorbell)
+{
+	fpga_result result;
+	uint64_t *umsg_ptr = NULL;
+
+	if (doorbell == NULL)
+		return FPGA_INVALID_PARAM;
+
+	if (num_slots == 0 ||
+	    (uint64_t) first_slot + num_slots > NUM_UMSG_PER_AFU)
+		return FPGA_INVALID_PARAM;
+
+	result = fpgaGetUmsgPtr(handle, &umsg_ptr);
+	if (result != FPGA_OK)
+		return result;
+
+	doorbell->base = umsg_ptr + (uint64_t) first_slot *
+		(ASE_PAGESIZE / sizeof(uint64_t));
+	doorbell->stride = ASE_PAGESIZE / sizeof(uint64_t);
+	doorbell->num_slots = num_slots;
+	doorbell->flags = (uint32_t) flags;
+	doorbell->next = 0;
+
+	return FPGA_OK;
+}
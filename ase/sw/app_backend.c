@@ -1739,7 +1739,7 @@ static int send_fd(int sock_fd, int fd, struct event_request *req)
 	char buf[CMSG_SPACE(sizeof(int))];
 
 	ase_memset(buf, 0x0, sizeof(buf));
-	struct iovec io = { .iov_base = req, .iov_len = sizeof(struct event_request *) };
+	struct iovec io = { .iov_base = req, .iov_len = sizeof(struct event_request) };
 
 	cmsg = (struct cmsghdr *)buf;
 	cmsg->cmsg_level = SOL_SOCKET;
@@ -1838,6 +1838,48 @@ int unregister_event(int event_handle)
 	return res;
 }
 
+/*
+ * Share a pinned buffer with the simulator. fd backs the pages pinned at
+ * iova. The simulator maps the same pages and serves AFU reads and writes
+ * to them directly instead of sending memory requests to the application.
+ */
+int share_host_memory(int fd, uint64_t iova, uint64_t length)
+{
+	struct sockaddr_un saddr;
+	int res;
+	struct event_request req;
+	int sock_fd;
+
+	res = generate_sockname(saddr.sun_path);
+	if (res < 0) {
+		return 1;
+	}
+
+	/* open socket */
+	sock_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sock_fd < 0) {
+		ASE_ERR("Error opening socket: %s\n", strerror(errno));
+		return 1;
+	}
+
+	saddr.sun_family = AF_UNIX;
+	res = connect(sock_fd, (struct sockaddr *) &saddr,
+		      sizeof(struct sockaddr_un));
+	if (res < 0) {
+		ASE_ERR("%s: Error connecting to stream socket: %s\n",
+			__func__, strerror(errno));
+	} else {
+		ase_memset(&req, 0, sizeof(req));
+		req.type = SHARE_HOST_MEMORY;
+		req.iova = iova;
+		req.length = length;
+		res = send_fd(sock_fd, fd, &req);
+	}
+
+	close(sock_fd);
+	return res;
+}
+
 /*
  * ase_portctrl: Send port control message to simulator
  *
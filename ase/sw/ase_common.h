@@ -591,16 +591,23 @@ struct ipc_t mq_array[ASE_MQ_INSTANCES];
 #define SOCKNAME "/tmp/ase_event_server_"
 enum request_type {
 	REGISTER_EVENT = 0,
-	UNREGISTER_EVENT = 1
+	UNREGISTER_EVENT = 1,
+	SHARE_HOST_MEMORY = 2
 };
 
+// Be careful of alignment within this structure!  The layout must be
+// identical on both 64 bit and 32 bit compilations.
 struct event_request {
 	enum request_type type;
 	int flags;
+	// SHARE_HOST_MEMORY only: pinned region backed by the passed fd
+	uint64_t iova;
+	uint64_t length;
 };
 
 int register_event(int event_handle, int flags);
 int unregister_event(int event_handle);
+int share_host_memory(int fd, uint64_t iova, uint64_t length);
 
 // ---------------------------------------------------------------------
 // Enable memory test function
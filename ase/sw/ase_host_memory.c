@@ -38,6 +38,7 @@
 #include <sys/mman.h>
 #include <assert.h>
 #include <pthread.h>
+#include <sched.h>
 
 #include "ase_common.h"
 #include "ase_host_memory.h"
@@ -46,11 +47,24 @@
 #define MB (1024 * KB)
 #define GB (1024UL * MB)
 
+// Serializes pin/unpin. Translation never takes the lock. See the
+// "Lock-free readers" section below.
 static pthread_mutex_t ase_pt_lock = PTHREAD_MUTEX_INITIALIZER;
 
 static uint64_t **ase_pt_root;
 static bool ase_pt_enable_debug;
 
+// Incremented whenever a pinned translation is removed, invalidating
+// all per-thread TLB entries.
+static uint64_t ase_pt_gen = 1;
+
+static void ase_pt_read_lock(void);
+static void ase_pt_read_unlock(void);
+static void ase_pt_synchronize(void);
+static uint64_t ase_pt_tlb_lookup(uint64_t pa, uint64_t gen);
+static void ase_pt_tlb_insert(uint64_t pa, int pt_level, uint64_t gen);
+static void ase_pt_tlb_report(void);
+
 static int ase_pt_length_to_level(uint64_t length);
 static uint64_t ase_pt_level_to_bit_idx(int pt_level);
 static void ase_pt_delete_tree(uint64_t **pt, int pt_level);
@@ -65,16 +79,16 @@ static int ase_pt_unpin_page(uint64_t iova, int pt_level);
  */
 int ase_host_memory_pin(void *va, uint64_t *iova, uint64_t length)
 {
-	if (pthread_mutex_lock(&ase_pt_lock)) {
-		ASE_ERR("pthread_mutex_lock could not attain the lock !\n");
-		return -1;
-	}
-
 	// Map buffer length to a level in the page table.
 	int pt_level = ase_pt_length_to_level(length);
 	if (pt_level == -1)
 		return -1;
 
+	if (pthread_mutex_lock(&ase_pt_lock)) {
+		ASE_ERR("pthread_mutex_lock could not attain the lock !\n");
+		return -1;
+	}
+
 	int status = ase_pt_pin_page((uint64_t)va, iova, pt_level);
 	if (status == 0) {
 		note_pinned_page((uint64_t)va, *iova, length);
@@ -96,17 +110,23 @@ int ase_host_memory_unpin(uint64_t iova, uint64_t length)
 {
 	int status = 0;
 
+	int pt_level = ase_pt_length_to_level(length);
+	if (pt_level == -1)
+		return -1;
+
 	if (pthread_mutex_lock(&ase_pt_lock)) {
 		ASE_ERR("pthread_mutex_lock could not attain lock !\n");
 		return -1;
 	}
 
 	if (ase_pt_root != NULL) {
-		int pt_level = ase_pt_length_to_level(length);
-		if (pt_level == -1)
-			return -1;
-
 		status = ase_pt_unpin_page(iova, pt_level);
+
+		// Invalidate cached translations and wait for readers that
+		// may still be using the page. The caller is free to unmap
+		// the page once we return.
+		__atomic_add_fetch(&ase_pt_gen, 1, __ATOMIC_SEQ_CST);
+		ase_pt_synchronize();
 	}
 
 	if (pthread_mutex_unlock(&ase_pt_lock)) {
@@ -158,7 +178,10 @@ uint64_t ase_host_memory_va_to_pa(uint64_t va, uint64_t length)
  * Translate from simulated physical address space. Optionally hold the lock
  * after translation so that the buffer remains pinned. Callers that set
  * "lock" must call ase_host_memory_unlock() or subsequent calls to
- * ase_host_memory functions will deadlock.
+ * ase_host_memory_unpin() will never return.
+ *
+ * Translation is lock-free. "lock" only keeps the calling thread in a
+ * read-side critical section, which delays unpinning of the page.
  */
 uint64_t ase_host_memory_pa_to_va(uint64_t pa, bool lock)
 {
@@ -168,35 +191,31 @@ uint64_t ase_host_memory_pa_to_va(uint64_t pa, bool lock)
 		raise(SIGABRT);
 	}
 
-	if (pthread_mutex_lock(&ase_pt_lock)) {
-		ASE_ERR("pthread_mutex_lock could not attain lock !\n");
-		return 0;
-	}
+	ase_pt_read_lock();
 
-	// Is the page pinned?
-	int pt_level;
-	bool found_addr;
-	found_addr = ase_pt_check_addr(pa, &pt_level);
+	// Recently translated?
+	uint64_t gen = __atomic_load_n(&ase_pt_gen, __ATOMIC_ACQUIRE);
+	uint64_t va = ase_pt_tlb_lookup(pa, gen);
 
-	if (!lock) {
-		if (pthread_mutex_unlock(&ase_pt_lock)) {
-			ASE_ERR("pthread_mutex_lock could not unlock !\n");
-			return 0;
+	if (!va) {
+		// Is the page pinned?
+		int pt_level;
+		if (ase_pt_check_addr(pa, &pt_level)) {
+			ase_pt_tlb_insert(pa, pt_level, gen);
+			va = pa ^ ase_host_memory_gen_xor_mask(pt_level);
 		}
 	}
 
-	if (!found_addr) {
-		return 0;
-	}
+	if (!lock)
+		ase_pt_read_unlock();
 
-	return pa ^ ase_host_memory_gen_xor_mask(pt_level);
+	return va;
 }
 
 
 void ase_host_memory_unlock(void)
 {
-	if (pthread_mutex_unlock(&ase_pt_lock))
-		ASE_ERR("pthread_mutex_lock could not unlock !\n");
+	ase_pt_read_unlock();
 }
 
 
@@ -215,11 +234,167 @@ void ase_host_memory_terminate(void)
 	if (pthread_mutex_lock(&ase_pt_lock))
 		ASE_ERR("pthread_mutex_lock could not attain the lock !\n");
 
-	ase_pt_delete_tree(ase_pt_root, 3);
-	ase_pt_root = NULL;
+	uint64_t **root = __atomic_exchange_n(&ase_pt_root, NULL,
+					      __ATOMIC_SEQ_CST);
+	__atomic_add_fetch(&ase_pt_gen, 1, __ATOMIC_SEQ_CST);
+	ase_pt_synchronize();
+	ase_pt_delete_tree(root, 3);
 
 	if (pthread_mutex_unlock(&ase_pt_lock))
 		ASE_ERR("pthread_mutex_lock could not unlock !\n");
+
+	ase_pt_tlb_report();
+}
+
+
+// ========================================================================
+//
+//	Lock-free readers.
+//
+// ========================================================================
+
+/*
+ * Translation walks the page table without locks. Pin and unpin are
+ * serialized by ase_pt_lock and modify the table with atomic stores, so
+ * a reader always sees either the old or the new entry. New nodes are
+ * fully initialized before they are published.
+ *
+ * Memory that may still be visible to readers (unpinned pages and
+ * replaced sub-trees) is released only after a grace period. Each reader
+ * thread owns a sequence counter that is odd while the thread is inside
+ * a read-side critical section. ase_pt_synchronize() waits for every
+ * counter that was odd on entry to change.
+ *
+ * Each reader thread also keeps a small TLB of recent translations.
+ * Entries are tagged with ase_pt_gen and become stale as soon as any page
+ * is unpinned.
+ */
+
+#define ASE_PT_TLB_ENTRIES 4
+
+struct ase_pt_tlb_entry {
+	uint64_t gen;
+	// pa >> page shift. Zero is never a valid tag since gen starts at 1.
+	uint64_t tag;
+	int pt_level;
+};
+
+struct ase_pt_reader {
+	uint64_t seq;
+	uint64_t tlb_hits;
+	uint64_t tlb_misses;
+	uint32_t tlb_next;
+	struct ase_pt_tlb_entry tlb[ASE_PT_TLB_ENTRIES];
+	struct ase_pt_reader *next;
+};
+
+// Reader records are never freed, so the list can be walked without locks.
+static struct ase_pt_reader *ase_pt_readers;
+static __thread struct ase_pt_reader *ase_pt_self;
+
+static struct ase_pt_reader *ase_pt_reader(void)
+{
+	struct ase_pt_reader *r = ase_pt_self;
+
+	if (r == NULL) {
+		r = ase_malloc(sizeof(*r));
+		r->next = __atomic_load_n(&ase_pt_readers, __ATOMIC_RELAXED);
+		while (!__atomic_compare_exchange_n(&ase_pt_readers, &r->next,
+						    r, false, __ATOMIC_RELEASE,
+						    __ATOMIC_RELAXED))
+			;
+		ase_pt_self = r;
+	}
+
+	return r;
+}
+
+static void ase_pt_read_lock(void)
+{
+	struct ase_pt_reader *r = ase_pt_reader();
+
+	// Full barrier: the increment must be visible before any table load.
+	__atomic_add_fetch(&r->seq, 1, __ATOMIC_SEQ_CST);
+}
+
+static void ase_pt_read_unlock(void)
+{
+	__atomic_add_fetch(&ase_pt_self->seq, 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Wait until every reader that might hold a reference to memory removed
+ * from the table has left its critical section.
+ */
+static void ase_pt_synchronize(void)
+{
+	struct ase_pt_reader *r;
+
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	r = __atomic_load_n(&ase_pt_readers, __ATOMIC_ACQUIRE);
+	for (; r != NULL; r = r->next) {
+		// A thread can't wait for itself.
+		if (r == ase_pt_self)
+			continue;
+
+		uint64_t seq = __atomic_load_n(&r->seq, __ATOMIC_ACQUIRE);
+		if (seq & 1) {
+			while (__atomic_load_n(&r->seq, __ATOMIC_ACQUIRE) == seq)
+				sched_yield();
+		}
+	}
+}
+
+static uint64_t ase_pt_tlb_lookup(uint64_t pa, uint64_t gen)
+{
+	struct ase_pt_reader *r = ase_pt_self;
+	int i;
+
+	for (i = 0; i < ASE_PT_TLB_ENTRIES; i++) {
+		struct ase_pt_tlb_entry *e = &r->tlb[i];
+		if ((e->gen == gen) &&
+		    (e->tag == (pa >> ase_pt_level_to_bit_idx(e->pt_level)))) {
+			r->tlb_hits += 1;
+			return pa ^ ase_host_memory_gen_xor_mask(e->pt_level);
+		}
+	}
+
+	r->tlb_misses += 1;
+	return 0;
+}
+
+static void ase_pt_tlb_insert(uint64_t pa, int pt_level, uint64_t gen)
+{
+	struct ase_pt_reader *r = ase_pt_self;
+	struct ase_pt_tlb_entry *e = &r->tlb[r->tlb_next];
+
+	r->tlb_next = (r->tlb_next + 1) % ASE_PT_TLB_ENTRIES;
+	e->gen = gen;
+	e->tag = pa >> ase_pt_level_to_bit_idx(pt_level);
+	e->pt_level = pt_level;
+}
+
+/*
+ * Log TLB hit rates at the end of the session.
+ */
+static void ase_pt_tlb_report(void)
+{
+	struct ase_pt_reader *r;
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+
+	r = __atomic_load_n(&ase_pt_readers, __ATOMIC_ACQUIRE);
+	for (; r != NULL; r = r->next) {
+		hits += r->tlb_hits;
+		misses += r->tlb_misses;
+	}
+
+	if (hits + misses) {
+		ASE_MSG("Host memory translations: %" PRIu64 ", TLB hits %" PRIu64
+			" (%.1f%%)\n", hits + misses, hits,
+			(100.0 * hits) / (hits + misses));
+	}
 }
 
 
@@ -350,7 +525,7 @@ static bool ase_pt_check_addr(uint64_t iova, int *pt_level)
 	*pt_level = -1;
 
 	int level = 3;
-	uint64_t **pt = ase_pt_root;
+	uint64_t **pt = __atomic_load_n(&ase_pt_root, __ATOMIC_ACQUIRE);
 
 	while (level > 0) {
 		if (pt == NULL) {
@@ -362,7 +537,8 @@ static bool ase_pt_check_addr(uint64_t iova, int *pt_level)
 		// here are simple virtual pointers. We can do this since the table
 		// isn't actually translating -- it is simply indicating whether a
 		// physical address is pinned.
-		pt = (uint64_t **) pt[ase_pt_idx(iova, level)];
+		pt = (uint64_t **) __atomic_load_n(&pt[ase_pt_idx(iova, level)],
+						   __ATOMIC_ACQUIRE);
 		if (pt == (uint64_t **) -1) {
 			// -1 indicates a valid huge page mapping at this level.
 			*pt_level = level;
@@ -376,7 +552,8 @@ static bool ase_pt_check_addr(uint64_t iova, int *pt_level)
 	// of pointers. We do this to save space since the table only has to
 	// indicate whether a page is valid.
 	int idx = ase_pt_idx(iova, 0);
-	if (pt && ((uint64_t)pt[idx / 64] & (1UL << (idx & 63)))) {
+	if (pt && (__atomic_load_n((uint64_t *)&pt[idx / 64], __ATOMIC_ACQUIRE) &
+		   (1UL << (idx & 63)))) {
 		*pt_level = 0;
 		return true;
 	}
@@ -406,33 +583,36 @@ static int ase_pt_pin_page(uint64_t va, uint64_t *iova, int pt_level)
 
 	// Does the translation table need a page of pointers for this portion of
 	// the tree?
+	// New nodes are initialized before they are published to lock-free
+	// readers.
 	if (pt == NULL) {
-		ase_pt_root = mmap(NULL, 4096, PROT_READ | PROT_WRITE,
-						   MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
-		pt = ase_pt_root;
-		if (ase_pt_root == MAP_FAILED) {
+		pt = mmap(NULL, 4096, PROT_READ | PROT_WRITE,
+				  MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
+		if (pt == MAP_FAILED) {
 			ASE_ERR("Simulated page table out of memory!\n");
 			return -1;
 		}
 		ase_memset(pt, 0, 4096);
+		__atomic_store_n(&ase_pt_root, pt, __ATOMIC_RELEASE);
 	}
 
 	while (level != pt_level) {
 		idx = ase_pt_idx(*iova, level);
 		if (pt[idx] == NULL) {
+			uint64_t *node;
 			if (level > 1) {
-				pt[idx] = mmap(NULL, 4096, PROT_READ | PROT_WRITE,
-							   MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
+				node = mmap(NULL, 4096, PROT_READ | PROT_WRITE,
+							MAP_PRIVATE | MAP_ANONYMOUS, 0, 0);
 			} else {
-				pt[idx] = ase_malloc(64);
+				node = ase_malloc(64);
 			}
-			if ((pt[idx] == NULL) || (pt[idx] == MAP_FAILED)) {
+			if ((node == NULL) || (node == MAP_FAILED)) {
 				ASE_ERR("Simulated page table out of memory!\n");
-				pt[idx] = NULL;
 				return -1;
 			}
 
-			ase_memset(pt[idx], 0, (level > 1) ? 4096 : 64);
+			ase_memset(node, 0, (level > 1) ? 4096 : 64);
+			__atomic_store_n(&pt[idx], node, __ATOMIC_RELEASE);
 		}
 
 		if (pt == (uint64_t **) -1) {
@@ -446,15 +626,19 @@ static int ase_pt_pin_page(uint64_t va, uint64_t *iova, int pt_level)
 
 	idx = ase_pt_idx(*iova, level);
 	if (level) {
-		if (pt[idx] != NULL) {
+		uint64_t **old = (uint64_t **) __atomic_exchange_n(
+			&pt[idx], (uint64_t *) -1, __ATOMIC_SEQ_CST);
+		if ((old != NULL) && (old != (uint64_t **) -1)) {
 			// The page is already pinned. What should we do? mmap() allows overwriting
-			// existing mappings, so we behave like it for now.
-			ase_pt_delete_tree((uint64_t **)pt[idx], level);
+			// existing mappings, so we behave like it for now. Readers
+			// may still be walking the old sub-tree.
+			__atomic_add_fetch(&ase_pt_gen, 1, __ATOMIC_SEQ_CST);
+			ase_pt_synchronize();
+			ase_pt_delete_tree(old, level);
 		}
-
-		pt[idx] = (uint64_t *) -1;
 	} else {
-		pt[idx / 64] = (uint64_t *)((uint64_t)pt[idx / 64] | (1UL << (idx & 63)));
+		__atomic_fetch_or((uint64_t *)&pt[idx / 64], 1UL << (idx & 63),
+				  __ATOMIC_RELEASE);
 	}
 
 	if (ase_pt_enable_debug) {
@@ -500,10 +684,11 @@ static int ase_pt_unpin_page(uint64_t iova, int pt_level)
 			ASE_ERR("Attempt to unpin non-existent page.\n");
 			return -1;
 		}
-		pt[idx] = NULL;
+		__atomic_store_n(&pt[idx], NULL, __ATOMIC_RELEASE);
 	} else if (pt) {
 		// Drop a 4KB page
-		pt[idx / 64] = (uint64_t *)((uint64_t)pt[idx / 64] & ~(1UL << (idx & 63)));
+		__atomic_fetch_and((uint64_t *)&pt[idx / 64], ~(1UL << (idx & 63)),
+				   __ATOMIC_RELEASE);
 	}
 
 	if (ase_pt_enable_debug) {
@@ -31,16 +31,22 @@
 //
 // Definitions for accessing host memory from the FPGA simulator.  Host
 // memory address mapping and contents are managed entirely in the application.
-// The RTL simulator sends requests to the application for all reads, writes
+// The RTL simulator sends requests to the application for reads, writes
 // and address translation.
 //
-// The primary reason for handling all memory in the application instead of
+// The primary reason for handling memory in the application instead of
 // by allocating shared memory buffers with the simulator is to be able
 // to map and access an arbitrary location from the FPGA, even if the page
 // is already mapped and in use by the application.  It is nearly impossible
 // in Linux to reclassify an existing memory page as shared.  Handling all
 // accesses on the application side makes shared mapping unnecessary.
 //
+// Buffers allocated by fpgaPrepareBuffer() are the exception.  They are
+// backed by a memfd that is passed to the simulator when the buffer is
+// pinned, and the simulator completes accesses to them with a local copy.
+// Preallocated buffers and any address not covered by a shared buffer
+// still use the request path.
+//
 
 //
 // Requests types that may be sent from simulator to application.
@@ -133,6 +139,19 @@ void ase_host_memory_unlock(void);
 int ase_host_memory_initialize(void);
 void ase_host_memory_terminate(void);
 
-#endif // not SIM_SIDE
+#else // SIM_SIDE
+
+// Map a buffer shared by the application at pin time.  The fd is consumed.
+int ase_host_memory_sim_map(int fd, uint64_t iova, uint64_t length);
+// Drop shared buffers overlapping an unpinned region.
+void ase_host_memory_sim_unmap(uint64_t iova, uint64_t length);
+void ase_host_memory_sim_unmap_all(void);
+
+// Access one line of shared host memory.  Return false when pa is not
+// shared and the request must be sent to the application.
+bool ase_host_memory_sim_read(uint64_t pa, void *data);
+bool ase_host_memory_sim_write(uint64_t pa, const void *data);
+
+#endif // SIM_SIDE
 
 #endif // _ASE_HOST_MEMORY_H_
@@ -31,6 +31,7 @@
  */
 
 #include "ase_common.h"
+#include "ase_host_memory.h"
 
 // ---------------------------------------------------------------
 // ASE graceful shutdown - Called if: error() occurs
@@ -205,5 +206,165 @@ void ase_shmem_destroy(void)
 		}
 	}
 
+	ase_host_memory_sim_unmap_all();
+
 	FUNC_CALL_EXIT;
 }
+
+
+// --------------------------------------------------------------------
+// Host memory shared by the application
+//
+// Pinned buffers that the application allocates from a memfd are passed
+// to the simulator at pin time and mapped here, keyed by I/O address.
+// AFU reads and writes that hit a shared region are completed with a
+// local copy.  Anything else is forwarded to the application.
+//
+// Regions arrive on the event socket thread and are consumed by the
+// DPI thread, so the list and the copies are protected by shared_lock.
+// --------------------------------------------------------------------
+struct ase_shared_host_mem {
+	uint64_t iova;
+	uint64_t length;
+	char *va;
+	struct ase_shared_host_mem *next;
+};
+
+static struct ase_shared_host_mem *shared_head;
+static struct ase_shared_host_mem *shared_last_hit;
+static pthread_mutex_t shared_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void ase_shared_region_free(struct ase_shared_host_mem *r)
+{
+	if (shared_last_hit == r)
+		shared_last_hit = NULL;
+
+	munmap(r->va, (size_t) r->length);
+	ase_free_buffer((char *) r);
+}
+
+/*
+ * Drop every region overlapping [iova, iova + length).  Called with
+ * shared_lock held.
+ */
+static void ase_shared_region_remove(uint64_t iova, uint64_t length)
+{
+	struct ase_shared_host_mem **prev = &shared_head;
+	struct ase_shared_host_mem *r;
+
+	while ((r = *prev) != NULL) {
+		if ((r->iova < iova + length) && (iova < r->iova + r->length)) {
+			*prev = r->next;
+			ase_shared_region_free(r);
+		} else {
+			prev = &r->next;
+		}
+	}
+}
+
+/*
+ * Map a region shared by the application.  The fd is consumed.
+ */
+int ase_host_memory_sim_map(int fd, uint64_t iova, uint64_t length)
+{
+	struct ase_shared_host_mem *r;
+	void *va;
+
+	va = mmap(NULL, (size_t) length, PROT_READ | PROT_WRITE, MAP_SHARED,
+		  fd, 0);
+	close(fd);
+	if (va == MAP_FAILED) {
+		ASE_ERR("SIM-C : Unable to map shared host memory at 0x%"
+			PRIx64 ": %s\n", iova, strerror(errno));
+		return 1;
+	}
+
+	r = (struct ase_shared_host_mem *) ase_malloc(sizeof(*r));
+	r->iova = iova;
+	r->length = length;
+	r->va = (char *) va;
+
+	pthread_mutex_lock(&shared_lock);
+	// A stale region may still be here if the unpin message for an
+	// earlier buffer at the same address has not been processed yet.
+	ase_shared_region_remove(iova, length);
+	r->next = shared_head;
+	shared_head = r;
+	pthread_mutex_unlock(&shared_lock);
+
+	return 0;
+}
+
+/*
+ * Forget a shared region when the application unpins it.
+ */
+void ase_host_memory_sim_unmap(uint64_t iova, uint64_t length)
+{
+	pthread_mutex_lock(&shared_lock);
+	ase_shared_region_remove(iova, length);
+	pthread_mutex_unlock(&shared_lock);
+}
+
+void ase_host_memory_sim_unmap_all(void)
+{
+	pthread_mutex_lock(&shared_lock);
+	while (shared_head != NULL) {
+		struct ase_shared_host_mem *r = shared_head;
+		shared_head = r->next;
+		ase_shared_region_free(r);
+	}
+	pthread_mutex_unlock(&shared_lock);
+}
+
+/*
+ * Find the shared line at pa.  Called with shared_lock held.
+ */
+static char *ase_shared_line(uint64_t pa)
+{
+	struct ase_shared_host_mem *r = shared_last_hit;
+
+	if ((r == NULL) || (pa < r->iova) ||
+	    (pa + CL_BYTE_WIDTH > r->iova + r->length)) {
+		for (r = shared_head; r != NULL; r = r->next) {
+			if ((pa >= r->iova) &&
+			    (pa + CL_BYTE_WIDTH <= r->iova + r->length))
+				break;
+		}
+		if (r == NULL)
+			return NULL;
+		shared_last_hit = r;
+	}
+
+	return r->va + (pa - r->iova);
+}
+
+/*
+ * Copy one line between the simulator and shared host memory.  Return
+ * false if pa isn't in a shared region and the request must go to the
+ * application.
+ */
+bool ase_host_memory_sim_read(uint64_t pa, void *data)
+{
+	char *line;
+
+	pthread_mutex_lock(&shared_lock);
+	line = ase_shared_line(pa);
+	if (line != NULL)
+		ase_memcpy(data, line, CL_BYTE_WIDTH);
+	pthread_mutex_unlock(&shared_lock);
+
+	return (line != NULL);
+}
+
+bool ase_host_memory_sim_write(uint64_t pa, const void *data)
+{
+	char *line;
+
+	pthread_mutex_lock(&shared_lock);
+	line = ase_shared_line(pa);
+	if (line != NULL)
+		ase_memcpy(line, data, CL_BYTE_WIDTH);
+	pthread_mutex_unlock(&shared_lock);
+
+	return (line != NULL);
+}
@@ -301,6 +301,63 @@ static void memline_addr_error(const char *access_type,
 }
 
 
+/*
+ * Memory lines completed locally in shared host memory.  The RTL calls
+ * request and response DPI functions in order, but a new request may be
+ * issued before the response to the previous one.  Requests are numbered
+ * and the sequence numbers of local requests are queued, letting the
+ * response functions tell local completions from ones that must be
+ * received from the application.  When the queue is full the request
+ * is simply sent to the application.
+ */
+#define MEMLINE_LOCAL_DEPTH 8
+
+struct memline_local {
+	uint64_t seq;
+	uint8_t data[CL_BYTE_WIDTH];
+};
+
+struct memline_local_queue {
+	uint64_t req_seq;
+	uint64_t rsp_seq;
+	uint32_t head;
+	uint32_t count;
+	struct memline_local line[MEMLINE_LOCAL_DEPTH];
+};
+
+static struct memline_local_queue rd_local;
+static struct memline_local_queue wr_local;
+
+// Reserve a local slot for the next request.  NULL if the queue is full.
+static struct memline_local *memline_local_push(struct memline_local_queue *q)
+{
+	struct memline_local *l;
+
+	if (q->count == MEMLINE_LOCAL_DEPTH)
+		return NULL;
+
+	l = &q->line[(q->head + q->count) % MEMLINE_LOCAL_DEPTH];
+	l->seq = q->req_seq;
+	q->count += 1;
+	return l;
+}
+
+// Match the next response against the oldest local request.
+static struct memline_local *memline_local_pop(struct memline_local_queue *q)
+{
+	struct memline_local *l = NULL;
+	uint64_t seq = q->rsp_seq++;
+
+	if (q->count && (q->line[q->head].seq == seq)) {
+		l = &q->line[q->head];
+		q->head = (q->head + 1) % MEMLINE_LOCAL_DEPTH;
+		q->count -= 1;
+	}
+
+	return l;
+}
+
+
 /*
  * DPI: Write line request (sent to application)
  */
@@ -312,6 +369,7 @@ void wr_memline_req_dex(cci_pkt *pkt)
 	int intr_id;
 
 	ase_host_memory_write_req wr_req;
+	struct memline_local *local;
 
 	if (pkt->mode == CCIPKT_WRITE_MODE) {
 		/*
@@ -320,12 +378,21 @@ void wr_memline_req_dex(cci_pkt *pkt)
 		 */
 		phys_addr = (uint64_t) pkt->cl_addr << 6;
 
-		// Write to memory
-		wr_req.req = HOST_MEM_REQ_WRITE_LINE;
-		wr_req.addr = phys_addr;
-		ase_memcpy(wr_req.data, (char *) pkt->qword, CL_BYTE_WIDTH);
+		// Write directly to shared host memory if possible
+		local = memline_local_push(&wr_local);
+		if (!local ||
+		    !ase_host_memory_sim_write(phys_addr, pkt->qword)) {
+			if (local)
+				wr_local.count -= 1;
 
-		mqueue_send(sim2app_membus_wr_req_tx, (char *) &wr_req, sizeof(wr_req));
+			// Write to memory
+			wr_req.req = HOST_MEM_REQ_WRITE_LINE;
+			wr_req.addr = phys_addr;
+			ase_memcpy(wr_req.data, (char *) pkt->qword, CL_BYTE_WIDTH);
+
+			mqueue_send(sim2app_membus_wr_req_tx, (char *) &wr_req, sizeof(wr_req));
+		}
+		wr_local.req_seq += 1;
 
 		// Success
 		pkt->success = 1;
@@ -360,6 +427,12 @@ void wr_memline_rsp_dex(cci_pkt *pkt)
 	// was valid.  Raise an error for invalid addresses.
 
 	if (pkt->mode == CCIPKT_WRITE_MODE) {
+		// Completed locally?
+		if (memline_local_pop(&wr_local)) {
+			FUNC_CALL_EXIT;
+			return;
+		}
+
 		while (true) {
 			status = mqueue_recv(app2sim_membus_wr_rsp_rx, (char *) &wr_rsp, sizeof(wr_rsp));
 
@@ -393,12 +466,21 @@ void rd_memline_req_dex(cci_pkt *pkt)
 
 	uint64_t phys_addr;
 	ase_host_memory_read_req rd_req;
+	struct memline_local *local;
 
 	phys_addr = (uint64_t) pkt->cl_addr << 6;
 
-	rd_req.req = HOST_MEM_REQ_READ_LINE;
-	rd_req.addr = phys_addr;
-	mqueue_send(sim2app_membus_rd_req_tx, (char *) &rd_req, sizeof(rd_req));
+	// Read directly from shared host memory if possible
+	local = memline_local_push(&rd_local);
+	if (!local || !ase_host_memory_sim_read(phys_addr, local->data)) {
+		if (local)
+			rd_local.count -= 1;
+
+		rd_req.req = HOST_MEM_REQ_READ_LINE;
+		rd_req.addr = phys_addr;
+		mqueue_send(sim2app_membus_rd_req_tx, (char *) &rd_req, sizeof(rd_req));
+	}
+	rd_local.req_seq += 1;
 
 	FUNC_CALL_EXIT;
 }
@@ -412,8 +494,17 @@ void rd_memline_rsp_dex(cci_pkt *pkt)
 	FUNC_CALL_ENTRY;
 
 	ase_host_memory_read_rsp rd_rsp;
+	struct memline_local *local;
 	int status;
 
+	// Completed locally?
+	local = memline_local_pop(&rd_local);
+	if (local) {
+		ase_memcpy((char *) pkt->qword, local->data, CL_BYTE_WIDTH);
+		FUNC_CALL_EXIT;
+		return;
+	}
+
 	while (true) {
 		status = mqueue_recv(app2sim_membus_rd_rsp_rx, (char *) &rd_rsp, sizeof(rd_rsp));
 
@@ -593,7 +684,7 @@ int read_fd(int sock_fd)
 {
 	struct msghdr msg = {0};
 	char buf[CMSG_SPACE(sizeof(int))];
-	struct event_request req = { .type = 0, .flags = 0 };
+	struct event_request req = { .type = 0, .flags = 0, .iova = 0, .length = 0 };
 	struct iovec io = { .iov_base = &req, .iov_len = sizeof(req) };
 	struct cmsghdr *cmsg;
 	int *fdptr;
@@ -636,6 +727,9 @@ int read_fd(int sock_fd)
 		vector_id = req.flags;
 		intr_event_fds[vector_id] = *fdptr;
 	}
+	if (req.type == SHARE_HOST_MEMORY) {
+		return ase_host_memory_sim_map(*fdptr, req.iova, req.length);
+	}
 	if (req.type == UNREGISTER_EVENT) {
 		int i;
 		// locate the interrupt vector to unregister
@@ -927,9 +1021,10 @@ int ase_listener(void)
 
 			if (ase_buffer.is_pinned) {
 				// Pinned buffer (host memory) messages are sent only for
-				// logging. The actual buffer is not shared with the simulator.
-				// The simulator will send read/write memory requests to the
-				// application.
+				// logging. Buffers that are shared with the simulator
+				// arrive separately on the event socket. The simulator
+				// will send read/write memory requests to the application
+				// for all others.
 				snprintf(logger_str,
 						 ASE_LOGGER_LEN,
 						 "Pinned host memory page =>\n"
@@ -1003,8 +1098,12 @@ int ase_listener(void)
 				   sizeof(struct buffer_t));
 
 			if (ase_buffer.is_pinned) {
-				// Pinned buffer (host memory) messages are sent only for
-				// logging.
+				// Pinned buffer (host memory) messages are used only for
+				// logging and for dropping the simulator's view of
+				// shared buffers.
+				ase_host_memory_sim_unmap(ase_buffer.fake_paddr,
+							  ase_buffer.memsize);
+
 				snprintf(logger_str,
 						 ASE_LOGGER_LEN,
 						 "Unpinned host memory page =>\n"
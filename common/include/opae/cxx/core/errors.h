@@ -27,7 +27,9 @@
 
 #include <opae/cxx/core/token.h>
 #include <opae/types_enum.h>
+#include <chrono>
 #include <memory>
+#include <vector>
 
 namespace opae {
 namespace fpga {
@@ -78,6 +80,28 @@ class error {
    */
   uint64_t read_value();
 
+  /**
+   * @brief The values of all error registers of a resource, read together.
+   */
+  struct snapshot_t {
+    /** Time at which the registers were read. */
+    std::chrono::system_clock::time_point timestamp;
+    /** Register values, indexed by error register number. */
+    std::vector<uint64_t> values;
+  };
+
+  /**
+   * @brief Read every error register of a resource in one pass.
+   *
+   * This is cheaper than calling read_value() on each error object when
+   * polling a resource's error state.
+   *
+   * @param tok The token object representing a resource.
+   *
+   * @return A snapshot_t holding one value per error register.
+   */
+  static snapshot_t snapshot(token::ptr_t tok);
+
   ~error() {}
 
   /**
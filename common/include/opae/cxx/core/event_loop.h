@@ -0,0 +1,205 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+
+#include <opae/cxx/core/events.h>
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#include <coroutine>
+#define OPAECXX_HAVE_COROUTINES 1
+#endif
+
+namespace opae {
+namespace fpga {
+namespace types {
+
+/**
+ * @brief Waits on many events at once from a single epoll instance
+ *
+ * An event_loop multiplexes the OS objects of any number of events (from
+ * any number of handles) on one epoll file descriptor. Each wait is
+ * one-shot: it completes exactly once, either because the event was
+ * signaled, because its timeout expired or because it was cancelled.
+ * Completions are delivered through callbacks, std::future or, when
+ * compiled as C++20, co_await.
+ *
+ * Callbacks run on the thread dispatching the loop, either a thread
+ * calling run()/run_once() or the background thread started by start().
+ * They must not block, but may register new waits.
+ */
+class event_loop {
+ public:
+  typedef std::shared_ptr<event_loop> ptr_t;
+
+  /**
+   * @brief The way a wait completed
+   */
+  enum class status { signaled, timeout, cancelled };
+
+  typedef std::function<void(status)> callback_t;
+  typedef uint64_t wait_id;
+
+  /**
+   * @brief Used as a timeout to wait without a time limit
+   */
+  static constexpr std::chrono::milliseconds infinite{-1};
+
+  /**
+   * @brief Factory function to create event_loop objects
+   *
+   * @return A shared ptr to an event_loop object
+   */
+  static event_loop::ptr_t create();
+
+  /**
+   * @brief Stop the loop and cancel any outstanding waits
+   */
+  virtual ~event_loop();
+
+  /**
+   * @brief Wait asynchronously for an event to be signaled
+   *
+   * @param ev The event to wait on
+   * @param cb Called once with the way the wait completed
+   * @param timeout How long to wait before completing with status::timeout
+   *
+   * @return An id that can be passed to cancel()
+   */
+  wait_id async_wait(event::ptr_t ev, callback_t cb,
+                     std::chrono::milliseconds timeout = infinite);
+
+  /**
+   * @brief Wait asynchronously for a file descriptor to become readable
+   *
+   * @note When the descriptor becomes readable, the loop consumes one
+   * 8-byte eventfd counter from it before completing the waits.
+   */
+  wait_id async_wait(int fd, callback_t cb,
+                     std::chrono::milliseconds timeout = infinite);
+
+  /**
+   * @brief Wait for an event, getting the result through a future
+   *
+   * @param ev The event to wait on
+   * @param timeout How long to wait before completing with status::timeout
+   *
+   * @return A future holding the way the wait completed
+   */
+  std::future<status> wait(event::ptr_t ev,
+                           std::chrono::milliseconds timeout = infinite);
+
+  /**
+   * @brief Cancel an outstanding wait
+   *
+   * The wait's callback is called with status::cancelled.
+   *
+   * @return true if the wait was still outstanding
+   */
+  bool cancel(wait_id id);
+
+  /**
+   * @brief Dispatch ready and expired waits from the calling thread
+   *
+   * @param timeout How long to block for something to become ready
+   *
+   * @return The number of waits completed
+   */
+  std::size_t run_once(std::chrono::milliseconds timeout = infinite);
+
+  /**
+   * @brief Dispatch waits from the calling thread until stop() is called
+   */
+  void run();
+
+  /**
+   * @brief Dispatch waits from a background thread owned by the loop
+   */
+  void start();
+
+  /**
+   * @brief Make run() return and join the background thread, if any
+   */
+  void stop();
+
+  /**
+   * @brief The number of outstanding waits
+   */
+  std::size_t size() const;
+
+#ifdef OPAECXX_HAVE_COROUTINES
+  /**
+   * @brief Awaitable returned by on(), resumed on the dispatching thread
+   */
+  class awaiter {
+   public:
+    awaiter(event_loop &loop, event::ptr_t ev,
+            std::chrono::milliseconds timeout)
+        : loop_(loop), ev_(ev), timeout_(timeout), status_(status::cancelled) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> h) {
+      loop_.async_wait(ev_,
+                       [this, h](status s) {
+                         status_ = s;
+                         h.resume();
+                       },
+                       timeout_);
+    }
+
+    status await_resume() const noexcept { return status_; }
+
+   private:
+    event_loop &loop_;
+    event::ptr_t ev_;
+    std::chrono::milliseconds timeout_;
+    status status_;
+  };
+
+  /**
+   * @brief Awaitable for an event: `auto s = co_await loop->on(ev);`
+   */
+  awaiter on(event::ptr_t ev, std::chrono::milliseconds timeout = infinite) {
+    return awaiter(*this, ev, timeout);
+  }
+#endif  // OPAECXX_HAVE_COROUTINES
+
+ private:
+  event_loop();
+
+  struct impl;
+  std::unique_ptr<impl> impl_;
+};
+
+}  // end of namespace types
+}  // end of namespace fpga
+}  // end of namespace opae
@@ -0,0 +1,157 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <opae/cxx/core/handle.h>
+#include <opae/cxx/core/token.h>
+
+namespace opae {
+namespace fpga {
+namespace types {
+
+/**
+ * @brief Keeps open handles warm for reuse across requests
+ *
+ * Opening a resource runs the whole driver open path and maps MMIO lazily
+ * on first access. A handle_pool keeps handles that have been released,
+ * along with their MMIO mappings, and hands them out again the next time
+ * the same resource is acquired with the same open flags. Resources are
+ * identified by their object id, so tokens from separate enumerations of
+ * the same resource share pooled handles.
+ *
+ * @note An idle handle opened without FPGA_OPEN_SHARED still owns its
+ * resource exclusively. acquire() closes it before opening the resource
+ * again with other flags, and closes idle shared handles before an
+ * exclusive open. Call clear() to give such resources back otherwise.
+ */
+class handle_pool : public std::enable_shared_from_this<handle_pool> {
+ public:
+  typedef std::shared_ptr<handle_pool> ptr_t;
+
+  /**
+   * @brief RAII ownership of a pooled handle
+   *
+   * The handle goes back to its pool when the lease is destroyed or
+   * release() is called. Copies of the handle::ptr_t must not be used
+   * after that.
+   */
+  class lease {
+   public:
+    lease() : reset_(false) {}
+    lease(lease &&other) noexcept;
+    lease &operator=(lease &&other) noexcept;
+    lease(const lease &) = delete;
+    lease &operator=(const lease &) = delete;
+    ~lease();
+
+    handle::ptr_t get() const { return handle_; }
+    handle *operator->() const { return handle_.get(); }
+    explicit operator bool() const { return handle_ != nullptr; }
+
+    /**
+     * @brief Give the handle back to the pool ahead of destruction
+     */
+    void release();
+
+   private:
+    friend class handle_pool;
+    lease(handle_pool::ptr_t pool, uint64_t object_id, int flags,
+          handle::ptr_t h, bool reset);
+
+    handle_pool::ptr_t pool_;
+    uint64_t object_id_;
+    int flags_;
+    handle::ptr_t handle_;
+    bool reset_;
+  };
+
+  /**
+   * @brief Counters describing how the pool has been used
+   */
+  struct stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t discarded;
+  };
+
+  /**
+   * @brief The pool shared by the whole process
+   */
+  static handle_pool::ptr_t instance();
+
+  /**
+   * @brief Factory function to create a private pool
+   *
+   * @param max_idle The most released handles to keep per resource
+   */
+  static handle_pool::ptr_t create(std::size_t max_idle = 4);
+
+  /**
+   * @brief Get a handle to the resource, opening one only if none is idle
+   *
+   * @param tok The resource to open
+   * @param flags Open flags passed on to fpgaOpen
+   * @param reset_on_release Reset the resource with fpgaReset when the
+   *        lease is released. A handle whose reset fails is closed instead
+   *        of being pooled.
+   *
+   * @return A lease on an open handle
+   */
+  lease acquire(token::ptr_t tok, int flags = 0, bool reset_on_release = false);
+
+  /**
+   * @brief Close all idle handles
+   */
+  void clear();
+
+  /**
+   * @brief The number of idle handles held by the pool
+   */
+  std::size_t idle() const;
+
+  stats get_stats() const;
+
+ private:
+  explicit handle_pool(std::size_t max_idle);
+  void put(uint64_t object_id, int flags, handle::ptr_t h, bool reset);
+
+  typedef std::pair<uint64_t, int> key_t;
+
+  std::size_t max_idle_;
+  mutable std::mutex lock_;
+  std::map<key_t, std::vector<handle::ptr_t>> idle_;
+  stats stats_;
+};
+
+}  // end of namespace types
+}  // end of namespace fpga
+}  // end of namespace opae
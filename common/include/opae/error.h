@@ -59,6 +59,32 @@ extern "C" {
  */
 fpga_result fpgaReadError(fpga_token token, uint32_t error_num, uint64_t *value);
 
+/**
+ * Read all error registers
+ *
+ * This function will read the values of all error registers of the resource
+ * referenced by `token` in a single pass. `values[i]` receives the value of
+ * error register `i`, as numbered by fpgaReadError() and fpgaGetErrorInfo().
+ *
+ * At most `max_values` values are stored. The total number of error
+ * registers of the resource is returned in `num_errors`, which may be larger
+ * than `max_values`. Passing NULL for `values` and 0 for `max_values`
+ * queries the number of error registers.
+ *
+ * Use this function instead of calling fpgaReadError() for each register
+ * when taking periodic snapshots of a resource's error state.
+ *
+ * @param[in]  token      Token to accelerator resource to query
+ * @param[out] values     Array of at least `max_values` 64 bit values
+ * @param[in]  max_values Number of elements in `values`
+ * @param[out] num_errors Number of error registers of the resource
+ * @returns FPGA_OK on success. FPGA_INVALID_PARAM if any of the supplied
+ * parameters is invalid. FPGA_EXCEPTION if an error register could not be
+ * read.
+ */
+fpga_result fpgaReadAllErrors(fpga_token token, uint64_t *values,
+			      uint32_t max_values, uint32_t *num_errors);
+
 /**
  * Clear error register
  *
@@ -118,6 +118,53 @@ fpga_result fpgaReadMMIO32(fpga_handle handle,
 			   uint32_t mmio_num,
 			   uint64_t offset, uint32_t *value);
 
+/**
+ * Write 512 bit value to MMIO space
+ *
+ * This function will write 64 bytes to MMIO space of the target object at a
+ * specified offset, as a single AVX-512 store when the CPU supports it and
+ * as eight 64-bit stores otherwise. The order in which the bytes reach the
+ * accelerator is not defined.
+ *
+ * If the target does not implement wide writes, the value is written with
+ * eight calls to fpgaWriteMMIO64(), lowest address first.
+ *
+ * @param[in]  handle   Handle to previously opened accelerator resource
+ * @param[in]  mmio_num Number of MMIO space to access
+ * @param[in]  offset   Byte offset into MMIO space. Must be 64-byte aligned.
+ * @param[in]  value    Pointer to the 64 bytes to write. Need not be aligned.
+ * @returns FPGA_OK on success. FPGA_INVALID_PARAM if any of the supplied
+ * parameters is invalid. FPGA_EXCEPTION if an internal exception occurred
+ * while trying to access the handle.
+ */
+fpga_result fpgaWriteMMIO512(fpga_handle handle,
+			     uint32_t mmio_num, uint64_t offset,
+			     const void *value);
+
+/**
+ * Write a block of memory to MMIO space
+ *
+ * This function will copy `len` bytes from `src` to MMIO space of the target
+ * object, starting at a specified offset. The copy uses 512-bit stores for
+ * the 64-byte aligned parts of the block, when the CPU supports them, and
+ * 64-bit stores for the rest. The order in which the bytes reach the
+ * accelerator is not defined. A register that must be written last (such as
+ * the control word of a DMA descriptor) should be written with a separate
+ * call, such as fpgaWriteMMIO64(), once the rest of the block is written.
+ *
+ * @param[in]  handle   Handle to previously opened accelerator resource
+ * @param[in]  mmio_num Number of MMIO space to access
+ * @param[in]  offset   Byte offset into MMIO space. Must be 8-byte aligned.
+ * @param[in]  src      Pointer to the data to write. Need not be aligned.
+ * @param[in]  len      Number of bytes to write. Must be a multiple of 8.
+ * @returns FPGA_OK on success. FPGA_INVALID_PARAM if any of the supplied
+ * parameters is invalid. FPGA_EXCEPTION if an internal exception occurred
+ * while trying to access the handle.
+ */
+fpga_result fpgaWriteMMIOBlock(fpga_handle handle,
+			       uint32_t mmio_num, uint64_t offset,
+			       const void *src, size_t len);
+
 /**
  * Map MMIO space
  *
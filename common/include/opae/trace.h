@@ -0,0 +1,121 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file trace.h
+ * @brief Functions for querying API call statistics
+ *
+ * When tracing is enabled, either by setting the LIBOPAE_TRACE environment
+ * variable to a non-zero value or by calling fpgaTraceEnable(), libopae
+ * counts every fpga* call that is dispatched to a plugin and records its
+ * latency in a log-linear histogram. Statistics are kept per plugin and per
+ * open handle. They are written out when the library is finalized, to
+ * stderr or to the file named by LIBOPAE_TRACE_FILE.
+ *
+ * When tracing is disabled, the cost per call is a single predictable
+ * branch.
+ */
+
+#ifndef __FPGA_TRACE_H__
+#define __FPGA_TRACE_H__
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <opae/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Summary of the calls made to a single API function
+ *
+ * Percentiles are reported as the upper bound of the histogram bucket
+ * containing them, which is within 12.5% of the exact value.
+ */
+typedef struct _fpga_trace_stats {
+	uint64_t count;    ///< number of calls
+	uint64_t errors;   ///< number of calls that did not return FPGA_OK
+	uint64_t total_ns; ///< sum of the call latencies
+	uint64_t min_ns;   ///< fastest call
+	uint64_t max_ns;   ///< slowest call
+	uint64_t p50_ns;   ///< median latency
+	uint64_t p90_ns;   ///< 90th percentile latency
+	uint64_t p99_ns;   ///< 99th percentile latency
+	uint64_t p999_ns;  ///< 99.9th percentile latency
+} fpga_trace_stats;
+
+/**
+ * Turn API call tracing on or off
+ *
+ * Statistics gathered so far are kept when tracing is turned off.
+ *
+ * @param[in] enable true to start recording, false to stop
+ * @returns FPGA_OK
+ */
+fpga_result fpgaTraceEnable(bool enable);
+
+/**
+ * Retrieve the statistics for one API function
+ *
+ * @param[in] handle Handle whose calls are of interest, or NULL to
+ * combine the calls made through all plugins
+ * @param[in] api_name Name of the API function, eg "fpgaReadMMIO64"
+ * @param[out] stats Receives the statistics. All fields are zero when
+ * no calls have been recorded.
+ *
+ * @returns FPGA_OK on success. FPGA_INVALID_PARAM if handle is not a
+ * valid handle or api_name or stats is NULL. FPGA_NOT_FOUND if api_name
+ * is not a traced function.
+ */
+fpga_result fpgaGetTraceStats(fpga_handle handle, const char *api_name,
+			      fpga_trace_stats *stats);
+
+/**
+ * Discard the statistics recorded so far
+ *
+ * @param[in] handle Handle whose statistics are to be cleared, or NULL
+ * to clear the statistics of all plugins
+ *
+ * @returns FPGA_OK on success. FPGA_INVALID_PARAM if handle is not a
+ * valid handle.
+ */
+fpga_result fpgaResetTraceStats(fpga_handle handle);
+
+/**
+ * Write a table of the statistics of each plugin
+ *
+ * @param[in] fp Stream to write to
+ *
+ * @returns FPGA_OK on success. FPGA_INVALID_PARAM if fp is NULL.
+ */
+fpga_result fpgaDumpTraceStats(FILE *fp);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+#endif // __FPGA_TRACE_H__
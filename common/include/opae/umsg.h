@@ -107,6 +107,87 @@ fpga_result fpgaTriggerUmsg(fpga_handle handle, uint64_t value);
  */
 fpga_result fpgaGetUmsgPtr(fpga_handle handle, uint64_t **umsg_ptr);
 
+/**
+ * Issue a store fence after each doorbell write
+ *
+ * Flag for fpgaGetUmsgDoorbell(). When set, fpgaRingUmsgDoorbell() follows
+ * the UMsg store with a store fence so that the write is pushed out of the
+ * write-combining buffers before the call returns.
+ */
+#define FPGA_UMSG_DOORBELL_FENCE (1u << 0)
+
+/**
+ * Pre-validated UMsg doorbell
+ *
+ * Filled in by fpgaGetUmsgDoorbell(). The doorbell caches the UMsg slot
+ * addresses of an open handle so that fpgaRingUmsgDoorbell() reduces to a
+ * single store, without any handle validation or locking. A doorbell stays
+ * valid until the handle it was obtained from is closed.
+ *
+ * When the doorbell spans more than one slot, concurrent producers are
+ * spread over the slots in round-robin order.
+ */
+typedef struct fpga_umsg_doorbell {
+	volatile uint64_t *base; /**< Address of the first UMsg slot */
+	uint64_t stride;         /**< Distance between slots, in uint64_t's */
+	uint32_t num_slots;      /**< Number of slots covered by the doorbell */
+	uint32_t flags;          /**< FPGA_UMSG_DOORBELL_* flags */
+	uint32_t next;           /**< Round-robin cursor (multi-slot only) */
+} fpga_umsg_doorbell;
+
+/**
+ * Get a UMsg doorbell
+ *
+ * Validates the handle and sets up the UMsg buffer once, returning a
+ * doorbell that can be rung from the hot path with fpgaRingUmsgDoorbell().
+ *
+ * @param[in]  handle     Handle to previously opened accelerator resource
+ * @param[in]  first_slot Index of the first UMsg slot to use
+ * @param[in]  num_slots  Number of consecutive UMsg slots to use
+ * @param[in]  flags      Bitwise OR of FPGA_UMSG_DOORBELL_* flags
+ * @param[out] doorbell   Doorbell to initialize
+ * @returns               FPGA_OK on success.
+ *                        FPGA_INVALID_PARAM if the slot range is empty or
+ *                        exceeds the number of UMsgs supported by the AFU.
+ *                        FPGA_NOT_SUPPORTED if UMsgs are not supported.
+ *                        FPGA_NO_MEMORY if the UMsg buffer can't be allocated.
+ */
+fpga_result fpgaGetUmsgDoorbell(fpga_handle handle, uint32_t first_slot,
+				uint32_t num_slots, int flags,
+				fpga_umsg_doorbell *doorbell);
+
+/**
+ * Ring a UMsg doorbell
+ *
+ * Writes a 64-bit value to the doorbell's UMsg slot. This performs no
+ * validation; doorbell must have been initialized by fpgaGetUmsgDoorbell()
+ * on a handle that is still open. Safe to call from multiple threads.
+ *
+ * @param[in]  doorbell   Doorbell returned by fpgaGetUmsgDoorbell()
+ * @param[in]  value      Value to use for UMsg
+ */
+static inline void fpgaRingUmsgDoorbell(fpga_umsg_doorbell *doorbell,
+					uint64_t value)
+{
+	volatile uint64_t *slot = doorbell->base;
+
+	if (doorbell->num_slots > 1) {
+		uint32_t n = __atomic_fetch_add(&doorbell->next, 1,
+						__ATOMIC_RELAXED);
+		slot += (uint64_t)(n % doorbell->num_slots) * doorbell->stride;
+	}
+
+	*slot = value;
+
+	if (doorbell->flags & FPGA_UMSG_DOORBELL_FENCE) {
+#if defined(__x86_64__) || defined(__i386__)
+		__asm__ __volatile__("sfence" : : : "memory");
+#else
+		__atomic_thread_fence(__ATOMIC_SEQ_CST);
+#endif
+	}
+}
+
 #ifdef __cplusplus
 } // extern "C"
 #endif // __cplusplus
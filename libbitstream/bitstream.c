@@ -29,6 +29,9 @@
 #endif // HAVE_CONFIG_H
 
 #include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -339,3 +342,254 @@ void opae_unload_bitstream(opae_bitstream_info *info)
 		memset_s(info, sizeof(*info), 0);
 	}
 }
+
+/*
+ * Bitstream cache
+ */
+typedef struct _opae_bitstream_cache_entry {
+	opae_bitstream_info info;
+	uint64_t content_hash;
+	struct _opae_bitstream_cache_entry *next;
+} opae_bitstream_cache_entry;
+
+/* A GBS file that has been loaded, and the image it held at the time. */
+typedef struct _opae_bitstream_cache_file {
+	dev_t dev;
+	ino_t ino;
+	off_t size;
+	struct timespec mtime;
+	opae_bitstream_cache_entry *entry;
+	struct _opae_bitstream_cache_file *next;
+} opae_bitstream_cache_file;
+
+struct _opae_bitstream_cache {
+	pthread_mutex_t lock;
+	opae_bitstream_cache_entry *entries;
+	opae_bitstream_cache_file *files;
+};
+
+// 64-bit FNV-1a
+STATIC uint64_t hash_bitstream(const uint8_t *data, size_t len)
+{
+	uint64_t h = 0xcbf29ce484222325ULL;
+	size_t i;
+
+	for (i = 0 ; i < len ; ++i) {
+		h ^= data[i];
+		h *= 0x100000001b3ULL;
+	}
+
+	return h;
+}
+
+STATIC bool file_unchanged(const opae_bitstream_cache_file *f,
+			   const struct stat *st)
+{
+	return f->size == st->st_size &&
+	       f->mtime.tv_sec == st->st_mtim.tv_sec &&
+	       f->mtime.tv_nsec == st->st_mtim.tv_nsec;
+}
+
+STATIC fpga_result validate_cached_bitstream(opae_bitstream_info *info)
+{
+	fpga_result res;
+
+	if (info->data_len >= METADATA_GUID_LEN + sizeof(uint32_t) &&
+	    check_bitstream_guid(info->data) == FPGA_OK) {
+		res = get_bitstream_ifc_id(info->data,
+					   info->data_len,
+					   &(info->interface_id));
+		if (res != FPGA_OK)
+			OPAE_ERR("Invalid metadata in the "
+				 "bitstream \"%s\"", info->filename);
+		return res;
+	}
+
+	return parse_metadata(info) ? FPGA_EXCEPTION : FPGA_OK;
+}
+
+fpga_result opae_bitstream_cache_create(opae_bitstream_cache **cache)
+{
+	opae_bitstream_cache *c;
+
+	if (!cache)
+		return FPGA_INVALID_PARAM;
+
+	c = (opae_bitstream_cache *)calloc(1, sizeof(opae_bitstream_cache));
+	if (!c) {
+		OPAE_ERR("calloc failed.");
+		return FPGA_NO_MEMORY;
+	}
+
+	if (pthread_mutex_init(&c->lock, NULL)) {
+		OPAE_ERR("pthread_mutex_init failed.");
+		free(c);
+		return FPGA_EXCEPTION;
+	}
+
+	*cache = c;
+	return FPGA_OK;
+}
+
+fpga_result opae_bitstream_cache_load(opae_bitstream_cache *cache,
+				      const char *file,
+				      const opae_bitstream_info **info)
+{
+	opae_bitstream_cache_entry *e;
+	opae_bitstream_cache_entry *entry = NULL;
+	opae_bitstream_cache_file *f;
+	bool new_file = false;
+	fpga_result res = FPGA_EXCEPTION;
+	struct stat st;
+	uint8_t *data;
+	uint64_t hash;
+	int fd;
+
+	if (!cache || !file || !info)
+		return FPGA_INVALID_PARAM;
+
+	fd = open(file, O_RDONLY);
+	if (fd < 0) {
+		OPAE_ERR("open failed for \"%s\"", file);
+		return FPGA_EXCEPTION;
+	}
+
+	if (fstat(fd, &st) != 0) {
+		OPAE_ERR("stat failed for \"%s\"", file);
+		goto out_close;
+	}
+
+	if (S_ISREG(st.st_mode) == 0 || st.st_size == 0) {
+		OPAE_ERR("Invalid input GBS file \"%s\"", file);
+		goto out_close;
+	}
+
+	pthread_mutex_lock(&cache->lock);
+
+	for (f = cache->files ; f ; f = f->next) {
+		if (f->dev == st.st_dev && f->ino == st.st_ino)
+			break;
+	}
+
+	if (f && file_unchanged(f, &st)) {
+		*info = &f->entry->info;
+		res = FPGA_OK;
+		goto out_unlock;
+	}
+
+	/*
+	 * Prefault the mapping so that programming the image doesn't
+	 * take page faults inside the PR ioctl.
+	 */
+	data = (uint8_t *)mmap(NULL, st.st_size, PROT_READ,
+			       MAP_PRIVATE | MAP_POPULATE, fd, 0);
+	if (data == MAP_FAILED) {
+		OPAE_ERR("mmap failed for \"%s\"", file);
+		goto out_unlock;
+	}
+
+	hash = hash_bitstream(data, st.st_size);
+
+	if (!f) {
+		f = (opae_bitstream_cache_file *)
+			calloc(1, sizeof(opae_bitstream_cache_file));
+		if (!f) {
+			OPAE_ERR("calloc failed.");
+			res = FPGA_NO_MEMORY;
+			goto out_unmap;
+		}
+		f->dev = st.st_dev;
+		f->ino = st.st_ino;
+		new_file = true;
+	}
+
+	for (e = cache->entries ; e ; e = e->next) {
+		if (e->content_hash == hash &&
+		    e->info.data_len == (size_t)st.st_size &&
+		    !memcmp(e->info.data, data, st.st_size)) {
+			// Same image under a new name or timestamp.
+			munmap(data, st.st_size);
+			entry = e;
+			goto out_file;
+		}
+	}
+
+	entry = (opae_bitstream_cache_entry *)
+		calloc(1, sizeof(opae_bitstream_cache_entry));
+	if (!entry) {
+		OPAE_ERR("calloc failed.");
+		res = FPGA_NO_MEMORY;
+		goto out_free_file;
+	}
+
+	entry->info.filename = strdup(file);
+	if (!entry->info.filename) {
+		OPAE_ERR("strdup failed.");
+		res = FPGA_NO_MEMORY;
+		goto out_free;
+	}
+
+	entry->info.data = data;
+	entry->info.data_len = st.st_size;
+
+	res = validate_cached_bitstream(&entry->info);
+	if (res != FPGA_OK)
+		goto out_free;
+
+	entry->content_hash = hash;
+	entry->next = cache->entries;
+	cache->entries = entry;
+
+out_file:
+	f->size = st.st_size;
+	f->mtime = st.st_mtim;
+	f->entry = entry;
+	if (new_file) {
+		f->next = cache->files;
+		cache->files = f;
+	}
+
+	*info = &entry->info;
+	res = FPGA_OK;
+	goto out_unlock;
+
+out_free:
+	free((void *)entry->info.filename);
+	free(entry);
+out_free_file:
+	if (new_file)
+		free(f);
+out_unmap:
+	munmap(data, st.st_size);
+out_unlock:
+	pthread_mutex_unlock(&cache->lock);
+out_close:
+	close(fd);
+	return res;
+}
+
+void opae_bitstream_cache_destroy(opae_bitstream_cache *cache)
+{
+	opae_bitstream_cache_entry *e;
+	opae_bitstream_cache_file *f;
+
+	if (!cache)
+		return;
+
+	while (cache->files) {
+		f = cache->files;
+		cache->files = f->next;
+		free(f);
+	}
+
+	while (cache->entries) {
+		e = cache->entries;
+		cache->entries = e->next;
+		munmap(e->info.data, e->info.data_len);
+		free((void *)e->info.filename);
+		free(e);
+	}
+
+	pthread_mutex_destroy(&cache->lock);
+	free(cache);
+}
@@ -46,6 +46,29 @@ fpga_result opae_load_bitstream(const char *file, opae_bitstream_info *info);
 
 void opae_unload_bitstream(opae_bitstream_info *info);
 
+/*
+ * Bitstream cache
+ *
+ * Maps GBS files read-only and validates each distinct file content once.
+ * Files are looked up by device and inode; a file whose size and
+ * modification time are unchanged since its last load is not rehashed.
+ * Files with identical content share one image, found through a hash of
+ * the content, and its info names the first file it was loaded from.
+ * The opae_bitstream_info returned by opae_bitstream_cache_load() refers
+ * to the mapped file and stays valid until the cache is destroyed, so GBS
+ * files should be updated by replacing them rather than by rewriting them
+ * in place.
+ */
+typedef struct _opae_bitstream_cache opae_bitstream_cache;
+
+fpga_result opae_bitstream_cache_create(opae_bitstream_cache **cache);
+
+fpga_result opae_bitstream_cache_load(opae_bitstream_cache *cache,
+				      const char *file,
+				      const opae_bitstream_info **info);
+
+void opae_bitstream_cache_destroy(opae_bitstream_cache *cache);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -29,6 +29,7 @@
 #include <stdbool.h>
 
 #include <opae/types.h>
+#include <opae/umsg.h>
 
 typedef struct _opae_plugin {
 	char *path;      // location on file system
@@ -68,6 +69,13 @@ typedef struct _opae_api_adapter_table {
 	fpga_result (*fpgaReadMMIO32)(fpga_handle handle, uint32_t mmio_num,
 				      uint64_t offset, uint32_t *value);
 
+	fpga_result (*fpgaWriteMMIO512)(fpga_handle handle, uint32_t mmio_num,
+					uint64_t offset, const void *value);
+
+	fpga_result (*fpgaWriteMMIOBlock)(fpga_handle handle,
+					  uint32_t mmio_num, uint64_t offset,
+					  const void *src, size_t len);
+
 	fpga_result (*fpgaMapMMIO)(fpga_handle handle, uint32_t mmio_num,
 				   uint64_t **mmio_ptr);
 
@@ -91,6 +99,11 @@ typedef struct _opae_api_adapter_table {
 
 	fpga_result (*fpgaGetUmsgPtr)(fpga_handle handle, uint64_t **umsg_ptr);
 
+	fpga_result (*fpgaGetUmsgDoorbell)(fpga_handle handle,
+					   uint32_t first_slot,
+					   uint32_t num_slots, int flags,
+					   fpga_umsg_doorbell *doorbell);
+
 	fpga_result (*fpgaPrepareBuffer)(fpga_handle handle, uint64_t len,
 					 void **buf_addr, uint64_t *wsid,
 					 int flags);
@@ -112,6 +125,10 @@ typedef struct _opae_api_adapter_table {
 	fpga_result (*fpgaReadError)(fpga_token token, uint32_t error_num,
 				     uint64_t *value);
 
+	fpga_result (*fpgaReadAllErrors)(fpga_token token, uint64_t *values,
+					 uint32_t max_values,
+					 uint32_t *num_errors);
+
 	fpga_result (*fpgaClearError)(fpga_token token, uint32_t error_num);
 
 	fpga_result (*fpgaClearAllErrors)(fpga_token token);
@@ -208,6 +225,9 @@ typedef struct _opae_api_adapter_table {
 	bool (*supports_device)(const char *device_type);
 	bool (*supports_host)(const char *hostname);
 
+	// call statistics, owned by libopae (see trace.h)
+	struct _opae_trace_set *trace;
+
 } opae_api_adapter_table;
 
 #endif /* __OPAE_ADAPTER_H__ */
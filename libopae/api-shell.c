@@ -33,6 +33,7 @@
 #endif // _GNU_SOURCE
 
 #include <opae/properties.h>
+#include <opae/umsg.h>
 
 #include "safe_string/safe_string.h"
 
@@ -41,6 +42,99 @@
 #include "props.h"
 
 
+opae_id_table opae_wrapped_token_ids = {
+	.tag = OPAE_WRAPPED_TOKEN_TAG,
+	.lock = PTHREAD_MUTEX_INITIALIZER
+};
+
+opae_id_table opae_wrapped_handle_ids = {
+	.tag = OPAE_WRAPPED_HANDLE_TAG,
+	.lock = PTHREAD_MUTEX_INITIALIZER
+};
+
+void *opae_id_alloc(opae_id_table *table, void *object)
+{
+	int err;
+	uint32_t index;
+	opae_id_slot *chunk;
+	opae_id_slot *slot;
+	uint32_t gen;
+	void *id = NULL;
+
+	if (opae_mutex_lock(err, &table->lock))
+		return NULL;
+
+	if (table->free_head) {
+		index = table->free_head - 1;
+		chunk = table->chunks[index >> OPAE_ID_CHUNK_SHIFT];
+		slot = &chunk[index & (OPAE_ID_CHUNK_SIZE - 1)];
+		table->free_head = slot->next_free;
+	} else {
+		index = table->num_slots;
+		if (index > OPAE_ID_INDEX_MASK) {
+			OPAE_ERR("no free IDs");
+			goto out_unlock;
+		}
+
+		chunk = table->chunks[index >> OPAE_ID_CHUNK_SHIFT];
+		if (!chunk) {
+			chunk = (opae_id_slot *)calloc(OPAE_ID_CHUNK_SIZE,
+						       sizeof(opae_id_slot));
+			if (!chunk) {
+				OPAE_ERR("calloc failed");
+				goto out_unlock;
+			}
+			__atomic_store_n(
+				&table->chunks[index >> OPAE_ID_CHUNK_SHIFT],
+				chunk, __ATOMIC_RELEASE);
+		}
+
+		slot = &chunk[index & (OPAE_ID_CHUNK_SIZE - 1)];
+		++table->num_slots;
+	}
+
+	slot->object = object;
+	slot->next_free = 0;
+	gen = (slot->generation + 1) & OPAE_ID_GEN_MASK;
+	__atomic_store_n(&slot->generation, gen, __ATOMIC_RELEASE);
+
+	id = (void *)(uintptr_t)((table->tag << OPAE_ID_TAG_SHIFT)
+				 | ((uint64_t)gen << OPAE_ID_INDEX_BITS)
+				 | index);
+
+out_unlock:
+	opae_mutex_unlock(err, &table->lock);
+	return id;
+}
+
+void opae_id_free(opae_id_table *table, void *id)
+{
+	int err;
+	uint32_t index = (uint32_t)((uintptr_t)id & OPAE_ID_INDEX_MASK);
+	opae_id_slot *slot;
+
+	if (opae_mutex_lock(err, &table->lock))
+		return;
+
+	if (!opae_id_lookup(table, id)) {
+		opae_mutex_unlock(err, &table->lock);
+		return;
+	}
+
+	slot = &table->chunks[index >> OPAE_ID_CHUNK_SHIFT]
+			     [index & (OPAE_ID_CHUNK_SIZE - 1)];
+
+	// An even generation marks the slot free and stales the ID.
+	__atomic_store_n(&slot->generation,
+			 (slot->generation + 1) & OPAE_ID_GEN_MASK,
+			 __ATOMIC_RELEASE);
+	slot->object = NULL;
+	slot->next_free = table->free_head;
+	table->free_head = index + 1;
+
+	opae_mutex_unlock(err, &table->lock);
+}
+
 opae_wrapped_token *
 opae_allocate_wrapped_token(fpga_token token,
 			    const opae_api_adapter_table *adapter)
@@ -49,9 +143,13 @@ opae_allocate_wrapped_token(fpga_token token,
 		(opae_wrapped_token *)malloc(sizeof(opae_wrapped_token));
 
 	if (wtok) {
-		wtok->magic = OPAE_WRAPPED_TOKEN_MAGIC;
 		wtok->opae_token = token;
 		wtok->adapter_table = (opae_api_adapter_table *)adapter;
+		wtok->id = opae_id_alloc(&opae_wrapped_token_ids, wtok);
+		if (!wtok->id) {
+			free(wtok);
+			wtok = NULL;
+		}
 	}
 
 	return wtok;
@@ -65,10 +163,15 @@ opae_allocate_wrapped_handle(opae_wrapped_token *wt, fpga_handle opae_handle,
 		(opae_wrapped_handle *)malloc(sizeof(opae_wrapped_handle));
 
 	if (whan) {
-		whan->magic = OPAE_WRAPPED_HANDLE_MAGIC;
 		whan->wrapped_token = wt;
 		whan->opae_handle = opae_handle;
 		whan->adapter_table = adapter;
+		whan->trace = NULL;
+		whan->id = opae_id_alloc(&opae_wrapped_handle_ids, whan);
+		if (!whan->id) {
+			free(whan);
+			whan = NULL;
+		}
 	}
 
 	return whan;
@@ -159,8 +262,9 @@ fpga_result fpgaOpen(fpga_token token, fpga_handle *handle, int flags)
 	ASSERT_NOT_NULL_RESULT(wrapped_token->adapter_table->fpgaClose,
 			       FPGA_NOT_SUPPORTED);
 
-	res = wrapped_token->adapter_table->fpgaOpen(wrapped_token->opae_token,
-						     &opae_handle, flags);
+	res = OPAE_TRACE_ADAPTER(fpgaOpen, wrapped_token->adapter_table,
+				 wrapped_token->opae_token, &opae_handle,
+				 flags);
 
 	ASSERT_RESULT(res);
 
@@ -173,7 +277,7 @@ fpga_result fpgaOpen(fpga_token token, fpga_handle *handle, int flags)
 		cres = wrapped_token->adapter_table->fpgaClose(opae_handle);
 	}
 
-	*handle = wrapped_handle;
+	*handle = wrapped_handle ? wrapped_handle->id : NULL;
 
 	return res != FPGA_OK ? res : cres;
 }
@@ -188,8 +292,8 @@ fpga_result fpgaClose(fpga_handle handle)
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaClose,
 			       FPGA_NOT_SUPPORTED);
 
-	res = wrapped_handle->adapter_table->fpgaClose(
-		wrapped_handle->opae_handle);
+	res = OPAE_TRACE_ADAPTER(fpgaClose, wrapped_handle->adapter_table,
+				 wrapped_handle->opae_handle);
 
 	opae_destroy_wrapped_handle(wrapped_handle);
 
@@ -205,8 +309,8 @@ fpga_result fpgaReset(fpga_handle handle)
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaReset,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaReset(
-		wrapped_handle->opae_handle);
+	return OPAE_TRACE_HANDLE(fpgaReset, wrapped_handle,
+				 wrapped_handle->opae_handle);
 }
 
 fpga_result fpgaGetPropertiesFromHandle(fpga_handle handle,
@@ -224,8 +328,8 @@ fpga_result fpgaGetPropertiesFromHandle(fpga_handle handle,
 		wrapped_handle->adapter_table->fpgaGetPropertiesFromHandle,
 		FPGA_NOT_SUPPORTED);
 
-	res = wrapped_handle->adapter_table->fpgaGetPropertiesFromHandle(
-		wrapped_handle->opae_handle, prop);
+	res = OPAE_TRACE_HANDLE(fpgaGetPropertiesFromHandle, wrapped_handle,
+				wrapped_handle->opae_handle, prop);
 
 	ASSERT_RESULT(res);
 
@@ -242,7 +346,7 @@ fpga_result fpgaGetPropertiesFromHandle(fpga_handle handle,
 				p->parent, wrapped_handle->adapter_table);
 
 		if (wrapped_parent) {
-			p->parent = wrapped_parent;
+			p->parent = wrapped_parent->id;
 			p->flags |= OPAE_PROPERTIES_FLAG_PARENT_ALLOC;
 		} else {
 			OPAE_ERR("malloc failed");
@@ -284,8 +388,9 @@ fpga_result fpgaGetProperties(fpga_token token, fpga_properties *prop)
 			wrapped_token->adapter_table->fpgaGetProperties,
 			FPGA_NOT_SUPPORTED);
 
-		res = wrapped_token->adapter_table->fpgaGetProperties(
-			wrapped_token->opae_token, prop);
+		res = OPAE_TRACE_ADAPTER(fpgaGetProperties,
+					 wrapped_token->adapter_table,
+					 wrapped_token->opae_token, prop);
 
 		ASSERT_RESULT(res);
 
@@ -303,7 +408,7 @@ fpga_result fpgaGetProperties(fpga_token token, fpga_properties *prop)
 					wrapped_token->adapter_table);
 
 			if (wrapped_parent) {
-				p->parent = wrapped_parent;
+				p->parent = wrapped_parent->id;
 				p->flags |= OPAE_PROPERTIES_FLAG_PARENT_ALLOC;
 			} else {
 				OPAE_ERR("malloc failed");
@@ -345,8 +450,9 @@ fpga_result fpgaUpdateProperties(fpga_token token, fpga_properties prop)
 			p->parent = wrapped_parent->opae_token;
 	}
 
-	res = wrapped_token->adapter_table->fpgaUpdateProperties(
-		wrapped_token->opae_token, prop);
+	res = OPAE_TRACE_ADAPTER(fpgaUpdateProperties,
+				 wrapped_token->adapter_table,
+				 wrapped_token->opae_token, prop);
 
 	if (res != FPGA_OK) {
 		opae_mutex_unlock(err, &p->lock);
@@ -363,7 +469,7 @@ fpga_result fpgaUpdateProperties(fpga_token token, fpga_properties prop)
 				p->parent, wrapped_token->adapter_table);
 
 			if (wrapped_parent) {
-				p->parent = wrapped_parent;
+				p->parent = wrapped_parent->id;
 				p->flags |= OPAE_PROPERTIES_FLAG_PARENT_ALLOC;
 			} else {
 				OPAE_ERR("malloc failed");
@@ -374,7 +480,7 @@ fpga_result fpgaUpdateProperties(fpga_token token, fpga_properties prop)
 			wrapped_parent->opae_token = p->parent;
 			wrapped_parent->adapter_table =
 				wrapped_token->adapter_table;
-			p->parent = wrapped_parent;
+			p->parent = wrapped_parent->id;
 			p->flags |= OPAE_PROPERTIES_FLAG_PARENT_ALLOC;
 		}
 	} else if (wrapped_parent)
@@ -395,8 +501,9 @@ fpga_result fpgaWriteMMIO64(fpga_handle handle, uint32_t mmio_num,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaWriteMMIO64,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaWriteMMIO64(
-		wrapped_handle->opae_handle, mmio_num, offset, value);
+	return OPAE_TRACE_HANDLE(fpgaWriteMMIO64, wrapped_handle,
+				 wrapped_handle->opae_handle, mmio_num, offset,
+				 value);
 }
 
 fpga_result fpgaReadMMIO64(fpga_handle handle, uint32_t mmio_num,
@@ -409,8 +516,9 @@ fpga_result fpgaReadMMIO64(fpga_handle handle, uint32_t mmio_num,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaReadMMIO64,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaReadMMIO64(
-		wrapped_handle->opae_handle, mmio_num, offset, value);
+	return OPAE_TRACE_HANDLE(fpgaReadMMIO64, wrapped_handle,
+				 wrapped_handle->opae_handle, mmio_num, offset,
+				 value);
 }
 
 fpga_result fpgaWriteMMIO32(fpga_handle handle, uint32_t mmio_num,
@@ -423,8 +531,9 @@ fpga_result fpgaWriteMMIO32(fpga_handle handle, uint32_t mmio_num,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaWriteMMIO32,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaWriteMMIO32(
-		wrapped_handle->opae_handle, mmio_num, offset, value);
+	return OPAE_TRACE_HANDLE(fpgaWriteMMIO32, wrapped_handle,
+				 wrapped_handle->opae_handle, mmio_num, offset,
+				 value);
 }
 
 fpga_result fpgaReadMMIO32(fpga_handle handle, uint32_t mmio_num,
@@ -437,8 +546,84 @@ fpga_result fpgaReadMMIO32(fpga_handle handle, uint32_t mmio_num,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaReadMMIO32,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaReadMMIO32(
-		wrapped_handle->opae_handle, mmio_num, offset, value);
+	return OPAE_TRACE_HANDLE(fpgaReadMMIO32, wrapped_handle,
+				 wrapped_handle->opae_handle, mmio_num, offset,
+				 value);
+}
+
+/*
+ * Fallback for plugins without wide MMIO writes: one fpgaWriteMMIO64()
+ * per quadword, in ascending address order.
+ */
+STATIC fpga_result opae_write_mmio64_block(opae_wrapped_handle *wrapped_handle,
+					   uint32_t mmio_num, uint64_t offset,
+					   const void *src, size_t len)
+{
+	const uint8_t *p = (const uint8_t *)src;
+	fpga_result res = FPGA_OK;
+	uint64_t value;
+	size_t i;
+
+	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaWriteMMIO64,
+			       FPGA_NOT_SUPPORTED);
+
+	for (i = 0; i < len && res == FPGA_OK; i += sizeof(uint64_t)) {
+		memcpy(&value, p + i, sizeof(value));
+		res = OPAE_TRACE_HANDLE(fpgaWriteMMIO64, wrapped_handle,
+					wrapped_handle->opae_handle, mmio_num,
+					offset + i, value);
+	}
+
+	return res;
+}
+
+fpga_result fpgaWriteMMIO512(fpga_handle handle, uint32_t mmio_num,
+			     uint64_t offset, const void *value)
+{
+	opae_wrapped_handle *wrapped_handle =
+		opae_validate_wrapped_handle(handle);
+
+	ASSERT_NOT_NULL(wrapped_handle);
+	ASSERT_NOT_NULL(value);
+
+	if (offset % 64) {
+		OPAE_MSG("Misaligned 512-bit MMIO access");
+		return FPGA_INVALID_PARAM;
+	}
+
+	if (!wrapped_handle->adapter_table->fpgaWriteMMIO512)
+		return opae_write_mmio64_block(wrapped_handle, mmio_num,
+					       offset, value, 64);
+
+	return OPAE_TRACE_HANDLE(fpgaWriteMMIO512, wrapped_handle,
+				 wrapped_handle->opae_handle, mmio_num, offset,
+				 value);
+}
+
+fpga_result fpgaWriteMMIOBlock(fpga_handle handle, uint32_t mmio_num,
+			       uint64_t offset, const void *src, size_t len)
+{
+	opae_wrapped_handle *wrapped_handle =
+		opae_validate_wrapped_handle(handle);
+
+	ASSERT_NOT_NULL(wrapped_handle);
+	ASSERT_NOT_NULL(src);
+
+	if ((offset % sizeof(uint64_t)) || (len % sizeof(uint64_t))) {
+		OPAE_MSG("Misaligned MMIO block");
+		return FPGA_INVALID_PARAM;
+	}
+
+	if (!len)
+		return FPGA_OK;
+
+	if (!wrapped_handle->adapter_table->fpgaWriteMMIOBlock)
+		return opae_write_mmio64_block(wrapped_handle, mmio_num,
+					       offset, src, len);
+
+	return OPAE_TRACE_HANDLE(fpgaWriteMMIOBlock, wrapped_handle,
+				 wrapped_handle->opae_handle, mmio_num, offset,
+				 src, len);
 }
 
 fpga_result fpgaMapMMIO(fpga_handle handle, uint32_t mmio_num,
@@ -451,8 +636,9 @@ fpga_result fpgaMapMMIO(fpga_handle handle, uint32_t mmio_num,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaMapMMIO,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaMapMMIO(
-		wrapped_handle->opae_handle, mmio_num, mmio_ptr);
+	return OPAE_TRACE_HANDLE(fpgaMapMMIO, wrapped_handle,
+				 wrapped_handle->opae_handle, mmio_num,
+				 mmio_ptr);
 }
 
 fpga_result fpgaUnmapMMIO(fpga_handle handle, uint32_t mmio_num)
@@ -464,8 +650,8 @@ fpga_result fpgaUnmapMMIO(fpga_handle handle, uint32_t mmio_num)
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaUnmapMMIO,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaUnmapMMIO(
-		wrapped_handle->opae_handle, mmio_num);
+	return OPAE_TRACE_HANDLE(fpgaUnmapMMIO, wrapped_handle,
+				 wrapped_handle->opae_handle, mmio_num);
 }
 
 typedef struct _opae_enumeration_context {
@@ -509,9 +695,11 @@ static int opae_enumerate(const opae_api_adapter_table *adapter, void *context)
 		return OPAE_ENUM_CONTINUE;
 	}
 
-	res = adapter->fpgaEnumerate(ctx->filters, ctx->num_filters,
-				     ctx->adapter_tokens, space_remaining,
-				     &num_matches);
+	res = OPAE_TRACE_ADAPTER(fpgaEnumerate,
+				 (opae_api_adapter_table *)adapter,
+				 ctx->filters, ctx->num_filters,
+				 ctx->adapter_tokens, space_remaining,
+				 &num_matches);
 
 	if (res != FPGA_OK) {
 		OPAE_ERR("fpgaEnumerate() failed for \"%s\"",
@@ -538,7 +726,7 @@ static int opae_enumerate(const opae_api_adapter_table *adapter, void *context)
 			return OPAE_ENUM_STOP;
 		}
 
-		ctx->wrapped_tokens[ctx->num_wrapped_tokens++] = wt;
+		ctx->wrapped_tokens[ctx->num_wrapped_tokens++] = wt->id;
 	}
 
 	return ctx->num_wrapped_tokens == ctx->max_wrapped_tokens
@@ -674,7 +862,7 @@ out_free_tokens:
 		ptf_list = ptf_list->next;
 
 		if (p) {
-			p->parent = trash->wrapped_token;
+			p->parent = trash->wrapped_token->id;
 			opae_mutex_unlock(err, &p->lock);
 		}
 
@@ -701,8 +889,9 @@ fpga_result fpgaCloneToken(fpga_token src, fpga_token *dst)
 		wrapped_src_token->adapter_table->fpgaDestroyToken,
 		FPGA_NOT_SUPPORTED);
 
-	res = wrapped_src_token->adapter_table->fpgaCloneToken(
-		wrapped_src_token->opae_token, &cloned_token);
+	res = OPAE_TRACE_ADAPTER(fpgaCloneToken,
+				 wrapped_src_token->adapter_table,
+				 wrapped_src_token->opae_token, &cloned_token);
 
 	ASSERT_RESULT(res);
 
@@ -716,7 +905,7 @@ fpga_result fpgaCloneToken(fpga_token src, fpga_token *dst)
 			&cloned_token);
 	}
 
-	*dst = wrapped_dst_token;
+	*dst = wrapped_dst_token ? wrapped_dst_token->id : NULL;
 
 	return res != FPGA_OK ? res : dres;
 }
@@ -734,8 +923,8 @@ fpga_result fpgaDestroyToken(fpga_token *token)
 	ASSERT_NOT_NULL_RESULT(wrapped_token->adapter_table->fpgaDestroyToken,
 			       FPGA_NOT_SUPPORTED);
 
-	res = wrapped_token->adapter_table->fpgaDestroyToken(
-		&wrapped_token->opae_token);
+	res = OPAE_TRACE_ADAPTER(fpgaDestroyToken, wrapped_token->adapter_table,
+				 &wrapped_token->opae_token);
 
 	opae_destroy_wrapped_token(wrapped_token);
 
@@ -752,8 +941,8 @@ fpga_result fpgaGetNumUmsg(fpga_handle handle, uint64_t *value)
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaGetNumUmsg,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaGetNumUmsg(
-		wrapped_handle->opae_handle, value);
+	return OPAE_TRACE_HANDLE(fpgaGetNumUmsg, wrapped_handle,
+				 wrapped_handle->opae_handle, value);
 }
 
 fpga_result fpgaSetUmsgAttributes(fpga_handle handle, uint64_t value)
@@ -766,8 +955,8 @@ fpga_result fpgaSetUmsgAttributes(fpga_handle handle, uint64_t value)
 		wrapped_handle->adapter_table->fpgaSetUmsgAttributes,
 		FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaSetUmsgAttributes(
-		wrapped_handle->opae_handle, value);
+	return OPAE_TRACE_HANDLE(fpgaSetUmsgAttributes, wrapped_handle,
+				 wrapped_handle->opae_handle, value);
 }
 
 fpga_result fpgaTriggerUmsg(fpga_handle handle, uint64_t value)
@@ -779,8 +968,8 @@ fpga_result fpgaTriggerUmsg(fpga_handle handle, uint64_t value)
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaTriggerUmsg,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaTriggerUmsg(
-		wrapped_handle->opae_handle, value);
+	return OPAE_TRACE_HANDLE(fpgaTriggerUmsg, wrapped_handle,
+				 wrapped_handle->opae_handle, value);
 }
 
 fpga_result fpgaGetUmsgPtr(fpga_handle handle, uint64_t **umsg_ptr)
@@ -793,8 +982,26 @@ fpga_result fpgaGetUmsgPtr(fpga_handle handle, uint64_t **umsg_ptr)
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaGetUmsgPtr,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaGetUmsgPtr(
-		wrapped_handle->opae_handle, umsg_ptr);
+	return OPAE_TRACE_HANDLE(fpgaGetUmsgPtr, wrapped_handle,
+				 wrapped_handle->opae_handle, umsg_ptr);
+}
+
+fpga_result fpgaGetUmsgDoorbell(fpga_handle handle, uint32_t first_slot,
+				uint32_t num_slots, int flags,
+				fpga_umsg_doorbell *doorbell)
+{
+	opae_wrapped_handle *wrapped_handle =
+		opae_validate_wrapped_handle(handle);
+
+	ASSERT_NOT_NULL(wrapped_handle);
+	ASSERT_NOT_NULL(doorbell);
+	ASSERT_NOT_NULL_RESULT(
+		wrapped_handle->adapter_table->fpgaGetUmsgDoorbell,
+		FPGA_NOT_SUPPORTED);
+
+	return OPAE_TRACE_HANDLE(fpgaGetUmsgDoorbell, wrapped_handle,
+				 wrapped_handle->opae_handle, first_slot,
+				 num_slots, flags, doorbell);
 }
 
 fpga_result fpgaPrepareBuffer(fpga_handle handle, uint64_t len, void **buf_addr,
@@ -816,8 +1023,9 @@ fpga_result fpgaPrepareBuffer(fpga_handle handle, uint64_t len, void **buf_addr,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaPrepareBuffer,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaPrepareBuffer(
-		wrapped_handle->opae_handle, len, buf_addr, wsid, flags);
+	return OPAE_TRACE_HANDLE(fpgaPrepareBuffer, wrapped_handle,
+				 wrapped_handle->opae_handle, len, buf_addr,
+				 wsid, flags);
 }
 
 fpga_result fpgaReleaseBuffer(fpga_handle handle, uint64_t wsid)
@@ -829,8 +1037,8 @@ fpga_result fpgaReleaseBuffer(fpga_handle handle, uint64_t wsid)
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaReleaseBuffer,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaReleaseBuffer(
-		wrapped_handle->opae_handle, wsid);
+	return OPAE_TRACE_HANDLE(fpgaReleaseBuffer, wrapped_handle,
+				 wrapped_handle->opae_handle, wsid);
 }
 
 fpga_result fpgaGetIOAddress(fpga_handle handle, uint64_t wsid,
@@ -844,8 +1052,8 @@ fpga_result fpgaGetIOAddress(fpga_handle handle, uint64_t wsid,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaGetIOAddress,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaGetIOAddress(
-		wrapped_handle->opae_handle, wsid, ioaddr);
+	return OPAE_TRACE_HANDLE(fpgaGetIOAddress, wrapped_handle,
+				 wrapped_handle->opae_handle, wsid, ioaddr);
 }
 
 fpga_result fpgaGetOPAECVersion(fpga_version *version)
@@ -902,8 +1110,29 @@ fpga_result fpgaReadError(fpga_token token, uint32_t error_num, uint64_t *value)
 	ASSERT_NOT_NULL_RESULT(wrapped_token->adapter_table->fpgaReadError,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_token->adapter_table->fpgaReadError(
-		wrapped_token->opae_token, error_num, value);
+	return OPAE_TRACE_ADAPTER(fpgaReadError, wrapped_token->adapter_table,
+				  wrapped_token->opae_token, error_num, value);
+}
+
+fpga_result fpgaReadAllErrors(fpga_token token, uint64_t *values,
+			      uint32_t max_values, uint32_t *num_errors)
+{
+	opae_wrapped_token *wrapped_token = opae_validate_wrapped_token(token);
+
+	ASSERT_NOT_NULL(wrapped_token);
+	ASSERT_NOT_NULL(num_errors);
+	ASSERT_NOT_NULL_RESULT(wrapped_token->adapter_table->fpgaReadAllErrors,
+			       FPGA_NOT_SUPPORTED);
+
+	if (!values && max_values > 0) {
+		OPAE_MSG("NULL values with max_values > 0");
+		return FPGA_INVALID_PARAM;
+	}
+
+	return OPAE_TRACE_ADAPTER(fpgaReadAllErrors,
+				  wrapped_token->adapter_table,
+				  wrapped_token->opae_token, values, max_values,
+				  num_errors);
 }
 
 fpga_result fpgaClearError(fpga_token token, uint32_t error_num)
@@ -914,8 +1143,8 @@ fpga_result fpgaClearError(fpga_token token, uint32_t error_num)
 	ASSERT_NOT_NULL_RESULT(wrapped_token->adapter_table->fpgaClearError,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_token->adapter_table->fpgaClearError(
-		wrapped_token->opae_token, error_num);
+	return OPAE_TRACE_ADAPTER(fpgaClearError, wrapped_token->adapter_table,
+				  wrapped_token->opae_token, error_num);
 }
 
 fpga_result fpgaClearAllErrors(fpga_token token)
@@ -926,8 +1155,9 @@ fpga_result fpgaClearAllErrors(fpga_token token)
 	ASSERT_NOT_NULL_RESULT(wrapped_token->adapter_table->fpgaClearAllErrors,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_token->adapter_table->fpgaClearAllErrors(
-		wrapped_token->opae_token);
+	return OPAE_TRACE_ADAPTER(fpgaClearAllErrors,
+				  wrapped_token->adapter_table,
+				  wrapped_token->opae_token);
 }
 
 fpga_result fpgaGetErrorInfo(fpga_token token, uint32_t error_num,
@@ -940,8 +1170,10 @@ fpga_result fpgaGetErrorInfo(fpga_token token, uint32_t error_num,
 	ASSERT_NOT_NULL_RESULT(wrapped_token->adapter_table->fpgaGetErrorInfo,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_token->adapter_table->fpgaGetErrorInfo(
-		wrapped_token->opae_token, error_num, error_info);
+	return OPAE_TRACE_ADAPTER(fpgaGetErrorInfo,
+				  wrapped_token->adapter_table,
+				  wrapped_token->opae_token, error_num,
+				  error_info);
 }
 
 const char *fpgaErrStr(fpga_result e)
@@ -1020,9 +1252,10 @@ fpga_result fpgaDestroyEventHandle(fpga_event_handle *event_handle)
 			return FPGA_INVALID_PARAM;
 		}
 
-		res = wrapped_event_handle->adapter_table
-			      ->fpgaDestroyEventHandle(
-				      &wrapped_event_handle->opae_event_handle);
+		res = OPAE_TRACE_ADAPTER(
+			fpgaDestroyEventHandle,
+			wrapped_event_handle->adapter_table,
+			&wrapped_event_handle->opae_event_handle);
 	}
 
 	opae_mutex_unlock(ires, &wrapped_event_handle->lock);
@@ -1065,9 +1298,9 @@ fpga_result fpgaGetOSObjectFromEventHandle(const fpga_event_handle eh, int *fd)
 		return FPGA_NOT_SUPPORTED;
 	}
 
-	res = wrapped_event_handle->adapter_table
-		      ->fpgaGetOSObjectFromEventHandle(
-			      wrapped_event_handle->opae_event_handle, fd);
+	res = OPAE_TRACE_ADAPTER(fpgaGetOSObjectFromEventHandle,
+				 wrapped_event_handle->adapter_table,
+				 wrapped_event_handle->opae_event_handle, fd);
 
 	opae_mutex_unlock(ires, &wrapped_event_handle->lock);
 
@@ -1100,8 +1333,8 @@ fpga_result fpgaRegisterEvent(fpga_handle handle, fpga_event_type event_type,
 			return FPGA_NOT_SUPPORTED;
 		}
 
-		res = wrapped_handle->adapter_table->fpgaCreateEventHandle(
-			&wrapped_event_handle->opae_event_handle);
+		res = OPAE_TRACE_HANDLE(fpgaCreateEventHandle, wrapped_handle,
+					&wrapped_event_handle->opae_event_handle);
 
 		if (res != FPGA_OK) {
 			opae_mutex_unlock(ires, &wrapped_event_handle->lock);
@@ -1127,15 +1360,16 @@ fpga_result fpgaRegisterEvent(fpga_handle handle, fpga_event_type event_type,
 		return FPGA_INVALID_PARAM;
 	}
 
-	if (!wrapped_event_handle->adapter_table->fpgaRegisterEvent) {
+	if (!wrapped_handle->adapter_table->fpgaRegisterEvent) {
 		OPAE_ERR("NULL fpgaRegisterEvent() in adapter.");
 		opae_mutex_unlock(ires, &wrapped_event_handle->lock);
 		return FPGA_NOT_SUPPORTED;
 	}
 
-	res = wrapped_event_handle->adapter_table->fpgaRegisterEvent(
-		wrapped_handle->opae_handle, event_type,
-		wrapped_event_handle->opae_event_handle, flags);
+	res = OPAE_TRACE_HANDLE(fpgaRegisterEvent, wrapped_handle,
+				wrapped_handle->opae_handle, event_type,
+				wrapped_event_handle->opae_event_handle,
+				flags);
 
 	opae_mutex_unlock(ires, &wrapped_event_handle->lock);
 
@@ -1171,15 +1405,15 @@ fpga_result fpgaUnregisterEvent(fpga_handle handle, fpga_event_type event_type,
 		return FPGA_INVALID_PARAM;
 	}
 
-	if (!wrapped_event_handle->adapter_table->fpgaUnregisterEvent) {
+	if (!wrapped_handle->adapter_table->fpgaUnregisterEvent) {
 		OPAE_ERR("NULL fpgaUnregisterEvent() in adapter.");
 		opae_mutex_unlock(ires, &wrapped_event_handle->lock);
 		return FPGA_NOT_SUPPORTED;
 	}
 
-	res = wrapped_event_handle->adapter_table->fpgaUnregisterEvent(
-		wrapped_handle->opae_handle, event_type,
-		wrapped_event_handle->opae_event_handle);
+	res = OPAE_TRACE_HANDLE(fpgaUnregisterEvent, wrapped_handle,
+				wrapped_handle->opae_handle, event_type,
+				wrapped_event_handle->opae_event_handle);
 
 	opae_mutex_unlock(ires, &wrapped_event_handle->lock);
 
@@ -1197,8 +1431,9 @@ fpga_result fpgaAssignPortToInterface(fpga_handle fpga, uint32_t interface_num,
 		wrapped_handle->adapter_table->fpgaAssignPortToInterface,
 		FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaAssignPortToInterface(
-		wrapped_handle->opae_handle, interface_num, slot_num, flags);
+	return OPAE_TRACE_HANDLE(fpgaAssignPortToInterface, wrapped_handle,
+				 wrapped_handle->opae_handle, interface_num,
+				 slot_num, flags);
 }
 
 fpga_result fpgaAssignToInterface(fpga_handle fpga, fpga_token accelerator,
@@ -1215,9 +1450,10 @@ fpga_result fpgaAssignToInterface(fpga_handle fpga, fpga_token accelerator,
 		wrapped_handle->adapter_table->fpgaAssignToInterface,
 		FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaAssignToInterface(
-		wrapped_handle->opae_handle, wrapped_token->opae_token,
-		host_interface, flags);
+	return OPAE_TRACE_HANDLE(fpgaAssignToInterface, wrapped_handle,
+				 wrapped_handle->opae_handle,
+				 wrapped_token->opae_token, host_interface,
+				 flags);
 }
 
 fpga_result fpgaReleaseFromInterface(fpga_handle fpga, fpga_token accelerator)
@@ -1233,8 +1469,9 @@ fpga_result fpgaReleaseFromInterface(fpga_handle fpga, fpga_token accelerator)
 		wrapped_handle->adapter_table->fpgaReleaseFromInterface,
 		FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaReleaseFromInterface(
-		wrapped_handle->opae_handle, wrapped_token->opae_token);
+	return OPAE_TRACE_HANDLE(fpgaReleaseFromInterface, wrapped_handle,
+				 wrapped_handle->opae_handle,
+				 wrapped_token->opae_token);
 }
 
 fpga_result fpgaReconfigureSlot(fpga_handle fpga, uint32_t slot,
@@ -1250,9 +1487,9 @@ fpga_result fpgaReconfigureSlot(fpga_handle fpga, uint32_t slot,
 		wrapped_handle->adapter_table->fpgaReconfigureSlot,
 		FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaReconfigureSlot(
-		wrapped_handle->opae_handle, slot, bitstream, bitstream_len,
-		flags);
+	return OPAE_TRACE_HANDLE(fpgaReconfigureSlot, wrapped_handle,
+				 wrapped_handle->opae_handle, slot, bitstream,
+				 bitstream_len, flags);
 }
 
 fpga_result fpgaTokenGetObject(fpga_token token, const char *name,
@@ -1272,8 +1509,9 @@ fpga_result fpgaTokenGetObject(fpga_token token, const char *name,
 	ASSERT_NOT_NULL_RESULT(wrapped_token->adapter_table->fpgaDestroyObject,
 			       FPGA_NOT_SUPPORTED);
 
-	res = wrapped_token->adapter_table->fpgaTokenGetObject(
-		wrapped_token->opae_token, name, &obj, flags);
+	res = OPAE_TRACE_ADAPTER(fpgaTokenGetObject,
+				 wrapped_token->adapter_table,
+				 wrapped_token->opae_token, name, &obj, flags);
 
 	ASSERT_RESULT(res);
 
@@ -1310,8 +1548,8 @@ fpga_result fpgaHandleGetObject(fpga_handle handle, const char *name,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaDestroyObject,
 			       FPGA_NOT_SUPPORTED);
 
-	res = wrapped_handle->adapter_table->fpgaHandleGetObject(
-		wrapped_handle->opae_handle, name, &obj, flags);
+	res = OPAE_TRACE_HANDLE(fpgaHandleGetObject, wrapped_handle,
+				wrapped_handle->opae_handle, name, &obj, flags);
 
 	ASSERT_RESULT(res);
 
@@ -1348,8 +1586,10 @@ fpga_result fpgaObjectGetObject(fpga_object parent, const char *name,
 	ASSERT_NOT_NULL_RESULT(wrapped_object->adapter_table->fpgaDestroyObject,
 			       FPGA_NOT_SUPPORTED);
 
-	res = wrapped_object->adapter_table->fpgaObjectGetObject(
-		wrapped_object->opae_object, name, &obj, flags);
+	res = OPAE_TRACE_ADAPTER(fpgaObjectGetObject,
+				 wrapped_object->adapter_table,
+				 wrapped_object->opae_object, name, &obj,
+				 flags);
 
 	ASSERT_RESULT(res);
 
@@ -1380,8 +1620,9 @@ fpga_result fpgaDestroyObject(fpga_object *obj)
 	ASSERT_NOT_NULL_RESULT(wrapped_object->adapter_table->fpgaDestroyObject,
 			       FPGA_NOT_SUPPORTED);
 
-	res = wrapped_object->adapter_table->fpgaDestroyObject(
-		&wrapped_object->opae_object);
+	res = OPAE_TRACE_ADAPTER(fpgaDestroyObject,
+				 wrapped_object->adapter_table,
+				 &wrapped_object->opae_object);
 
 	opae_destroy_wrapped_object(wrapped_object);
 
@@ -1398,8 +1639,9 @@ fpga_result fpgaObjectRead(fpga_object obj, uint8_t *buffer, size_t offset,
 	ASSERT_NOT_NULL_RESULT(wrapped_object->adapter_table->fpgaObjectRead,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_object->adapter_table->fpgaObjectRead(
-		wrapped_object->opae_object, buffer, offset, len, flags);
+	return OPAE_TRACE_ADAPTER(fpgaObjectRead, wrapped_object->adapter_table,
+				  wrapped_object->opae_object, buffer, offset,
+				  len, flags);
 }
 
 fpga_result fpgaObjectGetSize(fpga_object obj, uint64_t *value, int flags)
@@ -1411,8 +1653,9 @@ fpga_result fpgaObjectGetSize(fpga_object obj, uint64_t *value, int flags)
 	ASSERT_NOT_NULL_RESULT(wrapped_object->adapter_table->fpgaObjectGetSize,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_object->adapter_table->fpgaObjectGetSize(
-		wrapped_object->opae_object, value, flags);
+	return OPAE_TRACE_ADAPTER(fpgaObjectGetSize,
+				  wrapped_object->adapter_table,
+				  wrapped_object->opae_object, value, flags);
 }
 
 fpga_result fpgaObjectRead64(fpga_object obj, uint64_t *value, int flags)
@@ -1424,8 +1667,9 @@ fpga_result fpgaObjectRead64(fpga_object obj, uint64_t *value, int flags)
 	ASSERT_NOT_NULL_RESULT(wrapped_object->adapter_table->fpgaObjectRead64,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_object->adapter_table->fpgaObjectRead64(
-		wrapped_object->opae_object, value, flags);
+	return OPAE_TRACE_ADAPTER(fpgaObjectRead64,
+				  wrapped_object->adapter_table,
+				  wrapped_object->opae_object, value, flags);
 }
 
 fpga_result fpgaObjectWrite64(fpga_object obj, uint64_t value, int flags)
@@ -1436,8 +1680,9 @@ fpga_result fpgaObjectWrite64(fpga_object obj, uint64_t value, int flags)
 	ASSERT_NOT_NULL_RESULT(wrapped_object->adapter_table->fpgaObjectWrite64,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_object->adapter_table->fpgaObjectWrite64(
-		wrapped_object->opae_object, value, flags);
+	return OPAE_TRACE_ADAPTER(fpgaObjectWrite64,
+				  wrapped_object->adapter_table,
+				  wrapped_object->opae_object, value, flags);
 }
 
 fpga_result fpgaSetUserClock(fpga_handle handle, uint64_t high_clk,
@@ -1450,8 +1695,9 @@ fpga_result fpgaSetUserClock(fpga_handle handle, uint64_t high_clk,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaSetUserClock,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaSetUserClock(
-		wrapped_handle->opae_handle, high_clk, low_clk, flags);
+	return OPAE_TRACE_HANDLE(fpgaSetUserClock, wrapped_handle,
+				 wrapped_handle->opae_handle, high_clk, low_clk,
+				 flags);
 }
 
 
@@ -1467,8 +1713,9 @@ fpga_result fpgaGetUserClock(fpga_handle handle, uint64_t *high_clk,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaGetUserClock,
 			       FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaGetUserClock(
-		wrapped_handle->opae_handle, high_clk, low_clk, flags);
+	return OPAE_TRACE_HANDLE(fpgaGetUserClock, wrapped_handle,
+				 wrapped_handle->opae_handle, high_clk, low_clk,
+				 flags);
 }
 
 fpga_result fpgaGetNumMetrics(fpga_handle handle, uint64_t *num_metrics)
@@ -1482,8 +1729,8 @@ fpga_result fpgaGetNumMetrics(fpga_handle handle, uint64_t *num_metrics)
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaGetNumMetrics,
 			     FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaGetNumMetrics(
-		wrapped_handle->opae_handle, num_metrics);
+	return OPAE_TRACE_HANDLE(fpgaGetNumMetrics, wrapped_handle,
+				 wrapped_handle->opae_handle, num_metrics);
 }
 
 fpga_result fpgaGetMetricsInfo(fpga_handle handle,
@@ -1499,8 +1746,9 @@ fpga_result fpgaGetMetricsInfo(fpga_handle handle,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaGetMetricsInfo,
 			    FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaGetMetricsInfo(
-		wrapped_handle->opae_handle, metric_info, num_metrics);
+	return OPAE_TRACE_HANDLE(fpgaGetMetricsInfo, wrapped_handle,
+				 wrapped_handle->opae_handle, metric_info,
+				 num_metrics);
 }
 
 fpga_result fpgaGetMetricsByIndex(fpga_handle handle,
@@ -1518,8 +1766,9 @@ fpga_result fpgaGetMetricsByIndex(fpga_handle handle,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaGetMetricsByIndex,
 			   FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaGetMetricsByIndex(
-		wrapped_handle->opae_handle, metric_num, num_metric_indexes, metrics);
+	return OPAE_TRACE_HANDLE(fpgaGetMetricsByIndex, wrapped_handle,
+				 wrapped_handle->opae_handle, metric_num,
+				 num_metric_indexes, metrics);
 }
 
 fpga_result fpgaGetMetricsByName(fpga_handle handle,
@@ -1537,6 +1786,7 @@ fpga_result fpgaGetMetricsByName(fpga_handle handle,
 	ASSERT_NOT_NULL_RESULT(wrapped_handle->adapter_table->fpgaGetMetricsByName,
 			   FPGA_NOT_SUPPORTED);
 
-	return wrapped_handle->adapter_table->fpgaGetMetricsByName(
-		wrapped_handle->opae_handle, metrics_names, num_metric_names, metrics);
+	return OPAE_TRACE_HANDLE(fpgaGetMetricsByName, wrapped_handle,
+				 wrapped_handle->opae_handle, metrics_names,
+				 num_metric_names, metrics);
 }
@@ -0,0 +1,997 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif /* HAVE_CONFIG_H */
+#define _GNU_SOURCE
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/types.h>
+
+#include "async_log.h"
+#include "opae_int.h"
+
+#define LOG_RING_SIZE      (64 * 1024)
+#define LOG_MAX_RECORD     2048
+#define LOG_MAX_LINE       4096
+#define LOG_FLUSH_PERIOD_NS (10 * 1000 * 1000)
+#define LOG_SITES          256
+#define LOG_SITE_PROBES    8
+
+#define LOG_REC_WRAP         0x0001
+#define LOG_REC_PREFORMATTED 0x0002
+
+#define LOG_ALIGN(__n) (((__n) + 7) & ~((size_t)7))
+
+typedef struct _log_record {
+	uint32_t size;       // total size of the record, including this header
+	uint16_t level;
+	uint16_t flags;
+	uint32_t suppressed; // messages from this site dropped by rate limit
+	uint32_t fmt_len;    // length of the format copy, including the NUL
+	uint64_t timestamp;  // CLOCK_REALTIME, in nanoseconds
+	// followed by the format string and the encoded arguments
+} log_record;
+
+typedef struct _log_ring {
+	uint64_t head;    // written by the owning thread only
+	uint64_t tail;    // written by the consumer only
+	uint64_t dropped; // records lost because the ring was full
+	uint64_t limit;   // consumer's snapshot of head for the current drain
+	int dead;         // set when the owning thread exits
+	struct _log_ring *next;
+	uint8_t data[LOG_RING_SIZE];
+} log_ring;
+
+typedef struct _log_site {
+	const char *fmt;
+	uint64_t window;
+	uint32_t count;
+	uint32_t suppressed;
+} log_site;
+
+static int g_enabled;
+static FILE *g_logfile;
+static uint32_t g_rate_limit;
+
+static log_ring *g_rings;
+static log_site g_sites[LOG_SITES];
+
+static pthread_key_t g_ring_key;
+static int g_ring_key_valid;
+static pthread_once_t g_ring_key_once = PTHREAD_ONCE_INIT;
+static __thread log_ring *tl_ring;
+
+static pthread_t g_flusher;
+static int g_flusher_running;
+static int g_flusher_stop;
+static pthread_mutex_t g_flusher_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_flusher_cond = PTHREAD_COND_INITIALIZER;
+/* serializes consumers: the flusher thread and opae_async_log_flush() */
+static pthread_mutex_t g_drain_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Format string parsing shared by the encoder and the decoder so that
+ * both walk the arguments in exactly the same order.
+ */
+enum log_arg_type {
+	LOG_ARG_NONE = 0, // %% or %n
+	LOG_ARG_INT,      // %d %i (signed, any length)
+	LOG_ARG_UINT,     // %o %u %x %X (unsigned, any length)
+	LOG_ARG_CHAR,     // %c
+	LOG_ARG_DOUBLE,   // %e %f %g %a
+	LOG_ARG_LDOUBLE,  // %Le %Lf %Lg %La
+	LOG_ARG_PTR,      // %p
+	LOG_ARG_STR,      // %s
+	LOG_ARG_BAD       // anything we don't know how to capture
+};
+
+enum log_arg_len {
+	LOG_LEN_NONE = 0,
+	LOG_LEN_HH,
+	LOG_LEN_H,
+	LOG_LEN_L,
+	LOG_LEN_LL,
+	LOG_LEN_J,
+	LOG_LEN_Z,
+	LOG_LEN_T,
+	LOG_LEN_BIG_L
+};
+
+typedef struct _log_spec {
+	const char *begin;     // the '%'
+	const char *len_begin; // first length modifier character
+	const char *end;       // one past the conversion character
+	int star_width;
+	int star_prec;
+	enum log_arg_len len;
+	enum log_arg_type type;
+	char conv;
+} log_spec;
+
+STATIC const char *log_parse_spec(const char *p, log_spec *spec)
+{
+	memset(spec, 0, sizeof(*spec));
+	spec->begin = p++;
+
+	if (*p == '%') {
+		spec->conv = '%';
+		spec->type = LOG_ARG_NONE;
+		spec->end = p + 1;
+		return spec->end;
+	}
+
+	while (*p && strchr("-+ #0'", *p))
+		++p;
+
+	if (*p == '*') {
+		spec->star_width = 1;
+		++p;
+	} else {
+		while (*p >= '0' && *p <= '9')
+			++p;
+	}
+
+	if (*p == '.') {
+		++p;
+		if (*p == '*') {
+			spec->star_prec = 1;
+			++p;
+		} else {
+			while (*p >= '0' && *p <= '9')
+				++p;
+		}
+	}
+
+	spec->len_begin = p;
+	switch (*p) {
+	case 'h':
+		spec->len = LOG_LEN_H;
+		if (*++p == 'h') {
+			spec->len = LOG_LEN_HH;
+			++p;
+		}
+		break;
+	case 'l':
+		spec->len = LOG_LEN_L;
+		if (*++p == 'l') {
+			spec->len = LOG_LEN_LL;
+			++p;
+		}
+		break;
+	case 'q':
+		spec->len = LOG_LEN_LL;
+		++p;
+		break;
+	case 'j':
+		spec->len = LOG_LEN_J;
+		++p;
+		break;
+	case 'z':
+		spec->len = LOG_LEN_Z;
+		++p;
+		break;
+	case 't':
+		spec->len = LOG_LEN_T;
+		++p;
+		break;
+	case 'L':
+		spec->len = LOG_LEN_BIG_L;
+		++p;
+		break;
+	}
+
+	spec->conv = *p;
+	switch (*p) {
+	case 'd':
+	case 'i':
+		spec->type = LOG_ARG_INT;
+		break;
+	case 'o':
+	case 'u':
+	case 'x':
+	case 'X':
+		spec->type = LOG_ARG_UINT;
+		break;
+	case 'c':
+		spec->type = spec->len == LOG_LEN_NONE ?
+			LOG_ARG_CHAR : LOG_ARG_BAD;
+		break;
+	case 'e':
+	case 'E':
+	case 'f':
+	case 'F':
+	case 'g':
+	case 'G':
+	case 'a':
+	case 'A':
+		spec->type = spec->len == LOG_LEN_BIG_L ?
+			LOG_ARG_LDOUBLE : LOG_ARG_DOUBLE;
+		break;
+	case 'p':
+		spec->type = LOG_ARG_PTR;
+		break;
+	case 's':
+		spec->type = spec->len == LOG_LEN_NONE ?
+			LOG_ARG_STR : LOG_ARG_BAD;
+		break;
+	case 'n':
+		spec->type = LOG_ARG_NONE;
+		break;
+	default:
+		spec->type = LOG_ARG_BAD;
+		spec->end = p;
+		return p;
+	}
+
+	spec->end = p + 1;
+	return spec->end;
+}
+
+/*
+ * Encoding: every argument occupies an 8-byte slot, except long double
+ * (16 bytes) and strings (an 8-byte length followed by the characters,
+ * padded to a multiple of 8). Integers are stored as 64-bit values after
+ * applying the conversion implied by their length modifier.
+ */
+typedef struct _log_writer {
+	uint8_t *buf;
+	size_t pos;
+	size_t size;
+} log_writer;
+
+static inline int log_put(log_writer *w, const void *src, size_t len)
+{
+	size_t n = LOG_ALIGN(len);
+	if (w->pos + n > w->size)
+		return 1;
+	memcpy(w->buf + w->pos, src, len);
+	w->pos += n;
+	return 0;
+}
+
+static inline int log_put_u64(log_writer *w, uint64_t value)
+{
+	return log_put(w, &value, sizeof(value));
+}
+
+static int log_put_str(log_writer *w, const char *s)
+{
+	size_t avail;
+	uint64_t len;
+
+	if (!s)
+		s = "(null)";
+	len = strlen(s);
+
+	if (w->pos + sizeof(len) + 8 > w->size)
+		return 1;
+	// Truncate long strings rather than failing the whole record.
+	avail = (w->size - w->pos - sizeof(len)) & ~((size_t)7);
+	if (len + 1 > avail)
+		len = avail - 1;
+
+	log_put_u64(w, len);
+	memcpy(w->buf + w->pos, s, len);
+	w->buf[w->pos + len] = '\0';
+	w->pos += LOG_ALIGN(len + 1);
+	return 0;
+}
+
+static int log_encode_args(log_writer *w, const char *fmt, va_list argp)
+{
+	const char *p = fmt;
+	log_spec spec;
+
+	while ((p = strchr(p, '%')) != NULL) {
+		p = log_parse_spec(p, &spec);
+
+		if (spec.type == LOG_ARG_BAD)
+			return 1;
+
+		if (spec.star_width &&
+		    log_put_u64(w, (uint64_t)(int64_t)va_arg(argp, int)))
+			return 1;
+		if (spec.star_prec &&
+		    log_put_u64(w, (uint64_t)(int64_t)va_arg(argp, int)))
+			return 1;
+
+		switch (spec.type) {
+		case LOG_ARG_INT: {
+			int64_t v;
+			switch (spec.len) {
+			case LOG_LEN_HH:
+				v = (signed char)va_arg(argp, int);
+				break;
+			case LOG_LEN_H:
+				v = (short)va_arg(argp, int);
+				break;
+			case LOG_LEN_L:
+				v = va_arg(argp, long);
+				break;
+			case LOG_LEN_LL:
+				v = va_arg(argp, long long);
+				break;
+			case LOG_LEN_J:
+				v = va_arg(argp, intmax_t);
+				break;
+			case LOG_LEN_Z:
+				v = va_arg(argp, ssize_t);
+				break;
+			case LOG_LEN_T:
+				v = va_arg(argp, ptrdiff_t);
+				break;
+			default:
+				v = va_arg(argp, int);
+				break;
+			}
+			if (log_put_u64(w, (uint64_t)v))
+				return 1;
+		} break;
+		case LOG_ARG_UINT: {
+			uint64_t v;
+			switch (spec.len) {
+			case LOG_LEN_HH:
+				v = (unsigned char)va_arg(argp, unsigned int);
+				break;
+			case LOG_LEN_H:
+				v = (unsigned short)va_arg(argp, unsigned int);
+				break;
+			case LOG_LEN_L:
+				v = va_arg(argp, unsigned long);
+				break;
+			case LOG_LEN_LL:
+				v = va_arg(argp, unsigned long long);
+				break;
+			case LOG_LEN_J:
+				v = va_arg(argp, uintmax_t);
+				break;
+			case LOG_LEN_Z:
+				v = va_arg(argp, size_t);
+				break;
+			case LOG_LEN_T:
+				v = (uint64_t)va_arg(argp, ptrdiff_t);
+				break;
+			default:
+				v = va_arg(argp, unsigned int);
+				break;
+			}
+			if (log_put_u64(w, v))
+				return 1;
+		} break;
+		case LOG_ARG_CHAR:
+			if (log_put_u64(w, (uint64_t)va_arg(argp, int)))
+				return 1;
+			break;
+		case LOG_ARG_DOUBLE: {
+			double d = va_arg(argp, double);
+			if (log_put(w, &d, sizeof(d)))
+				return 1;
+		} break;
+		case LOG_ARG_LDOUBLE: {
+			long double ld = va_arg(argp, long double);
+			if (log_put(w, &ld, sizeof(ld)))
+				return 1;
+		} break;
+		case LOG_ARG_PTR: {
+			void *ptr = va_arg(argp, void *);
+			if (log_put(w, &ptr, sizeof(ptr)))
+				return 1;
+		} break;
+		case LOG_ARG_STR:
+			if (log_put_str(w, va_arg(argp, const char *)))
+				return 1;
+			break;
+		case LOG_ARG_NONE:
+			if (spec.conv == 'n')
+				(void)va_arg(argp, void *);
+			break;
+		default:
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static inline uint64_t log_get_u64(const uint8_t **src)
+{
+	uint64_t v;
+	memcpy(&v, *src, sizeof(v));
+	*src += sizeof(v);
+	return v;
+}
+
+#define LOG_EMIT(__val)                                                      \
+	do {                                                                 \
+		if (spec.star_width && spec.star_prec)                       \
+			res = snprintf(out, avail, one, width, prec, __val); \
+		else if (spec.star_width)                                    \
+			res = snprintf(out, avail, one, width, __val);       \
+		else if (spec.star_prec)                                     \
+			res = snprintf(out, avail, one, prec, __val);        \
+		else                                                         \
+			res = snprintf(out, avail, one, __val);              \
+	} while (0)
+
+/*
+ * Re-create the message from the format string and the captured
+ * arguments by formatting one conversion specification at a time.
+ */
+static size_t log_decode(char *buf, size_t size, const char *fmt,
+			 const uint8_t *args)
+{
+	const char *p = fmt;
+	char *out = buf;
+	size_t avail = size;
+	char one[64];
+	log_spec spec;
+
+	while (*p && avail > 1) {
+		const char *pct = strchr(p, '%');
+		size_t lit = pct ? (size_t)(pct - p) : strlen(p);
+		int res = 0;
+		int width = 0;
+		int prec = 0;
+		size_t n;
+
+		if (lit) {
+			n = lit < avail - 1 ? lit : avail - 1;
+			memcpy(out, p, n);
+			out += n;
+			avail -= n;
+			p += lit;
+			continue;
+		}
+
+		p = log_parse_spec(p, &spec);
+
+		if (spec.star_width)
+			width = (int)log_get_u64(&args);
+		if (spec.star_prec)
+			prec = (int)log_get_u64(&args);
+
+		// Rewrite the specification with the length modifier that
+		// matches how the argument was stored.
+		n = spec.len_begin ? (size_t)(spec.len_begin - spec.begin) :
+			(size_t)(spec.end - spec.begin);
+		if (n + 4 > sizeof(one))
+			break;
+		memcpy(one, spec.begin, n);
+		switch (spec.type) {
+		case LOG_ARG_INT:
+		case LOG_ARG_UINT:
+			one[n++] = 'l';
+			one[n++] = 'l';
+			break;
+		case LOG_ARG_LDOUBLE:
+			one[n++] = 'L';
+			break;
+		default:
+			break;
+		}
+		if (spec.len_begin)
+			one[n++] = spec.conv;
+		one[n] = '\0';
+
+		switch (spec.type) {
+		case LOG_ARG_INT:
+			LOG_EMIT((long long)log_get_u64(&args));
+			break;
+		case LOG_ARG_UINT:
+			LOG_EMIT((unsigned long long)log_get_u64(&args));
+			break;
+		case LOG_ARG_CHAR:
+			LOG_EMIT((int)log_get_u64(&args));
+			break;
+		case LOG_ARG_DOUBLE: {
+			double d;
+			memcpy(&d, args, sizeof(d));
+			args += LOG_ALIGN(sizeof(d));
+			LOG_EMIT(d);
+		} break;
+		case LOG_ARG_LDOUBLE: {
+			long double ld;
+			memcpy(&ld, args, sizeof(ld));
+			args += LOG_ALIGN(sizeof(ld));
+			LOG_EMIT(ld);
+		} break;
+		case LOG_ARG_PTR: {
+			void *ptr;
+			memcpy(&ptr, args, sizeof(ptr));
+			args += LOG_ALIGN(sizeof(ptr));
+			LOG_EMIT(ptr);
+		} break;
+		case LOG_ARG_STR: {
+			uint64_t len = log_get_u64(&args);
+			LOG_EMIT((const char *)args);
+			args += LOG_ALIGN(len + 1);
+		} break;
+		case LOG_ARG_NONE:
+			if (spec.conv == '%') {
+				*out = '%';
+				res = 1;
+			}
+			break;
+		default:
+			res = 0;
+			break;
+		}
+
+		if (res < 0)
+			break;
+		n = (size_t)res < avail - 1 ? (size_t)res : avail - 1;
+		out += n;
+		avail -= n;
+	}
+
+	*out = '\0';
+	return (size_t)(out - buf);
+}
+
+static inline uint64_t log_timestamp(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * Per call site rate limiting. Sites are identified by the address of
+ * their format string and live in a small open-addressed table that is
+ * claimed with compare-and-swap. Returns non-zero when the message
+ * should be dropped; *suppressed receives the number of messages that
+ * were dropped for this site in the previous window.
+ */
+static int log_rate_limited(const char *fmt, uint64_t now,
+			    uint32_t *suppressed)
+{
+	uint64_t window = now / 1000000000ULL;
+	uint64_t h = ((uintptr_t)fmt >> 3) * 0x9E3779B97F4A7C15ULL;
+	uint32_t i;
+
+	*suppressed = 0;
+	if (!g_rate_limit)
+		return 0;
+
+	for (i = 0; i < LOG_SITE_PROBES; ++i) {
+		log_site *site = &g_sites[(h + i) % LOG_SITES];
+		const char *owner = __atomic_load_n(&site->fmt,
+						    __ATOMIC_ACQUIRE);
+		uint64_t last;
+
+		if (!owner) {
+			const char *expected = NULL;
+			if (!__atomic_compare_exchange_n(&site->fmt, &expected,
+							 fmt, 0,
+							 __ATOMIC_ACQ_REL,
+							 __ATOMIC_ACQUIRE) &&
+			    expected != fmt)
+				continue;
+		} else if (owner != fmt) {
+			continue;
+		}
+
+		last = __atomic_load_n(&site->window, __ATOMIC_RELAXED);
+		if (last != window &&
+		    __atomic_compare_exchange_n(&site->window, &last, window,
+						0, __ATOMIC_RELAXED,
+						__ATOMIC_RELAXED)) {
+			__atomic_store_n(&site->count, 0, __ATOMIC_RELAXED);
+			*suppressed = __atomic_exchange_n(&site->suppressed, 0,
+							  __ATOMIC_RELAXED);
+		}
+
+		if (__atomic_add_fetch(&site->count, 1, __ATOMIC_RELAXED) >
+		    g_rate_limit) {
+			__atomic_add_fetch(&site->suppressed, 1,
+					   __ATOMIC_RELAXED);
+			return 1;
+		}
+		return 0;
+	}
+
+	// table is full: don't limit this site.
+	return 0;
+}
+
+static void log_ring_release(void *arg)
+{
+	log_ring *ring = (log_ring *)arg;
+	__atomic_store_n(&ring->dead, 1, __ATOMIC_RELEASE);
+	tl_ring = NULL;
+}
+
+static void log_ring_key_create(void)
+{
+	g_ring_key_valid = !pthread_key_create(&g_ring_key, log_ring_release);
+}
+
+static log_ring *log_thread_ring(void)
+{
+	log_ring *ring = tl_ring;
+
+	if (ring)
+		return ring;
+
+	ring = calloc(1, sizeof(log_ring));
+	if (!ring)
+		return NULL;
+
+	// The key's destructor marks the ring for reclamation once the
+	// thread exits.
+	pthread_once(&g_ring_key_once, log_ring_key_create);
+	if (g_ring_key_valid)
+		pthread_setspecific(g_ring_key, ring);
+
+	ring->next = __atomic_load_n(&g_rings, __ATOMIC_ACQUIRE);
+	while (!__atomic_compare_exchange_n(&g_rings, &ring->next, ring, 1,
+					    __ATOMIC_RELEASE,
+					    __ATOMIC_ACQUIRE))
+		;
+
+	tl_ring = ring;
+	return ring;
+}
+
+/*
+ * Reserve len bytes of contiguous space in the ring, inserting a wrap
+ * record if the space left before the end of the ring is too small.
+ * *head receives the value to publish once the record is written.
+ * Only the owning thread calls this.
+ */
+static uint8_t *log_ring_reserve(log_ring *ring, size_t len, uint64_t *head)
+{
+	uint64_t h = ring->head;
+	uint64_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+	size_t pos = h % LOG_RING_SIZE;
+	size_t contig = LOG_RING_SIZE - pos;
+
+	if (len > contig) {
+		log_record *wrap;
+
+		if (h - tail + contig + len > LOG_RING_SIZE)
+			return NULL;
+		wrap = (log_record *)&ring->data[pos];
+		wrap->size = (uint32_t)contig;
+		wrap->flags = LOG_REC_WRAP;
+		*head = h + contig + len;
+		return ring->data;
+	}
+
+	if (h - tail + len > LOG_RING_SIZE)
+		return NULL;
+	*head = h + len;
+	return &ring->data[pos];
+}
+
+void opae_async_log_vprint(int loglevel, const char *fmt, va_list argp)
+{
+	uint64_t buf[LOG_MAX_RECORD / sizeof(uint64_t)];
+	log_writer w = { (uint8_t *)buf, sizeof(log_record),
+			 sizeof(buf) };
+	log_record *rec = (log_record *)buf;
+	log_ring *ring;
+	uint64_t now = log_timestamp();
+	uint32_t suppressed = 0;
+	uint64_t head = 0;
+	uint8_t *dst;
+	va_list args;
+
+	if (log_rate_limited(fmt, now, &suppressed))
+		return;
+
+	ring = log_thread_ring();
+	if (!ring)
+		return;
+
+	rec->level = (uint16_t)loglevel;
+	rec->flags = 0;
+	rec->suppressed = suppressed;
+	rec->timestamp = now;
+	rec->fmt_len = (uint32_t)strlen(fmt) + 1;
+
+	// The format is copied because it may live in a plugin that can be
+	// unloaded before the record is written out.
+	va_copy(args, argp);
+	if (log_put(&w, fmt, rec->fmt_len) ||
+	    log_encode_args(&w, fmt, args)) {
+		// Fall back to formatting the message right away.
+		w.pos = sizeof(log_record);
+		rec->flags = LOG_REC_PREFORMATTED;
+		vsnprintf((char *)w.buf + w.pos, w.size - w.pos, fmt, argp);
+		rec->fmt_len = (uint32_t)strlen((char *)w.buf + w.pos) + 1;
+		w.pos += LOG_ALIGN(rec->fmt_len);
+	}
+	va_end(args);
+
+	rec->size = (uint32_t)w.pos;
+
+	dst = log_ring_reserve(ring, rec->size, &head);
+	if (!dst) {
+		__atomic_add_fetch(&ring->dropped, 1, __ATOMIC_RELAXED);
+		return;
+	}
+
+	memcpy(dst, buf, rec->size);
+	__atomic_store_n(&ring->head, head, __ATOMIC_RELEASE);
+}
+
+static const log_record *log_ring_peek(log_ring *ring)
+{
+	while (ring->tail != ring->limit) {
+		const log_record *rec =
+			(const log_record *)&ring->data[ring->tail % LOG_RING_SIZE];
+		if (!(rec->flags & LOG_REC_WRAP))
+			return rec;
+		__atomic_store_n(&ring->tail, ring->tail + rec->size,
+				 __ATOMIC_RELEASE);
+	}
+	return NULL;
+}
+
+static void log_write_record(const log_record *rec)
+{
+	char line[LOG_MAX_LINE];
+	const char *fmt = (const char *)(rec + 1);
+	FILE *fp = rec->level == OPAE_LOG_ERROR ? stderr : g_logfile;
+	uint64_t sec = rec->timestamp / 1000000000ULL;
+	uint64_t usec = (rec->timestamp % 1000000000ULL) / 1000;
+	int n;
+
+	if (!fp)
+		fp = stdout;
+
+	n = snprintf(line, sizeof(line), "[%lu.%06lu] ",
+		     (unsigned long)sec, (unsigned long)usec);
+	if (n < 0 || (size_t)n >= sizeof(line))
+		n = 0;
+
+	if (rec->suppressed)
+		fprintf(fp, "%s(%u similar messages were suppressed)\n",
+			line, rec->suppressed);
+
+	if (rec->flags & LOG_REC_PREFORMATTED)
+		snprintf(line + n, sizeof(line) - n, "%s", fmt);
+	else
+		log_decode(line + n, sizeof(line) - n, fmt,
+			   (const uint8_t *)fmt + LOG_ALIGN(rec->fmt_len));
+
+	fputs(line, fp);
+}
+
+/* Write out every published record. The caller holds g_drain_lock. */
+static void log_drain(void)
+{
+	log_ring *ring;
+	log_ring *prev;
+	log_ring *next;
+
+	for (ring = __atomic_load_n(&g_rings, __ATOMIC_ACQUIRE); ring;
+	     ring = ring->next)
+		ring->limit = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+	// Merge the per-thread rings so that messages come out in
+	// timestamp order.
+	for (;;) {
+		log_ring *best = NULL;
+		const log_record *best_rec = NULL;
+
+		for (ring = __atomic_load_n(&g_rings, __ATOMIC_ACQUIRE); ring;
+		     ring = ring->next) {
+			const log_record *rec = log_ring_peek(ring);
+			if (rec && (!best_rec ||
+				    rec->timestamp < best_rec->timestamp)) {
+				best = ring;
+				best_rec = rec;
+			}
+		}
+
+		if (!best)
+			break;
+
+		log_write_record(best_rec);
+		__atomic_store_n(&best->tail, best->tail + best_rec->size,
+				 __ATOMIC_RELEASE);
+	}
+
+	prev = NULL;
+	for (ring = __atomic_load_n(&g_rings, __ATOMIC_ACQUIRE); ring;
+	     ring = next) {
+		uint64_t dropped = __atomic_exchange_n(&ring->dropped, 0,
+						       __ATOMIC_RELAXED);
+		next = ring->next;
+
+		if (dropped)
+			fprintf(g_logfile ? g_logfile : stdout,
+				"(%lu log messages were dropped)\n",
+				(unsigned long)dropped);
+
+		// Reclaim the rings of threads that have exited. Producers
+		// only ever push new rings at the front of the list, so
+		// only unlinking the first ring needs to be atomic.
+		if (__atomic_load_n(&ring->dead, __ATOMIC_ACQUIRE) &&
+		    ring->tail == __atomic_load_n(&ring->head,
+						  __ATOMIC_ACQUIRE)) {
+			log_ring *expected = ring;
+			if (prev) {
+				prev->next = next;
+			} else if (!__atomic_compare_exchange_n(
+					   &g_rings, &expected, next, 0,
+					   __ATOMIC_ACQ_REL,
+					   __ATOMIC_ACQUIRE)) {
+				prev = expected;
+				while (prev->next != ring)
+					prev = prev->next;
+				prev->next = next;
+			}
+			free(ring);
+			continue;
+		}
+		prev = ring;
+	}
+
+	fflush(g_logfile ? g_logfile : stdout);
+	fflush(stderr);
+}
+
+void opae_async_log_flush(void)
+{
+	if (pthread_mutex_lock(&g_drain_lock))
+		return;
+	log_drain();
+	pthread_mutex_unlock(&g_drain_lock);
+}
+
+static void *log_flusher(void *arg)
+{
+	struct timespec deadline;
+
+	UNUSED_PARAM(arg);
+
+	pthread_mutex_lock(&g_flusher_lock);
+	while (!g_flusher_stop) {
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_nsec += LOG_FLUSH_PERIOD_NS;
+		if (deadline.tv_nsec >= 1000000000L) {
+			deadline.tv_nsec -= 1000000000L;
+			++deadline.tv_sec;
+		}
+		pthread_cond_timedwait(&g_flusher_cond, &g_flusher_lock,
+				       &deadline);
+		pthread_mutex_unlock(&g_flusher_lock);
+		opae_async_log_flush();
+		pthread_mutex_lock(&g_flusher_lock);
+	}
+	pthread_mutex_unlock(&g_flusher_lock);
+
+	return NULL;
+}
+
+/*
+ * fork() only duplicates the calling thread, so the child has no flusher.
+ * Drain the rings and hold both locks across the fork so that the child
+ * starts with consistent locks and nothing that the parent will also
+ * write out.
+ */
+static void log_atfork_prepare(void)
+{
+	pthread_mutex_lock(&g_flusher_lock);
+	pthread_mutex_lock(&g_drain_lock);
+	if (__atomic_load_n(&g_enabled, __ATOMIC_ACQUIRE))
+		log_drain();
+}
+
+static void log_atfork_parent(void)
+{
+	pthread_mutex_unlock(&g_drain_lock);
+	pthread_mutex_unlock(&g_flusher_lock);
+}
+
+static void log_atfork_child(void)
+{
+	log_ring *ring;
+
+	// The other threads' rings belong to the parent, which writes out
+	// whatever they still hold. Their owners don't exist here, so mark
+	// them for reclamation.
+	for (ring = g_rings; ring; ring = ring->next) {
+		if (ring == tl_ring)
+			continue;
+		ring->tail = ring->head;
+		ring->dead = 1;
+	}
+
+	pthread_mutex_unlock(&g_drain_lock);
+	pthread_mutex_unlock(&g_flusher_lock);
+
+	if (!g_flusher_running)
+		return;
+
+	g_flusher_stop = 0;
+	if (pthread_create(&g_flusher, NULL, log_flusher, NULL)) {
+		// no flusher: log synchronously from now on
+		g_flusher_running = 0;
+		__atomic_store_n(&g_enabled, 0, __ATOMIC_RELEASE);
+	}
+}
+
+static void log_atfork_register(void)
+{
+	pthread_atfork(log_atfork_prepare, log_atfork_parent,
+		       log_atfork_child);
+}
+
+int opae_async_log_init(FILE *logfile, uint32_t rate_limit)
+{
+	static pthread_once_t atfork_once = PTHREAD_ONCE_INIT;
+
+	if (__atomic_load_n(&g_enabled, __ATOMIC_ACQUIRE))
+		return 0;
+
+	pthread_once(&atfork_once, log_atfork_register);
+
+	g_logfile = logfile;
+	g_rate_limit = rate_limit;
+	memset(g_sites, 0, sizeof(g_sites));
+
+	g_flusher_stop = 0;
+	if (pthread_create(&g_flusher, NULL, log_flusher, NULL))
+		return 1;
+	g_flusher_running = 1;
+
+	__atomic_store_n(&g_enabled, 1, __ATOMIC_RELEASE);
+	return 0;
+}
+
+int opae_async_log_enabled(void)
+{
+	return __atomic_load_n(&g_enabled, __ATOMIC_ACQUIRE);
+}
+
+void opae_async_log_release(void)
+{
+	if (!__atomic_load_n(&g_enabled, __ATOMIC_ACQUIRE))
+		return;
+
+	__atomic_store_n(&g_enabled, 0, __ATOMIC_RELEASE);
+
+	if (g_flusher_running) {
+		pthread_mutex_lock(&g_flusher_lock);
+		g_flusher_stop = 1;
+		pthread_cond_signal(&g_flusher_cond);
+		pthread_mutex_unlock(&g_flusher_lock);
+		pthread_join(g_flusher, NULL);
+		g_flusher_running = 0;
+	}
+
+	opae_async_log_flush();
+}
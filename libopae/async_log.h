@@ -0,0 +1,65 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef __OPAE_ASYNC_LOG_H__
+#define __OPAE_ASYNC_LOG_H__
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * Asynchronous back end for opae_print().
+ *
+ * Each thread that logs owns a lock-free single-producer ring. A message
+ * is stored as a binary record (timestamp, format string and the raw
+ * argument values); it is formatted and written by a background flusher
+ * thread. When a ring is full the message is dropped and counted rather
+ * than blocking the caller. Messages from a single call site (identified
+ * by its format string) are limited to a configurable number per second.
+ */
+
+// default number of messages per second allowed from one call site.
+#define OPAE_DEFAULT_LOG_RATE 1000
+
+// non-zero on failure.
+// logfile: destination stream for the formatted messages.
+// rate_limit: messages per second allowed per call site (0 = unlimited).
+int opae_async_log_init(FILE *logfile, uint32_t rate_limit);
+
+// non-zero when opae_async_log_init() has been called successfully.
+int opae_async_log_enabled(void);
+
+// Queue a message. Never blocks on I/O or on other threads.
+void opae_async_log_vprint(int loglevel, const char *fmt, va_list argp);
+
+// Format and write all queued messages before returning.
+void opae_async_log_flush(void);
+
+// Stop the flusher thread after writing any queued messages.
+void opae_async_log_release(void);
+
+#endif /* __OPAE_ASYNC_LOG_H__ */
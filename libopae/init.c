@@ -32,6 +32,8 @@
 #include <opae/utils.h>
 #include "pluginmgr.h"
 #include "opae_int.h"
+#include "async_log.h"
+#include "trace.h"
 #undef __USE_GNU
 
 #include <stdio.h>
@@ -59,6 +61,14 @@ void /* __FIXME_MAKE_VISIBLE__ */ opae_print(int loglevel, const char *fmt, ...)
 	if (loglevel > g_loglevel)
 		return;
 
+	if (loglevel != OPAE_LOG_ERROR && opae_async_log_enabled()) {
+		/* errors stay synchronous so they are never lost */
+		va_start(argp, fmt);
+		opae_async_log_vprint(loglevel, fmt, argp);
+		va_end(argp);
+		return;
+	}
+
 	if (loglevel == OPAE_LOG_ERROR)
 		fp = stderr;
 	else
@@ -110,6 +120,22 @@ __attribute__((constructor)) STATIC void opae_init(void)
 	if (g_logfile == NULL)
 		g_logfile = stdout;
 
+	/* optionally hand messages off to the asynchronous logger */
+	s = getenv("LIBOPAE_LOG_ASYNC");
+	if (s && atoi(s)) {
+		uint32_t rate = OPAE_DEFAULT_LOG_RATE;
+
+		s = getenv("LIBOPAE_LOG_RATE");
+		if (s)
+			rate = (uint32_t)strtoul(s, NULL, 0);
+
+		if (opae_async_log_init(g_logfile, rate))
+			fprintf(stderr, "Could not start the asynchronous "
+					"logger. Logging synchronously.\n");
+	}
+
+	opae_trace_init();
+
 	// If the environment hasn't requested explicit initialization,
 	// perform the initialization implicitly here.
 	if (getenv("OPAE_EXPLICIT_INITIALIZE") == NULL)
@@ -120,10 +146,15 @@ __attribute__((destructor)) STATIC void opae_release(void)
 {
 	fpga_result res;
 
+	/* the statistics live in the adapters, so report before finalizing */
+	opae_trace_release();
+
 	res = fpgaFinalize();
 	if (res != FPGA_OK)
 		OPAE_ERR("fpgaFinalize: %s", fpgaErrStr(res));
 
+	opae_async_log_release();
+
 	if (g_logfile != NULL && g_logfile != stdout) {
 		fclose(g_logfile);
 	}
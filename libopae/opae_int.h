@@ -40,6 +40,8 @@
 #endif // __USE_GNU
 #include <pthread.h>
 
+#include "trace.h"
+
 /* Macro for defining symbol visibility */
 //#define __FPGA_API__ __attribute__((visibility("default")))
 //#define __FIXME_MAKE_VISIBLE__ __attribute__((visibility("default")))
@@ -95,11 +97,75 @@
 
 typedef struct _opae_api_adapter_table opae_api_adapter_table;
 
-//                                  k o t w
-#define OPAE_WRAPPED_TOKEN_MAGIC 0x6b6f7477
+/*
+ * Wrapped tokens and handles are given to the caller as IDs rather than
+ * pointers:
+ *
+ *   | type tag (16) | generation (28) | slot index (20) |
+ *
+ * The slots live in chunks that are never freed, so validating an ID is
+ * a tag check, a bounds check and a generation compare that can't touch
+ * freed memory. Releasing a slot bumps its generation, which turns every
+ * outstanding copy of the ID stale.
+ */
+#define OPAE_ID_INDEX_BITS 20
+#define OPAE_ID_GEN_BITS 28
+#define OPAE_ID_TAG_SHIFT (OPAE_ID_INDEX_BITS + OPAE_ID_GEN_BITS)
+#define OPAE_ID_INDEX_MASK ((1ULL << OPAE_ID_INDEX_BITS) - 1)
+#define OPAE_ID_GEN_MASK ((1ULL << OPAE_ID_GEN_BITS) - 1)
+#define OPAE_ID_CHUNK_SHIFT 8
+#define OPAE_ID_CHUNK_SIZE (1 << OPAE_ID_CHUNK_SHIFT)
+#define OPAE_ID_MAX_CHUNKS (1 << (OPAE_ID_INDEX_BITS - OPAE_ID_CHUNK_SHIFT))
+
+typedef struct _opae_id_slot {
+	uint32_t generation; // odd while the slot is in use
+	uint32_t next_free;  // index + 1 of the next free slot
+	void *object;
+} opae_id_slot;
+
+typedef struct _opae_id_table {
+	uint64_t tag;
+	pthread_mutex_t lock;
+	uint32_t num_slots; // slots handed out so far
+	uint32_t free_head; // index + 1 of the first free slot, 0 if none
+	opae_id_slot *chunks[OPAE_ID_MAX_CHUNKS];
+} opae_id_table;
+
+// Returns the new ID, or NULL when the table is full or out of memory.
+void *opae_id_alloc(opae_id_table *table, void *object);
+
+void opae_id_free(opae_id_table *table, void *id);
+
+static inline void *opae_id_lookup(opae_id_table *table, const void *id)
+{
+	uint64_t v = (uint64_t)(uintptr_t)id;
+	uint32_t index = (uint32_t)(v & OPAE_ID_INDEX_MASK);
+	opae_id_slot *chunk;
+	opae_id_slot *slot;
+
+	if ((v >> OPAE_ID_TAG_SHIFT) != table->tag)
+		return NULL;
+
+	chunk = __atomic_load_n(&table->chunks[index >> OPAE_ID_CHUNK_SHIFT],
+				__ATOMIC_ACQUIRE);
+	if (!chunk)
+		return NULL;
+
+	slot = &chunk[index & (OPAE_ID_CHUNK_SIZE - 1)];
+	if (__atomic_load_n(&slot->generation, __ATOMIC_ACQUIRE)
+	    != ((v >> OPAE_ID_INDEX_BITS) & OPAE_ID_GEN_MASK))
+		return NULL;
+
+	return slot->object;
+}
+
+//                            t w
+#define OPAE_WRAPPED_TOKEN_TAG 0x7477
+
+extern opae_id_table opae_wrapped_token_ids;
 
 typedef struct _opae_wrapped_token {
-	uint32_t magic;
+	fpga_token id;
 	fpga_token opae_token;
 	opae_api_adapter_table *adapter_table;
 } opae_wrapped_token;
@@ -110,27 +176,27 @@ opae_allocate_wrapped_token(fpga_token token,
 
 static inline opae_wrapped_token *opae_validate_wrapped_token(fpga_token t)
 {
-	opae_wrapped_token *wt;
-	if (!t)
-		return NULL;
-	wt = (opae_wrapped_token *)t;
-	return (wt->magic == OPAE_WRAPPED_TOKEN_MAGIC) ? wt : NULL;
+	return (opae_wrapped_token *)opae_id_lookup(&opae_wrapped_token_ids,
+						    t);
 }
 
 static inline void opae_destroy_wrapped_token(opae_wrapped_token *wt)
 {
-	wt->magic = 0;
+	opae_id_free(&opae_wrapped_token_ids, wt->id);
 	free(wt);
 }
 
-//                                   n a h w
-#define OPAE_WRAPPED_HANDLE_MAGIC 0x6e616877
+//                             h w
+#define OPAE_WRAPPED_HANDLE_TAG 0x6877
+
+extern opae_id_table opae_wrapped_handle_ids;
 
 typedef struct _opae_wrapped_handle {
-	uint32_t magic;
+	fpga_handle id;
 	opae_wrapped_token *wrapped_token;
 	fpga_handle opae_handle;
 	opae_api_adapter_table *adapter_table;
+	opae_trace_set *trace;
 } opae_wrapped_handle;
 
 opae_wrapped_handle *
@@ -139,16 +205,15 @@ opae_allocate_wrapped_handle(opae_wrapped_token *wt, fpga_handle opae_handle,
 
 static inline opae_wrapped_handle *opae_validate_wrapped_handle(fpga_handle h)
 {
-	opae_wrapped_handle *wh;
-	if (!h)
-		return NULL;
-	wh = (opae_wrapped_handle *)h;
-	return (wh->magic == OPAE_WRAPPED_HANDLE_MAGIC) ? wh : NULL;
+	return (opae_wrapped_handle *)opae_id_lookup(&opae_wrapped_handle_ids,
+						     h);
 }
 
 static inline void opae_destroy_wrapped_handle(opae_wrapped_handle *wh)
 {
-	wh->magic = 0;
+	opae_id_free(&opae_wrapped_handle_ids, wh->id);
+	if (wh->trace)
+		opae_trace_free_set(wh->trace);
 	free(wh);
 }
 
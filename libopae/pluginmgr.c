@@ -175,6 +175,9 @@ STATIC int opae_plugin_mgr_free_adapter(opae_api_adapter_table *adapter)
 		OPAE_ERR("dlclose failed with %d %s", res, err ? err : "");
 	}
 
+	if (adapter->trace)
+		opae_trace_free_set(adapter->trace);
+
 	free(adapter);
 
 	return res;
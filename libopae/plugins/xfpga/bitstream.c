@@ -350,6 +350,45 @@ out_free:
 	return result;
 }
 
+fpga_result check_gbs_metadata_interface_id(fpga_handle handle,
+				const struct gbs_metadata *gbs_metadata)
+{
+	fpga_guid expected_guid;
+	uint64_t ifc_id_val_l, ifc_id_val_h;
+	errno_t e;
+
+	if (gbs_metadata == NULL) {
+		FPGA_ERR("Invalid input metadata");
+		return FPGA_INVALID_PARAM;
+	}
+
+	if (string_to_guid(gbs_metadata->afu_image.interface_uuid,
+			   &expected_guid) != FPGA_OK) {
+		FPGA_ERR("Invalid BBS interface ID");
+		return FPGA_INVALID_PARAM;
+	}
+
+	e = memcpy_s(&ifc_id_val_h, sizeof(ifc_id_val_h),
+			expected_guid, sizeof(uint64_t));
+	if (EOK != e) {
+		FPGA_ERR("memcpy_s failed");
+		return FPGA_EXCEPTION;
+	}
+	ifc_id_val_h = int64_be_to_le(ifc_id_val_h);
+
+	e = memcpy_s(&ifc_id_val_l, sizeof(ifc_id_val_l),
+			expected_guid + sizeof(uint64_t), sizeof(uint64_t));
+	if (EOK != e) {
+		FPGA_ERR("memcpy_s failed");
+		return FPGA_EXCEPTION;
+	}
+	ifc_id_val_l = int64_be_to_le(ifc_id_val_l);
+
+	return check_interface_id(handle,
+				  (uint32_t)gbs_metadata->afu_image.magic_num,
+				  ifc_id_val_l, ifc_id_val_h);
+}
+
 fpga_result read_gbs_metadata(const uint8_t *bitstream,
 				struct gbs_metadata *gbs_metadata)
 {
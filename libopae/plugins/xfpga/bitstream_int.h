@@ -142,6 +142,20 @@ fpga_result validate_bitstream_metadata(fpga_handle handle,
 fpga_result read_gbs_metadata(const uint8_t *bitstream,
 			      struct gbs_metadata *gbs_metadata);
 
+/**
+ * Check previously parsed GBS metadata against the FPGA
+ *
+ * Compares the magic no and interface id recorded in
+ * metadata returned by read_gbs_metadata() with the
+ * values expected by the FPGA.
+ *
+ * @param[in] handle       Handle to previously opened FPGA object
+ * @param[in] gbs_metadata Pointer to gbs metadata struct
+ * @returns                FPGA_OK on success
+ */
+fpga_result check_gbs_metadata_interface_id(fpga_handle handle,
+				const struct gbs_metadata *gbs_metadata);
+
 /**
 * Reads interface id high and low values
 *
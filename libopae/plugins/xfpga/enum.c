@@ -621,6 +621,11 @@ fpga_result __FPGA_API__ xfpga_fpgaEnumerate(const fpga_properties *filters,
 
 	memset_s(&head, sizeof(head), 0);
 
+	// Devices may have come and gone, or an AFU may have been
+	// reprogrammed by another process, since the last enumeration.
+	opae_glob_cache_invalidate();
+	token_invalidate_props();
+
 	//enum FPGA regions & resources
 	result = enum_fpga_region_resources(&head,
 				include_afu(filters, num_filters));
@@ -31,9 +31,11 @@
 #include "safe_string/safe_string.h"
 
 #include <sys/stat.h>
+#include <fcntl.h>
 #include <unistd.h>
 #include <dirent.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "common_int.h"
 #include "opae/error.h"
@@ -53,7 +55,7 @@ fpga_result __FPGA_API__ xfpga_fpgaReadError(fpga_token token, uint32_t error_nu
 		return FPGA_INVALID_PARAM;
 	}
 
-	struct error_list *p = _token->errors;
+	struct error_list *p = token_get_errors(_token);
 	while (p) {
 		if (i == error_num) {
 			// test if file exists
@@ -77,6 +79,102 @@ fpga_result __FPGA_API__ xfpga_fpgaReadError(fpga_token token, uint32_t error_nu
 	return FPGA_NOT_FOUND;
 }
 
+/* Return the cached file descriptor of an error register, opening it on
+ * first use. Tokens share their error list with all of their clones, so
+ * racing openers keep whichever descriptor got there first. */
+static int error_fd_get(struct error_list *p)
+{
+	int fd = __atomic_load_n(&p->fd, __ATOMIC_ACQUIRE);
+	int expected = -1;
+
+	if (fd >= 0)
+		return fd;
+
+	fd = open(p->error_file, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		FPGA_MSG("can't open %s", p->error_file);
+		return -1;
+	}
+
+	if (!__atomic_compare_exchange_n(&p->fd, &expected, fd, false,
+					 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+		close(fd);
+		fd = expected;
+	}
+
+	return fd;
+}
+
+/* Read an error register through its cached file descriptor. A descriptor
+ * that fails to read (the device was removed and re-added, or the region
+ * was reprogrammed) is dropped and the file is opened once more. */
+static fpga_result read_error_fd(struct error_list *p, uint64_t *value)
+{
+	char buf[SYSFS_PATH_MAX];
+	int retries = 1;
+	int fd;
+	ssize_t n;
+
+	do {
+		fd = error_fd_get(p);
+		if (fd < 0)
+			return FPGA_EXCEPTION;
+
+		// sysfs regenerates the attribute on every read at offset 0
+		n = pread(fd, buf, sizeof(buf) - 1, 0);
+		if (n > 0) {
+			buf[n] = '\0';
+			*value = strtoull(buf, NULL, 0);
+			return FPGA_OK;
+		}
+
+		// only the thread that uninstalls the descriptor closes it
+		if (__atomic_compare_exchange_n(&p->fd, &fd, -1, false,
+						__ATOMIC_ACQ_REL,
+						__ATOMIC_ACQUIRE))
+			close(fd);
+	} while (retries--);
+
+	FPGA_MSG("can't read error file '%s'", p->error_file);
+	return FPGA_EXCEPTION;
+}
+
+fpga_result __FPGA_API__ xfpga_fpgaReadAllErrors(fpga_token token,
+						 uint64_t *values,
+						 uint32_t max_values,
+						 uint32_t *num_errors)
+{
+	struct _fpga_token *_token = (struct _fpga_token *)token;
+	uint32_t i = 0;
+	fpga_result res;
+
+	ASSERT_NOT_NULL(token);
+	ASSERT_NOT_NULL(num_errors);
+	if (_token->magic != FPGA_TOKEN_MAGIC) {
+		FPGA_MSG("Invalid token");
+		return FPGA_INVALID_PARAM;
+	}
+
+	if (!values && max_values) {
+		FPGA_MSG("values is NULL");
+		return FPGA_INVALID_PARAM;
+	}
+
+	struct error_list *p = token_get_errors(_token);
+	while (p) {
+		if (i < max_values) {
+			res = read_error_fd(p, &values[i]);
+			if (res != FPGA_OK)
+				return res;
+		}
+		i++;
+		p = p->next;
+	}
+
+	*num_errors = i;
+	return FPGA_OK;
+}
+
 fpga_result __FPGA_API__ xfpga_fpgaClearError(fpga_token token, uint32_t error_num)
 {
 	struct _fpga_token *_token = (struct _fpga_token *)token;
@@ -91,7 +189,7 @@ fpga_result __FPGA_API__ xfpga_fpgaClearError(fpga_token token, uint32_t error_n
 		return FPGA_INVALID_PARAM;
 	}
 
-	struct error_list *p = _token->errors;
+	struct error_list *p = token_get_errors(_token);
 	while (p) {
 		if (i == error_num) {
 			if (!p->info.can_clear) {
@@ -135,7 +233,7 @@ fpga_result __FPGA_API__ xfpga_fpgaClearAllErrors(fpga_token token)
 		return FPGA_INVALID_PARAM;
 	}
 
-	struct error_list *p = _token->errors;
+	struct error_list *p = token_get_errors(_token);
 	while (p) {
 		// if error can be cleared
 		if (p->info.can_clear) {
@@ -169,7 +267,7 @@ fpga_result __FPGA_API__ xfpga_fpgaGetErrorInfo(fpga_token token,
 		return FPGA_INVALID_PARAM;
 	}
 
-	struct error_list *p = _token->errors;
+	struct error_list *p = token_get_errors(_token);
 	while (p) {
 		if (i == error_num) {
 			memcpy_s(error_info, sizeof(struct fpga_error_info), &p->info, sizeof(struct fpga_error_info));
@@ -324,6 +422,7 @@ build_error_list(const char *path, struct error_list **list)
 			break;
 		}
 		new_entry->next = NULL;
+		new_entry->fd = -1;
 		// Errors can be cleared:
 		//   * if the name is "errors" and there is a file called "clear" (generic case), OR
 		//   * if the name is in the "errors_clearable" table
@@ -397,6 +496,17 @@ build_error_list(const char *path, struct error_list **list)
 }
 
 
+void free_error_list(struct error_list *list)
+{
+	while (list) {
+		struct error_list *q = list->next;
+		if (list->fd >= 0)
+			close(list->fd);
+		free(list);
+		list = q;
+	}
+}
+
 uint32_t count_error_files(const char *path)
 {
 	return build_error_list(path, NULL);
@@ -40,10 +40,12 @@ struct error_list {
 	struct error_list *next;
 	char error_file[SYSFS_PATH_MAX];
 	char clear_file[SYSFS_PATH_MAX];
+	int fd; // error_file, opened on first use by fpgaReadAllErrors()
 };
 
 uint32_t count_error_files(const char *path);
 uint32_t build_error_list(const char *path, struct error_list **list);
+void free_error_list(struct error_list *list);
 
 #ifdef __cplusplus
 } // extern "C"
@@ -40,6 +40,13 @@
 #include <sys/mman.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_WIDE_STORES 1
+#endif
 
 /* Port UAFU */
 #define AFU_PERMISSION (FPGA_REGION_READ | FPGA_REGION_WRITE | FPGA_REGION_MMAP)
@@ -319,6 +326,145 @@ out_unlock:
 	return result;
 }
 
+/*
+ * Wide MMIO stores. CCI-P only accepts 4-, 8- and 64-byte MMIO writes, so
+ * a block is written with 512-bit stores where the CPU supports them and
+ * the destination is 64-byte aligned, and with 64-bit stores otherwise.
+ * A wide store to uncached memory may be split, and its pieces may reach
+ * the device in any order.
+ */
+struct mmio_store_ops {
+	size_t width; /* widest single store, in bytes */
+	void (*store512)(volatile uint8_t *dst, const uint8_t *src);
+};
+
+#ifdef HAVE_WIDE_STORES
+__attribute__((target("avx512f")))
+static void mmio_store512_avx512(volatile uint8_t *dst, const uint8_t *src)
+{
+	_mm512_store_si512((void *)dst, _mm512_loadu_si512((const void *)src));
+}
+#endif // HAVE_WIDE_STORES
+
+STATIC struct mmio_store_ops mmio_ops = {
+	.width = sizeof(uint64_t),
+	.store512 = NULL
+};
+static pthread_once_t mmio_ops_once = PTHREAD_ONCE_INIT;
+
+static void mmio_select_ops(void)
+{
+#ifdef HAVE_WIDE_STORES
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f")) {
+		mmio_ops.store512 = mmio_store512_avx512;
+		mmio_ops.width = 64;
+	}
+#endif // HAVE_WIDE_STORES
+}
+
+/*
+ * Copy len bytes (a multiple of 8) to MMIO, using a 512-bit store for each
+ * aligned 64-byte chunk when possible, then drain the stores. The order in
+ * which the bytes reach the device is not defined.
+ */
+STATIC void mmio_copy(volatile uint8_t *dst, const uint8_t *src, size_t len)
+{
+	uint64_t value;
+	size_t n;
+
+	pthread_once(&mmio_ops_once, mmio_select_ops);
+
+	while (len) {
+		uintptr_t addr = (uintptr_t)dst;
+
+		if (mmio_ops.width >= 64 && len >= 64 && !(addr & 63)) {
+			mmio_ops.store512(dst, src);
+			n = 64;
+		} else {
+			memcpy(&value, src, sizeof(value));
+			*((volatile uint64_t *)dst) = value;
+			n = sizeof(uint64_t);
+		}
+
+		dst += n;
+		src += n;
+		len -= n;
+	}
+
+#ifdef HAVE_WIDE_STORES
+	_mm_sfence();
+#else
+	__sync_synchronize();
+#endif // HAVE_WIDE_STORES
+}
+
+STATIC fpga_result write_mmio_block(fpga_handle handle, uint32_t mmio_num,
+				    uint64_t offset, const void *src,
+				    size_t len)
+{
+	int err;
+	struct _fpga_handle *_handle = (struct _fpga_handle *) handle;
+	struct wsid_map *wm = NULL;
+	fpga_result result = FPGA_OK;
+
+	if (!src) {
+		FPGA_MSG("src is NULL");
+		return FPGA_INVALID_PARAM;
+	}
+
+	if (offset % sizeof(uint64_t) != 0 || len % sizeof(uint64_t) != 0) {
+		FPGA_MSG("Misaligned MMIO access");
+		return FPGA_INVALID_PARAM;
+	}
+
+	result = handle_check_and_lock(_handle);
+	if (result)
+		return result;
+
+	result = find_or_map_wm(handle, mmio_num, &wm);
+	if (result)
+		goto out_unlock;
+
+	if (len > wm->len || offset > wm->len - len) {
+		FPGA_MSG("offset out of bounds");
+		result = FPGA_INVALID_PARAM;
+		goto out_unlock;
+	}
+
+	mmio_copy((volatile uint8_t *)wm->offset + offset,
+		  (const uint8_t *)src, len);
+
+out_unlock:
+	err = pthread_mutex_unlock(&_handle->lock);
+	if (err) {
+		FPGA_ERR("pthread_mutex_unlock() failed: %s", strerror(err));
+	}
+	return result;
+}
+
+fpga_result __FPGA_API__ xfpga_fpgaWriteMMIO512(fpga_handle handle,
+					  uint32_t mmio_num,
+					  uint64_t offset,
+					  const void *value)
+{
+	if (offset % 64 != 0) {
+		FPGA_MSG("Misaligned MMIO access");
+		return FPGA_INVALID_PARAM;
+	}
+
+	return write_mmio_block(handle, mmio_num, offset, value, 64);
+}
+
+fpga_result __FPGA_API__ xfpga_fpgaWriteMMIOBlock(fpga_handle handle,
+					    uint32_t mmio_num,
+					    uint64_t offset,
+					    const void *src,
+					    size_t len)
+{
+	return write_mmio_block(handle, mmio_num, offset, src, len);
+}
+
 fpga_result __FPGA_API__ xfpga_fpgaMapMMIO(fpga_handle handle,
 				     uint32_t mmio_num,
 				     uint64_t **mmio_ptr)
@@ -32,6 +32,7 @@
 #include <opae/access.h>
 #include <opae/utils.h>
 #include "types_int.h"
+#include "sysfs_int.h"
 
 #include <string.h>
 #include <stdio.h>
@@ -120,6 +121,12 @@ xfpga_fpgaOpen(fpga_token token, fpga_handle *handle, int flags)
 	// Save the file descriptor for close.
 	_handle->fddev = fddev;
 
+	// Resolve the FME's port device once, so that partial
+	// reconfiguration can probe it without enumerating.
+	if (strstr(_token->sysfspath, FPGA_SYSFS_FME) &&
+	    get_port_devpath(_handle, _handle->port_devpath) != FPGA_OK)
+		_handle->port_devpath[0] = '\0';
+
 	if (pthread_mutexattr_init(&mattr)) {
 		FPGA_MSG("Failed to init handle mutex attributes");
 		result = FPGA_EXCEPTION;
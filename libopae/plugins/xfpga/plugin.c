@@ -92,6 +92,10 @@ int __FPGA_API__ opae_plugin_configure(opae_api_adapter_table *adapter,
 		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaWriteMMIO32");
 	adapter->fpgaReadMMIO32 =
 		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaReadMMIO32");
+	adapter->fpgaWriteMMIO512 =
+		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaWriteMMIO512");
+	adapter->fpgaWriteMMIOBlock =
+		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaWriteMMIOBlock");
 	adapter->fpgaMapMMIO =
 		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaMapMMIO");
 	adapter->fpgaUnmapMMIO =
@@ -110,6 +114,8 @@ int __FPGA_API__ opae_plugin_configure(opae_api_adapter_table *adapter,
 		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaTriggerUmsg");
 	adapter->fpgaGetUmsgPtr =
 		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaGetUmsgPtr");
+	adapter->fpgaGetUmsgDoorbell =
+		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaGetUmsgDoorbell");
 	adapter->fpgaPrepareBuffer =
 		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaPrepareBuffer");
 	adapter->fpgaReleaseBuffer =
@@ -126,6 +132,8 @@ int __FPGA_API__ opae_plugin_configure(opae_api_adapter_table *adapter,
 	*/
 	adapter->fpgaReadError =
 		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaReadError");
+	adapter->fpgaReadAllErrors =
+		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaReadAllErrors");
 	adapter->fpgaClearError =
 		dlsym(adapter->plugin.dl_handle, "xfpga_fpgaClearError");
 	adapter->fpgaClearAllErrors =
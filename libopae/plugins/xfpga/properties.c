@@ -36,6 +36,7 @@
 #include "common_int.h"
 #include "props.h"
 #include "error_int.h"
+#include "token_list_int.h"
 
 
 fpga_result __FPGA_API__
@@ -85,45 +86,29 @@ out_free:
 	return result;
 }
 
-fpga_result __FPGA_API__ xfpga_fpgaUpdateProperties(fpga_token token,
-						    fpga_properties prop)
+/*
+ * Read the properties of a token from sysfs: everything except the
+ * parent and, for accelerators, the state, which can change whenever
+ * the port is opened.
+ */
+STATIC fpga_result read_properties(struct _fpga_token *_token,
+				   struct _fpga_properties *_iprop)
 {
-	struct _fpga_token *_token = (struct _fpga_token *)token;
-	struct _fpga_properties *_prop = (struct _fpga_properties *)prop;
-
-	struct _fpga_properties _iprop;
-
 	char spath[SYSFS_PATH_MAX];
 	char idpath[SYSFS_PATH_MAX];
 	char *p;
 	int s, b, d, f;
-	int res;
 	errno_t e;
-	int err = 0;
 	int resval = 0;
 	uint64_t value = 0;
 	uint32_t x = 0;
 	enum fpga_hw_type hw_type = FPGA_HW_UNKNOWN;
 
-	pthread_mutex_t lock;
-
 	fpga_result result = FPGA_INVALID_PARAM;
 
-	ASSERT_NOT_NULL(token);
-	if (_token->magic != FPGA_TOKEN_MAGIC) {
-		FPGA_MSG("Invalid token");
-		return FPGA_INVALID_PARAM;
-	}
-
-	ASSERT_NOT_NULL(_prop);
-	if (_prop->magic != FPGA_PROPERTY_MAGIC) {
-		FPGA_MSG("Invalid properties object");
-		return FPGA_INVALID_PARAM;
-	}
-
 	// clear fpga_properties buffer
-	memset_s(&_iprop, sizeof(struct _fpga_properties), 0);
-	_iprop.magic = FPGA_PROPERTY_MAGIC;
+	memset_s(_iprop, sizeof(struct _fpga_properties), 0);
+	_iprop->magic = FPGA_PROPERTY_MAGIC;
 
 	// read the vendor and device ID from the 'device' path
 	snprintf_s_s(idpath, SYSFS_PATH_MAX, "%s/../device/vendor",
@@ -132,8 +117,8 @@ fpga_result __FPGA_API__ xfpga_fpgaUpdateProperties(fpga_token token,
 	result = sysfs_read_u32(idpath, &x);
 	if (result != FPGA_OK)
 		return result;
-	_iprop.vendor_id = (uint16_t)x;
-	SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_VENDORID);
+	_iprop->vendor_id = (uint16_t)x;
+	SET_FIELD_VALID(_iprop, FPGA_PROPERTY_VENDORID);
 
 	snprintf_s_s(idpath, SYSFS_PATH_MAX, "%s/../device/device",
 		     _token->sysfspath);
@@ -141,10 +126,10 @@ fpga_result __FPGA_API__ xfpga_fpgaUpdateProperties(fpga_token token,
 	result = sysfs_read_u32(idpath, &x);
 	if (result != FPGA_OK)
 		return result;
-	_iprop.device_id = (uint16_t)x;
-	SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_DEVICEID);
+	_iprop->device_id = (uint16_t)x;
+	SET_FIELD_VALID(_iprop, FPGA_PROPERTY_DEVICEID);
 
-	hw_type = opae_id_to_hw_type(_iprop.vendor_id, _iprop.device_id);
+	hw_type = opae_id_to_hw_type(_iprop->vendor_id, _iprop->device_id);
 
 	// The input token is either for an FME or an AFU.
 	// Go one level back to get to the dev.
@@ -165,94 +150,80 @@ fpga_result __FPGA_API__ xfpga_fpgaUpdateProperties(fpga_token token,
 	if (NULL != p) {
 		// AFU
 		result = sysfs_get_guid(_token, FPGA_SYSFS_AFU_GUID,
-			 _iprop.guid);
+			 _iprop->guid);
 		if (FPGA_OK != result)
 			return result;
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_GUID);
-
-		_iprop.parent = (fpga_token)token_get_parent(_token);
-		if (NULL != _iprop.parent)
-			SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_PARENT);
-
-		_iprop.objtype = FPGA_ACCELERATOR;
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_OBJTYPE);
+		SET_FIELD_VALID(_iprop, FPGA_PROPERTY_GUID);
 
-		res = open(_token->devpath, O_RDWR);
-		if (-1 == res) {
-			_iprop.u.accelerator.state = FPGA_ACCELERATOR_ASSIGNED;
-		} else {
-			close(res);
-			_iprop.u.accelerator.state =
-				FPGA_ACCELERATOR_UNASSIGNED;
-		}
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_ACCELERATOR_STATE);
+		_iprop->objtype = FPGA_ACCELERATOR;
+		SET_FIELD_VALID(_iprop, FPGA_PROPERTY_OBJTYPE);
 
-		_iprop.u.accelerator.num_mmio = 2;
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_NUM_MMIO);
+		_iprop->u.accelerator.num_mmio = 2;
+		SET_FIELD_VALID(_iprop, FPGA_PROPERTY_NUM_MMIO);
 
-		_iprop.u.accelerator.num_interrupts = 0;
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_NUM_INTERRUPTS);
+		_iprop->u.accelerator.num_interrupts = 0;
+		SET_FIELD_VALID(_iprop, FPGA_PROPERTY_NUM_INTERRUPTS);
 	}
 
 	p = strstr(_token->sysfspath, FPGA_SYSFS_FME);
 	if (NULL != p) {
 		// FME
-		_iprop.objtype = FPGA_DEVICE;
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_OBJTYPE);
+		_iprop->objtype = FPGA_DEVICE;
+		SET_FIELD_VALID(_iprop, FPGA_PROPERTY_OBJTYPE);
 		// get bitstream id
-		result = sysfs_get_interface_id(_token, _iprop.guid);
+		result = sysfs_get_interface_id(_token, _iprop->guid);
 		if (FPGA_OK != result)
 			return result;
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_GUID);
+		SET_FIELD_VALID(_iprop, FPGA_PROPERTY_GUID);
 
 		resval = sysfs_parse_attribute64(_token->sysfspath,
 			FPGA_SYSFS_NUM_SLOTS, &value);
 		if (resval != 0) {
 			return FPGA_NOT_FOUND;
 		}
-		_iprop.u.fpga.num_slots = (uint32_t)value;
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_NUM_SLOTS);
+		_iprop->u.fpga.num_slots = (uint32_t)value;
+		SET_FIELD_VALID(_iprop, FPGA_PROPERTY_NUM_SLOTS);
 
 		resval = sysfs_parse_attribute64(_token->sysfspath,
-			FPGA_SYSFS_BITSTREAM_ID, &_iprop.u.fpga.bbs_id);
+			FPGA_SYSFS_BITSTREAM_ID, &_iprop->u.fpga.bbs_id);
 		if (resval != 0) {
 			return FPGA_NOT_FOUND;
 		}
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_BBSID);
+		SET_FIELD_VALID(_iprop, FPGA_PROPERTY_BBSID);
 
 		if (hw_type == FPGA_HW_MCP) {
-			_iprop.u.fpga.bbs_version.major =
-				MCP_FPGA_BBS_VER_MAJOR(_iprop.u.fpga.bbs_id);
-			_iprop.u.fpga.bbs_version.minor =
-				MCP_FPGA_BBS_VER_MINOR(_iprop.u.fpga.bbs_id);
-			_iprop.u.fpga.bbs_version.patch =
-				MCP_FPGA_BBS_VER_PATCH(_iprop.u.fpga.bbs_id);
+			_iprop->u.fpga.bbs_version.major =
+				MCP_FPGA_BBS_VER_MAJOR(_iprop->u.fpga.bbs_id);
+			_iprop->u.fpga.bbs_version.minor =
+				MCP_FPGA_BBS_VER_MINOR(_iprop->u.fpga.bbs_id);
+			_iprop->u.fpga.bbs_version.patch =
+				MCP_FPGA_BBS_VER_PATCH(_iprop->u.fpga.bbs_id);
 		} else {
-			_iprop.u.fpga.bbs_version.major =
-				DCP_FPGA_BBS_VER_MAJOR(_iprop.u.fpga.bbs_id);
-			_iprop.u.fpga.bbs_version.minor =
-				DCP_FPGA_BBS_VER_MINOR(_iprop.u.fpga.bbs_id);
-			_iprop.u.fpga.bbs_version.patch =
-				DCP_FPGA_BBS_VER_PATCH(_iprop.u.fpga.bbs_id);
+			_iprop->u.fpga.bbs_version.major =
+				DCP_FPGA_BBS_VER_MAJOR(_iprop->u.fpga.bbs_id);
+			_iprop->u.fpga.bbs_version.minor =
+				DCP_FPGA_BBS_VER_MINOR(_iprop->u.fpga.bbs_id);
+			_iprop->u.fpga.bbs_version.patch =
+				DCP_FPGA_BBS_VER_PATCH(_iprop->u.fpga.bbs_id);
 		}
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_BBSVERSION);
+		SET_FIELD_VALID(_iprop, FPGA_PROPERTY_BBSVERSION);
 	}
 
 	result = sysfs_sbdf_from_path(spath, &s, &b, &d, &f);
 	if (result)
 		return result;
 
-	_iprop.segment = (uint16_t)s;
-	SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_SEGMENT);
+	_iprop->segment = (uint16_t)s;
+	SET_FIELD_VALID(_iprop, FPGA_PROPERTY_SEGMENT);
 
-	_iprop.bus = (uint8_t)b;
-	SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_BUS);
+	_iprop->bus = (uint8_t)b;
+	SET_FIELD_VALID(_iprop, FPGA_PROPERTY_BUS);
 
-	_iprop.device = (uint8_t)d;
-	SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_DEVICE);
+	_iprop->device = (uint8_t)d;
+	SET_FIELD_VALID(_iprop, FPGA_PROPERTY_DEVICE);
 
-	_iprop.function = (uint8_t)f;
-	SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_FUNCTION);
+	_iprop->function = (uint8_t)f;
+	SET_FIELD_VALID(_iprop, FPGA_PROPERTY_FUNCTION);
 
 	// only set socket id if we have it on sysfs
 	result = sysfs_get_fme_path(_token->device_instance,
@@ -264,18 +235,95 @@ fpga_result __FPGA_API__ xfpga_fpgaUpdateProperties(fpga_token token,
 		FPGA_SYSFS_SOCKET_ID, &value);
 
 	if (0 == resval) {
-		_iprop.socket_id = (uint8_t)value;
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_SOCKETID);
+		_iprop->socket_id = (uint8_t)value;
+		SET_FIELD_VALID(_iprop, FPGA_PROPERTY_SOCKETID);
 	}
 
-	result = sysfs_objectid_from_path(_token->sysfspath, &_iprop.object_id);
+	result = sysfs_objectid_from_path(_token->sysfspath, &_iprop->object_id);
 	if (0 == result)
-		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_OBJECTID);
+		SET_FIELD_VALID(_iprop, FPGA_PROPERTY_OBJECTID);
 
 	char errpath[SYSFS_PATH_MAX];
 	snprintf_s_s(errpath, SYSFS_PATH_MAX, "%s/errors", _token->sysfspath);
-	_iprop.num_errors = count_error_files(errpath);
-	SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_NUM_ERRORS);
+	_iprop->num_errors = count_error_files(errpath);
+	SET_FIELD_VALID(_iprop, FPGA_PROPERTY_NUM_ERRORS);
+
+	return FPGA_OK;
+}
+
+fpga_result __FPGA_API__ xfpga_fpgaUpdateProperties(fpga_token token,
+						    fpga_properties prop)
+{
+	struct _fpga_token *_token = (struct _fpga_token *)token;
+	struct _fpga_properties *_prop = (struct _fpga_properties *)prop;
+
+	struct _fpga_properties _iprop;
+
+	int res;
+	int err = 0;
+	bool cached;
+
+	pthread_mutex_t lock;
+
+	fpga_result result = FPGA_INVALID_PARAM;
+
+	ASSERT_NOT_NULL(token);
+	if (_token->magic != FPGA_TOKEN_MAGIC) {
+		FPGA_MSG("Invalid token");
+		return FPGA_INVALID_PARAM;
+	}
+
+	ASSERT_NOT_NULL(_prop);
+	if (_prop->magic != FPGA_PROPERTY_MAGIC) {
+		FPGA_MSG("Invalid properties object");
+		return FPGA_INVALID_PARAM;
+	}
+
+	// Most sysfs reads only change with a device event, so they are
+	// done once per token and cached in the token list after that.
+	// Enumeration drops the cache.
+	cached = token_get_cached_props(_token, &_iprop) == FPGA_OK;
+	if (!cached) {
+		result = read_properties(_token, &_iprop);
+		if (result != FPGA_OK)
+			return result;
+	}
+
+	if (_iprop.objtype == FPGA_ACCELERATOR && cached) {
+		// Another process may have reprogrammed the slot since the
+		// cache entry was made, so the AFU GUID is always read again.
+		result = sysfs_get_guid(_token, FPGA_SYSFS_AFU_GUID,
+					_iprop.guid);
+		if (result != FPGA_OK)
+			return result;
+	}
+
+	if (_iprop.objtype == FPGA_ACCELERATOR) {
+		// The parent may not have been in the token list yet when
+		// the cache entry was made.
+		if (!FIELD_VALID(&_iprop, FPGA_PROPERTY_PARENT)) {
+			_iprop.parent = (fpga_token)token_get_parent(_token);
+			if (NULL != _iprop.parent) {
+				SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_PARENT);
+				cached = false;
+			}
+		}
+	}
+
+	if (!cached)
+		token_set_cached_props(_token, &_iprop);
+
+	if (_iprop.objtype == FPGA_ACCELERATOR) {
+		res = open(_token->devpath, O_RDWR);
+		if (-1 == res) {
+			_iprop.u.accelerator.state = FPGA_ACCELERATOR_ASSIGNED;
+		} else {
+			close(res);
+			_iprop.u.accelerator.state =
+				FPGA_ACCELERATOR_UNASSIGNED;
+		}
+		SET_FIELD_VALID(&_iprop, FPGA_PROPERTY_ACCELERATOR_STATE);
+	}
 
 	if (pthread_mutex_lock(&_prop->lock)) {
 		FPGA_MSG("Failed to lock properties mutex");
@@ -32,7 +32,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <pthread.h>
 #include <sys/types.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <unistd.h>
 
 #include "safe_string/safe_string.h"
 
@@ -116,16 +120,92 @@ STATIC fpga_result validate_bitstream(fpga_handle handle,
 	}
 }
 
+// Validated GBS metadata, keyed by the exact bytes of the GBS header.
+#define RECONF_METADATA_CACHE_SIZE 8
+
+struct reconf_metadata_entry {
+	uint8_t *header;
+	int header_len;
+	struct gbs_metadata metadata;
+};
+
+STATIC struct reconf_metadata_entry
+	reconf_metadata_cache[RECONF_METADATA_CACHE_SIZE];
+STATIC unsigned reconf_metadata_next;
+STATIC pthread_mutex_t reconf_metadata_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// look up the metadata of a bitstream whose header was validated before
+STATIC bool lookup_gbs_metadata(const uint8_t *bitstream, size_t bitstream_len,
+				int *header_len, struct gbs_metadata *metadata)
+{
+	struct reconf_metadata_entry *e;
+	bool found = false;
+	int len;
+	unsigned i;
+
+	if (check_bitstream_guid(bitstream) != FPGA_OK)
+		return false;
+
+	len = get_bitstream_header_len(bitstream);
+	if (len < 0 || (size_t)len > bitstream_len)
+		return false;
+
+	if (pthread_mutex_lock(&reconf_metadata_lock))
+		return false;
+
+	for (i = 0 ; i < RECONF_METADATA_CACHE_SIZE ; ++i) {
+		e = &reconf_metadata_cache[i];
+		if (e->header && e->header_len == len &&
+		    !memcmp(e->header, bitstream, len)) {
+			*header_len = len;
+			*metadata = e->metadata;
+			found = true;
+			break;
+		}
+	}
+
+	pthread_mutex_unlock(&reconf_metadata_lock);
+	return found;
+}
+
+// remember the metadata of a bitstream that passed validation
+STATIC void cache_gbs_metadata(const uint8_t *bitstream, int header_len,
+			       const struct gbs_metadata *metadata)
+{
+	struct reconf_metadata_entry *e;
+	uint8_t *header;
+
+	header = (uint8_t *)malloc(header_len);
+	if (!header)
+		return;
+
+	if (memcpy_s(header, header_len, bitstream, header_len) != EOK) {
+		free(header);
+		return;
+	}
+
+	if (pthread_mutex_lock(&reconf_metadata_lock)) {
+		free(header);
+		return;
+	}
+
+	e = &reconf_metadata_cache[reconf_metadata_next];
+	reconf_metadata_next =
+		(reconf_metadata_next + 1) % RECONF_METADATA_CACHE_SIZE;
+
+	free(e->header);
+	e->header = header;
+	e->header_len = header_len;
+	e->metadata = *metadata;
+
+	pthread_mutex_unlock(&reconf_metadata_lock);
+}
 
 // open child accelerator exclusively - it not, it's busy!
-STATIC fpga_result open_accel(fpga_handle handle, fpga_handle *accel)
+STATIC fpga_result open_accel(fpga_handle handle, int *accel_fd)
 {
-	fpga_result result                = FPGA_OK;
-	fpga_result destroy_result        = FPGA_OK;
 	struct _fpga_handle *_handle      = (struct _fpga_handle *)handle;
-	fpga_token token = NULL;
-	fpga_properties props;
-	uint32_t matches = 0;
+	int fd;
 
 	if (_handle == NULL) {
 		FPGA_ERR("Invalid handle");
@@ -137,49 +217,25 @@ STATIC fpga_result open_accel(fpga_handle handle, fpga_handle *accel)
 		return FPGA_INVALID_PARAM;
 	}
 
-	result = xfpga_fpgaGetProperties(NULL, &props);
-	if (result != FPGA_OK)
-		return result;
-
-	result = fpgaPropertiesSetParent(props, _handle->token);
-	if (result != FPGA_OK) {
-		FPGA_ERR("Error setting parent in properties.");
-		goto free_props;
-	}
-
-	// TODO: Use slot number as part of filter
-	//       We only want to query for accelerators for the
-	//       slot being reconfigured
-	result = xfpga_fpgaEnumerate(&props, 1, &token, 1, &matches);
-	if (result != FPGA_OK) {
-		FPGA_ERR("Error enumerating for accelerator to reconfigure");
-		goto free_props;
+	if (accel_fd == NULL) {
+		FPGA_ERR("Invalid output pointer");
+		return FPGA_INVALID_PARAM;
 	}
 
-	if (matches == 0) {
+	// The port device was resolved when the FME was opened.
+	if (!_handle->port_devpath[0]) {
 		FPGA_ERR("No accelerator found to reconfigure");
-		result = FPGA_BUSY;
-		goto destroy_token;
+		return FPGA_BUSY;
 	}
 
-	result = xfpga_fpgaOpen(token, accel, 0);
-	if (result != FPGA_OK) {
-		FPGA_ERR("Could not open accelerator for given slot");
-		goto destroy_token;
+	fd = open(_handle->port_devpath, O_RDWR | O_EXCL);
+	if (fd < 0) {
+		FPGA_ERR("Could not open accelerator for given slot: %s",
+			 strerror(errno));
+		return FPGA_BUSY;
 	}
 
-destroy_token:
-	destroy_result = xfpga_fpgaDestroyToken(&token);
-	if (destroy_result != FPGA_OK)
-		FPGA_ERR("Error destroying a token");
-
-free_props:
-	destroy_result = fpgaDestroyProperties(&props);
-	if (destroy_result != FPGA_OK)
-		FPGA_ERR("Error destroying properties");
-
-	if (result != FPGA_OK || destroy_result != FPGA_OK)
-		return result != FPGA_OK ? result : destroy_result;
+	*accel_fd = fd;
 
 	return FPGA_OK;
 }
@@ -318,7 +374,8 @@ fpga_result __FPGA_API__ xfpga_fpgaReconfigureSlot(fpga_handle fpga,
 	struct gbs_metadata  metadata;
 	int bitstream_header_len        = 0;
 	int err                         = 0;
-	fpga_handle accel               = NULL;
+	int accel_fd                    = -1;
+	bool cached                     = false;
 
 	result = handle_check_and_lock(_handle);
 	if (result)
@@ -330,7 +387,19 @@ fpga_result __FPGA_API__ xfpga_fpgaReconfigureSlot(fpga_handle fpga,
 		goto out_unlock;
 	}
 
-	if (validate_bitstream(fpga, bitstream, bitstream_len,
+	// A bitstream seen before only needs its interface id re-checked.
+	if (bitstream && bitstream_len > sizeof(struct bitstream_header))
+		cached = lookup_gbs_metadata(bitstream, bitstream_len,
+					     &bitstream_header_len, &metadata);
+
+	if (cached) {
+		if (check_gbs_metadata_interface_id(fpga, &metadata) !=
+		    FPGA_OK) {
+			FPGA_MSG("Invalid bitstream");
+			result = FPGA_INVALID_PARAM;
+			goto out_unlock;
+		}
+	} else if (validate_bitstream(fpga, bitstream, bitstream_len,
 				&bitstream_header_len) != FPGA_OK) {
 		FPGA_MSG("Invalid bitstream");
 		result = FPGA_INVALID_PARAM;
@@ -340,7 +409,7 @@ fpga_result __FPGA_API__ xfpga_fpgaReconfigureSlot(fpga_handle fpga,
 	// error out if "force" flag is NOT indicated
 	// and the resource is in use
 	if (!(flags & FPGA_RECONF_FORCE)) {
-		result = open_accel(fpga, &accel);
+		result = open_accel(fpga, &accel_fd);
 		if (result != FPGA_OK) {
 			FPGA_ERR("Accelerator in use or not found");
 			goto out_unlock;
@@ -357,11 +426,15 @@ fpga_result __FPGA_API__ xfpga_fpgaReconfigureSlot(fpga_handle fpga,
 		enum fpga_hw_type hw_type = FPGA_HW_UNKNOWN;
 
 		// Read GBS json metadata
-		memset_s(&metadata, sizeof(metadata), 0);
-		result = read_gbs_metadata(bitstream, &metadata);
-		if (result != FPGA_OK) {
-			FPGA_ERR("Failed to read metadata");
-			goto out_unlock;
+		if (!cached) {
+			memset_s(&metadata, sizeof(metadata), 0);
+			result = read_gbs_metadata(bitstream, &metadata);
+			if (result != FPGA_OK) {
+				FPGA_ERR("Failed to read metadata");
+				goto out_unlock;
+			}
+			cache_gbs_metadata(bitstream, bitstream_header_len,
+					   &metadata);
 		}
 
 		FPGA_DBG(" Version                  :%f\n", metadata.version);
@@ -414,6 +487,12 @@ fpga_result __FPGA_API__ xfpga_fpgaReconfigureSlot(fpga_handle fpga,
 	result = opae_fme_port_pr(
 		_handle->fddev, 0, slot, bitstream_len - bitstream_header_len,
 		(uint64_t)bitstream + bitstream_header_len, &error.csr);
+
+	// PR may re-create the region and AFU sysfs entries, so forget any
+	// paths that were resolved below them and the AFU properties.
+	opae_glob_cache_invalidate();
+	token_invalidate_props();
+
 	if (result != 0) {
 		FPGA_ERR("Failed to reconfigure bitstream: %s",
 			  strerror(errno));
@@ -462,7 +541,7 @@ fpga_result __FPGA_API__ xfpga_fpgaReconfigureSlot(fpga_handle fpga,
 
 out_unlock:
 	// close the accelerator opened during `open_accel`
-	if (accel && xfpga_fpgaClose(accel) != FPGA_OK) {
+	if (accel_fd >= 0 && close(accel_fd)) {
 		FPGA_ERR("Error closing accelerator after reconfiguration");
 		result = FPGA_RECONF_ERROR;
 	}
@@ -420,6 +420,8 @@ int sysfs_initialize(void)
 	}
 
 	_sysfs_device_count = 0;
+	opae_glob_cache_invalidate();
+	token_invalidate_props();
 
 	if (SYSFS_FORMAT(sysfs_device_fmt)) {
 
@@ -505,6 +507,8 @@ int sysfs_finalize(void)
 	}
 	_sysfs_device_count = 0;
 	_sysfs_format_ptr = NULL;
+	opae_glob_cache_invalidate();
+	token_invalidate_props();
 	if (opae_mutex_unlock(res, &_sysfs_device_lock)) {
 		FPGA_ERR("Error unlocking mutex");
 		return FPGA_EXCEPTION;
@@ -1185,6 +1189,37 @@ fpga_result get_port_sysfs(fpga_handle handle, char *sysfs_port)
 	return FPGA_OK;
 }
 
+fpga_result get_port_devpath(fpga_handle handle, char *devpath)
+{
+	char sysfs_port[SYSFS_PATH_MAX] = {0};
+	fpga_result result              = FPGA_OK;
+	char *p                         = NULL;
+	int len;
+
+	if (devpath == NULL) {
+		FPGA_ERR("Invalid output pointer");
+		return FPGA_INVALID_PARAM;
+	}
+
+	result = get_port_sysfs(handle, sysfs_port);
+	if (result != FPGA_OK)
+		return result;
+
+	p = strrchr(sysfs_port, '/');
+	if (NULL == p) {
+		FPGA_ERR("Invalid port sysfs path");
+		return FPGA_EXCEPTION;
+	}
+
+	len = snprintf_s_s(devpath, DEV_PATH_MAX, FPGA_DEV_PATH "/%s", p + 1);
+	if (len < 0) {
+		FPGA_ERR("Error formatting port device path");
+		return FPGA_EXCEPTION;
+	}
+
+	return FPGA_OK;
+}
+
 enum fpga_hw_type opae_id_to_hw_type(uint16_t vendor_id, uint16_t device_id)
 {
 	enum fpga_hw_type hw_type = FPGA_HW_UNKNOWN;
@@ -1490,7 +1525,7 @@ struct _fpga_object *alloc_fpga_object(const char *sysfspath, const char *name)
 	return obj;
 }
 
-fpga_result opae_glob_path(char *path)
+STATIC fpga_result glob_first(char *path)
 {
 	fpga_result res = FPGA_OK;
 	glob_t pglob;
@@ -1524,6 +1559,146 @@ fpga_result opae_glob_path(char *path)
 	return res;
 }
 
+/*
+ * Cache of glob patterns that have been resolved to a concrete path.
+ * The patterns already carry the token's sysfs path, so keying on the
+ * whole pattern gives each token its own entries. The cache is dropped
+ * on every enumeration, at sysfs init/finalize and after partial
+ * reconfiguration, so it only saves the rescans made between those.
+ */
+#define GLOB_CACHE_BUCKETS 128
+
+struct glob_cache_entry {
+	char *pattern;
+	char *path;
+	struct glob_cache_entry *next;
+};
+
+static struct glob_cache_entry *_glob_cache[GLOB_CACHE_BUCKETS];
+static pthread_mutex_t _glob_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+STATIC uint32_t glob_cache_hash(const char *pattern)
+{
+	/* FNV-1a */
+	uint32_t h = 2166136261u;
+
+	while (*pattern) {
+		h ^= (uint8_t)*pattern++;
+		h *= 16777619u;
+	}
+	return h % GLOB_CACHE_BUCKETS;
+}
+
+STATIC bool glob_cache_lookup(const char *pattern, char *path)
+{
+	struct glob_cache_entry *e;
+	bool found = false;
+	int res = 0;
+
+	if (opae_mutex_lock(res, &_glob_cache_lock))
+		return false;
+
+	for (e = _glob_cache[glob_cache_hash(pattern)]; e; e = e->next) {
+		if (!strcmp(e->pattern, pattern)) {
+			found = !strcpy_s(path, FILENAME_MAX, e->path);
+			break;
+		}
+	}
+
+	opae_mutex_unlock(res, &_glob_cache_lock);
+	return found;
+}
+
+STATIC void glob_cache_store(const char *pattern, const char *path)
+{
+	struct glob_cache_entry *e;
+	uint32_t h = glob_cache_hash(pattern);
+	int res = 0;
+
+	if (opae_mutex_lock(res, &_glob_cache_lock))
+		return;
+
+	for (e = _glob_cache[h]; e; e = e->next) {
+		if (!strcmp(e->pattern, pattern))
+			break;
+	}
+
+	if (e) {
+		char *p = cstr_dup(path);
+
+		if (p) {
+			free(e->path);
+			e->path = p;
+		}
+	} else {
+		e = calloc(1, sizeof(*e));
+		if (e) {
+			e->pattern = cstr_dup(pattern);
+			e->path = cstr_dup(path);
+			if (!e->pattern || !e->path) {
+				free(e->pattern);
+				free(e->path);
+				free(e);
+			} else {
+				e->next = _glob_cache[h];
+				_glob_cache[h] = e;
+			}
+		}
+	}
+
+	opae_mutex_unlock(res, &_glob_cache_lock);
+}
+
+void opae_glob_cache_invalidate(void)
+{
+	struct glob_cache_entry *e;
+	size_t i;
+	int res = 0;
+
+	if (opae_mutex_lock(res, &_glob_cache_lock))
+		return;
+
+	for (i = 0; i < GLOB_CACHE_BUCKETS; ++i) {
+		while ((e = _glob_cache[i])) {
+			_glob_cache[i] = e->next;
+			free(e->pattern);
+			free(e->path);
+			free(e);
+		}
+	}
+
+	opae_mutex_unlock(res, &_glob_cache_lock);
+}
+
+fpga_result opae_glob_path(char *path)
+{
+	char pattern[SYSFS_PATH_MAX];
+	char cached[FILENAME_MAX];
+	fpga_result res;
+
+	// Literal paths need no directory scan, so only patterns are cached.
+	if (!path || !strpbrk(path, "*?[") ||
+	    strcpy_s(pattern, SYSFS_PATH_MAX, path))
+		return glob_first(path);
+
+	if (glob_cache_lookup(pattern, cached)) {
+		// Make sure the device is still there. Globbing the literal
+		// path costs a single stat rather than a scan.
+		if (!glob_first(cached)) {
+			if (strcpy_s(path, FILENAME_MAX, cached)) {
+				FPGA_ERR("Could not copy globbed path");
+				return FPGA_EXCEPTION;
+			}
+			return FPGA_OK;
+		}
+	}
+
+	res = glob_first(path);
+	if (res == FPGA_OK)
+		glob_cache_store(pattern, path);
+	return res;
+}
+
 fpga_result sync_object(fpga_object obj)
 {
 	struct _fpga_object *_obj;
@@ -102,6 +102,11 @@ fpga_result sysfs_get_interface_id(fpga_token token, fpga_guid guid);
  */
 
 fpga_result opae_glob_path(char *path);
+/*
+ * Forget every glob pattern resolved by opae_glob_path, e.g. after the
+ * set of devices, or the sysfs tree below one of them, has changed.
+ */
+void opae_glob_cache_invalidate(void);
 fpga_result sysfs_sbdf_from_path(const char *sysfspath, int *s, int *b, int *d, int *f);
 fpga_result sysfs_read_int(const char *path, int *i);
 fpga_result sysfs_read_u32(const char *path, uint32_t *u);
@@ -116,6 +121,7 @@ fpga_result sysfs_get_pr_id(int dev, int subdev, fpga_guid guid);
 fpga_result sysfs_get_slots(int dev, int subdev, uint32_t *slots);
 fpga_result sysfs_get_bitstream_id(int dev, int subdev, uint64_t *id);
 fpga_result get_port_sysfs(fpga_handle handle, char *sysfs_port);
+fpga_result get_port_devpath(fpga_handle handle, char *devpath);
 enum fpga_hw_type opae_id_to_hw_type(uint16_t vendor_id, uint16_t device_id);
 fpga_result get_fpga_hw_type(fpga_handle handle, enum fpga_hw_type *hw_type);
 fpga_result sysfs_deviceid_from_path(const char *sysfspath,
@@ -24,6 +24,7 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif // HAVE_CONFIG_H
@@ -32,20 +33,71 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <dirent.h>
 
 #include "safe_string/safe_string.h"
 #include "error_int.h"
+#include "props.h"
 
 #include "token_list_int.h"
 
-/* global list of tokens we've seen */
-static struct token_map *token_root;
+/*
+ * Global registry of tokens we've seen, hashed on the device instance.
+ * Entries are matched on (device_instance, subdev_instance) and then on
+ * their paths; since the bucket only depends on the device, an FME and
+ * its ports share a chain, which makes finding a port's parent cheap.
+ *
+ * The registry is read-mostly: entries are only ever pushed onto the
+ * head of a chain (with release semantics) and are not freed until
+ * token_cleanup(), so lookups walk the chains without taking a lock.
+ * Writers serialize on global_lock.
+ */
+#define TOKEN_MAP_BUCKETS 64
+
+static struct token_map *token_table[TOKEN_MAP_BUCKETS];
 /* mutex to protect global data structures */
 extern pthread_mutex_t global_lock;
 
+static inline struct token_map **token_bucket(uint32_t device_instance)
+{
+	return &token_table[device_instance % TOKEN_MAP_BUCKETS];
+}
+
+static inline struct token_map *chain_head(struct token_map **bucket)
+{
+	return __atomic_load_n(bucket, __ATOMIC_ACQUIRE);
+}
+
+STATIC struct token_map *token_lookup(uint32_t device_instance,
+				      uint32_t subdev_instance,
+				      const char *sysfspath,
+				      const char *devpath)
+{
+	struct token_map *itr;
+
+	for (itr = chain_head(token_bucket(device_instance)) ; NULL != itr ;
+	     itr = itr->next) {
+		if (itr->_token.device_instance != device_instance ||
+		    itr->_token.subdev_instance != subdev_instance)
+			continue;
+		if (strncmp(sysfspath, itr->_token.sysfspath, SYSFS_PATH_MAX))
+			continue;
+		if (devpath &&
+		    strncmp(devpath, itr->_token.devpath, DEV_PATH_MAX))
+			continue;
+		return itr;
+	}
+
+	return NULL;
+}
+
+STATIC struct token_map *token_find(const struct _fpga_token *t)
+{
+	return token_lookup(t->device_instance, t->subdev_instance,
+			    t->sysfspath, NULL);
+}
+
 /**
- * @brief Add entry to linked list for tokens
+ * @brief Add entry to the token registry
  *	Will allocate memory (which is freed by token_cleanup())
  *
  * @param sysfspath
@@ -56,6 +108,7 @@ extern pthread_mutex_t global_lock;
 struct _fpga_token *token_add(const char *sysfspath, const char *devpath)
 {
 	struct token_map *tmp;
+	struct token_map **bucket;
 	errno_t e;
 	int err = 0;
 	uint32_t device_instance;
@@ -91,23 +144,26 @@ struct _fpga_token *token_add(const char *sysfspath, const char *devpath)
 		return NULL;
 	}
 
+	/* Devices seen before are found without taking the lock. */
+	tmp = token_lookup(device_instance, subdev_instance,
+			   sysfspath, devpath);
+	if (tmp)
+		return &tmp->_token;
+
 	if (pthread_mutex_lock(&global_lock)) {
 		FPGA_MSG("Failed to lock global mutex");
 		return NULL;
 	}
 
 	/* Prevent duplicate entries. */
-	for (tmp = token_root ; NULL != tmp ; tmp = tmp->next) {
-		if ((0 == strncmp(sysfspath, tmp->_token.sysfspath,
-						SYSFS_PATH_MAX)) &&
-				(0 == strncmp(devpath, tmp->_token.devpath,
-					      DEV_PATH_MAX))) {
-			err = pthread_mutex_unlock(&global_lock);
-			if (err) {
-				FPGA_ERR("pthread_mutex_unlock() failed: %S", strerror(err));
-			}
-			return &tmp->_token;
+	tmp = token_lookup(device_instance, subdev_instance,
+			   sysfspath, devpath);
+	if (tmp) {
+		err = pthread_mutex_unlock(&global_lock);
+		if (err) {
+			FPGA_ERR("pthread_mutex_unlock() failed: %S", strerror(err));
 		}
+		return &tmp->_token;
 	}
 
 	tmp = malloc(sizeof(struct token_map));
@@ -119,12 +175,11 @@ struct _fpga_token *token_add(const char *sysfspath, const char *devpath)
 		return NULL;
 	}
 
+	tmp->props = NULL;
 
-	/* populate error list */
+	/* the error list is built on first use, by token_get_errors() */
 	tmp->_token.errors = NULL;
-	char errpath[SYSFS_PATH_MAX];
-	snprintf_s_s(errpath, SYSFS_PATH_MAX, "%s/errors", sysfspath);
-	build_error_list(errpath, &tmp->_token.errors);
+	tmp->errors_built = false;
 
 	/* mark data structure as valid */
 	tmp->_token.magic = FPGA_TOKEN_MAGIC;
@@ -148,8 +203,10 @@ struct _fpga_token *token_add(const char *sysfspath, const char *devpath)
 		goto out_free;
 	}
 
-	tmp->next = token_root;
-	token_root = tmp;
+	/* publish the fully initialized entry to lock-free readers */
+	bucket = token_bucket(device_instance);
+	tmp->next = *bucket;
+	__atomic_store_n(bucket, tmp, __ATOMIC_RELEASE);
 
 	err = pthread_mutex_unlock(&global_lock);
 	if (err) {
@@ -167,6 +224,16 @@ out_free:
 	return NULL;
 }
 
+/* Is itr the FME in directory dir (which ends in '/')? */
+STATIC bool is_fme_in(struct token_map *itr, const char *dir, size_t len)
+{
+	const char *name = itr->_token.sysfspath + len;
+
+	if (strncmp(itr->_token.sysfspath, dir, len))
+		return false;
+	return !strchr(name, '/') && strstr(name, FPGA_SYSFS_FME);
+}
+
 /**
  * @ brief Find the token that is the parent of _t
  *
@@ -179,18 +246,15 @@ struct _fpga_token *token_get_parent(struct _fpga_token *_t)
 	char *p;
 	char spath[SYSFS_PATH_MAX];
 	struct token_map *itr;
-	int err = 0;
 	errno_t e;
-	DIR *dir;
-	struct dirent *dirent;
-	int i;
-	int found;
+	size_t len;
+	size_t i;
 
 	p = strstr(_t->sysfspath, FPGA_SYSFS_AFU);
 	if (!p) // FME objects have no parent.
 		return NULL;
 
-	// Find the parent FME device of the specified Port device.
+	// The parent is the FME device next to the specified Port device.
 	e = strncpy_s(spath, sizeof(spath),
 			_t->sysfspath, sizeof(_t->sysfspath));
 	if (EOK != e) {
@@ -204,76 +268,75 @@ struct _fpga_token *token_get_parent(struct _fpga_token *_t)
 		return NULL;
 	}
 	*(p+1) = 0;
+	len = strlen(spath);
 
-	dir = opendir(spath);
-	if (!dir) {
-		FPGA_ERR("can't open directory: %s", spath);
-		return NULL;
+	// Usually it is in the same chain as the port...
+	for (itr = chain_head(token_bucket(_t->device_instance)) ;
+	     NULL != itr ; itr = itr->next) {
+		if (is_fme_in(itr, spath, len))
+			return &itr->_token;
 	}
 
-	found = 0;
-	while ((dirent = readdir(dir)) != NULL) {
-		e = strcmp_s(dirent->d_name, sizeof(dirent->d_name),
-				".", &i);
-		if (e != EOK || i == 0)
-			continue;
-		e = strcmp_s(dirent->d_name, sizeof(dirent->d_name),
-				"..", &i);
-		if (e != EOK || i == 0)
-			continue;
-
-		if (strstr(dirent->d_name, FPGA_SYSFS_FME)) {
-			e = strcat_s(spath, sizeof(spath),
-					dirent->d_name);
-			if (e != EOK) {
-				FPGA_ERR("strcat_s failed");
-				closedir(dir);
-				return NULL;
-			}
-			found = 1;
-			break;
+	// ...but the instance numbers come from the sysfs names, and not
+	// every driver numbers an FME like its ports.
+	for (i = 0 ; i < TOKEN_MAP_BUCKETS ; ++i) {
+		for (itr = chain_head(&token_table[i]) ; NULL != itr ;
+		     itr = itr->next) {
+			if (is_fme_in(itr, spath, len))
+				return &itr->_token;
 		}
 	}
 
-	closedir(dir);
+	FPGA_MSG("can't find parent in: %s", spath);
+	return NULL;
+}
+
+struct error_list *token_get_errors(struct _fpga_token *_t)
+{
+	struct token_map *itr;
+	char errpath[SYSFS_PATH_MAX];
+	int err = 0;
 
-	if (!found) {
-		FPGA_ERR("can't find parent in: %s", spath);
+	// Tokens that are not in the registry bring their own list.
+	if (_t->errors)
+		return _t->errors;
+
+	itr = token_find(_t);
+	if (!itr)
 		return NULL;
-	}
+
+	if (__atomic_load_n(&itr->errors_built, __ATOMIC_ACQUIRE))
+		return itr->_token.errors;
 
 	if (pthread_mutex_lock(&global_lock)) {
 		FPGA_MSG("Failed to lock global mutex");
 		return NULL;
 	}
 
-	for (itr = token_root ; NULL != itr ; itr = itr->next) {
-		if (0 == strncmp(spath, itr->_token.sysfspath,
-					SYSFS_PATH_MAX)) {
-			err = pthread_mutex_unlock(&global_lock);
-			if (err) {
-				FPGA_ERR("pthread_mutex_unlock() failed: %S", strerror(err));
-			}
-			return &itr->_token;
-		}
+	if (!itr->errors_built) {
+		snprintf_s_s(errpath, SYSFS_PATH_MAX, "%s/errors",
+			     itr->_token.sysfspath);
+		build_error_list(errpath, &itr->_token.errors);
+		__atomic_store_n(&itr->errors_built, true, __ATOMIC_RELEASE);
 	}
 
 	err = pthread_mutex_unlock(&global_lock);
 	if (err) {
-		FPGA_ERR("pthread_mutex_unlock() failed: %S", strerror(err));
+		FPGA_ERR("pthread_mutex_unlock() failed: %s", strerror(err));
 	}
 
-	return NULL;
+	return itr->_token.errors;
 }
 
 /*
- * Clean up remaining entries in linked list
+ * Clean up remaining entries in the registry
  * Will delete all remaining entries
  */
 void token_cleanup(void)
 {
+	struct token_map *tmp;
+	size_t i;
 	int err = 0;
-	struct error_list *p;
 
 	err = pthread_mutex_lock(&global_lock);
 	if (err) {
@@ -281,41 +344,100 @@ void token_cleanup(void)
 		return;
 	}
 
-	if (!token_root)
-		goto out_unlock;
+	for (i = 0 ; i < TOKEN_MAP_BUCKETS ; ++i) {
+		while (token_table[i]) {
+			tmp = token_table[i];
+			token_table[i] = tmp->next;
 
-	while (token_root->next) {
-		struct token_map *tmp = token_root;
-		token_root = token_root->next;
+			// free error list
+			free_error_list(tmp->_token.errors);
+			free(tmp->props);
 
-		// free error list
-		p = tmp->_token.errors;
-		while (p) {
-			struct error_list *q = p->next;
-			free(p);
-			p = q;
+			// invalidate magic (just in case)
+			tmp->_token.magic = FPGA_INVALID_MAGIC;
+			free(tmp);
 		}
+	}
+
+	err = pthread_mutex_unlock(&global_lock);
+	if (err) {
+		FPGA_ERR("pthread_mutex_unlock() failed: %s", strerror(err));
+	}
+}
+
+fpga_result token_get_cached_props(struct _fpga_token *_t,
+				   struct _fpga_properties *props)
+{
+	struct token_map *itr;
+	fpga_result res = FPGA_NOT_FOUND;
+	int err = 0;
+
+	itr = token_find(_t);
+	if (!itr)
+		return FPGA_NOT_FOUND;
+
+	if (pthread_mutex_lock(&global_lock)) {
+		FPGA_MSG("Failed to lock global mutex");
+		return FPGA_EXCEPTION;
+	}
+
+	if (itr->props) {
+		*props = *itr->props;
+		res = FPGA_OK;
+	}
+
+	err = pthread_mutex_unlock(&global_lock);
+	if (err) {
+		FPGA_ERR("pthread_mutex_unlock() failed: %s", strerror(err));
+	}
 
-		// invalidate magic (just in case)
-		tmp->_token.magic = FPGA_INVALID_MAGIC;
-		free(tmp);
+	return res;
+}
+
+void token_set_cached_props(struct _fpga_token *_t,
+			    const struct _fpga_properties *props)
+{
+	struct token_map *itr;
+	int err = 0;
+
+	itr = token_find(_t);
+	if (!itr)
+		return;
+
+	if (pthread_mutex_lock(&global_lock)) {
+		FPGA_MSG("Failed to lock global mutex");
+		return;
 	}
 
-	// free error list
-	p = token_root->_token.errors;
-	while (p) {
-		struct error_list *q = p->next;
-		free(p);
-		p = q;
+	if (!itr->props)
+		itr->props = malloc(sizeof(struct _fpga_properties));
+	if (itr->props)
+		*itr->props = *props;
+
+	err = pthread_mutex_unlock(&global_lock);
+	if (err) {
+		FPGA_ERR("pthread_mutex_unlock() failed: %s", strerror(err));
 	}
+}
 
-	// invalidate magic (just in case)
-	token_root->_token.magic = FPGA_INVALID_MAGIC;
-	free(token_root);
+void token_invalidate_props(void)
+{
+	struct token_map *itr;
+	size_t i;
+	int err = 0;
 
-	token_root = NULL;
+	if (pthread_mutex_lock(&global_lock)) {
+		FPGA_MSG("Failed to lock global mutex");
+		return;
+	}
+
+	for (i = 0 ; i < TOKEN_MAP_BUCKETS ; ++i) {
+		for (itr = token_table[i] ; NULL != itr ; itr = itr->next) {
+			free(itr->props);
+			itr->props = NULL;
+		}
+	}
 
-out_unlock:
 	err = pthread_mutex_unlock(&global_lock);
 	if (err) {
 		FPGA_ERR("pthread_mutex_unlock() failed: %s", strerror(err));
@@ -37,4 +37,21 @@ struct _fpga_token *token_add(const char *sysfspath, const char *devpath);
 struct _fpga_token *token_get_parent(struct _fpga_token *t);
 void token_cleanup(void);
 
+/*
+ * The error list of a token. Tokens from the registry (and their clones)
+ * get theirs built the first time it is asked for.
+ */
+struct error_list *token_get_errors(struct _fpga_token *t);
+
+/*
+ * Per-token cache of the properties read from sysfs. Only tokens in the
+ * list have one, and it lives until the next device event (e.g. PR) or
+ * until the list is cleaned up.
+ */
+fpga_result token_get_cached_props(struct _fpga_token *t,
+				   struct _fpga_properties *props);
+void token_set_cached_props(struct _fpga_token *t,
+			    const struct _fpga_properties *props);
+void token_invalidate_props(void);
+
 #endif // ___FPGA_TOKEN_LIST_INT_H__
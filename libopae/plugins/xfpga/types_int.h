@@ -167,6 +167,7 @@ struct _fpga_handle {
 	void *umsg_virt;	        // umsg Virtual Memory pointer
 	uint64_t umsg_size;	        // umsg Virtual Memory Size
 	uint64_t *umsg_iova;	        // umsg IOVA from driver
+	char port_devpath[DEV_PATH_MAX]; // port device of an FME handle
 
 	// Metric
 	bool metric_enum_status;                             // metric enum status
@@ -217,6 +218,8 @@ struct wsid_tracker {
  */
 struct token_map {
 	struct _fpga_token _token;
+	struct _fpga_properties *props; // cached by fpgaUpdateProperties
+	bool errors_built;              // _token.errors has been built
 	struct token_map *next;
 };
 
@@ -251,10 +251,14 @@ xfpga_fpgaTriggerUmsg(fpga_handle handle, uint64_t value)
 		goto out_unlock;
 	}
 
-	result = xfpga_fpgaGetUmsgPtr(handle, &umsg_ptr);
-	if (result != FPGA_OK) {
-		OPAE_ERR("Failed to get UMsg buffer");
-		goto out_unlock;
+	if (_handle->umsg_iova != NULL) {
+		umsg_ptr = _handle->umsg_virt;
+	} else {
+		result = xfpga_fpgaGetUmsgPtr(handle, &umsg_ptr);
+		if (result != FPGA_OK) {
+			OPAE_ERR("Failed to get UMsg buffer");
+			goto out_unlock;
+		}
 	}
 
 	// Assign Value to UMsg
@@ -266,3 +270,47 @@ out_unlock:
 		OPAE_ERR("pthread_mutex_unlock() failed: %s", strerror(err));
 	return result;
 }
+
+// Get a doorbell for UMsg slots [first_slot, first_slot + num_slots)
+fpga_result __FPGA_API__
+xfpga_fpgaGetUmsgDoorbell(fpga_handle handle, uint32_t first_slot,
+			  uint32_t num_slots, int flags,
+			  fpga_umsg_doorbell *doorbell)
+{
+	fpga_result result = FPGA_OK;
+	uint64_t num_umsg  = 0;
+	uint64_t *umsg_ptr = NULL;
+	uint64_t stride    = 0;
+
+	if (!doorbell) {
+		OPAE_ERR("doorbell is NULL");
+		return FPGA_INVALID_PARAM;
+	}
+
+	result = xfpga_fpgaGetNumUmsg(handle, &num_umsg);
+	if (result != FPGA_OK)
+		return result;
+
+	if (!num_slots || (uint64_t)first_slot + num_slots > num_umsg) {
+		OPAE_ERR("UMsg slots [%u, %u) exceed the %lu supported by the AFU",
+			 first_slot, first_slot + num_slots,
+			 (unsigned long)num_umsg);
+		return FPGA_INVALID_PARAM;
+	}
+
+	result = xfpga_fpgaGetUmsgPtr(handle, &umsg_ptr);
+	if (result != FPGA_OK)
+		return result;
+
+	// Each UMsg occupies its own page of the buffer set up by
+	// xfpga_fpgaGetUmsgPtr().
+	stride = (uint64_t)sysconf(_SC_PAGESIZE) / sizeof(uint64_t);
+
+	doorbell->base      = umsg_ptr + first_slot * stride;
+	doorbell->stride    = stride;
+	doorbell->num_slots = num_slots;
+	doorbell->flags     = (uint32_t)flags;
+	doorbell->next      = 0;
+
+	return FPGA_OK;
+}
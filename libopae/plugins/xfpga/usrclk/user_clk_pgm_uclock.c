@@ -46,7 +46,6 @@
 
 #include "user_clk_pgm_uclock.h"
 #include "user_clk_pgm_uclock_freq_template.h"
-#include "user_clk_pgm_uclock_freq_template_322.h"
 #include "user_clk_pgm_uclock_eror_messages.h"
 #include "user_clk_iopll_freq.h"
 
@@ -64,6 +63,13 @@
 #define  USRCLK_SLEEEP_1MS           1000000
 #define  USRCLK_SLEEEP_10MS          10000000
 
+// User clock status polling: spin, then back off exponentially
+#define  USRCLK_POLL_SPINS           100
+#define  USRCLK_POLL_SLEEP_MIN       1000
+#define  USRCLK_POLL_SLEEP_MAX       USRCLK_SLEEEP_1MS
+#define  USRCLK_TIMEOUT_100MS        (100 * USRCLK_SLEEEP_1MS)
+#define  USRCLK_TIMEOUT_1000MS       (1000 * USRCLK_SLEEEP_1MS)
+
 struct  QUCPU_Uclock   gQUCPU_Uclock;
 
 static int using_iopll(char* sysfs_usrpath, const char* sysfs_path);
@@ -363,9 +369,7 @@ int fi_AvmmRWcom(int i_CmdWrite,
 	uint64_t u64i_SeqCmdAddrData, u64i_SeqCmdAddrData_seq_2, u64i_SeqCmdAddrData_wrt_1;
 	uint64_t u64i_SeqCmdAddrData_adr_10, u64i_SeqCmdAddrData_dat_32;
 	uint64_t u64i_PrtData;
-	uint64_t u64i_DataX;
-	uint64_t u64i_FastPoll, u64i_SlowPoll;
-	long int li_sleep_nanoseconds;
+	uint64_t u64i_DataX = 0;
 	int      i_ReturnErr;
 	char sysfs_usrpath[SYSFS_PATH_MAX];
 
@@ -402,35 +406,12 @@ int fi_AvmmRWcom(int i_CmdWrite,
 	snprintf_s_ss(sysfs_usrpath, sizeof(sysfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_CMD0);
 	sysfs_write_u64(sysfs_usrpath, u64i_PrtData);
 
-	li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-	fv_SleepShort(li_sleep_nanoseconds);
-
-	snprintf_s_ss(sysfs_usrpath, sizeof(sysfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS0);
-
 	// Poll register 0 for completion.
 	// CCI is synchronous and needs only 1 read with matching sequence.
-
-	for (u64i_SlowPoll = 0; u64i_SlowPoll<100; ++u64i_SlowPoll)  // 100 ms
-	{ // Poll 0, slow outer loop with 1 ms sleep
-		for (u64i_FastPoll = 0; u64i_FastPoll<100; ++u64i_FastPoll)
-		{
-			// Poll 0, fast inner loop with no sleep
-			sysfs_read_u64(sysfs_usrpath, &u64i_DataX);
-
-			if ((u64i_DataX & QUCPU_UI64_STS_0_SEQ_b49t48) == (u64i_SeqCmdAddrData & QUCPU_UI64_STS_0_SEQ_b49t48))
-			{ // Have result
-				goto GOTO_LABEL_HAVE_RESULT;
-			} // Have result
-		} // Poll 0, fast inner loop with no sleep
-
-		// Sleep 1 ms
-		li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-		fv_SleepShort(li_sleep_nanoseconds);
-	} // Poll 0, slow outer loop with 1 ms sleep
-
-	i_ReturnErr = QUCPU_INT_UCLOCK_AVMMRWCOM_ERR_TIMEOUT; // Error
-
-GOTO_LABEL_HAVE_RESULT: // No error
+	if (fi_PollSts0(QUCPU_UI64_STS_0_SEQ_b49t48,
+			u64i_SeqCmdAddrData & QUCPU_UI64_STS_0_SEQ_b49t48,
+			USRCLK_TIMEOUT_100MS, &u64i_DataX))
+		i_ReturnErr = QUCPU_INT_UCLOCK_AVMMRWCOM_ERR_TIMEOUT; // Error
 
 	if (i_CmdWrite == 0) *pu64i_ReadData = u64i_DataX;
 	return(i_ReturnErr);
@@ -497,6 +478,65 @@ void fv_SleepShort(long int li_sleep_nanoseconds)
 	return;
 } // fv_SleepShort
 
+//Poll status register 0 until (status & mask) == value
+int fi_PollSts0(uint64_t u64i_Mask,
+		uint64_t u64i_Value,
+		uint64_t u64i_TimeoutNs,
+		uint64_t *pu64i_Status)
+{
+	// fi_PollSts0
+	// Spin on the status for the common fast completion, then back off
+	// exponentially so that a slow PLL doesn't keep a CPU busy.
+	char sysfs_usrpath[SYSFS_PATH_MAX]    = {0};
+	struct timespec ts                    = {0};
+	uint64_t u64i_Status                  = 0;
+	uint64_t u64i_Now                     = 0;
+	uint64_t u64i_Deadline                = 0;
+	uint64_t u64i_Spin                    = 0;
+	long int li_sleep_nanoseconds         = USRCLK_POLL_SLEEP_MIN;
+
+	snprintf_s_ss(sysfs_usrpath, sizeof(sysfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS0);
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	u64i_Deadline = (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec + u64i_TimeoutNs;
+
+	for (;;)
+	{ // Poll until match or timeout
+		sysfs_read_u64(sysfs_usrpath, &u64i_Status);
+
+		if ((u64i_Status & u64i_Mask) == u64i_Value)
+		{ // Have result
+			*pu64i_Status = u64i_Status;
+			return (0);
+		} // Have result
+
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		u64i_Now = (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+		if (u64i_Now >= u64i_Deadline)
+			break;
+
+		if (u64i_Spin < USRCLK_POLL_SPINS)
+		{ // Tight spin
+			++u64i_Spin;
+#if defined(__x86_64__) || defined(__i386__)
+			__builtin_ia32_pause();
+#endif
+			continue;
+		} // Tight spin
+
+		if ((uint64_t) li_sleep_nanoseconds > u64i_Deadline - u64i_Now)
+			li_sleep_nanoseconds = (long int) (u64i_Deadline - u64i_Now);
+		fv_SleepShort(li_sleep_nanoseconds);
+
+		li_sleep_nanoseconds *= 2;
+		if (li_sleep_nanoseconds > USRCLK_POLL_SLEEP_MAX)
+			li_sleep_nanoseconds = USRCLK_POLL_SLEEP_MAX;
+	} // Poll until match or timeout
+
+	*pu64i_Status = u64i_Status;
+	return (1);
+} // fi_PollSts0
+
 // get user clock
 // Read the frequency for the User clock and div2 clock
 int fi_GetFreqs(QUCPU_tFreqs *ptFreqs_retFreqs)
@@ -533,8 +573,6 @@ int fi_GetFreqs(QUCPU_tFreqs *ptFreqs_retFreqs)
 
 		ptFreqs_retFreqs->u64i_Frq_DivBy2 = (u64i_PrtData & QUCPU_UI64_STS_1_FRQ_b16t00) * 10000; // Hz
 		//printf(" ptFreqs_retFreqs->u64i_Frq_ClkUsr %llx \n", ptFreqs_retFreqs->u64i_Frq_DivBy2);
-		li_sleep_nanoseconds = USRCLK_SLEEEP_10MS;
-		fv_SleepShort(li_sleep_nanoseconds);
 
 		// High frequency
 		gQUCPU_Uclock.u64i_cmd_reg_1 |= QUCPU_UI64_CMD_1_MEA_b32;
@@ -552,8 +590,6 @@ int fi_GetFreqs(QUCPU_tFreqs *ptFreqs_retFreqs)
 		ptFreqs_retFreqs->u64i_Frq_ClkUsr = (u64i_PrtData & QUCPU_UI64_STS_1_FRQ_b16t00) * 10000; // Hz
 		//printf(" ptFreqs_retFreqs->u64i_Frq_ClkUsr %llx \n", ptFreqs_retFreqs->u64i_Frq_ClkUsr);
 
-		fv_SleepShort(li_sleep_nanoseconds);
-
 	} // Read div2 and 1x user clock frequency
 
 	FPGA_DBG("\nApproximate frequency:\n"
@@ -571,7 +607,7 @@ int fi_SetFreqs(uint64_t u64i_Refclk,
 {
 	// fi_SetFreqs
 	// Set the user clock frequency
-	uint64_t u64i_I, u64i_MifReg, u64i_PrtData;
+	uint64_t u64i_MifReg, u64i_PrtData = 0;
 	uint64_t u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk;
 	long int li_sleep_nanoseconds;
 	int      i_ReturnErr;
@@ -621,20 +657,13 @@ int fi_SetFreqs(uint64_t u64i_Refclk,
 		u64i_AvmmMsk = 0x03LLU;
 
 		i_ReturnErr = fi_AvmmReadModifyWriteVerify(u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
-
-		// Sleep 1 ms
-		li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-		fv_SleepShort(li_sleep_nanoseconds);
 	} // Power down PLL
 
 	if (i_ReturnErr == 0)
-	{ // Verifying fcr PLL not locking
-
-		snprintf_s_ss(sysfs_usrpath, sizeof(sysfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS0);
-		sysfs_read_u64(sysfs_usrpath,  &u64i_PrtData);
-		//sysfs_read_uint64(gQUCPU_Uclock.sys_path, USER_CLOCK_STS0, &u64i_PrtData);
+	{ // Verifying fcr PLL not locking, allowing 1 ms to unlock
 
-		if ((u64i_PrtData & QUCPU_UI64_STS_0_LCK_b60) != 0)
+		if (fi_PollSts0(QUCPU_UI64_STS_0_LCK_b60, 0,
+				USRCLK_SLEEEP_1MS, &u64i_PrtData))
 		{ // fcr PLL is locked but should be unlocked
 			i_ReturnErr = QUCPU_INT_UCLOCK_SETFREQS_ERR_PLL_NO_UNLOCK;
 		} // fcr PLL is locked but should be unlocked
@@ -658,19 +687,11 @@ int fi_SetFreqs(uint64_t u64i_Refclk,
 		for (u64i_MifReg = 0; u64i_MifReg<gQUCPU_Uclock.tInitz_InitialParams.u64i_NumReg; u64i_MifReg++)
 		{ // Write each register in the diff mif
 
-			uint32_t tbl_entry;
-			if (u64i_Refclk == 0)
-			{ // 100 MHz table
-				tbl_entry = scu32ia3d_DiffMifTbl[(int) u64i_FrqInx][(int) u64i_MifReg][(int) u64i_Refclk];
-			}
-			else
-			{ // 322.265625 MHz table
-				tbl_entry = scu32ia3d_DiffMifTbl_322[(int) u64i_FrqInx][(int) u64i_MifReg][(int) u64i_Refclk];
-			}
+			uint32_t u32i_AdrMsk = scu32ia1d_DiffMifAdrMsk[(int) u64i_MifReg];
 
-			u64i_AvmmAdr = (uint64_t) (tbl_entry) >> 16;
-			u64i_AvmmDat = (uint64_t) (tbl_entry & 0x000000ff);
-			u64i_AvmmMsk = (uint64_t) (tbl_entry & 0x0000ff00) >> 8;
+			u64i_AvmmAdr = (uint64_t) (u32i_AdrMsk >> 8);
+			u64i_AvmmDat = (uint64_t) scu8ia3d_DiffMifDat[(int) u64i_Refclk][(int) u64i_FrqInx][(int) u64i_MifReg];
+			u64i_AvmmMsk = (uint64_t) (u32i_AdrMsk & 0x000000ff);
 			i_ReturnErr = fi_AvmmReadModifyWriteVerify(u64i_AvmmAdr, u64i_AvmmDat, u64i_AvmmMsk);
 
 			if (i_ReturnErr) break;
@@ -732,18 +753,9 @@ int fi_SetFreqs(uint64_t u64i_Refclk,
 	if (i_ReturnErr == 0)
 	{ // Wait for PLL to lock
 
-		for (u64i_I = 0; u64i_I<100; u64i_I++)
-		{ // Poll with 100 ms timeout
-
-			snprintf_s_ss(sysfs_usrpath, sizeof(sysfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS0);
-			sysfs_read_u64(sysfs_usrpath,  &u64i_PrtData);
-
-			if ((u64i_PrtData & QUCPU_UI64_STS_0_LCK_b60) != 0) break;
-
-			// Sleep 1 ms
-			li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-			fv_SleepShort(li_sleep_nanoseconds);
-		} // Poll with 100 ms timeout
+		// Poll with 100 ms timeout
+		fi_PollSts0(QUCPU_UI64_STS_0_LCK_b60, QUCPU_UI64_STS_0_LCK_b60,
+			    USRCLK_TIMEOUT_100MS, &u64i_PrtData);
 
 		if ((u64i_PrtData & QUCPU_UI64_STS_0_LCK_b60) == 0)
 		{ // fcr PLL lock error
@@ -849,25 +861,12 @@ int fi_WaitCalDone(void)
 	// fi_WaitCalDone
 	// Wait for calibration to be done
 	uint64_t u64i_PrtData                = 0;
-	uint64_t u64i_I                      = 0;
-	long int li_sleep_nanoseconds        = 0;
 	int      res                         = 0;
-	char sysfs_usrpath[SYSFS_PATH_MAX]    = {0};
 
 	// Waiting for fcr PLL calibration not to be busy
-	for (u64i_I = 0; u64i_I<1000; u64i_I++)
-	{ // Poll with 1000 ms timeout
-
-		snprintf_s_ss(sysfs_usrpath, sizeof(sysfs_usrpath), "%s/%s", gQUCPU_Uclock.sysfs_path, USER_CLOCK_STS0);
-		sysfs_read_u64(sysfs_usrpath,  &u64i_PrtData);
-
-		if ((u64i_PrtData & QUCPU_UI64_STS_0_BSY_b61) == 0) break;
-
-		// Sleep 1 ms
-		li_sleep_nanoseconds = USRCLK_SLEEEP_1MS;
-		fv_SleepShort(li_sleep_nanoseconds);
-	} // Poll with 1000 ms timeout
-
+	// Poll with 1000 ms timeout
+	fi_PollSts0(QUCPU_UI64_STS_0_BSY_b61, 0,
+		    USRCLK_TIMEOUT_1000MS, &u64i_PrtData);
 
 	if ((u64i_PrtData & QUCPU_UI64_STS_0_BSY_b61) != 0)
 	{ // ERROR: calibration busy too long
@@ -212,6 +212,9 @@ int fi_AvmmReadModifyWriteVerify(uint64_t u64i_AvmmAdr, uint64_t u64i_AvmmDat,
 
 void fv_SleepShort(long int li_sleep_nanoseconds);
 
+int fi_PollSts0(uint64_t u64i_Mask, uint64_t u64i_Value,
+		uint64_t u64i_TimeoutNs, uint64_t *pu64i_Status);
+
 int fi_AvmmWrite(uint64_t u64i_AvmmAdr, uint64_t u64i_WriteData);
 
 int fi_AvmmRead(uint64_t u64i_AvmmAdr, uint64_t *pu64i_ReadData);
@@ -27,18020 +27,4828 @@
 // Arthur.Sheiman@Intel.com   Created: 09-08-16
 // Revision: 03-21-17  19:51
 
-
-const uint32_t scu32ia3d_DiffMifTbl[QUCPU_INT_NUMFRQ][QUCPU_INT_NUMREG]
-				   [QUCPU_INT_NUMRCK] = {
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0b},
-					    {0x110ff1e, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff40},
-					    {0x12cff08, 0x12cff18},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f46},
-					    {0x1347c30, 0x1347c50},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff05},
-					    {0x110ff1e, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff0a},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c30},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff0f, 0x10fff0a},
-					    {0x110ff1e, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afc04, 0x12afc04},
-					    {0x12bff1e, 0x12bff10},
-					    {0x12cff08, 0x12cff08},
-					    {0x12dff01, 0x12dff01},
-					    {0x12eff00, 0x12eff00},
-					    {0x12fff00, 0x12fff00},
-					    {0x130ff00, 0x130ff00},
-					    {0x1337f42, 0x1337f4a},
-					    {0x1347c30, 0x1347c40},
-					    {0x135ff03, 0x135ff04},
-					    {0x1427f00, 0x1427f00}},
-
-					   {{0x10fff3c, 0x10fff3c},
-					    {0x110ff78, 0x110ff78},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff3a, 0x10fff3a},
-					    {0x110ff74, 0x110ff74},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff99},
-					    {0x12effc2, 0x12effb0},
-					    {0x12ffff5, 0x12fffac},
-					    {0x130ff28, 0x130ffb7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff38, 0x10fff38},
-					    {0x110ff70, 0x110ff70},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff36, 0x10fff36},
-					    {0x110ff6c, 0x110ff6c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff34, 0x10fff34},
-					    {0x110ff68, 0x110ff68},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff99},
-					    {0x12effc2, 0x12effb0},
-					    {0x12ffff5, 0x12fffac},
-					    {0x130ff28, 0x130ffb7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff32, 0x10fff32},
-					    {0x110ff64, 0x110ff64},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff31, 0x10fff31},
-					    {0x110ff62, 0x110ff62},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffd2},
-					    {0x12effae, 0x12eff89},
-					    {0x12fff47, 0x12fffa0},
-					    {0x130ff61, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff2f, 0x10fff2f},
-					    {0x110ff5e, 0x110ff5e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff3e},
-					    {0x12effe1, 0x12effed},
-					    {0x12fff7a, 0x12ffff6},
-					    {0x130ff14, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff2e, 0x10fff2e},
-					    {0x110ff5c, 0x110ff5c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dfffc},
-					    {0x12efff5, 0x12eff18},
-					    {0x12fff28, 0x12fff73},
-					    {0x130ff5c, 0x130ffd7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff2d, 0x10fff2d},
-					    {0x110ff5a, 0x110ff5a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff2b, 0x10fff2b},
-					    {0x110ff56, 0x110ff56},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff15},
-					    {0x12eff99, 0x12eff5e},
-					    {0x12fff99, 0x12fff24},
-					    {0x130ff19, 0x130ffae},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff2a, 0x10fff2a},
-					    {0x110ff54, 0x110ff54},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff29, 0x10fff29},
-					    {0x110ff52, 0x110ff52},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff25},
-					    {0x12eff3d, 0x12effa8},
-					    {0x12fff0a, 0x12fff45},
-					    {0x130ff57, 0x130ffd4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff28, 0x10fff28},
-					    {0x110ff50, 0x110ff50},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa9},
-					    {0x12eff66, 0x12efffa},
-					    {0x12fff66, 0x12fffcd},
-					    {0x130ff66, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff27, 0x10fff27},
-					    {0x110ff4e, 0x110ff4e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff80},
-					    {0x12eff1e, 0x12eff6b},
-					    {0x12fff85, 0x12ffffb},
-					    {0x130ff6b, 0x130ffe0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff26, 0x10fff26},
-					    {0x110ff4c, 0x110ff4c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa9},
-					    {0x12eff66, 0x12efffa},
-					    {0x12fff66, 0x12fffcd},
-					    {0x130ff66, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff25, 0x10fff25},
-					    {0x110ff4a, 0x110ff4a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff25},
-					    {0x12eff3d, 0x12effa8},
-					    {0x12fff0a, 0x12fff45},
-					    {0x130ff57, 0x130ffd4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff24, 0x10fff24},
-					    {0x110ff48, 0x110ff48},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff23, 0x10fff23},
-					    {0x110ff46, 0x110ff46},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff15},
-					    {0x12eff99, 0x12eff5e},
-					    {0x12fff99, 0x12fff24},
-					    {0x130ff19, 0x130ffae},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff23, 0x10fff23},
-					    {0x110ff46, 0x110ff46},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff22, 0x10fff22},
-					    {0x110ff44, 0x110ff44},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff21, 0x10fff21},
-					    {0x110ff42, 0x110ff42},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dfffc},
-					    {0x12efff5, 0x12eff18},
-					    {0x12fff28, 0x12fff73},
-					    {0x130ff5c, 0x130ffd7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff20, 0x10fff20},
-					    {0x110ff40, 0x110ff40},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff3e},
-					    {0x12effe1, 0x12effed},
-					    {0x12fff7a, 0x12ffff6},
-					    {0x130ff14, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff20, 0x10fff20},
-					    {0x110ff40, 0x110ff40},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff14},
-					    {0x12effeb, 0x12eff08},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff1f, 0x10fff1f},
-					    {0x110ff3e, 0x110ff3e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffd2},
-					    {0x12effae, 0x12eff89},
-					    {0x12fff47, 0x12fffa0},
-					    {0x130ff61, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff1e, 0x10fff1e},
-					    {0x110ff3c, 0x110ff3c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff1e, 0x10fff1e},
-					    {0x110ff3c, 0x110ff3c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff1d, 0x10fff1d},
-					    {0x110ff3a, 0x110ff3a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff99},
-					    {0x12effc2, 0x12effb0},
-					    {0x12ffff5, 0x12fffac},
-					    {0x130ff28, 0x130ffb7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff1d, 0x10fff1d},
-					    {0x110ff3a, 0x110ff3a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffeb},
-					    {0x12effa3, 0x12eff78},
-					    {0x12fff70, 0x12fffd2},
-					    {0x130ffbd, 0x130ff13},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff1c, 0x10fff1c},
-					    {0x110ff38, 0x110ff38},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff1c, 0x10fff1c},
-					    {0x110ff38, 0x110ff38},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff1b, 0x10fff1b},
-					    {0x110ff36, 0x110ff36},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff1b, 0x10fff1b},
-					    {0x110ff36, 0x110ff36},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff98},
-					    {0x12eff14, 0x12eff5a},
-					    {0x12fffae, 0x12fff2d},
-					    {0x130ffc7, 0x130ff1a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff1a, 0x10fff1a},
-					    {0x110ff34, 0x110ff34},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff99},
-					    {0x12effc2, 0x12effb0},
-					    {0x12ffff5, 0x12fffac},
-					    {0x130ff28, 0x130ffb7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff1a, 0x10fff1a},
-					    {0x110ff34, 0x110ff34},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff67},
-					    {0x12eff7a, 0x12eff26},
-					    {0x12fff14, 0x12fff4a},
-					    {0x130ffae, 0x130ff0a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff19, 0x10fff19},
-					    {0x110ff32, 0x110ff32},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff19, 0x10fff19},
-					    {0x110ff32, 0x110ff32},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffdb},
-					    {0x12eff00, 0x12eff2e},
-					    {0x12fff00, 0x12fffb1},
-					    {0x130ff80, 0x130ffed},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff19, 0x10fff19},
-					    {0x110ff32, 0x110ff32},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffd2},
-					    {0x12eff00, 0x12eff33},
-					    {0x12fff00, 0x12fff21},
-					    {0x130ff00, 0x130ff3d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff18, 0x10fff18},
-					    {0x110ff30, 0x110ff30},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff18, 0x10fff18},
-					    {0x110ff30, 0x110ff30},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff14},
-					    {0x12effeb, 0x12eff08},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff18, 0x10fff18},
-					    {0x110ff30, 0x110ff30},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff17, 0x10fff17},
-					    {0x110ff2e, 0x110ff2e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dfffc},
-					    {0x12efff5, 0x12eff18},
-					    {0x12fff28, 0x12fff73},
-					    {0x130ff5c, 0x130ffd7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff17, 0x10fff17},
-					    {0x110ff2e, 0x110ff2e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff45},
-					    {0x12eff85, 0x12eff3c},
-					    {0x12fffeb, 0x12fff88},
-					    {0x130ffd1, 0x130ff20},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff17, 0x10fff17},
-					    {0x110ff2e, 0x110ff2e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff8f},
-					    {0x12eff14, 0x12eff5f},
-					    {0x12fffae, 0x12fff9d},
-					    {0x130ff47, 0x130ff69},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff16, 0x10fff16},
-					    {0x110ff2c, 0x110ff2c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dfffc},
-					    {0x12efff5, 0x12eff18},
-					    {0x12fff28, 0x12fff73},
-					    {0x130ff5c, 0x130ffd7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff16, 0x10fff16},
-					    {0x110ff2c, 0x110ff2c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff16, 0x10fff16},
-					    {0x110ff2c, 0x110ff2c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffe2},
-					    {0x12effa3, 0x12eff7d},
-					    {0x12fff70, 0x12fff42},
-					    {0x130ff3d, 0x130ff63},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff15, 0x10fff15},
-					    {0x110ff2a, 0x110ff2a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff15, 0x10fff15},
-					    {0x110ff2a, 0x110ff2a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff90},
-					    {0x12effc2, 0x12effb5},
-					    {0x12ffff5, 0x12fff1c},
-					    {0x130ffa8, 0x130ff07},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff15, 0x10fff15},
-					    {0x110ff2a, 0x110ff2a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff2c},
-					    {0x12effe1, 0x12efff7},
-					    {0x12fff7a, 0x12fffd6},
-					    {0x130ff14, 0x130ff49},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff14, 0x10fff14},
-					    {0x110ff28, 0x110ff28},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff14, 0x10fff14},
-					    {0x110ff28, 0x110ff28},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa9},
-					    {0x12eff66, 0x12efffa},
-					    {0x12fff66, 0x12fffcd},
-					    {0x130ff66, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff14, 0x10fff14},
-					    {0x110ff28, 0x110ff28},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff14, 0x10fff14},
-					    {0x110ff28, 0x110ff28},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff13, 0x10fff13},
-					    {0x110ff26, 0x110ff26},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dffba},
-					    {0x12effb8, 0x12eff9a},
-					    {0x12fff1e, 0x12fff6e},
-					    {0x130ff05, 0x130ffa1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff13, 0x10fff13},
-					    {0x110ff26, 0x110ff26},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa9},
-					    {0x12eff66, 0x12efffa},
-					    {0x12fff66, 0x12fffcd},
-					    {0x130ff66, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff13, 0x10fff13},
-					    {0x110ff26, 0x110ff26},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff98},
-					    {0x12eff14, 0x12eff5a},
-					    {0x12fffae, 0x12fff2d},
-					    {0x130ffc7, 0x130ff1a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff13, 0x10fff13},
-					    {0x110ff26, 0x110ff26},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff87},
-					    {0x12effc2, 0x12effba},
-					    {0x12ffff5, 0x12fff8c},
-					    {0x130ff28, 0x130ff56},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff13, 0x10fff13},
-					    {0x110ff26, 0x110ff26},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff76},
-					    {0x12eff70, 0x12eff1a},
-					    {0x12fff3d, 0x12fffec},
-					    {0x130ff8a, 0x130ff92},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff12, 0x10fff12},
-					    {0x110ff24, 0x110ff24},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff12, 0x10fff12},
-					    {0x110ff24, 0x110ff24},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff12, 0x10fff12},
-					    {0x110ff24, 0x110ff24},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff24},
-					    {0x12eff8f, 0x12eff52},
-					    {0x12fffc2, 0x12fffc6},
-					    {0x130fff5, 0x130ff36},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff12, 0x10fff12},
-					    {0x110ff24, 0x110ff24},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff3c},
-					    {0x12eff85, 0x12eff41},
-					    {0x12fffeb, 0x12ffff8},
-					    {0x130ff51, 0x130ff6f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff12, 0x10fff12},
-					    {0x110ff24, 0x110ff24},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff55},
-					    {0x12eff7a, 0x12eff30},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff11, 0x10fff11},
-					    {0x110ff22, 0x110ff22},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dffca},
-					    {0x12eff5c, 0x12effe4},
-					    {0x12fff8f, 0x12fff8f},
-					    {0x130ff42, 0x130ffc7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff11, 0x10fff11},
-					    {0x110ff22, 0x110ff22},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff11, 0x10fff11},
-					    {0x110ff22, 0x110ff22},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff4e},
-					    {0x12effd7, 0x12effe1},
-					    {0x12fffa3, 0x12fff98},
-					    {0x130fff0, 0x130ff33},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff11, 0x10fff11},
-					    {0x110ff22, 0x110ff22},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff8f},
-					    {0x12eff14, 0x12eff5f},
-					    {0x12fffae, 0x12fff9d},
-					    {0x130ff47, 0x130ff69},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff11, 0x10fff11},
-					    {0x110ff22, 0x110ff22},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffd1},
-					    {0x12eff51, 0x12effdd},
-					    {0x12fffb8, 0x12fffa1},
-					    {0x130ff9e, 0x130ff9f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff10, 0x10fff10},
-					    {0x110ff20, 0x110ff20},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff3e},
-					    {0x12effe1, 0x12effed},
-					    {0x12fff7a, 0x12ffff6},
-					    {0x130ff14, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff10, 0x10fff10},
-					    {0x110ff20, 0x110ff20},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa9},
-					    {0x12eff66, 0x12efffa},
-					    {0x12fff66, 0x12fffcd},
-					    {0x130ff66, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff10, 0x10fff10},
-					    {0x110ff20, 0x110ff20},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff14},
-					    {0x12effeb, 0x12eff08},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff10, 0x10fff10},
-					    {0x110ff20, 0x110ff20},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff7f},
-					    {0x12eff70, 0x12eff15},
-					    {0x12fff3d, 0x12fff7c},
-					    {0x130ff0a, 0x130ff43},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff10, 0x10fff10},
-					    {0x110ff20, 0x110ff20},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffea},
-					    {0x12efff5, 0x12eff22},
-					    {0x12fff28, 0x12fff53},
-					    {0x130ff5c, 0x130ff76},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff10, 0x10fff10},
-					    {0x110ff20, 0x110ff20},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff55},
-					    {0x12eff7a, 0x12eff30},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0f, 0x10fff0f},
-					    {0x110ff1e, 0x110ff1e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0f, 0x10fff0f},
-					    {0x110ff1e, 0x110ff1e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff78},
-					    {0x12effcc, 0x12effc6},
-					    {0x12fffcc, 0x12fffea},
-					    {0x130ff4c, 0x130ffcd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0f, 0x10fff0f},
-					    {0x110ff1e, 0x110ff1e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0f, 0x10fff0f},
-					    {0x110ff1e, 0x110ff1e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa0},
-					    {0x12eff66, 0x12effff},
-					    {0x12fff66, 0x12fff3d},
-					    {0x130ffe6, 0x130ff2d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0f, 0x10fff0f},
-					    {0x110ff1e, 0x110ff1e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0f, 0x10fff0f},
-					    {0x110ff1e, 0x110ff1e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffc9},
-					    {0x12eff00, 0x12eff38},
-					    {0x12fff00, 0x12fff91},
-					    {0x130ff80, 0x130ff8c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0f, 0x10fff0f},
-					    {0x110ff1e, 0x110ff1e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff5d},
-					    {0x12effcc, 0x12effd5},
-					    {0x12fffcc, 0x12fff3a},
-					    {0x130ffcc, 0x130ffbc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0f, 0x10fff0f},
-					    {0x110ff1e, 0x110ff1e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dfff1},
-					    {0x12eff99, 0x12eff71},
-					    {0x12fff99, 0x12fffe4},
-					    {0x130ff19, 0x130ffeb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0e, 0x10fff0e},
-					    {0x110ff1c, 0x110ff1c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0e, 0x10fff0e},
-					    {0x110ff1c, 0x110ff1c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dffb1},
-					    {0x12effb8, 0x12eff9f},
-					    {0x12fff1e, 0x12fffde},
-					    {0x130ff85, 0x130fff0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0e, 0x10fff0e},
-					    {0x110ff1c, 0x110ff1c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0e, 0x10fff0e},
-					    {0x110ff1c, 0x110ff1c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff2c},
-					    {0x12effe1, 0x12efff7},
-					    {0x12fff7a, 0x12fffd6},
-					    {0x130ff14, 0x130ff49},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0e, 0x10fff0e},
-					    {0x110ff1c, 0x110ff1c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffea},
-					    {0x12efff5, 0x12eff22},
-					    {0x12fff28, 0x12fff53},
-					    {0x130ff5c, 0x130ff76},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0e, 0x10fff0e},
-					    {0x110ff1c, 0x110ff1c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dffa7},
-					    {0x12eff0a, 0x12eff4e},
-					    {0x12fffd7, 0x12fffcf},
-					    {0x130ffa3, 0x130ffa2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0e, 0x10fff0e},
-					    {0x110ff1c, 0x110ff1c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff65},
-					    {0x12eff1e, 0x12eff7a},
-					    {0x12fff85, 0x12fff4b},
-					    {0x130ffeb, 0x130ffcf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0e, 0x10fff0e},
-					    {0x110ff1c, 0x110ff1c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff22},
-					    {0x12eff33, 0x12effa6},
-					    {0x12fff33, 0x12fffc7},
-					    {0x130ff33, 0x130fffb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0d, 0x10fff0d},
-					    {0x110ff1a, 0x110ff1a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff99},
-					    {0x12effc2, 0x12effb0},
-					    {0x12ffff5, 0x12fffac},
-					    {0x130ff28, 0x130ffb7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0d, 0x10fff0d},
-					    {0x110ff1a, 0x110ff1a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff80},
-					    {0x12eff1e, 0x12eff6b},
-					    {0x12fff85, 0x12ffffb},
-					    {0x130ff6b, 0x130ffe0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0d, 0x10fff0d},
-					    {0x110ff1a, 0x110ff1a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff67},
-					    {0x12eff7a, 0x12eff26},
-					    {0x12fff14, 0x12fff4a},
-					    {0x130ffae, 0x130ff0a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0d, 0x10fff0d},
-					    {0x110ff1a, 0x110ff1a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff4e},
-					    {0x12effd7, 0x12effe1},
-					    {0x12fffa3, 0x12fff98},
-					    {0x130fff0, 0x130ff33},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0d, 0x10fff0d},
-					    {0x110ff1a, 0x110ff1a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0d, 0x10fff0d},
-					    {0x110ff1a, 0x110ff1a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff1b},
-					    {0x12eff8f, 0x12eff57},
-					    {0x12fffc2, 0x12fff36},
-					    {0x130ff75, 0x130ff86},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0d, 0x10fff0d},
-					    {0x110ff1a, 0x110ff1a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff02},
-					    {0x12effeb, 0x12eff12},
-					    {0x12fff51, 0x12fff85},
-					    {0x130ffb8, 0x130ffaf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0d, 0x10fff0d},
-					    {0x110ff1a, 0x110ff1a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffe9},
-					    {0x12eff47, 0x12effcc},
-					    {0x12fffe1, 0x12fffd3},
-					    {0x130fffa, 0x130ffd8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0d, 0x10fff0d},
-					    {0x110ff1a, 0x110ff1a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffd0},
-					    {0x12effa3, 0x12eff87},
-					    {0x12fff70, 0x12fff22},
-					    {0x130ff3d, 0x130ff02},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff04},
-					    {0x12eff47, 0x12effbe},
-					    {0x12fffe1, 0x12fff83},
-					    {0x130ff7a, 0x130ffea},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff14},
-					    {0x12effeb, 0x12eff08},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff24},
-					    {0x12eff8f, 0x12eff52},
-					    {0x12fffc2, 0x12fffc6},
-					    {0x130fff5, 0x130ff36},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff45},
-					    {0x12effd7, 0x12effe6},
-					    {0x12fffa3, 0x12fff08},
-					    {0x130ff70, 0x130ff83},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff55},
-					    {0x12eff7a, 0x12eff30},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff65},
-					    {0x12eff1e, 0x12eff7a},
-					    {0x12fff85, 0x12fff4b},
-					    {0x130ffeb, 0x130ffcf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff75},
-					    {0x12effc2, 0x12effc4},
-					    {0x12ffff5, 0x12fff6c},
-					    {0x130ff28, 0x130fff5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff85},
-					    {0x12eff66, 0x12eff0e},
-					    {0x12fff66, 0x12fff8e},
-					    {0x130ff66, 0x130ff1b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0c, 0x10fff0c},
-					    {0x110ff18, 0x110ff18},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff95},
-					    {0x12eff0a, 0x12eff58},
-					    {0x12fffd7, 0x12fffaf},
-					    {0x130ffa3, 0x130ff41},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dffc2},
-					    {0x12eff0a, 0x12eff3f},
-					    {0x12fffd7, 0x12fff7f},
-					    {0x130ff23, 0x130ffb4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dfffc},
-					    {0x12efff5, 0x12eff18},
-					    {0x12fff28, 0x12fff73},
-					    {0x130ff5c, 0x130ffd7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff35},
-					    {0x12effe1, 0x12efff2},
-					    {0x12fff7a, 0x12fff66},
-					    {0x130ff94, 0x130fffa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dffa8},
-					    {0x12effb8, 0x12effa4},
-					    {0x12fff1e, 0x12fff4e},
-					    {0x130ff05, 0x130ff40},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffe2},
-					    {0x12effa3, 0x12eff7d},
-					    {0x12fff70, 0x12fff42},
-					    {0x130ff3d, 0x130ff63},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff1b},
-					    {0x12eff8f, 0x12eff57},
-					    {0x12fffc2, 0x12fff36},
-					    {0x130ff75, 0x130ff86},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff55},
-					    {0x12eff7a, 0x12eff30},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff8e},
-					    {0x12eff66, 0x12eff09},
-					    {0x12fff66, 0x12fff1e},
-					    {0x130ffe6, 0x130ffcc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffc8},
-					    {0x12eff51, 0x12effe2},
-					    {0x12fffb8, 0x12fff11},
-					    {0x130ff1e, 0x130ffef},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff01},
-					    {0x12eff3d, 0x12effbc},
-					    {0x12fff0a, 0x12fff05},
-					    {0x130ff57, 0x130ff12},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff3b},
-					    {0x12eff28, 0x12eff95},
-					    {0x12fff5c, 0x12ffff9},
-					    {0x130ff8f, 0x130ff34},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0b, 0x10fff0b},
-					    {0x110ff16, 0x110ff16},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff74},
-					    {0x12eff14, 0x12eff6e},
-					    {0x12fffae, 0x12fffed},
-					    {0x130ffc7, 0x130ff57},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff46},
-					    {0x12eff33, 0x12eff92},
-					    {0x12fff33, 0x12fff07},
-					    {0x130ff33, 0x130ffbe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa9},
-					    {0x12eff66, 0x12efffa},
-					    {0x12fff66, 0x12fffcd},
-					    {0x130ff66, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffd2},
-					    {0x12eff00, 0x12eff33},
-					    {0x12fff00, 0x12fff21},
-					    {0x130ff00, 0x130ff3d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff97},
-					    {0x12eff66, 0x12eff04},
-					    {0x12fff66, 0x12fffae},
-					    {0x130ff66, 0x130ff7c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dfffa},
-					    {0x12eff99, 0x12eff6c},
-					    {0x12fff99, 0x12fff74},
-					    {0x130ff99, 0x130ff9c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff5d},
-					    {0x12effcc, 0x12effd5},
-					    {0x12fffcc, 0x12fff3a},
-					    {0x130ffcc, 0x130ffbc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffc0},
-					    {0x12eff00, 0x12eff3d},
-					    {0x12fff00, 0x12fff01},
-					    {0x130ff00, 0x130ffdc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff22},
-					    {0x12eff33, 0x12effa6},
-					    {0x12fff33, 0x12fffc7},
-					    {0x130ff33, 0x130fffb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff85},
-					    {0x12eff66, 0x12eff0e},
-					    {0x12fff66, 0x12fff8e},
-					    {0x130ff66, 0x130ff1b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffe8},
-					    {0x12eff99, 0x12eff76},
-					    {0x12fff99, 0x12fff54},
-					    {0x130ff99, 0x130ff3b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff4b},
-					    {0x12effcc, 0x12effdf},
-					    {0x12fffcc, 0x12fff1a},
-					    {0x130ffcc, 0x130ff5b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffae},
-					    {0x12eff00, 0x12eff47},
-					    {0x12fff00, 0x12fffe1},
-					    {0x130ff00, 0x130ff7a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff0a, 0x10fff0a},
-					    {0x110ff14, 0x110ff14},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff10},
-					    {0x12eff33, 0x12effb0},
-					    {0x12fff33, 0x12fffa7},
-					    {0x130ff33, 0x130ff9a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff68},
-					    {0x12eff28, 0x12eff7c},
-					    {0x12fff5c, 0x12fffc9},
-					    {0x130ff0f, 0x130ffa7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff80},
-					    {0x12eff1e, 0x12eff6b},
-					    {0x12fff85, 0x12ffffb},
-					    {0x130ff6b, 0x130ffe0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff98},
-					    {0x12eff14, 0x12eff5a},
-					    {0x12fffae, 0x12fff2d},
-					    {0x130ffc7, 0x130ff1a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff24},
-					    {0x12eff8f, 0x12eff52},
-					    {0x12fffc2, 0x12fffc6},
-					    {0x130fff5, 0x130ff36},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dffb0},
-					    {0x12eff0a, 0x12eff49},
-					    {0x12fffd7, 0x12fff5f},
-					    {0x130ff23, 0x130ff53},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff3c},
-					    {0x12eff85, 0x12eff41},
-					    {0x12fffeb, 0x12ffff8},
-					    {0x130ff51, 0x130ff6f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffc9},
-					    {0x12eff00, 0x12eff38},
-					    {0x12fff00, 0x12fff91},
-					    {0x130ff80, 0x130ff8c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff55},
-					    {0x12eff7a, 0x12eff30},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffe1},
-					    {0x12efff5, 0x12eff27},
-					    {0x12fff28, 0x12fffc3},
-					    {0x130ffdc, 0x130ffc5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff6d},
-					    {0x12eff70, 0x12eff1f},
-					    {0x12fff3d, 0x12fff5c},
-					    {0x130ff0a, 0x130ffe2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dfff9},
-					    {0x12effeb, 0x12eff16},
-					    {0x12fff51, 0x12ffff5},
-					    {0x130ff38, 0x130fffe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff85},
-					    {0x12eff66, 0x12eff0e},
-					    {0x12fff66, 0x12fff8e},
-					    {0x130ff66, 0x130ff1b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff11},
-					    {0x12effe1, 0x12eff06},
-					    {0x12fff7a, 0x12fff27},
-					    {0x130ff94, 0x130ff38},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff9d},
-					    {0x12eff5c, 0x12efffd},
-					    {0x12fff8f, 0x12fffbf},
-					    {0x130ffc2, 0x130ff54},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff2a},
-					    {0x12effd7, 0x12efff5},
-					    {0x12fffa3, 0x12fff58},
-					    {0x130fff0, 0x130ff71},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffb6},
-					    {0x12eff51, 0x12effec},
-					    {0x12fffb8, 0x12ffff1},
-					    {0x130ff1e, 0x130ff8d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff42},
-					    {0x12effcc, 0x12effe4},
-					    {0x12fffcc, 0x12fff8a},
-					    {0x130ff4c, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffce},
-					    {0x12eff47, 0x12effdb},
-					    {0x12fffe1, 0x12fff23},
-					    {0x130ff7a, 0x130ffc7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff09, 0x10fff09},
-					    {0x110ff12, 0x110ff12},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff5a},
-					    {0x12effc2, 0x12effd3},
-					    {0x12ffff5, 0x12fffbc},
-					    {0x130ffa8, 0x130ffe3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff3e},
-					    {0x12effe1, 0x12effed},
-					    {0x12fff7a, 0x12ffff6},
-					    {0x130ff14, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa9},
-					    {0x12eff66, 0x12efffa},
-					    {0x12fff66, 0x12fffcd},
-					    {0x130ff66, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff5f},
-					    {0x12eff28, 0x12eff81},
-					    {0x12fff5c, 0x12fff39},
-					    {0x130ff8f, 0x130fff7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff14},
-					    {0x12effeb, 0x12eff08},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffc9},
-					    {0x12effae, 0x12eff8e},
-					    {0x12fff47, 0x12fff10},
-					    {0x130ffe1, 0x130ff2a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff7f},
-					    {0x12eff70, 0x12eff15},
-					    {0x12fff3d, 0x12fff7c},
-					    {0x130ff0a, 0x130ff43},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffea},
-					    {0x12efff5, 0x12eff22},
-					    {0x12fff28, 0x12fff53},
-					    {0x130ff5c, 0x130ff76},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff9f},
-					    {0x12effb8, 0x12effa9},
-					    {0x12fff1e, 0x12fffbe},
-					    {0x130ff85, 0x130ff8f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff55},
-					    {0x12eff7a, 0x12eff30},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff0a},
-					    {0x12eff3d, 0x12effb7},
-					    {0x12fff0a, 0x12fff95},
-					    {0x130ffd7, 0x130ffc2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffc0},
-					    {0x12eff00, 0x12eff3d},
-					    {0x12fff00, 0x12fff01},
-					    {0x130ff00, 0x130ffdc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff75},
-					    {0x12effc2, 0x12effc4},
-					    {0x12ffff5, 0x12fff6c},
-					    {0x130ff28, 0x130fff5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff2a},
-					    {0x12eff85, 0x12eff4b},
-					    {0x12fffeb, 0x12fffd8},
-					    {0x130ff51, 0x130ff0e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffe0},
-					    {0x12eff47, 0x12effd1},
-					    {0x12fffe1, 0x12fff43},
-					    {0x130ff7a, 0x130ff28},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff95},
-					    {0x12eff0a, 0x12eff58},
-					    {0x12fffd7, 0x12fffaf},
-					    {0x130ffa3, 0x130ff41},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff4b},
-					    {0x12effcc, 0x12effdf},
-					    {0x12fffcc, 0x12fff1a},
-					    {0x130ffcc, 0x130ff5b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff00},
-					    {0x12eff8f, 0x12eff66},
-					    {0x12fffc2, 0x12fff86},
-					    {0x130fff5, 0x130ff74},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffb6},
-					    {0x12eff51, 0x12effec},
-					    {0x12fffb8, 0x12ffff1},
-					    {0x130ff1e, 0x130ff8d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff6b},
-					    {0x12eff14, 0x12eff73},
-					    {0x12fffae, 0x12fff5d},
-					    {0x130ff47, 0x130ffa7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff21},
-					    {0x12effd7, 0x12efffa},
-					    {0x12fffa3, 0x12fffc8},
-					    {0x130ff70, 0x130ffc0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffd6},
-					    {0x12eff99, 0x12eff80},
-					    {0x12fff99, 0x12fff34},
-					    {0x130ff99, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff8b},
-					    {0x12eff5c, 0x12eff07},
-					    {0x12fff8f, 0x12fffa0},
-					    {0x130ffc2, 0x130fff3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff41},
-					    {0x12eff1e, 0x12eff8e},
-					    {0x12fff85, 0x12fff0b},
-					    {0x130ffeb, 0x130ff0d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dfff6},
-					    {0x12effe1, 0x12eff14},
-					    {0x12fff7a, 0x12fff77},
-					    {0x130ff14, 0x130ff26},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff08, 0x10fff08},
-					    {0x110ff10, 0x110ff10},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffac},
-					    {0x12effa3, 0x12eff9b},
-					    {0x12fff70, 0x12fffe2},
-					    {0x130ff3d, 0x130ff3f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff15},
-					    {0x12eff99, 0x12eff5e},
-					    {0x12fff99, 0x12fff24},
-					    {0x130ff19, 0x130ffae},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffd2},
-					    {0x12effae, 0x12eff89},
-					    {0x12fff47, 0x12fffa0},
-					    {0x130ff61, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dffb1},
-					    {0x12effb8, 0x12eff9f},
-					    {0x12fff1e, 0x12fffde},
-					    {0x130ff85, 0x130fff0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff90},
-					    {0x12effc2, 0x12effb5},
-					    {0x12ffff5, 0x12fff1c},
-					    {0x130ffa8, 0x130ff07},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff4e},
-					    {0x12effd7, 0x12effe1},
-					    {0x12fffa3, 0x12fff98},
-					    {0x130fff0, 0x130ff33},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff2c},
-					    {0x12effe1, 0x12efff7},
-					    {0x12fff7a, 0x12fffd6},
-					    {0x130ff14, 0x130ff49},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff0b},
-					    {0x12effeb, 0x12eff0d},
-					    {0x12fff51, 0x12fff15},
-					    {0x130ff38, 0x130ff60},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffea},
-					    {0x12efff5, 0x12eff22},
-					    {0x12fff28, 0x12fff53},
-					    {0x130ff5c, 0x130ff76},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffc9},
-					    {0x12eff00, 0x12eff38},
-					    {0x12fff00, 0x12fff91},
-					    {0x130ff80, 0x130ff8c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dffa7},
-					    {0x12eff0a, 0x12eff4e},
-					    {0x12fffd7, 0x12fffcf},
-					    {0x130ffa3, 0x130ffa2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff86},
-					    {0x12eff14, 0x12eff64},
-					    {0x12fffae, 0x12fff0d},
-					    {0x130ffc7, 0x130ffb9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff65},
-					    {0x12eff1e, 0x12eff7a},
-					    {0x12fff85, 0x12fff4b},
-					    {0x130ffeb, 0x130ffcf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff44},
-					    {0x12eff28, 0x12eff90},
-					    {0x12fff5c, 0x12fff89},
-					    {0x130ff0f, 0x130ffe5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff22},
-					    {0x12eff33, 0x12effa6},
-					    {0x12fff33, 0x12fffc7},
-					    {0x130ff33, 0x130fffb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff01},
-					    {0x12eff3d, 0x12effbc},
-					    {0x12fff0a, 0x12fff05},
-					    {0x130ff57, 0x130ff12},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffe0},
-					    {0x12eff47, 0x12effd1},
-					    {0x12fffe1, 0x12fff43},
-					    {0x130ff7a, 0x130ff28},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffbf},
-					    {0x12eff51, 0x12effe7},
-					    {0x12fffb8, 0x12fff81},
-					    {0x130ff9e, 0x130ff3e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff9d},
-					    {0x12eff5c, 0x12efffd},
-					    {0x12fff8f, 0x12fffbf},
-					    {0x130ffc2, 0x130ff54},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff7c},
-					    {0x12eff66, 0x12eff13},
-					    {0x12fff66, 0x12ffffe},
-					    {0x130ffe6, 0x130ff6a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff5b},
-					    {0x12eff70, 0x12eff29},
-					    {0x12fff3d, 0x12fff3c},
-					    {0x130ff0a, 0x130ff81},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff3a},
-					    {0x12eff7a, 0x12eff3f},
-					    {0x12fff14, 0x12fff7a},
-					    {0x130ff2e, 0x130ff97},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff18},
-					    {0x12eff85, 0x12eff55},
-					    {0x12fffeb, 0x12fffb8},
-					    {0x130ff51, 0x130ffad},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dfff7},
-					    {0x12eff8f, 0x12eff6a},
-					    {0x12fffc2, 0x12ffff6},
-					    {0x130ff75, 0x130ffc3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffd6},
-					    {0x12eff99, 0x12eff80},
-					    {0x12fff99, 0x12fff34},
-					    {0x130ff99, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffb5},
-					    {0x12effa3, 0x12eff96},
-					    {0x12fff70, 0x12fff72},
-					    {0x130ffbd, 0x130fff0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff94},
-					    {0x12effae, 0x12effac},
-					    {0x12fff47, 0x12fffb0},
-					    {0x130ffe1, 0x130ff06},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff72},
-					    {0x12effb8, 0x12effc2},
-					    {0x12fff1e, 0x12fffee},
-					    {0x130ff05, 0x130ff1c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff51},
-					    {0x12effc2, 0x12effd8},
-					    {0x12ffff5, 0x12fff2c},
-					    {0x130ff28, 0x130ff33},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff30},
-					    {0x12effcc, 0x12effee},
-					    {0x12fffcc, 0x12fff6a},
-					    {0x130ff4c, 0x130ff49},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff0f},
-					    {0x12effd7, 0x12eff04},
-					    {0x12fffa3, 0x12fffa9},
-					    {0x130ff70, 0x130ff5f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dffed},
-					    {0x12effe1, 0x12eff19},
-					    {0x12fff7a, 0x12fffe7},
-					    {0x130ff94, 0x130ff75},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffcc},
-					    {0x12effeb, 0x12eff2f},
-					    {0x12fff51, 0x12fff25},
-					    {0x130ffb8, 0x130ff8c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff07, 0x10fff07},
-					    {0x110ff0e, 0x110ff0e},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffab},
-					    {0x12efff5, 0x12eff45},
-					    {0x12fff28, 0x12fff63},
-					    {0x130ffdc, 0x130ffa2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffec},
-					    {0x12eff51, 0x12effce},
-					    {0x12fffb8, 0x12fff51},
-					    {0x130ff1e, 0x130ffb1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dfffc},
-					    {0x12efff5, 0x12eff18},
-					    {0x12fff28, 0x12fff73},
-					    {0x130ff5c, 0x130ffd7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff04},
-					    {0x12eff47, 0x12effbe},
-					    {0x12fffe1, 0x12fff83},
-					    {0x130ff7a, 0x130ffea},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff14},
-					    {0x12effeb, 0x12eff08},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff1c},
-					    {0x12eff3d, 0x12effad},
-					    {0x12fff0a, 0x12fffb5},
-					    {0x130ffd7, 0x130ff23},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff24},
-					    {0x12eff8f, 0x12eff52},
-					    {0x12fffc2, 0x12fffc6},
-					    {0x130fff5, 0x130ff36},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff2c},
-					    {0x12effe1, 0x12efff7},
-					    {0x12fff7a, 0x12fffd6},
-					    {0x130ff14, 0x130ff49},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff3c},
-					    {0x12eff85, 0x12eff41},
-					    {0x12fffeb, 0x12ffff8},
-					    {0x130ff51, 0x130ff6f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff45},
-					    {0x12effd7, 0x12effe6},
-					    {0x12fffa3, 0x12fff08},
-					    {0x130ff70, 0x130ff83},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff4d},
-					    {0x12eff28, 0x12eff8b},
-					    {0x12fff5c, 0x12fff19},
-					    {0x130ff8f, 0x130ff96},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff55},
-					    {0x12eff7a, 0x12eff30},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff5d},
-					    {0x12effcc, 0x12effd5},
-					    {0x12fffcc, 0x12fff3a},
-					    {0x130ffcc, 0x130ffbc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff65},
-					    {0x12eff1e, 0x12eff7a},
-					    {0x12fff85, 0x12fff4b},
-					    {0x130ffeb, 0x130ffcf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff6d},
-					    {0x12eff70, 0x12eff1f},
-					    {0x12fff3d, 0x12fff5c},
-					    {0x130ff0a, 0x130ffe2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff75},
-					    {0x12effc2, 0x12effc4},
-					    {0x12ffff5, 0x12fff6c},
-					    {0x130ff28, 0x130fff5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff7d},
-					    {0x12eff14, 0x12eff69},
-					    {0x12fffae, 0x12fff7d},
-					    {0x130ff47, 0x130ff08},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff85},
-					    {0x12eff66, 0x12eff0e},
-					    {0x12fff66, 0x12fff8e},
-					    {0x130ff66, 0x130ff1b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff8d},
-					    {0x12effb8, 0x12effb3},
-					    {0x12fff1e, 0x12fff9e},
-					    {0x130ff85, 0x130ff2e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff95},
-					    {0x12eff0a, 0x12eff58},
-					    {0x12fffd7, 0x12fffaf},
-					    {0x130ffa3, 0x130ff41},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff9d},
-					    {0x12eff5c, 0x12efffd},
-					    {0x12fff8f, 0x12fffbf},
-					    {0x130ffc2, 0x130ff54},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffa5},
-					    {0x12effae, 0x12effa2},
-					    {0x12fff47, 0x12fffd0},
-					    {0x130ffe1, 0x130ff67},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffae},
-					    {0x12eff00, 0x12eff47},
-					    {0x12fff00, 0x12fffe1},
-					    {0x130ff00, 0x130ff7a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffb6},
-					    {0x12eff51, 0x12effec},
-					    {0x12fffb8, 0x12ffff1},
-					    {0x130ff1e, 0x130ff8d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffbe},
-					    {0x12effa3, 0x12eff91},
-					    {0x12fff70, 0x12fff02},
-					    {0x130ff3d, 0x130ffa1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffc6},
-					    {0x12efff5, 0x12eff36},
-					    {0x12fff28, 0x12fff13},
-					    {0x130ff5c, 0x130ffb4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffce},
-					    {0x12eff47, 0x12effdb},
-					    {0x12fffe1, 0x12fff23},
-					    {0x130ff7a, 0x130ffc7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffd6},
-					    {0x12eff99, 0x12eff80},
-					    {0x12fff99, 0x12fff34},
-					    {0x130ff99, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffde},
-					    {0x12effeb, 0x12eff25},
-					    {0x12fff51, 0x12fff45},
-					    {0x130ffb8, 0x130ffed},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffe6},
-					    {0x12eff3d, 0x12effca},
-					    {0x12fff0a, 0x12fff55},
-					    {0x130ffd7, 0x130ff00},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffee},
-					    {0x12eff8f, 0x12eff6f},
-					    {0x12fffc2, 0x12fff66},
-					    {0x130fff5, 0x130ff13},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dfff6},
-					    {0x12effe1, 0x12eff14},
-					    {0x12fff7a, 0x12fff77},
-					    {0x130ff14, 0x130ff26},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dfffe},
-					    {0x12eff33, 0x12effb9},
-					    {0x12fff33, 0x12fff87},
-					    {0x130ff33, 0x130ff39},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff06},
-					    {0x12eff85, 0x12eff5f},
-					    {0x12fffeb, 0x12fff98},
-					    {0x130ff51, 0x130ff4c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff0f},
-					    {0x12effd7, 0x12eff04},
-					    {0x12fffa3, 0x12fffa9},
-					    {0x130ff70, 0x130ff5f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff17},
-					    {0x12eff28, 0x12effa9},
-					    {0x12fff5c, 0x12fffb9},
-					    {0x130ff8f, 0x130ff72},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff1f},
-					    {0x12eff7a, 0x12eff4e},
-					    {0x12fff14, 0x12fffca},
-					    {0x130ffae, 0x130ff85},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff27},
-					    {0x12effcc, 0x12efff3},
-					    {0x12fffcc, 0x12fffda},
-					    {0x130ffcc, 0x130ff98},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff2f},
-					    {0x12eff1e, 0x12eff98},
-					    {0x12fff85, 0x12fffeb},
-					    {0x130ffeb, 0x130ffab},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff37},
-					    {0x12eff70, 0x12eff3d},
-					    {0x12fff3d, 0x12ffffc},
-					    {0x130ff0a, 0x130ffbe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff3f},
-					    {0x12effc2, 0x12effe2},
-					    {0x12ffff5, 0x12fff0c},
-					    {0x130ff28, 0x130ffd2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff47},
-					    {0x12eff14, 0x12eff87},
-					    {0x12fffae, 0x12fff1d},
-					    {0x130ff47, 0x130ffe5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff4f},
-					    {0x12eff66, 0x12eff2c},
-					    {0x12fff66, 0x12fff2e},
-					    {0x130ff66, 0x130fff8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff57},
-					    {0x12effb8, 0x12effd1},
-					    {0x12fff1e, 0x12fff3e},
-					    {0x130ff85, 0x130ff0b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff5f},
-					    {0x12eff0a, 0x12eff76},
-					    {0x12fffd7, 0x12fff4f},
-					    {0x130ffa3, 0x130ff1e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff67},
-					    {0x12eff5c, 0x12eff1b},
-					    {0x12fff8f, 0x12fff60},
-					    {0x130ffc2, 0x130ff31},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff06, 0x10fff06},
-					    {0x110ff0c, 0x110ff0c},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff70},
-					    {0x12effae, 0x12effc0},
-					    {0x12fff47, 0x12fff70},
-					    {0x130ffe1, 0x130ff44},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff15},
-					    {0x12eff99, 0x12eff5e},
-					    {0x12fff99, 0x12fff24},
-					    {0x130ff19, 0x130ffae},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff46},
-					    {0x12eff33, 0x12eff92},
-					    {0x12fff33, 0x12fff07},
-					    {0x130ff33, 0x130ffbe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff78},
-					    {0x12effcc, 0x12effc6},
-					    {0x12fffcc, 0x12fffea},
-					    {0x130ff4c, 0x130ffcd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa9},
-					    {0x12eff66, 0x12efffa},
-					    {0x12fff66, 0x12fffcd},
-					    {0x130ff66, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffdb},
-					    {0x12eff00, 0x12eff2e},
-					    {0x12fff00, 0x12fffb1},
-					    {0x130ff80, 0x130ffed},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff3d},
-					    {0x12eff33, 0x12eff97},
-					    {0x12fff33, 0x12fff77},
-					    {0x130ffb3, 0x130ff0d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa0},
-					    {0x12eff66, 0x12effff},
-					    {0x12fff66, 0x12fff3d},
-					    {0x130ffe6, 0x130ff2d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffd2},
-					    {0x12eff00, 0x12eff33},
-					    {0x12fff00, 0x12fff21},
-					    {0x130ff00, 0x130ff3d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff03},
-					    {0x12eff99, 0x12eff68},
-					    {0x12fff99, 0x12fff04},
-					    {0x130ff19, 0x130ff4d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff66},
-					    {0x12effcc, 0x12effd0},
-					    {0x12fffcc, 0x12fffca},
-					    {0x130ff4c, 0x130ff6c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff97},
-					    {0x12eff66, 0x12eff04},
-					    {0x12fff66, 0x12fffae},
-					    {0x130ff66, 0x130ff7c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffc9},
-					    {0x12eff00, 0x12eff38},
-					    {0x12fff00, 0x12fff91},
-					    {0x130ff80, 0x130ff8c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dfffa},
-					    {0x12eff99, 0x12eff6c},
-					    {0x12fff99, 0x12fff74},
-					    {0x130ff99, 0x130ff9c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff2b},
-					    {0x12eff33, 0x12effa1},
-					    {0x12fff33, 0x12fff57},
-					    {0x130ffb3, 0x130ffac},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff5d},
-					    {0x12effcc, 0x12effd5},
-					    {0x12fffcc, 0x12fff3a},
-					    {0x130ffcc, 0x130ffbc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff8e},
-					    {0x12eff66, 0x12eff09},
-					    {0x12fff66, 0x12fff1e},
-					    {0x130ffe6, 0x130ffcc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffc0},
-					    {0x12eff00, 0x12eff3d},
-					    {0x12fff00, 0x12fff01},
-					    {0x130ff00, 0x130ffdc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dfff1},
-					    {0x12eff99, 0x12eff71},
-					    {0x12fff99, 0x12fffe4},
-					    {0x130ff19, 0x130ffeb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff22},
-					    {0x12eff33, 0x12effa6},
-					    {0x12fff33, 0x12fffc7},
-					    {0x130ff33, 0x130fffb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff54},
-					    {0x12effcc, 0x12effda},
-					    {0x12fffcc, 0x12fffaa},
-					    {0x130ff4c, 0x130ff0b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff85},
-					    {0x12eff66, 0x12eff0e},
-					    {0x12fff66, 0x12fff8e},
-					    {0x130ff66, 0x130ff1b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffb7},
-					    {0x12eff00, 0x12eff42},
-					    {0x12fff00, 0x12fff71},
-					    {0x130ff80, 0x130ff2b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffe8},
-					    {0x12eff99, 0x12eff76},
-					    {0x12fff99, 0x12fff54},
-					    {0x130ff99, 0x130ff3b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff19},
-					    {0x12eff33, 0x12effab},
-					    {0x12fff33, 0x12fff37},
-					    {0x130ffb3, 0x130ff4b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff4b},
-					    {0x12effcc, 0x12effdf},
-					    {0x12fffcc, 0x12fff1a},
-					    {0x130ffcc, 0x130ff5b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff7c},
-					    {0x12eff66, 0x12eff13},
-					    {0x12fff66, 0x12ffffe},
-					    {0x130ffe6, 0x130ff6a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffae},
-					    {0x12eff00, 0x12eff47},
-					    {0x12fff00, 0x12fffe1},
-					    {0x130ff00, 0x130ff7a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffdf},
-					    {0x12eff99, 0x12eff7b},
-					    {0x12fff99, 0x12fffc4},
-					    {0x130ff19, 0x130ff8a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff10},
-					    {0x12eff33, 0x12effb0},
-					    {0x12fff33, 0x12fffa7},
-					    {0x130ff33, 0x130ff9a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff42},
-					    {0x12effcc, 0x12effe4},
-					    {0x12fffcc, 0x12fff8a},
-					    {0x130ff4c, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff73},
-					    {0x12eff66, 0x12eff18},
-					    {0x12fff66, 0x12fff6e},
-					    {0x130ff66, 0x130ffba},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffa5},
-					    {0x12eff00, 0x12eff4c},
-					    {0x12fff00, 0x12fff51},
-					    {0x130ff80, 0x130ffca},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffd6},
-					    {0x12eff99, 0x12eff80},
-					    {0x12fff99, 0x12fff34},
-					    {0x130ff99, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff07},
-					    {0x12eff33, 0x12effb5},
-					    {0x12fff33, 0x12fff17},
-					    {0x130ffb3, 0x130ffea},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff39},
-					    {0x12effcc, 0x12effe9},
-					    {0x12fffcc, 0x12ffffa},
-					    {0x130ffcc, 0x130fff9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff6a},
-					    {0x12eff66, 0x12eff1d},
-					    {0x12fff66, 0x12fffde},
-					    {0x130ffe6, 0x130ff09},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff9c},
-					    {0x12eff00, 0x12eff51},
-					    {0x12fff00, 0x12fffc1},
-					    {0x130ff00, 0x130ff19},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffcd},
-					    {0x12eff99, 0x12eff85},
-					    {0x12fff99, 0x12fffa4},
-					    {0x130ff19, 0x130ff29},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dfffe},
-					    {0x12eff33, 0x12effb9},
-					    {0x12fff33, 0x12fff87},
-					    {0x130ff33, 0x130ff39},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff30},
-					    {0x12effcc, 0x12effee},
-					    {0x12fffcc, 0x12fff6a},
-					    {0x130ff4c, 0x130ff49},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff61},
-					    {0x12eff66, 0x12eff22},
-					    {0x12fff66, 0x12fff4e},
-					    {0x130ff66, 0x130ff59},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff93},
-					    {0x12eff00, 0x12eff56},
-					    {0x12fff00, 0x12fff31},
-					    {0x130ff80, 0x130ff69},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffc4},
-					    {0x12eff99, 0x12eff8a},
-					    {0x12fff99, 0x12fff14},
-					    {0x130ff99, 0x130ff79},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dfff5},
-					    {0x12eff33, 0x12effbe},
-					    {0x12fff33, 0x12ffff7},
-					    {0x130ffb3, 0x130ff88},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff27},
-					    {0x12effcc, 0x12efff3},
-					    {0x12fffcc, 0x12fffda},
-					    {0x130ffcc, 0x130ff98},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff58},
-					    {0x12eff66, 0x12eff27},
-					    {0x12fff66, 0x12fffbe},
-					    {0x130ffe6, 0x130ffa8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff8a},
-					    {0x12eff00, 0x12eff5b},
-					    {0x12fff00, 0x12fffa1},
-					    {0x130ff00, 0x130ffb8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffbb},
-					    {0x12eff99, 0x12eff8f},
-					    {0x12fff99, 0x12fff84},
-					    {0x130ff19, 0x130ffc8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffec},
-					    {0x12eff33, 0x12effc3},
-					    {0x12fff33, 0x12fff67},
-					    {0x130ff33, 0x130ffd8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff1e},
-					    {0x12effcc, 0x12efff8},
-					    {0x12fffcc, 0x12fff4a},
-					    {0x130ff4c, 0x130ffe8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff4f},
-					    {0x12eff66, 0x12eff2c},
-					    {0x12fff66, 0x12fff2e},
-					    {0x130ff66, 0x130fff8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff81},
-					    {0x12eff00, 0x12eff60},
-					    {0x12fff00, 0x12fff11},
-					    {0x130ff80, 0x130ff08},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffb2},
-					    {0x12eff99, 0x12eff94},
-					    {0x12fff99, 0x12ffff4},
-					    {0x130ff99, 0x130ff17},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffe3},
-					    {0x12eff33, 0x12effc8},
-					    {0x12fff33, 0x12fffd7},
-					    {0x130ffb3, 0x130ff27},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff15},
-					    {0x12effcc, 0x12efffd},
-					    {0x12fffcc, 0x12fffba},
-					    {0x130ffcc, 0x130ff37},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff46},
-					    {0x12eff66, 0x12eff31},
-					    {0x12fff66, 0x12fff9e},
-					    {0x130ffe6, 0x130ff47},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff78},
-					    {0x12eff00, 0x12eff65},
-					    {0x12fff00, 0x12fff81},
-					    {0x130ff00, 0x130ff57},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffa9},
-					    {0x12eff99, 0x12eff99},
-					    {0x12fff99, 0x12fff64},
-					    {0x130ff19, 0x130ff67},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffda},
-					    {0x12eff33, 0x12effcd},
-					    {0x12fff33, 0x12fff47},
-					    {0x130ff33, 0x130ff77},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff0c},
-					    {0x12effcc, 0x12eff02},
-					    {0x12fffcc, 0x12fff2b},
-					    {0x130ff4c, 0x130ff87},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff3d},
-					    {0x12eff66, 0x12eff36},
-					    {0x12fff66, 0x12fff0e},
-					    {0x130ff66, 0x130ff97},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff6f},
-					    {0x12eff00, 0x12eff6a},
-					    {0x12fff00, 0x12ffff1},
-					    {0x130ff80, 0x130ffa6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffa0},
-					    {0x12eff99, 0x12eff9e},
-					    {0x12fff99, 0x12fffd4},
-					    {0x130ff99, 0x130ffb6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffd1},
-					    {0x12eff33, 0x12effd2},
-					    {0x12fff33, 0x12fffb7},
-					    {0x130ffb3, 0x130ffc6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff03},
-					    {0x12effcc, 0x12eff07},
-					    {0x12fffcc, 0x12fff9b},
-					    {0x130ffcc, 0x130ffd6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff34},
-					    {0x12eff66, 0x12eff3b},
-					    {0x12fff66, 0x12fff7e},
-					    {0x130ffe6, 0x130ffe6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff66},
-					    {0x12eff00, 0x12eff6f},
-					    {0x12fff00, 0x12fff61},
-					    {0x130ff00, 0x130fff6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff97},
-					    {0x12eff99, 0x12effa3},
-					    {0x12fff99, 0x12fff44},
-					    {0x130ff19, 0x130ff06},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffc8},
-					    {0x12eff33, 0x12effd7},
-					    {0x12fff33, 0x12fff27},
-					    {0x130ff33, 0x130ff16},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dfffa},
-					    {0x12effcc, 0x12eff0b},
-					    {0x12fffcc, 0x12fff0b},
-					    {0x130ff4c, 0x130ff26},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff05, 0x10fff05},
-					    {0x110ff0a, 0x110ff0a},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff2b},
-					    {0x12eff66, 0x12eff40},
-					    {0x12fff66, 0x12fffee},
-					    {0x130ff66, 0x130ff35},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff3e},
-					    {0x12effe1, 0x12effed},
-					    {0x12fff7a, 0x12ffff6},
-					    {0x130ff14, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff99},
-					    {0x12effc2, 0x12effb0},
-					    {0x12ffff5, 0x12fffac},
-					    {0x130ff28, 0x130ffb7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff4e},
-					    {0x12eff85, 0x12eff37},
-					    {0x12fffeb, 0x12fff18},
-					    {0x130ff51, 0x130ffd1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa9},
-					    {0x12eff66, 0x12efffa},
-					    {0x12fff66, 0x12fffcd},
-					    {0x130ff66, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff04},
-					    {0x12eff47, 0x12effbe},
-					    {0x12fffe1, 0x12fff83},
-					    {0x130ff7a, 0x130ffea},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff5f},
-					    {0x12eff28, 0x12eff81},
-					    {0x12fff5c, 0x12fff39},
-					    {0x130ff8f, 0x130fff7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dffb9},
-					    {0x12eff0a, 0x12eff44},
-					    {0x12fffd7, 0x12fffef},
-					    {0x130ffa3, 0x130ff03},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff14},
-					    {0x12effeb, 0x12eff08},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffc9},
-					    {0x12effae, 0x12eff8e},
-					    {0x12fff47, 0x12fff10},
-					    {0x130ffe1, 0x130ff2a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff24},
-					    {0x12eff8f, 0x12eff52},
-					    {0x12fffc2, 0x12fffc6},
-					    {0x130fff5, 0x130ff36},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff7f},
-					    {0x12eff70, 0x12eff15},
-					    {0x12fff3d, 0x12fff7c},
-					    {0x130ff0a, 0x130ff43},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffda},
-					    {0x12eff51, 0x12effd8},
-					    {0x12fffb8, 0x12fff31},
-					    {0x130ff1e, 0x130ff50},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff8f},
-					    {0x12eff14, 0x12eff5f},
-					    {0x12fffae, 0x12fff9d},
-					    {0x130ff47, 0x130ff69},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffea},
-					    {0x12efff5, 0x12eff22},
-					    {0x12fff28, 0x12fff53},
-					    {0x130ff5c, 0x130ff76},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff45},
-					    {0x12effd7, 0x12effe6},
-					    {0x12fffa3, 0x12fff08},
-					    {0x130ff70, 0x130ff83},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff9f},
-					    {0x12effb8, 0x12effa9},
-					    {0x12fff1e, 0x12fffbe},
-					    {0x130ff85, 0x130ff8f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dfffa},
-					    {0x12eff99, 0x12eff6c},
-					    {0x12fff99, 0x12fff74},
-					    {0x130ff99, 0x130ff9c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff55},
-					    {0x12eff7a, 0x12eff30},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dffaf},
-					    {0x12eff5c, 0x12efff3},
-					    {0x12fff8f, 0x12fffdf},
-					    {0x130ffc2, 0x130ffb5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff0a},
-					    {0x12eff3d, 0x12effb7},
-					    {0x12fff0a, 0x12fff95},
-					    {0x130ffd7, 0x130ffc2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff65},
-					    {0x12eff1e, 0x12eff7a},
-					    {0x12fff85, 0x12fff4b},
-					    {0x130ffeb, 0x130ffcf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffc0},
-					    {0x12eff00, 0x12eff3d},
-					    {0x12fff00, 0x12fff01},
-					    {0x130ff00, 0x130ffdc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff1a},
-					    {0x12effe1, 0x12eff01},
-					    {0x12fff7a, 0x12fffb7},
-					    {0x130ff14, 0x130ffe8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff75},
-					    {0x12effc2, 0x12effc4},
-					    {0x12ffff5, 0x12fff6c},
-					    {0x130ff28, 0x130fff5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffd0},
-					    {0x12effa3, 0x12eff87},
-					    {0x12fff70, 0x12fff22},
-					    {0x130ff3d, 0x130ff02},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff2a},
-					    {0x12eff85, 0x12eff4b},
-					    {0x12fffeb, 0x12fffd8},
-					    {0x130ff51, 0x130ff0e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff85},
-					    {0x12eff66, 0x12eff0e},
-					    {0x12fff66, 0x12fff8e},
-					    {0x130ff66, 0x130ff1b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffe0},
-					    {0x12eff47, 0x12effd1},
-					    {0x12fffe1, 0x12fff43},
-					    {0x130ff7a, 0x130ff28},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff3b},
-					    {0x12eff28, 0x12eff95},
-					    {0x12fff5c, 0x12ffff9},
-					    {0x130ff8f, 0x130ff34},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff95},
-					    {0x12eff0a, 0x12eff58},
-					    {0x12fffd7, 0x12fffaf},
-					    {0x130ffa3, 0x130ff41},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dfff0},
-					    {0x12effeb, 0x12eff1b},
-					    {0x12fff51, 0x12fff65},
-					    {0x130ffb8, 0x130ff4e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff4b},
-					    {0x12effcc, 0x12effdf},
-					    {0x12fffcc, 0x12fff1a},
-					    {0x130ffcc, 0x130ff5b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffa5},
-					    {0x12effae, 0x12effa2},
-					    {0x12fff47, 0x12fffd0},
-					    {0x130ffe1, 0x130ff67},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff00},
-					    {0x12eff8f, 0x12eff66},
-					    {0x12fffc2, 0x12fff86},
-					    {0x130fff5, 0x130ff74},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff5b},
-					    {0x12eff70, 0x12eff29},
-					    {0x12fff3d, 0x12fff3c},
-					    {0x130ff0a, 0x130ff81},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffb6},
-					    {0x12eff51, 0x12effec},
-					    {0x12fffb8, 0x12ffff1},
-					    {0x130ff1e, 0x130ff8d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff10},
-					    {0x12eff33, 0x12effb0},
-					    {0x12fff33, 0x12fffa7},
-					    {0x130ff33, 0x130ff9a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff6b},
-					    {0x12eff14, 0x12eff73},
-					    {0x12fffae, 0x12fff5d},
-					    {0x130ff47, 0x130ffa7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffc6},
-					    {0x12efff5, 0x12eff36},
-					    {0x12fff28, 0x12fff13},
-					    {0x130ff5c, 0x130ffb4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff21},
-					    {0x12effd7, 0x12efffa},
-					    {0x12fffa3, 0x12fffc8},
-					    {0x130ff70, 0x130ffc0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff7b},
-					    {0x12effb8, 0x12effbd},
-					    {0x12fff1e, 0x12fff7e},
-					    {0x130ff85, 0x130ffcd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffd6},
-					    {0x12eff99, 0x12eff80},
-					    {0x12fff99, 0x12fff34},
-					    {0x130ff99, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff31},
-					    {0x12eff7a, 0x12eff44},
-					    {0x12fff14, 0x12fffea},
-					    {0x130ffae, 0x130ffe6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff8b},
-					    {0x12eff5c, 0x12eff07},
-					    {0x12fff8f, 0x12fffa0},
-					    {0x130ffc2, 0x130fff3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffe6},
-					    {0x12eff3d, 0x12effca},
-					    {0x12fff0a, 0x12fff55},
-					    {0x130ffd7, 0x130ff00},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff41},
-					    {0x12eff1e, 0x12eff8e},
-					    {0x12fff85, 0x12fff0b},
-					    {0x130ffeb, 0x130ff0d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff9c},
-					    {0x12eff00, 0x12eff51},
-					    {0x12fff00, 0x12fffc1},
-					    {0x130ff00, 0x130ff19},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dfff6},
-					    {0x12effe1, 0x12eff14},
-					    {0x12fff7a, 0x12fff77},
-					    {0x130ff14, 0x130ff26},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff51},
-					    {0x12effc2, 0x12effd8},
-					    {0x12ffff5, 0x12fff2c},
-					    {0x130ff28, 0x130ff33},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffac},
-					    {0x12effa3, 0x12eff9b},
-					    {0x12fff70, 0x12fffe2},
-					    {0x130ff3d, 0x130ff3f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff06},
-					    {0x12eff85, 0x12eff5f},
-					    {0x12fffeb, 0x12fff98},
-					    {0x130ff51, 0x130ff4c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff61},
-					    {0x12eff66, 0x12eff22},
-					    {0x12fff66, 0x12fff4e},
-					    {0x130ff66, 0x130ff59},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffbc},
-					    {0x12eff47, 0x12effe5},
-					    {0x12fffe1, 0x12fff03},
-					    {0x130ff7a, 0x130ff66},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff17},
-					    {0x12eff28, 0x12effa9},
-					    {0x12fff5c, 0x12fffb9},
-					    {0x130ff8f, 0x130ff72},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff71},
-					    {0x12eff0a, 0x12eff6c},
-					    {0x12fffd7, 0x12fff6f},
-					    {0x130ffa3, 0x130ff7f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffcc},
-					    {0x12effeb, 0x12eff2f},
-					    {0x12fff51, 0x12fff25},
-					    {0x130ffb8, 0x130ff8c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff27},
-					    {0x12effcc, 0x12efff3},
-					    {0x12fffcc, 0x12fffda},
-					    {0x130ffcc, 0x130ff98},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff82},
-					    {0x12effae, 0x12effb6},
-					    {0x12fff47, 0x12fff90},
-					    {0x130ffe1, 0x130ffa5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffdc},
-					    {0x12eff8f, 0x12eff79},
-					    {0x12fffc2, 0x12fff46},
-					    {0x130fff5, 0x130ffb2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff37},
-					    {0x12eff70, 0x12eff3d},
-					    {0x12fff3d, 0x12ffffc},
-					    {0x130ff0a, 0x130ffbe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff92},
-					    {0x12eff51, 0x12eff00},
-					    {0x12fffb8, 0x12fffb2},
-					    {0x130ff1e, 0x130ffcb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffec},
-					    {0x12eff33, 0x12effc3},
-					    {0x12fff33, 0x12fff67},
-					    {0x130ff33, 0x130ffd8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff47},
-					    {0x12eff14, 0x12eff87},
-					    {0x12fffae, 0x12fff1d},
-					    {0x130ff47, 0x130ffe5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffa2},
-					    {0x12efff5, 0x12eff4a},
-					    {0x12fff28, 0x12fffd3},
-					    {0x130ff5c, 0x130fff1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dfffd},
-					    {0x12effd7, 0x12eff0d},
-					    {0x12fffa3, 0x12fff89},
-					    {0x130ff70, 0x130fffe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff57},
-					    {0x12effb8, 0x12effd1},
-					    {0x12fff1e, 0x12fff3e},
-					    {0x130ff85, 0x130ff0b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffb2},
-					    {0x12eff99, 0x12eff94},
-					    {0x12fff99, 0x12ffff4},
-					    {0x130ff99, 0x130ff17},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff0d},
-					    {0x12eff7a, 0x12eff58},
-					    {0x12fff14, 0x12fffaa},
-					    {0x130ffae, 0x130ff24},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff67},
-					    {0x12eff5c, 0x12eff1b},
-					    {0x12fff8f, 0x12fff60},
-					    {0x130ffc2, 0x130ff31},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffc2},
-					    {0x12eff3d, 0x12effde},
-					    {0x12fff0a, 0x12fff15},
-					    {0x130ffd7, 0x130ff3e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff1d},
-					    {0x12eff1e, 0x12effa2},
-					    {0x12fff85, 0x12fffcb},
-					    {0x130ffeb, 0x130ff4a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff78},
-					    {0x12eff00, 0x12eff65},
-					    {0x12fff00, 0x12fff81},
-					    {0x130ff00, 0x130ff57},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dffd2},
-					    {0x12effe1, 0x12eff28},
-					    {0x12fff7a, 0x12fff37},
-					    {0x130ff14, 0x130ff64},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff2d},
-					    {0x12effc2, 0x12effec},
-					    {0x12ffff5, 0x12fffec},
-					    {0x130ff28, 0x130ff70},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dff88},
-					    {0x12effa3, 0x12effaf},
-					    {0x12fff70, 0x12fffa2},
-					    {0x130ff3d, 0x130ff7d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dffe2},
-					    {0x12eff85, 0x12eff72},
-					    {0x12fffeb, 0x12fff58},
-					    {0x130ff51, 0x130ff8a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff3d},
-					    {0x12eff66, 0x12eff36},
-					    {0x12fff66, 0x12fff0e},
-					    {0x130ff66, 0x130ff97},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff98},
-					    {0x12eff47, 0x12efff9},
-					    {0x12fffe1, 0x12fffc3},
-					    {0x130ff7a, 0x130ffa3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dfff3},
-					    {0x12eff28, 0x12effbc},
-					    {0x12fff5c, 0x12fff79},
-					    {0x130ff8f, 0x130ffb0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff4d},
-					    {0x12eff0a, 0x12eff80},
-					    {0x12fffd7, 0x12fff2f},
-					    {0x130ffa3, 0x130ffbd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffa8},
-					    {0x12effeb, 0x12eff43},
-					    {0x12fff51, 0x12fffe5},
-					    {0x130ffb8, 0x130ffc9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff03},
-					    {0x12effcc, 0x12eff07},
-					    {0x12fffcc, 0x12fff9b},
-					    {0x130ffcc, 0x130ffd6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff5e},
-					    {0x12effae, 0x12effca},
-					    {0x12fff47, 0x12fff50},
-					    {0x130ffe1, 0x130ffe3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffb8},
-					    {0x12eff8f, 0x12eff8d},
-					    {0x12fffc2, 0x12fff06},
-					    {0x130fff5, 0x130fff0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff13},
-					    {0x12eff70, 0x12eff51},
-					    {0x12fff3d, 0x12fffbc},
-					    {0x130ff0a, 0x130fffc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff6e},
-					    {0x12eff51, 0x12eff14},
-					    {0x12fffb8, 0x12fff72},
-					    {0x130ff1e, 0x130ff09},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffc8},
-					    {0x12eff33, 0x12effd7},
-					    {0x12fff33, 0x12fff27},
-					    {0x130ff33, 0x130ff16},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff23},
-					    {0x12eff14, 0x12eff9b},
-					    {0x12fffae, 0x12fffdd},
-					    {0x130ff47, 0x130ff22},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dff7e},
-					    {0x12efff5, 0x12eff5e},
-					    {0x12fff28, 0x12fff93},
-					    {0x130ff5c, 0x130ff2f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dffd9},
-					    {0x12effd7, 0x12eff21},
-					    {0x12fffa3, 0x12fff49},
-					    {0x130ff70, 0x130ff3c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff33},
-					    {0x12effb8, 0x12effe5},
-					    {0x12fff1e, 0x12ffffe},
-					    {0x130ff85, 0x130ff48},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff8e},
-					    {0x12eff99, 0x12effa8},
-					    {0x12fff99, 0x12fffb4},
-					    {0x130ff99, 0x130ff55},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dffe9},
-					    {0x12eff7a, 0x12eff6b},
-					    {0x12fff14, 0x12fff6a},
-					    {0x130ffae, 0x130ff62},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff43},
-					    {0x12eff5c, 0x12eff2f},
-					    {0x12fff8f, 0x12fff20},
-					    {0x130ffc2, 0x130ff6f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff9e},
-					    {0x12eff3d, 0x12efff2},
-					    {0x12fff0a, 0x12fffd5},
-					    {0x130ffd7, 0x130ff7b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dfff9},
-					    {0x12eff1e, 0x12effb5},
-					    {0x12fff85, 0x12fff8b},
-					    {0x130ffeb, 0x130ff88},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff54},
-					    {0x12eff00, 0x12eff79},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff95},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dffae},
-					    {0x12effe1, 0x12eff3c},
-					    {0x12fff7a, 0x12ffff7},
-					    {0x130ff14, 0x130ffa1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff09},
-					    {0x12effc2, 0x12eff00},
-					    {0x12ffff5, 0x12fffad},
-					    {0x130ff28, 0x130ffae},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dff64},
-					    {0x12effa3, 0x12effc3},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffbb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dffbe},
-					    {0x12eff85, 0x12eff86},
-					    {0x12fffeb, 0x12fff18},
-					    {0x130ff51, 0x130ffc8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff19},
-					    {0x12eff66, 0x12eff4a},
-					    {0x12fff66, 0x12fffce},
-					    {0x130ff66, 0x130ffd4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff74},
-					    {0x12eff47, 0x12eff0d},
-					    {0x12fffe1, 0x12fff84},
-					    {0x130ff7a, 0x130ffe1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dffcf},
-					    {0x12eff28, 0x12effd0},
-					    {0x12fff5c, 0x12fff39},
-					    {0x130ff8f, 0x130ffee},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff29},
-					    {0x12eff0a, 0x12eff94},
-					    {0x12fffd7, 0x12fffef},
-					    {0x130ffa3, 0x130fffa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff84},
-					    {0x12effeb, 0x12eff57},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff07},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffdf},
-					    {0x12effcc, 0x12eff1a},
-					    {0x12fffcc, 0x12fff5b},
-					    {0x130ffcc, 0x130ff14},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff3a},
-					    {0x12effae, 0x12effde},
-					    {0x12fff47, 0x12fff10},
-					    {0x130ffe1, 0x130ff21},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff94},
-					    {0x12eff8f, 0x12effa1},
-					    {0x12fffc2, 0x12fffc6},
-					    {0x130fff5, 0x130ff2d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dffef},
-					    {0x12eff70, 0x12eff64},
-					    {0x12fff3d, 0x12fff7c},
-					    {0x130ff0a, 0x130ff3a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff4a},
-					    {0x12eff51, 0x12eff28},
-					    {0x12fffb8, 0x12fff32},
-					    {0x130ff1e, 0x130ff47},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffa4},
-					    {0x12eff33, 0x12effeb},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff53},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dffff},
-					    {0x12eff14, 0x12effae},
-					    {0x12fffae, 0x12fff9d},
-					    {0x130ff47, 0x130ff60},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dff5a},
-					    {0x12efff5, 0x12eff72},
-					    {0x12fff28, 0x12fff53},
-					    {0x130ff5c, 0x130ff6d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dffb5},
-					    {0x12effd7, 0x12eff35},
-					    {0x12fffa3, 0x12fff09},
-					    {0x130ff70, 0x130ff7a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff0f},
-					    {0x12effb8, 0x12efff9},
-					    {0x12fff1e, 0x12fffbe},
-					    {0x130ff85, 0x130ff86},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff6a},
-					    {0x12eff99, 0x12effbc},
-					    {0x12fff99, 0x12fff74},
-					    {0x130ff99, 0x130ff93},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dffc5},
-					    {0x12eff7a, 0x12eff7f},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff1f},
-					    {0x12eff5c, 0x12eff43},
-					    {0x12fff8f, 0x12fffe0},
-					    {0x130ffc2, 0x130ffac},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff7a},
-					    {0x12eff3d, 0x12eff06},
-					    {0x12fff0a, 0x12fff96},
-					    {0x130ffd7, 0x130ffb9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff04, 0x10fff04},
-					    {0x110ff08, 0x110ff08},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dffd5},
-					    {0x12eff1e, 0x12effc9},
-					    {0x12fff85, 0x12fff4b},
-					    {0x130ffeb, 0x130ffc6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff68},
-					    {0x12eff28, 0x12eff7c},
-					    {0x12fff5c, 0x12fffc9},
-					    {0x130ff0f, 0x130ffa7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffec},
-					    {0x12eff51, 0x12effce},
-					    {0x12fffb8, 0x12fff51},
-					    {0x130ff1e, 0x130ffb1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff70},
-					    {0x12eff7a, 0x12eff21},
-					    {0x12fff14, 0x12fffda},
-					    {0x130ff2e, 0x130ffba},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff78},
-					    {0x12effcc, 0x12effc6},
-					    {0x12fffcc, 0x12fffea},
-					    {0x130ff4c, 0x130ffcd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dfffc},
-					    {0x12efff5, 0x12eff18},
-					    {0x12fff28, 0x12fff73},
-					    {0x130ff5c, 0x130ffd7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff80},
-					    {0x12eff1e, 0x12eff6b},
-					    {0x12fff85, 0x12ffffb},
-					    {0x130ff6b, 0x130ffe0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff04},
-					    {0x12eff47, 0x12effbe},
-					    {0x12fffe1, 0x12fff83},
-					    {0x130ff7a, 0x130ffea},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff88},
-					    {0x12eff70, 0x12eff10},
-					    {0x12fff3d, 0x12fff0c},
-					    {0x130ff8a, 0x130fff4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff90},
-					    {0x12effc2, 0x12effb5},
-					    {0x12ffff5, 0x12fff1c},
-					    {0x130ffa8, 0x130ff07},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff14},
-					    {0x12effeb, 0x12eff08},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff98},
-					    {0x12eff14, 0x12eff5a},
-					    {0x12fffae, 0x12fff2d},
-					    {0x130ffc7, 0x130ff1a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff1c},
-					    {0x12eff3d, 0x12effad},
-					    {0x12fff0a, 0x12fffb5},
-					    {0x130ffd7, 0x130ff23},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa0},
-					    {0x12eff66, 0x12effff},
-					    {0x12fff66, 0x12fff3d},
-					    {0x130ffe6, 0x130ff2d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff24},
-					    {0x12eff8f, 0x12eff52},
-					    {0x12fffc2, 0x12fffc6},
-					    {0x130fff5, 0x130ff36},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dffa8},
-					    {0x12effb8, 0x12effa4},
-					    {0x12fff1e, 0x12fff4e},
-					    {0x130ff05, 0x130ff40},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff2c},
-					    {0x12effe1, 0x12efff7},
-					    {0x12fff7a, 0x12fffd6},
-					    {0x130ff14, 0x130ff49},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dffb0},
-					    {0x12eff0a, 0x12eff49},
-					    {0x12fffd7, 0x12fff5f},
-					    {0x130ff23, 0x130ff53},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dffb8},
-					    {0x12eff5c, 0x12effee},
-					    {0x12fff8f, 0x12fff6f},
-					    {0x130ff42, 0x130ff66},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff3c},
-					    {0x12eff85, 0x12eff41},
-					    {0x12fffeb, 0x12ffff8},
-					    {0x130ff51, 0x130ff6f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffc0},
-					    {0x12effae, 0x12eff93},
-					    {0x12fff47, 0x12fff80},
-					    {0x130ff61, 0x130ff79},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff45},
-					    {0x12effd7, 0x12effe6},
-					    {0x12fffa3, 0x12fff08},
-					    {0x130ff70, 0x130ff83},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffc9},
-					    {0x12eff00, 0x12eff38},
-					    {0x12fff00, 0x12fff91},
-					    {0x130ff80, 0x130ff8c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff4d},
-					    {0x12eff28, 0x12eff8b},
-					    {0x12fff5c, 0x12fff19},
-					    {0x130ff8f, 0x130ff96},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffd1},
-					    {0x12eff51, 0x12effdd},
-					    {0x12fffb8, 0x12fffa1},
-					    {0x130ff9e, 0x130ff9f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff55},
-					    {0x12eff7a, 0x12eff30},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffd9},
-					    {0x12effa3, 0x12eff82},
-					    {0x12fff70, 0x12fffb2},
-					    {0x130ffbd, 0x130ffb2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff5d},
-					    {0x12effcc, 0x12effd5},
-					    {0x12fffcc, 0x12fff3a},
-					    {0x130ffcc, 0x130ffbc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffe1},
-					    {0x12efff5, 0x12eff27},
-					    {0x12fff28, 0x12fffc3},
-					    {0x130ffdc, 0x130ffc5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff65},
-					    {0x12eff1e, 0x12eff7a},
-					    {0x12fff85, 0x12fff4b},
-					    {0x130ffeb, 0x130ffcf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffe9},
-					    {0x12eff47, 0x12effcc},
-					    {0x12fffe1, 0x12fffd3},
-					    {0x130fffa, 0x130ffd8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff6d},
-					    {0x12eff70, 0x12eff1f},
-					    {0x12fff3d, 0x12fff5c},
-					    {0x130ff0a, 0x130ffe2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dfff1},
-					    {0x12eff99, 0x12eff71},
-					    {0x12fff99, 0x12fffe4},
-					    {0x130ff19, 0x130ffeb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff75},
-					    {0x12effc2, 0x12effc4},
-					    {0x12ffff5, 0x12fff6c},
-					    {0x130ff28, 0x130fff5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dfff9},
-					    {0x12effeb, 0x12eff16},
-					    {0x12fff51, 0x12ffff5},
-					    {0x130ff38, 0x130fffe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff7d},
-					    {0x12eff14, 0x12eff69},
-					    {0x12fffae, 0x12fff7d},
-					    {0x130ff47, 0x130ff08},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff01},
-					    {0x12eff3d, 0x12effbc},
-					    {0x12fff0a, 0x12fff05},
-					    {0x130ff57, 0x130ff12},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff85},
-					    {0x12eff66, 0x12eff0e},
-					    {0x12fff66, 0x12fff8e},
-					    {0x130ff66, 0x130ff1b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff09},
-					    {0x12eff8f, 0x12eff61},
-					    {0x12fffc2, 0x12fff16},
-					    {0x130ff75, 0x130ff25},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff8d},
-					    {0x12effb8, 0x12effb3},
-					    {0x12fff1e, 0x12fff9e},
-					    {0x130ff85, 0x130ff2e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff11},
-					    {0x12effe1, 0x12eff06},
-					    {0x12fff7a, 0x12fff27},
-					    {0x130ff94, 0x130ff38},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff95},
-					    {0x12eff0a, 0x12eff58},
-					    {0x12fffd7, 0x12fffaf},
-					    {0x130ffa3, 0x130ff41},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff19},
-					    {0x12eff33, 0x12effab},
-					    {0x12fff33, 0x12fff37},
-					    {0x130ffb3, 0x130ff4b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff9d},
-					    {0x12eff5c, 0x12efffd},
-					    {0x12fff8f, 0x12fffbf},
-					    {0x130ffc2, 0x130ff54},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff21},
-					    {0x12eff85, 0x12eff50},
-					    {0x12fffeb, 0x12fff48},
-					    {0x130ffd1, 0x130ff5e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffa5},
-					    {0x12effae, 0x12effa2},
-					    {0x12fff47, 0x12fffd0},
-					    {0x130ffe1, 0x130ff67},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff2a},
-					    {0x12effd7, 0x12efff5},
-					    {0x12fffa3, 0x12fff58},
-					    {0x130fff0, 0x130ff71},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffae},
-					    {0x12eff00, 0x12eff47},
-					    {0x12fff00, 0x12fffe1},
-					    {0x130ff00, 0x130ff7a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff32},
-					    {0x12eff28, 0x12eff9a},
-					    {0x12fff5c, 0x12fff69},
-					    {0x130ff0f, 0x130ff84},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffb6},
-					    {0x12eff51, 0x12effec},
-					    {0x12fffb8, 0x12ffff1},
-					    {0x130ff1e, 0x130ff8d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff3a},
-					    {0x12eff7a, 0x12eff3f},
-					    {0x12fff14, 0x12fff7a},
-					    {0x130ff2e, 0x130ff97},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffbe},
-					    {0x12effa3, 0x12eff91},
-					    {0x12fff70, 0x12fff02},
-					    {0x130ff3d, 0x130ffa1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff42},
-					    {0x12effcc, 0x12effe4},
-					    {0x12fffcc, 0x12fff8a},
-					    {0x130ff4c, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffc6},
-					    {0x12efff5, 0x12eff36},
-					    {0x12fff28, 0x12fff13},
-					    {0x130ff5c, 0x130ffb4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff4a},
-					    {0x12eff1e, 0x12eff89},
-					    {0x12fff85, 0x12fff9b},
-					    {0x130ff6b, 0x130ffbd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffce},
-					    {0x12eff47, 0x12effdb},
-					    {0x12fffe1, 0x12fff23},
-					    {0x130ff7a, 0x130ffc7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff52},
-					    {0x12eff70, 0x12eff2e},
-					    {0x12fff3d, 0x12fffac},
-					    {0x130ff8a, 0x130ffd0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffd6},
-					    {0x12eff99, 0x12eff80},
-					    {0x12fff99, 0x12fff34},
-					    {0x130ff99, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff5a},
-					    {0x12effc2, 0x12effd3},
-					    {0x12ffff5, 0x12fffbc},
-					    {0x130ffa8, 0x130ffe3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffde},
-					    {0x12effeb, 0x12eff25},
-					    {0x12fff51, 0x12fff45},
-					    {0x130ffb8, 0x130ffed},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff62},
-					    {0x12eff14, 0x12eff78},
-					    {0x12fffae, 0x12fffcd},
-					    {0x130ffc7, 0x130fff6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffe6},
-					    {0x12eff3d, 0x12effca},
-					    {0x12fff0a, 0x12fff55},
-					    {0x130ffd7, 0x130ff00},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff6a},
-					    {0x12eff66, 0x12eff1d},
-					    {0x12fff66, 0x12fffde},
-					    {0x130ffe6, 0x130ff09},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffee},
-					    {0x12eff8f, 0x12eff6f},
-					    {0x12fffc2, 0x12fff66},
-					    {0x130fff5, 0x130ff13},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff72},
-					    {0x12effb8, 0x12effc2},
-					    {0x12fff1e, 0x12fffee},
-					    {0x130ff05, 0x130ff1c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dfff6},
-					    {0x12effe1, 0x12eff14},
-					    {0x12fff7a, 0x12fff77},
-					    {0x130ff14, 0x130ff26},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff7a},
-					    {0x12eff0a, 0x12eff67},
-					    {0x12fffd7, 0x12fffff},
-					    {0x130ff23, 0x130ff2f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dfffe},
-					    {0x12eff33, 0x12effb9},
-					    {0x12fff33, 0x12fff87},
-					    {0x130ff33, 0x130ff39},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff82},
-					    {0x12eff5c, 0x12eff0c},
-					    {0x12fff8f, 0x12fff10},
-					    {0x130ff42, 0x130ff43},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff06},
-					    {0x12eff85, 0x12eff5f},
-					    {0x12fffeb, 0x12fff98},
-					    {0x130ff51, 0x130ff4c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff8b},
-					    {0x12effae, 0x12effb1},
-					    {0x12fff47, 0x12fff20},
-					    {0x130ff61, 0x130ff56},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff0f},
-					    {0x12effd7, 0x12eff04},
-					    {0x12fffa3, 0x12fffa9},
-					    {0x130ff70, 0x130ff5f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff93},
-					    {0x12eff00, 0x12eff56},
-					    {0x12fff00, 0x12fff31},
-					    {0x130ff80, 0x130ff69},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff17},
-					    {0x12eff28, 0x12effa9},
-					    {0x12fff5c, 0x12fffb9},
-					    {0x130ff8f, 0x130ff72},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff9b},
-					    {0x12eff51, 0x12efffb},
-					    {0x12fffb8, 0x12fff41},
-					    {0x130ff9e, 0x130ff7c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff1f},
-					    {0x12eff7a, 0x12eff4e},
-					    {0x12fff14, 0x12fffca},
-					    {0x130ffae, 0x130ff85},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffa3},
-					    {0x12effa3, 0x12effa0},
-					    {0x12fff70, 0x12fff52},
-					    {0x130ffbd, 0x130ff8f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff27},
-					    {0x12effcc, 0x12efff3},
-					    {0x12fffcc, 0x12fffda},
-					    {0x130ffcc, 0x130ff98},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffab},
-					    {0x12efff5, 0x12eff45},
-					    {0x12fff28, 0x12fff63},
-					    {0x130ffdc, 0x130ffa2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff2f},
-					    {0x12eff1e, 0x12eff98},
-					    {0x12fff85, 0x12fffeb},
-					    {0x130ffeb, 0x130ffab},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffb3},
-					    {0x12eff47, 0x12effea},
-					    {0x12fffe1, 0x12fff73},
-					    {0x130fffa, 0x130ffb5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff37},
-					    {0x12eff70, 0x12eff3d},
-					    {0x12fff3d, 0x12ffffc},
-					    {0x130ff0a, 0x130ffbe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffbb},
-					    {0x12eff99, 0x12eff8f},
-					    {0x12fff99, 0x12fff84},
-					    {0x130ff19, 0x130ffc8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff3f},
-					    {0x12effc2, 0x12effe2},
-					    {0x12ffff5, 0x12fff0c},
-					    {0x130ff28, 0x130ffd2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffc3},
-					    {0x12effeb, 0x12eff34},
-					    {0x12fff51, 0x12fff95},
-					    {0x130ff38, 0x130ffdb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff47},
-					    {0x12eff14, 0x12eff87},
-					    {0x12fffae, 0x12fff1d},
-					    {0x130ff47, 0x130ffe5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffcb},
-					    {0x12eff3d, 0x12effd9},
-					    {0x12fff0a, 0x12fffa5},
-					    {0x130ff57, 0x130ffee},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff4f},
-					    {0x12eff66, 0x12eff2c},
-					    {0x12fff66, 0x12fff2e},
-					    {0x130ff66, 0x130fff8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffd3},
-					    {0x12eff8f, 0x12eff7e},
-					    {0x12fffc2, 0x12fffb6},
-					    {0x130ff75, 0x130ff01},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff57},
-					    {0x12effb8, 0x12effd1},
-					    {0x12fff1e, 0x12fff3e},
-					    {0x130ff85, 0x130ff0b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dffdb},
-					    {0x12effe1, 0x12eff23},
-					    {0x12fff7a, 0x12fffc7},
-					    {0x130ff94, 0x130ff14},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff5f},
-					    {0x12eff0a, 0x12eff76},
-					    {0x12fffd7, 0x12fff4f},
-					    {0x130ffa3, 0x130ff1e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffe3},
-					    {0x12eff33, 0x12effc8},
-					    {0x12fff33, 0x12fffd7},
-					    {0x130ffb3, 0x130ff27},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff67},
-					    {0x12eff5c, 0x12eff1b},
-					    {0x12fff8f, 0x12fff60},
-					    {0x130ffc2, 0x130ff31},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dffeb},
-					    {0x12eff85, 0x12eff6d},
-					    {0x12fffeb, 0x12fffe8},
-					    {0x130ffd1, 0x130ff3a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff70},
-					    {0x12effae, 0x12effc0},
-					    {0x12fff47, 0x12fff70},
-					    {0x130ffe1, 0x130ff44},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dfff4},
-					    {0x12effd7, 0x12eff12},
-					    {0x12fffa3, 0x12ffff9},
-					    {0x130fff0, 0x130ff4d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fff03, 0x10fff03},
-					    {0x110ff06, 0x110ff06},
-					    {0x111ff30, 0x111ff30},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff78},
-					    {0x12eff00, 0x12eff65},
-					    {0x12fff00, 0x12fff81},
-					    {0x130ff00, 0x130ff57},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dfffc},
-					    {0x12effcc, 0x12effc3},
-					    {0x12fffcc, 0x12fff32},
-					    {0x130ff0c, 0x130ffa6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff15},
-					    {0x12eff99, 0x12eff5e},
-					    {0x12fff99, 0x12fff24},
-					    {0x130ff19, 0x130ffae},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff2e},
-					    {0x12eff66, 0x12efff8},
-					    {0x12fff66, 0x12fff15},
-					    {0x130ff26, 0x130ffb6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff46},
-					    {0x12eff33, 0x12eff92},
-					    {0x12fff33, 0x12fff07},
-					    {0x130ff33, 0x130ffbe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff5f},
-					    {0x12eff00, 0x12eff2c},
-					    {0x12fff00, 0x12ffff9},
-					    {0x130ff40, 0x130ffc5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff78},
-					    {0x12effcc, 0x12effc6},
-					    {0x12fffcc, 0x12fffea},
-					    {0x130ff4c, 0x130ffcd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff90},
-					    {0x12eff99, 0x12eff60},
-					    {0x12fff99, 0x12fffdc},
-					    {0x130ff59, 0x130ffd5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa9},
-					    {0x12eff66, 0x12efffa},
-					    {0x12fff66, 0x12fffcd},
-					    {0x130ff66, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffc2},
-					    {0x12eff33, 0x12eff94},
-					    {0x12fff33, 0x12fffbf},
-					    {0x130ff73, 0x130ffe5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffdb},
-					    {0x12eff00, 0x12eff2e},
-					    {0x12fff00, 0x12fffb1},
-					    {0x130ff80, 0x130ffed},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dfff3},
-					    {0x12effcc, 0x12effc8},
-					    {0x12fffcc, 0x12fffa2},
-					    {0x130ff8c, 0x130fff5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff25},
-					    {0x12eff66, 0x12efffd},
-					    {0x12fff66, 0x12fff85},
-					    {0x130ffa6, 0x130ff05},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff3d},
-					    {0x12eff33, 0x12eff97},
-					    {0x12fff33, 0x12fff77},
-					    {0x130ffb3, 0x130ff0d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff56},
-					    {0x12eff00, 0x12eff31},
-					    {0x12fff00, 0x12fff69},
-					    {0x130ffc0, 0x130ff15},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff87},
-					    {0x12eff99, 0x12eff65},
-					    {0x12fff99, 0x12fff4c},
-					    {0x130ffd9, 0x130ff25},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa0},
-					    {0x12eff66, 0x12effff},
-					    {0x12fff66, 0x12fff3d},
-					    {0x130ffe6, 0x130ff2d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffb9},
-					    {0x12eff33, 0x12eff99},
-					    {0x12fff33, 0x12fff2f},
-					    {0x130fff3, 0x130ff35},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffd2},
-					    {0x12eff00, 0x12eff33},
-					    {0x12fff00, 0x12fff21},
-					    {0x130ff00, 0x130ff3d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffea},
-					    {0x12effcc, 0x12effcd},
-					    {0x12fffcc, 0x12fff12},
-					    {0x130ff0c, 0x130ff45},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff03},
-					    {0x12eff99, 0x12eff68},
-					    {0x12fff99, 0x12fff04},
-					    {0x130ff19, 0x130ff4d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff1c},
-					    {0x12eff66, 0x12eff02},
-					    {0x12fff66, 0x12ffff6},
-					    {0x130ff26, 0x130ff54},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff4d},
-					    {0x12eff00, 0x12eff36},
-					    {0x12fff00, 0x12fffd9},
-					    {0x130ff40, 0x130ff64},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff66},
-					    {0x12effcc, 0x12effd0},
-					    {0x12fffcc, 0x12fffca},
-					    {0x130ff4c, 0x130ff6c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff7e},
-					    {0x12eff99, 0x12eff6a},
-					    {0x12fff99, 0x12fffbc},
-					    {0x130ff59, 0x130ff74},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff97},
-					    {0x12eff66, 0x12eff04},
-					    {0x12fff66, 0x12fffae},
-					    {0x130ff66, 0x130ff7c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffb0},
-					    {0x12eff33, 0x12eff9e},
-					    {0x12fff33, 0x12fff9f},
-					    {0x130ff73, 0x130ff84},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffc9},
-					    {0x12eff00, 0x12eff38},
-					    {0x12fff00, 0x12fff91},
-					    {0x130ff80, 0x130ff8c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffe1},
-					    {0x12effcc, 0x12effd2},
-					    {0x12fffcc, 0x12fff82},
-					    {0x130ff8c, 0x130ff94},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dfffa},
-					    {0x12eff99, 0x12eff6c},
-					    {0x12fff99, 0x12fff74},
-					    {0x130ff99, 0x130ff9c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff13},
-					    {0x12eff66, 0x12eff07},
-					    {0x12fff66, 0x12fff66},
-					    {0x130ffa6, 0x130ffa4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff2b},
-					    {0x12eff33, 0x12effa1},
-					    {0x12fff33, 0x12fff57},
-					    {0x130ffb3, 0x130ffac},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff44},
-					    {0x12eff00, 0x12eff3b},
-					    {0x12fff00, 0x12fff49},
-					    {0x130ffc0, 0x130ffb4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff5d},
-					    {0x12effcc, 0x12effd5},
-					    {0x12fffcc, 0x12fff3a},
-					    {0x130ffcc, 0x130ffbc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff75},
-					    {0x12eff99, 0x12eff6f},
-					    {0x12fff99, 0x12fff2c},
-					    {0x130ffd9, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff8e},
-					    {0x12eff66, 0x12eff09},
-					    {0x12fff66, 0x12fff1e},
-					    {0x130ffe6, 0x130ffcc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffa7},
-					    {0x12eff33, 0x12effa3},
-					    {0x12fff33, 0x12fff0f},
-					    {0x130fff3, 0x130ffd4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffc0},
-					    {0x12eff00, 0x12eff3d},
-					    {0x12fff00, 0x12fff01},
-					    {0x130ff00, 0x130ffdc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffd8},
-					    {0x12effcc, 0x12effd7},
-					    {0x12fffcc, 0x12ffff2},
-					    {0x130ff0c, 0x130ffe3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dfff1},
-					    {0x12eff99, 0x12eff71},
-					    {0x12fff99, 0x12fffe4},
-					    {0x130ff19, 0x130ffeb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff0a},
-					    {0x12eff66, 0x12eff0c},
-					    {0x12fff66, 0x12fffd6},
-					    {0x130ff26, 0x130fff3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff22},
-					    {0x12eff33, 0x12effa6},
-					    {0x12fff33, 0x12fffc7},
-					    {0x130ff33, 0x130fffb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff3b},
-					    {0x12eff00, 0x12eff40},
-					    {0x12fff00, 0x12fffb9},
-					    {0x130ff40, 0x130ff03},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff54},
-					    {0x12effcc, 0x12effda},
-					    {0x12fffcc, 0x12fffaa},
-					    {0x130ff4c, 0x130ff0b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff6c},
-					    {0x12eff99, 0x12eff74},
-					    {0x12fff99, 0x12fff9c},
-					    {0x130ff59, 0x130ff13},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff85},
-					    {0x12eff66, 0x12eff0e},
-					    {0x12fff66, 0x12fff8e},
-					    {0x130ff66, 0x130ff1b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff9e},
-					    {0x12eff33, 0x12effa8},
-					    {0x12fff33, 0x12fff7f},
-					    {0x130ff73, 0x130ff23},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffb7},
-					    {0x12eff00, 0x12eff42},
-					    {0x12fff00, 0x12fff71},
-					    {0x130ff80, 0x130ff2b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffcf},
-					    {0x12effcc, 0x12effdc},
-					    {0x12fffcc, 0x12fff62},
-					    {0x130ff8c, 0x130ff33},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffe8},
-					    {0x12eff99, 0x12eff76},
-					    {0x12fff99, 0x12fff54},
-					    {0x130ff99, 0x130ff3b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff01},
-					    {0x12eff66, 0x12eff11},
-					    {0x12fff66, 0x12fff46},
-					    {0x130ffa6, 0x130ff43},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff19},
-					    {0x12eff33, 0x12effab},
-					    {0x12fff33, 0x12fff37},
-					    {0x130ffb3, 0x130ff4b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff32},
-					    {0x12eff00, 0x12eff45},
-					    {0x12fff00, 0x12fff29},
-					    {0x130ffc0, 0x130ff53},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff4b},
-					    {0x12effcc, 0x12effdf},
-					    {0x12fffcc, 0x12fff1a},
-					    {0x130ffcc, 0x130ff5b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff63},
-					    {0x12eff99, 0x12eff79},
-					    {0x12fff99, 0x12fff0c},
-					    {0x130ffd9, 0x130ff63},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff7c},
-					    {0x12eff66, 0x12eff13},
-					    {0x12fff66, 0x12ffffe},
-					    {0x130ffe6, 0x130ff6a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff95},
-					    {0x12eff33, 0x12effad},
-					    {0x12fff33, 0x12fffef},
-					    {0x130fff3, 0x130ff72},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffae},
-					    {0x12eff00, 0x12eff47},
-					    {0x12fff00, 0x12fffe1},
-					    {0x130ff00, 0x130ff7a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffc6},
-					    {0x12effcc, 0x12effe1},
-					    {0x12fffcc, 0x12fffd2},
-					    {0x130ff0c, 0x130ff82},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffdf},
-					    {0x12eff99, 0x12eff7b},
-					    {0x12fff99, 0x12fffc4},
-					    {0x130ff19, 0x130ff8a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dfff8},
-					    {0x12eff66, 0x12eff15},
-					    {0x12fff66, 0x12fffb6},
-					    {0x130ff26, 0x130ff92},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff10},
-					    {0x12eff33, 0x12effb0},
-					    {0x12fff33, 0x12fffa7},
-					    {0x130ff33, 0x130ff9a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff29},
-					    {0x12eff00, 0x12eff4a},
-					    {0x12fff00, 0x12fff99},
-					    {0x130ff40, 0x130ffa2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff42},
-					    {0x12effcc, 0x12effe4},
-					    {0x12fffcc, 0x12fff8a},
-					    {0x130ff4c, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff5a},
-					    {0x12eff99, 0x12eff7e},
-					    {0x12fff99, 0x12fff7c},
-					    {0x130ff59, 0x130ffb2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff73},
-					    {0x12eff66, 0x12eff18},
-					    {0x12fff66, 0x12fff6e},
-					    {0x130ff66, 0x130ffba},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff8c},
-					    {0x12eff33, 0x12effb2},
-					    {0x12fff33, 0x12fff5f},
-					    {0x130ff73, 0x130ffc2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffa5},
-					    {0x12eff00, 0x12eff4c},
-					    {0x12fff00, 0x12fff51},
-					    {0x130ff80, 0x130ffca},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffbd},
-					    {0x12effcc, 0x12effe6},
-					    {0x12fffcc, 0x12fff42},
-					    {0x130ff8c, 0x130ffd2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffd6},
-					    {0x12eff99, 0x12eff80},
-					    {0x12fff99, 0x12fff34},
-					    {0x130ff99, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffef},
-					    {0x12eff66, 0x12eff1a},
-					    {0x12fff66, 0x12fff26},
-					    {0x130ffa6, 0x130ffe2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff07},
-					    {0x12eff33, 0x12effb5},
-					    {0x12fff33, 0x12fff17},
-					    {0x130ffb3, 0x130ffea},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff20},
-					    {0x12eff00, 0x12eff4f},
-					    {0x12fff00, 0x12fff09},
-					    {0x130ffc0, 0x130fff2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff39},
-					    {0x12effcc, 0x12effe9},
-					    {0x12fffcc, 0x12ffffa},
-					    {0x130ffcc, 0x130fff9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff51},
-					    {0x12eff99, 0x12eff83},
-					    {0x12fff99, 0x12fffec},
-					    {0x130ffd9, 0x130ff01},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff6a},
-					    {0x12eff66, 0x12eff1d},
-					    {0x12fff66, 0x12fffde},
-					    {0x130ffe6, 0x130ff09},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff83},
-					    {0x12eff33, 0x12effb7},
-					    {0x12fff33, 0x12fffcf},
-					    {0x130fff3, 0x130ff11},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff9c},
-					    {0x12eff00, 0x12eff51},
-					    {0x12fff00, 0x12fffc1},
-					    {0x130ff00, 0x130ff19},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffb4},
-					    {0x12effcc, 0x12effeb},
-					    {0x12fffcc, 0x12fffb2},
-					    {0x130ff0c, 0x130ff21},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffcd},
-					    {0x12eff99, 0x12eff85},
-					    {0x12fff99, 0x12fffa4},
-					    {0x130ff19, 0x130ff29},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffe6},
-					    {0x12eff66, 0x12eff1f},
-					    {0x12fff66, 0x12fff96},
-					    {0x130ff26, 0x130ff31},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dfffe},
-					    {0x12eff33, 0x12effb9},
-					    {0x12fff33, 0x12fff87},
-					    {0x130ff33, 0x130ff39},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff17},
-					    {0x12eff00, 0x12eff54},
-					    {0x12fff00, 0x12fff79},
-					    {0x130ff40, 0x130ff41},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff30},
-					    {0x12effcc, 0x12effee},
-					    {0x12fffcc, 0x12fff6a},
-					    {0x130ff4c, 0x130ff49},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff48},
-					    {0x12eff99, 0x12eff88},
-					    {0x12fff99, 0x12fff5c},
-					    {0x130ff59, 0x130ff51},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff61},
-					    {0x12eff66, 0x12eff22},
-					    {0x12fff66, 0x12fff4e},
-					    {0x130ff66, 0x130ff59},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff7a},
-					    {0x12eff33, 0x12effbc},
-					    {0x12fff33, 0x12fff3f},
-					    {0x130ff73, 0x130ff61},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff93},
-					    {0x12eff00, 0x12eff56},
-					    {0x12fff00, 0x12fff31},
-					    {0x130ff80, 0x130ff69},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffab},
-					    {0x12effcc, 0x12efff0},
-					    {0x12fffcc, 0x12fff22},
-					    {0x130ff8c, 0x130ff71},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffc4},
-					    {0x12eff99, 0x12eff8a},
-					    {0x12fff99, 0x12fff14},
-					    {0x130ff99, 0x130ff79},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffdd},
-					    {0x12eff66, 0x12eff24},
-					    {0x12fff66, 0x12fff06},
-					    {0x130ffa6, 0x130ff81},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dfff5},
-					    {0x12eff33, 0x12effbe},
-					    {0x12fff33, 0x12ffff7},
-					    {0x130ffb3, 0x130ff88},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff0e},
-					    {0x12eff00, 0x12eff59},
-					    {0x12fff00, 0x12fffe9},
-					    {0x130ffc0, 0x130ff90},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff27},
-					    {0x12effcc, 0x12efff3},
-					    {0x12fffcc, 0x12fffda},
-					    {0x130ffcc, 0x130ff98},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff3f},
-					    {0x12eff99, 0x12eff8d},
-					    {0x12fff99, 0x12fffcc},
-					    {0x130ffd9, 0x130ffa0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff58},
-					    {0x12eff66, 0x12eff27},
-					    {0x12fff66, 0x12fffbe},
-					    {0x130ffe6, 0x130ffa8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff71},
-					    {0x12eff33, 0x12effc1},
-					    {0x12fff33, 0x12fffaf},
-					    {0x130fff3, 0x130ffb0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff8a},
-					    {0x12eff00, 0x12eff5b},
-					    {0x12fff00, 0x12fffa1},
-					    {0x130ff00, 0x130ffb8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffa2},
-					    {0x12effcc, 0x12efff5},
-					    {0x12fffcc, 0x12fff92},
-					    {0x130ff0c, 0x130ffc0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffbb},
-					    {0x12eff99, 0x12eff8f},
-					    {0x12fff99, 0x12fff84},
-					    {0x130ff19, 0x130ffc8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffd4},
-					    {0x12eff66, 0x12eff29},
-					    {0x12fff66, 0x12fff76},
-					    {0x130ff26, 0x130ffd0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffec},
-					    {0x12eff33, 0x12effc3},
-					    {0x12fff33, 0x12fff67},
-					    {0x130ff33, 0x130ffd8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff05},
-					    {0x12eff00, 0x12eff5e},
-					    {0x12fff00, 0x12fff59},
-					    {0x130ff40, 0x130ffe0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff1e},
-					    {0x12effcc, 0x12efff8},
-					    {0x12fffcc, 0x12fff4a},
-					    {0x130ff4c, 0x130ffe8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff36},
-					    {0x12eff99, 0x12eff92},
-					    {0x12fff99, 0x12fff3c},
-					    {0x130ff59, 0x130fff0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff4f},
-					    {0x12eff66, 0x12eff2c},
-					    {0x12fff66, 0x12fff2e},
-					    {0x130ff66, 0x130fff8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff68},
-					    {0x12eff33, 0x12effc6},
-					    {0x12fff33, 0x12fff1f},
-					    {0x130ff73, 0x130ff00},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff81},
-					    {0x12eff00, 0x12eff60},
-					    {0x12fff00, 0x12fff11},
-					    {0x130ff80, 0x130ff08},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff99},
-					    {0x12effcc, 0x12efffa},
-					    {0x12fffcc, 0x12fff02},
-					    {0x130ff8c, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffb2},
-					    {0x12eff99, 0x12eff94},
-					    {0x12fff99, 0x12ffff4},
-					    {0x130ff99, 0x130ff17},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffcb},
-					    {0x12eff66, 0x12eff2e},
-					    {0x12fff66, 0x12fffe6},
-					    {0x130ffa6, 0x130ff1f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffe3},
-					    {0x12eff33, 0x12effc8},
-					    {0x12fff33, 0x12fffd7},
-					    {0x130ffb3, 0x130ff27},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dfffc},
-					    {0x12eff00, 0x12eff62},
-					    {0x12fff00, 0x12fffc9},
-					    {0x130ffc0, 0x130ff2f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff15},
-					    {0x12effcc, 0x12efffd},
-					    {0x12fffcc, 0x12fffba},
-					    {0x130ffcc, 0x130ff37},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff2d},
-					    {0x12eff99, 0x12eff97},
-					    {0x12fff99, 0x12fffac},
-					    {0x130ffd9, 0x130ff3f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff46},
-					    {0x12eff66, 0x12eff31},
-					    {0x12fff66, 0x12fff9e},
-					    {0x130ffe6, 0x130ff47},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff5f},
-					    {0x12eff33, 0x12effcb},
-					    {0x12fff33, 0x12fff8f},
-					    {0x130fff3, 0x130ff4f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff78},
-					    {0x12eff00, 0x12eff65},
-					    {0x12fff00, 0x12fff81},
-					    {0x130ff00, 0x130ff57},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff90},
-					    {0x12effcc, 0x12effff},
-					    {0x12fffcc, 0x12fff72},
-					    {0x130ff0c, 0x130ff5f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffa9},
-					    {0x12eff99, 0x12eff99},
-					    {0x12fff99, 0x12fff64},
-					    {0x130ff19, 0x130ff67},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffc2},
-					    {0x12eff66, 0x12eff33},
-					    {0x12fff66, 0x12fff56},
-					    {0x130ff26, 0x130ff6f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffda},
-					    {0x12eff33, 0x12effcd},
-					    {0x12fff33, 0x12fff47},
-					    {0x130ff33, 0x130ff77},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dfff3},
-					    {0x12eff00, 0x12eff67},
-					    {0x12fff00, 0x12fff39},
-					    {0x130ff40, 0x130ff7f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff0c},
-					    {0x12effcc, 0x12eff02},
-					    {0x12fffcc, 0x12fff2b},
-					    {0x130ff4c, 0x130ff87},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff24},
-					    {0x12eff99, 0x12eff9c},
-					    {0x12fff99, 0x12fff1c},
-					    {0x130ff59, 0x130ff8f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff3d},
-					    {0x12eff66, 0x12eff36},
-					    {0x12fff66, 0x12fff0e},
-					    {0x130ff66, 0x130ff97},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff56},
-					    {0x12eff33, 0x12effd0},
-					    {0x12fff33, 0x12fffff},
-					    {0x130ff73, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff6f},
-					    {0x12eff00, 0x12eff6a},
-					    {0x12fff00, 0x12ffff1},
-					    {0x130ff80, 0x130ffa6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff87},
-					    {0x12effcc, 0x12eff04},
-					    {0x12fffcc, 0x12fffe3},
-					    {0x130ff8c, 0x130ffae},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffa0},
-					    {0x12eff99, 0x12eff9e},
-					    {0x12fff99, 0x12fffd4},
-					    {0x130ff99, 0x130ffb6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffb9},
-					    {0x12eff66, 0x12eff38},
-					    {0x12fff66, 0x12fffc6},
-					    {0x130ffa6, 0x130ffbe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffd1},
-					    {0x12eff33, 0x12effd2},
-					    {0x12fff33, 0x12fffb7},
-					    {0x130ffb3, 0x130ffc6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffea},
-					    {0x12eff00, 0x12eff6c},
-					    {0x12fff00, 0x12fffa9},
-					    {0x130ffc0, 0x130ffce},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff03},
-					    {0x12effcc, 0x12eff07},
-					    {0x12fffcc, 0x12fff9b},
-					    {0x130ffcc, 0x130ffd6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff1b},
-					    {0x12eff99, 0x12effa1},
-					    {0x12fff99, 0x12fff8c},
-					    {0x130ffd9, 0x130ffde},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff34},
-					    {0x12eff66, 0x12eff3b},
-					    {0x12fff66, 0x12fff7e},
-					    {0x130ffe6, 0x130ffe6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff4d},
-					    {0x12eff33, 0x12effd5},
-					    {0x12fff33, 0x12fff6f},
-					    {0x130fff3, 0x130ffee},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff66},
-					    {0x12eff00, 0x12eff6f},
-					    {0x12fff00, 0x12fff61},
-					    {0x130ff00, 0x130fff6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff7e},
-					    {0x12effcc, 0x12eff09},
-					    {0x12fffcc, 0x12fff53},
-					    {0x130ff0c, 0x130fffe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff97},
-					    {0x12eff99, 0x12effa3},
-					    {0x12fff99, 0x12fff44},
-					    {0x130ff19, 0x130ff06},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffb0},
-					    {0x12eff66, 0x12eff3d},
-					    {0x12fff66, 0x12fff36},
-					    {0x130ff26, 0x130ff0e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffc8},
-					    {0x12eff33, 0x12effd7},
-					    {0x12fff33, 0x12fff27},
-					    {0x130ff33, 0x130ff16},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffe1},
-					    {0x12eff00, 0x12eff71},
-					    {0x12fff00, 0x12fff19},
-					    {0x130ff40, 0x130ff1e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dfffa},
-					    {0x12effcc, 0x12eff0b},
-					    {0x12fffcc, 0x12fff0b},
-					    {0x130ff4c, 0x130ff26},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff12},
-					    {0x12eff99, 0x12effa6},
-					    {0x12fff99, 0x12ffffc},
-					    {0x130ff59, 0x130ff2d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff2b},
-					    {0x12eff66, 0x12eff40},
-					    {0x12fff66, 0x12fffee},
-					    {0x130ff66, 0x130ff35},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff05, 0x110ff05},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff44},
-					    {0x12eff33, 0x12effda},
-					    {0x12fff33, 0x12fffdf},
-					    {0x130ff73, 0x130ff3d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff91},
-					    {0x12eff70, 0x12eff0b},
-					    {0x12fff3d, 0x12fff9c},
-					    {0x130ff0a, 0x130ffa4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff3e},
-					    {0x12effe1, 0x12effed},
-					    {0x12fff7a, 0x12ffff6},
-					    {0x130ff14, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffec},
-					    {0x12eff51, 0x12effce},
-					    {0x12fffb8, 0x12fff51},
-					    {0x130ff1e, 0x130ffb1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff99},
-					    {0x12effc2, 0x12effb0},
-					    {0x12ffff5, 0x12fffac},
-					    {0x130ff28, 0x130ffb7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff46},
-					    {0x12eff33, 0x12eff92},
-					    {0x12fff33, 0x12fff07},
-					    {0x130ff33, 0x130ffbe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dffa1},
-					    {0x12eff14, 0x12eff55},
-					    {0x12fffae, 0x12fffbd},
-					    {0x130ff47, 0x130ffca},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff4e},
-					    {0x12eff85, 0x12eff37},
-					    {0x12fffeb, 0x12fff18},
-					    {0x130ff51, 0x130ffd1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dfffc},
-					    {0x12efff5, 0x12eff18},
-					    {0x12fff28, 0x12fff73},
-					    {0x130ff5c, 0x130ffd7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa9},
-					    {0x12eff66, 0x12efffa},
-					    {0x12fff66, 0x12fffcd},
-					    {0x130ff66, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff57},
-					    {0x12effd7, 0x12effdc},
-					    {0x12fffa3, 0x12fff28},
-					    {0x130ff70, 0x130ffe4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff04},
-					    {0x12eff47, 0x12effbe},
-					    {0x12fffe1, 0x12fff83},
-					    {0x130ff7a, 0x130ffea},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dffb1},
-					    {0x12effb8, 0x12eff9f},
-					    {0x12fff1e, 0x12fffde},
-					    {0x130ff85, 0x130fff0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff5f},
-					    {0x12eff28, 0x12eff81},
-					    {0x12fff5c, 0x12fff39},
-					    {0x130ff8f, 0x130fff7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dffb9},
-					    {0x12eff0a, 0x12eff44},
-					    {0x12fffd7, 0x12fffef},
-					    {0x130ffa3, 0x130ff03},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff67},
-					    {0x12eff7a, 0x12eff26},
-					    {0x12fff14, 0x12fff4a},
-					    {0x130ffae, 0x130ff0a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff14},
-					    {0x12effeb, 0x12eff08},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dffc1},
-					    {0x12eff5c, 0x12effe9},
-					    {0x12fff8f, 0x12fffff},
-					    {0x130ffc2, 0x130ff16},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff6f},
-					    {0x12effcc, 0x12effcb},
-					    {0x12fffcc, 0x12fff5a},
-					    {0x130ffcc, 0x130ff1d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff1c},
-					    {0x12eff3d, 0x12effad},
-					    {0x12fff0a, 0x12fffb5},
-					    {0x130ffd7, 0x130ff23},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffc9},
-					    {0x12effae, 0x12eff8e},
-					    {0x12fff47, 0x12fff10},
-					    {0x130ffe1, 0x130ff2a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff77},
-					    {0x12eff1e, 0x12eff70},
-					    {0x12fff85, 0x12fff6b},
-					    {0x130ffeb, 0x130ff30},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff24},
-					    {0x12eff8f, 0x12eff52},
-					    {0x12fffc2, 0x12fffc6},
-					    {0x130fff5, 0x130ff36},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffd2},
-					    {0x12eff00, 0x12eff33},
-					    {0x12fff00, 0x12fff21},
-					    {0x130ff00, 0x130ff3d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff7f},
-					    {0x12eff70, 0x12eff15},
-					    {0x12fff3d, 0x12fff7c},
-					    {0x130ff0a, 0x130ff43},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff2c},
-					    {0x12effe1, 0x12efff7},
-					    {0x12fff7a, 0x12fffd6},
-					    {0x130ff14, 0x130ff49},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffda},
-					    {0x12eff51, 0x12effd8},
-					    {0x12fffb8, 0x12fff31},
-					    {0x130ff1e, 0x130ff50},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff87},
-					    {0x12effc2, 0x12effba},
-					    {0x12ffff5, 0x12fff8c},
-					    {0x130ff28, 0x130ff56},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffe2},
-					    {0x12effa3, 0x12eff7d},
-					    {0x12fff70, 0x12fff42},
-					    {0x130ff3d, 0x130ff63},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff8f},
-					    {0x12eff14, 0x12eff5f},
-					    {0x12fffae, 0x12fff9d},
-					    {0x130ff47, 0x130ff69},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff3c},
-					    {0x12eff85, 0x12eff41},
-					    {0x12fffeb, 0x12ffff8},
-					    {0x130ff51, 0x130ff6f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffea},
-					    {0x12efff5, 0x12eff22},
-					    {0x12fff28, 0x12fff53},
-					    {0x130ff5c, 0x130ff76},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff97},
-					    {0x12eff66, 0x12eff04},
-					    {0x12fff66, 0x12fffae},
-					    {0x130ff66, 0x130ff7c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff45},
-					    {0x12effd7, 0x12effe6},
-					    {0x12fffa3, 0x12fff08},
-					    {0x130ff70, 0x130ff83},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dfff2},
-					    {0x12eff47, 0x12effc7},
-					    {0x12fffe1, 0x12fff63},
-					    {0x130ff7a, 0x130ff89},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff9f},
-					    {0x12effb8, 0x12effa9},
-					    {0x12fff1e, 0x12fffbe},
-					    {0x130ff85, 0x130ff8f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff4d},
-					    {0x12eff28, 0x12eff8b},
-					    {0x12fff5c, 0x12fff19},
-					    {0x130ff8f, 0x130ff96},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dfffa},
-					    {0x12eff99, 0x12eff6c},
-					    {0x12fff99, 0x12fff74},
-					    {0x130ff99, 0x130ff9c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dffa7},
-					    {0x12eff0a, 0x12eff4e},
-					    {0x12fffd7, 0x12fffcf},
-					    {0x130ffa3, 0x130ffa2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff55},
-					    {0x12eff7a, 0x12eff30},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff02},
-					    {0x12effeb, 0x12eff12},
-					    {0x12fff51, 0x12fff85},
-					    {0x130ffb8, 0x130ffaf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dffaf},
-					    {0x12eff5c, 0x12efff3},
-					    {0x12fff8f, 0x12fffdf},
-					    {0x130ffc2, 0x130ffb5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff5d},
-					    {0x12effcc, 0x12effd5},
-					    {0x12fffcc, 0x12fff3a},
-					    {0x130ffcc, 0x130ffbc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff0a},
-					    {0x12eff3d, 0x12effb7},
-					    {0x12fff0a, 0x12fff95},
-					    {0x130ffd7, 0x130ffc2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffb7},
-					    {0x12effae, 0x12eff98},
-					    {0x12fff47, 0x12ffff0},
-					    {0x130ffe1, 0x130ffc8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff65},
-					    {0x12eff1e, 0x12eff7a},
-					    {0x12fff85, 0x12fff4b},
-					    {0x130ffeb, 0x130ffcf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff12},
-					    {0x12eff8f, 0x12eff5c},
-					    {0x12fffc2, 0x12fffa6},
-					    {0x130fff5, 0x130ffd5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffc0},
-					    {0x12eff00, 0x12eff3d},
-					    {0x12fff00, 0x12fff01},
-					    {0x130ff00, 0x130ffdc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff6d},
-					    {0x12eff70, 0x12eff1f},
-					    {0x12fff3d, 0x12fff5c},
-					    {0x130ff0a, 0x130ffe2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff1a},
-					    {0x12effe1, 0x12eff01},
-					    {0x12fff7a, 0x12fffb7},
-					    {0x130ff14, 0x130ffe8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffc8},
-					    {0x12eff51, 0x12effe2},
-					    {0x12fffb8, 0x12fff11},
-					    {0x130ff1e, 0x130ffef},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff75},
-					    {0x12effc2, 0x12effc4},
-					    {0x12ffff5, 0x12fff6c},
-					    {0x130ff28, 0x130fff5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff22},
-					    {0x12eff33, 0x12effa6},
-					    {0x12fff33, 0x12fffc7},
-					    {0x130ff33, 0x130fffb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffd0},
-					    {0x12effa3, 0x12eff87},
-					    {0x12fff70, 0x12fff22},
-					    {0x130ff3d, 0x130ff02},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff7d},
-					    {0x12eff14, 0x12eff69},
-					    {0x12fffae, 0x12fff7d},
-					    {0x130ff47, 0x130ff08},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff2a},
-					    {0x12eff85, 0x12eff4b},
-					    {0x12fffeb, 0x12fffd8},
-					    {0x130ff51, 0x130ff0e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffd8},
-					    {0x12efff5, 0x12eff2c},
-					    {0x12fff28, 0x12fff33},
-					    {0x130ff5c, 0x130ff15},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff85},
-					    {0x12eff66, 0x12eff0e},
-					    {0x12fff66, 0x12fff8e},
-					    {0x130ff66, 0x130ff1b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff33},
-					    {0x12effd7, 0x12efff0},
-					    {0x12fffa3, 0x12fffe8},
-					    {0x130ff70, 0x130ff21},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffe0},
-					    {0x12eff47, 0x12effd1},
-					    {0x12fffe1, 0x12fff43},
-					    {0x130ff7a, 0x130ff28},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff8d},
-					    {0x12effb8, 0x12effb3},
-					    {0x12fff1e, 0x12fff9e},
-					    {0x130ff85, 0x130ff2e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff3b},
-					    {0x12eff28, 0x12eff95},
-					    {0x12fff5c, 0x12ffff9},
-					    {0x130ff8f, 0x130ff34},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffe8},
-					    {0x12eff99, 0x12eff76},
-					    {0x12fff99, 0x12fff54},
-					    {0x130ff99, 0x130ff3b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff95},
-					    {0x12eff0a, 0x12eff58},
-					    {0x12fffd7, 0x12fffaf},
-					    {0x130ffa3, 0x130ff41},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff43},
-					    {0x12eff7a, 0x12eff3a},
-					    {0x12fff14, 0x12fff0a},
-					    {0x130ffae, 0x130ff48},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dfff0},
-					    {0x12effeb, 0x12eff1b},
-					    {0x12fff51, 0x12fff65},
-					    {0x130ffb8, 0x130ff4e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff9d},
-					    {0x12eff5c, 0x12efffd},
-					    {0x12fff8f, 0x12fffbf},
-					    {0x130ffc2, 0x130ff54},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff4b},
-					    {0x12effcc, 0x12effdf},
-					    {0x12fffcc, 0x12fff1a},
-					    {0x130ffcc, 0x130ff5b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dfff8},
-					    {0x12eff3d, 0x12effc0},
-					    {0x12fff0a, 0x12fff75},
-					    {0x130ffd7, 0x130ff61},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffa5},
-					    {0x12effae, 0x12effa2},
-					    {0x12fff47, 0x12fffd0},
-					    {0x130ffe1, 0x130ff67},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff53},
-					    {0x12eff1e, 0x12eff84},
-					    {0x12fff85, 0x12fff2b},
-					    {0x130ffeb, 0x130ff6e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff00},
-					    {0x12eff8f, 0x12eff66},
-					    {0x12fffc2, 0x12fff86},
-					    {0x130fff5, 0x130ff74},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffae},
-					    {0x12eff00, 0x12eff47},
-					    {0x12fff00, 0x12fffe1},
-					    {0x130ff00, 0x130ff7a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff5b},
-					    {0x12eff70, 0x12eff29},
-					    {0x12fff3d, 0x12fff3c},
-					    {0x130ff0a, 0x130ff81},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff08},
-					    {0x12effe1, 0x12eff0b},
-					    {0x12fff7a, 0x12fff97},
-					    {0x130ff14, 0x130ff87},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffb6},
-					    {0x12eff51, 0x12effec},
-					    {0x12fffb8, 0x12ffff1},
-					    {0x130ff1e, 0x130ff8d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff63},
-					    {0x12effc2, 0x12effce},
-					    {0x12ffff5, 0x12fff4c},
-					    {0x130ff28, 0x130ff94},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff10},
-					    {0x12eff33, 0x12effb0},
-					    {0x12fff33, 0x12fffa7},
-					    {0x130ff33, 0x130ff9a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffbe},
-					    {0x12effa3, 0x12eff91},
-					    {0x12fff70, 0x12fff02},
-					    {0x130ff3d, 0x130ffa1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff6b},
-					    {0x12eff14, 0x12eff73},
-					    {0x12fffae, 0x12fff5d},
-					    {0x130ff47, 0x130ffa7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff18},
-					    {0x12eff85, 0x12eff55},
-					    {0x12fffeb, 0x12fffb8},
-					    {0x130ff51, 0x130ffad},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffc6},
-					    {0x12efff5, 0x12eff36},
-					    {0x12fff28, 0x12fff13},
-					    {0x130ff5c, 0x130ffb4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff73},
-					    {0x12eff66, 0x12eff18},
-					    {0x12fff66, 0x12fff6e},
-					    {0x130ff66, 0x130ffba},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff21},
-					    {0x12effd7, 0x12efffa},
-					    {0x12fffa3, 0x12fffc8},
-					    {0x130ff70, 0x130ffc0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffce},
-					    {0x12eff47, 0x12effdb},
-					    {0x12fffe1, 0x12fff23},
-					    {0x130ff7a, 0x130ffc7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff7b},
-					    {0x12effb8, 0x12effbd},
-					    {0x12fff1e, 0x12fff7e},
-					    {0x130ff85, 0x130ffcd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff29},
-					    {0x12eff28, 0x12eff9f},
-					    {0x12fff5c, 0x12fffd9},
-					    {0x130ff8f, 0x130ffd3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffd6},
-					    {0x12eff99, 0x12eff80},
-					    {0x12fff99, 0x12fff34},
-					    {0x130ff99, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff83},
-					    {0x12eff0a, 0x12eff62},
-					    {0x12fffd7, 0x12fff8f},
-					    {0x130ffa3, 0x130ffe0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff31},
-					    {0x12eff7a, 0x12eff44},
-					    {0x12fff14, 0x12fffea},
-					    {0x130ffae, 0x130ffe6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffde},
-					    {0x12effeb, 0x12eff25},
-					    {0x12fff51, 0x12fff45},
-					    {0x130ffb8, 0x130ffed},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff8b},
-					    {0x12eff5c, 0x12eff07},
-					    {0x12fff8f, 0x12fffa0},
-					    {0x130ffc2, 0x130fff3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff39},
-					    {0x12effcc, 0x12effe9},
-					    {0x12fffcc, 0x12ffffa},
-					    {0x130ffcc, 0x130fff9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffe6},
-					    {0x12eff3d, 0x12effca},
-					    {0x12fff0a, 0x12fff55},
-					    {0x130ffd7, 0x130ff00},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff94},
-					    {0x12effae, 0x12effac},
-					    {0x12fff47, 0x12fffb0},
-					    {0x130ffe1, 0x130ff06},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff41},
-					    {0x12eff1e, 0x12eff8e},
-					    {0x12fff85, 0x12fff0b},
-					    {0x130ffeb, 0x130ff0d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffee},
-					    {0x12eff8f, 0x12eff6f},
-					    {0x12fffc2, 0x12fff66},
-					    {0x130fff5, 0x130ff13},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff9c},
-					    {0x12eff00, 0x12eff51},
-					    {0x12fff00, 0x12fffc1},
-					    {0x130ff00, 0x130ff19},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff49},
-					    {0x12eff70, 0x12eff33},
-					    {0x12fff3d, 0x12fff1c},
-					    {0x130ff0a, 0x130ff20},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dfff6},
-					    {0x12effe1, 0x12eff14},
-					    {0x12fff7a, 0x12fff77},
-					    {0x130ff14, 0x130ff26},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffa4},
-					    {0x12eff51, 0x12efff6},
-					    {0x12fffb8, 0x12fffd1},
-					    {0x130ff1e, 0x130ff2c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff51},
-					    {0x12effc2, 0x12effd8},
-					    {0x12ffff5, 0x12fff2c},
-					    {0x130ff28, 0x130ff33},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dfffe},
-					    {0x12eff33, 0x12effb9},
-					    {0x12fff33, 0x12fff87},
-					    {0x130ff33, 0x130ff39},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffac},
-					    {0x12effa3, 0x12eff9b},
-					    {0x12fff70, 0x12fffe2},
-					    {0x130ff3d, 0x130ff3f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff59},
-					    {0x12eff14, 0x12eff7d},
-					    {0x12fffae, 0x12fff3d},
-					    {0x130ff47, 0x130ff46},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff06},
-					    {0x12eff85, 0x12eff5f},
-					    {0x12fffeb, 0x12fff98},
-					    {0x130ff51, 0x130ff4c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffb4},
-					    {0x12efff5, 0x12eff40},
-					    {0x12fff28, 0x12ffff3},
-					    {0x130ff5c, 0x130ff52},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff61},
-					    {0x12eff66, 0x12eff22},
-					    {0x12fff66, 0x12fff4e},
-					    {0x130ff66, 0x130ff59},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff0f},
-					    {0x12effd7, 0x12eff04},
-					    {0x12fffa3, 0x12fffa9},
-					    {0x130ff70, 0x130ff5f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffbc},
-					    {0x12eff47, 0x12effe5},
-					    {0x12fffe1, 0x12fff03},
-					    {0x130ff7a, 0x130ff66},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff69},
-					    {0x12effb8, 0x12effc7},
-					    {0x12fff1e, 0x12fff5e},
-					    {0x130ff85, 0x130ff6c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff17},
-					    {0x12eff28, 0x12effa9},
-					    {0x12fff5c, 0x12fffb9},
-					    {0x130ff8f, 0x130ff72},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffc4},
-					    {0x12eff99, 0x12eff8a},
-					    {0x12fff99, 0x12fff14},
-					    {0x130ff99, 0x130ff79},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff71},
-					    {0x12eff0a, 0x12eff6c},
-					    {0x12fffd7, 0x12fff6f},
-					    {0x130ffa3, 0x130ff7f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff1f},
-					    {0x12eff7a, 0x12eff4e},
-					    {0x12fff14, 0x12fffca},
-					    {0x130ffae, 0x130ff85},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffcc},
-					    {0x12effeb, 0x12eff2f},
-					    {0x12fff51, 0x12fff25},
-					    {0x130ffb8, 0x130ff8c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff79},
-					    {0x12eff5c, 0x12eff11},
-					    {0x12fff8f, 0x12fff80},
-					    {0x130ffc2, 0x130ff92},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff27},
-					    {0x12effcc, 0x12efff3},
-					    {0x12fffcc, 0x12fffda},
-					    {0x130ffcc, 0x130ff98},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffd4},
-					    {0x12eff3d, 0x12effd4},
-					    {0x12fff0a, 0x12fff35},
-					    {0x130ffd7, 0x130ff9f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff82},
-					    {0x12effae, 0x12effb6},
-					    {0x12fff47, 0x12fff90},
-					    {0x130ffe1, 0x130ffa5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff2f},
-					    {0x12eff1e, 0x12eff98},
-					    {0x12fff85, 0x12fffeb},
-					    {0x130ffeb, 0x130ffab},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffdc},
-					    {0x12eff8f, 0x12eff79},
-					    {0x12fffc2, 0x12fff46},
-					    {0x130fff5, 0x130ffb2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff8a},
-					    {0x12eff00, 0x12eff5b},
-					    {0x12fff00, 0x12fffa1},
-					    {0x130ff00, 0x130ffb8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff37},
-					    {0x12eff70, 0x12eff3d},
-					    {0x12fff3d, 0x12ffffc},
-					    {0x130ff0a, 0x130ffbe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dffe4},
-					    {0x12effe1, 0x12eff1e},
-					    {0x12fff7a, 0x12fff57},
-					    {0x130ff14, 0x130ffc5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff92},
-					    {0x12eff51, 0x12eff00},
-					    {0x12fffb8, 0x12fffb2},
-					    {0x130ff1e, 0x130ffcb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff3f},
-					    {0x12effc2, 0x12effe2},
-					    {0x12ffff5, 0x12fff0c},
-					    {0x130ff28, 0x130ffd2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffec},
-					    {0x12eff33, 0x12effc3},
-					    {0x12fff33, 0x12fff67},
-					    {0x130ff33, 0x130ffd8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dff9a},
-					    {0x12effa3, 0x12effa5},
-					    {0x12fff70, 0x12fffc2},
-					    {0x130ff3d, 0x130ffde},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff47},
-					    {0x12eff14, 0x12eff87},
-					    {0x12fffae, 0x12fff1d},
-					    {0x130ff47, 0x130ffe5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dfff4},
-					    {0x12eff85, 0x12eff68},
-					    {0x12fffeb, 0x12fff78},
-					    {0x130ff51, 0x130ffeb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffa2},
-					    {0x12efff5, 0x12eff4a},
-					    {0x12fff28, 0x12fffd3},
-					    {0x130ff5c, 0x130fff1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff4f},
-					    {0x12eff66, 0x12eff2c},
-					    {0x12fff66, 0x12fff2e},
-					    {0x130ff66, 0x130fff8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dfffd},
-					    {0x12effd7, 0x12eff0d},
-					    {0x12fffa3, 0x12fff89},
-					    {0x130ff70, 0x130fffe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffaa},
-					    {0x12eff47, 0x12effef},
-					    {0x12fffe1, 0x12fffe3},
-					    {0x130ff7a, 0x130ff04},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff57},
-					    {0x12effb8, 0x12effd1},
-					    {0x12fff1e, 0x12fff3e},
-					    {0x130ff85, 0x130ff0b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff05},
-					    {0x12eff28, 0x12effb3},
-					    {0x12fff5c, 0x12fff99},
-					    {0x130ff8f, 0x130ff11},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffb2},
-					    {0x12eff99, 0x12eff94},
-					    {0x12fff99, 0x12ffff4},
-					    {0x130ff99, 0x130ff17},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff5f},
-					    {0x12eff0a, 0x12eff76},
-					    {0x12fffd7, 0x12fff4f},
-					    {0x130ffa3, 0x130ff1e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff0d},
-					    {0x12eff7a, 0x12eff58},
-					    {0x12fff14, 0x12fffaa},
-					    {0x130ffae, 0x130ff24},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffba},
-					    {0x12effeb, 0x12eff39},
-					    {0x12fff51, 0x12fff05},
-					    {0x130ffb8, 0x130ff2b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff67},
-					    {0x12eff5c, 0x12eff1b},
-					    {0x12fff8f, 0x12fff60},
-					    {0x130ffc2, 0x130ff31},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff15},
-					    {0x12effcc, 0x12efffd},
-					    {0x12fffcc, 0x12fffba},
-					    {0x130ffcc, 0x130ff37},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffc2},
-					    {0x12eff3d, 0x12effde},
-					    {0x12fff0a, 0x12fff15},
-					    {0x130ffd7, 0x130ff3e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff70},
-					    {0x12effae, 0x12effc0},
-					    {0x12fff47, 0x12fff70},
-					    {0x130ffe1, 0x130ff44},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff1d},
-					    {0x12eff1e, 0x12effa2},
-					    {0x12fff85, 0x12fffcb},
-					    {0x130ffeb, 0x130ff4a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffca},
-					    {0x12eff8f, 0x12eff83},
-					    {0x12fffc2, 0x12fff26},
-					    {0x130fff5, 0x130ff51},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff78},
-					    {0x12eff00, 0x12eff65},
-					    {0x12fff00, 0x12fff81},
-					    {0x130ff00, 0x130ff57},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff25},
-					    {0x12eff70, 0x12eff47},
-					    {0x12fff3d, 0x12fffdc},
-					    {0x130ff0a, 0x130ff5d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dffd2},
-					    {0x12effe1, 0x12eff28},
-					    {0x12fff7a, 0x12fff37},
-					    {0x130ff14, 0x130ff64},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff80},
-					    {0x12eff51, 0x12eff0a},
-					    {0x12fffb8, 0x12fff92},
-					    {0x130ff1e, 0x130ff6a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff2d},
-					    {0x12effc2, 0x12effec},
-					    {0x12ffff5, 0x12fffec},
-					    {0x130ff28, 0x130ff70},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffda},
-					    {0x12eff33, 0x12effcd},
-					    {0x12fff33, 0x12fff47},
-					    {0x130ff33, 0x130ff77},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dff88},
-					    {0x12effa3, 0x12effaf},
-					    {0x12fff70, 0x12fffa2},
-					    {0x130ff3d, 0x130ff7d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff35},
-					    {0x12eff14, 0x12eff91},
-					    {0x12fffae, 0x12ffffd},
-					    {0x130ff47, 0x130ff83},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dffe2},
-					    {0x12eff85, 0x12eff72},
-					    {0x12fffeb, 0x12fff58},
-					    {0x130ff51, 0x130ff8a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dff90},
-					    {0x12efff5, 0x12eff54},
-					    {0x12fff28, 0x12fffb3},
-					    {0x130ff5c, 0x130ff90},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff3d},
-					    {0x12eff66, 0x12eff36},
-					    {0x12fff66, 0x12fff0e},
-					    {0x130ff66, 0x130ff97},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dffeb},
-					    {0x12effd7, 0x12eff17},
-					    {0x12fffa3, 0x12fff69},
-					    {0x130ff70, 0x130ff9d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff98},
-					    {0x12eff47, 0x12efff9},
-					    {0x12fffe1, 0x12fffc3},
-					    {0x130ff7a, 0x130ffa3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff45},
-					    {0x12effb8, 0x12effdb},
-					    {0x12fff1e, 0x12fff1e},
-					    {0x130ff85, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dfff3},
-					    {0x12eff28, 0x12effbc},
-					    {0x12fff5c, 0x12fff79},
-					    {0x130ff8f, 0x130ffb0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffa0},
-					    {0x12eff99, 0x12eff9e},
-					    {0x12fff99, 0x12fffd4},
-					    {0x130ff99, 0x130ffb6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff4d},
-					    {0x12eff0a, 0x12eff80},
-					    {0x12fffd7, 0x12fff2f},
-					    {0x130ffa3, 0x130ffbd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dfffb},
-					    {0x12eff7a, 0x12eff61},
-					    {0x12fff14, 0x12fff8a},
-					    {0x130ffae, 0x130ffc3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffa8},
-					    {0x12effeb, 0x12eff43},
-					    {0x12fff51, 0x12fffe5},
-					    {0x130ffb8, 0x130ffc9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff55},
-					    {0x12eff5c, 0x12eff25},
-					    {0x12fff8f, 0x12fff40},
-					    {0x130ffc2, 0x130ffd0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff03},
-					    {0x12effcc, 0x12eff07},
-					    {0x12fffcc, 0x12fff9b},
-					    {0x130ffcc, 0x130ffd6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffb0},
-					    {0x12eff3d, 0x12effe8},
-					    {0x12fff0a, 0x12ffff5},
-					    {0x130ffd7, 0x130ffdc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff5e},
-					    {0x12effae, 0x12effca},
-					    {0x12fff47, 0x12fff50},
-					    {0x130ffe1, 0x130ffe3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff0b},
-					    {0x12eff1e, 0x12effac},
-					    {0x12fff85, 0x12fffab},
-					    {0x130ffeb, 0x130ffe9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffb8},
-					    {0x12eff8f, 0x12eff8d},
-					    {0x12fffc2, 0x12fff06},
-					    {0x130fff5, 0x130fff0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff66},
-					    {0x12eff00, 0x12eff6f},
-					    {0x12fff00, 0x12fff61},
-					    {0x130ff00, 0x130fff6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff13},
-					    {0x12eff70, 0x12eff51},
-					    {0x12fff3d, 0x12fffbc},
-					    {0x130ff0a, 0x130fffc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dffc0},
-					    {0x12effe1, 0x12eff32},
-					    {0x12fff7a, 0x12fff17},
-					    {0x130ff14, 0x130ff03},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff6e},
-					    {0x12eff51, 0x12eff14},
-					    {0x12fffb8, 0x12fff72},
-					    {0x130ff1e, 0x130ff09},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff1b},
-					    {0x12effc2, 0x12efff6},
-					    {0x12ffff5, 0x12fffcc},
-					    {0x130ff28, 0x130ff0f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffc8},
-					    {0x12eff33, 0x12effd7},
-					    {0x12fff33, 0x12fff27},
-					    {0x130ff33, 0x130ff16},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dff76},
-					    {0x12effa3, 0x12effb9},
-					    {0x12fff70, 0x12fff82},
-					    {0x130ff3d, 0x130ff1c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff23},
-					    {0x12eff14, 0x12eff9b},
-					    {0x12fffae, 0x12fffdd},
-					    {0x130ff47, 0x130ff22},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dffd0},
-					    {0x12eff85, 0x12eff7c},
-					    {0x12fffeb, 0x12fff38},
-					    {0x130ff51, 0x130ff29},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dff7e},
-					    {0x12efff5, 0x12eff5e},
-					    {0x12fff28, 0x12fff93},
-					    {0x130ff5c, 0x130ff2f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff2b},
-					    {0x12eff66, 0x12eff40},
-					    {0x12fff66, 0x12fffee},
-					    {0x130ff66, 0x130ff35},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dffd9},
-					    {0x12effd7, 0x12eff21},
-					    {0x12fffa3, 0x12fff49},
-					    {0x130ff70, 0x130ff3c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff86},
-					    {0x12eff47, 0x12eff03},
-					    {0x12fffe1, 0x12fffa4},
-					    {0x130ff7a, 0x130ff42},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff33},
-					    {0x12effb8, 0x12effe5},
-					    {0x12fff1e, 0x12ffffe},
-					    {0x130ff85, 0x130ff48},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dffe1},
-					    {0x12eff28, 0x12effc6},
-					    {0x12fff5c, 0x12fff59},
-					    {0x130ff8f, 0x130ff4f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff8e},
-					    {0x12eff99, 0x12effa8},
-					    {0x12fff99, 0x12fffb4},
-					    {0x130ff99, 0x130ff55},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff3b},
-					    {0x12eff0a, 0x12eff8a},
-					    {0x12fffd7, 0x12fff0f},
-					    {0x130ffa3, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dffe9},
-					    {0x12eff7a, 0x12eff6b},
-					    {0x12fff14, 0x12fff6a},
-					    {0x130ffae, 0x130ff62},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff96},
-					    {0x12effeb, 0x12eff4d},
-					    {0x12fff51, 0x12fffc5},
-					    {0x130ffb8, 0x130ff68},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff43},
-					    {0x12eff5c, 0x12eff2f},
-					    {0x12fff8f, 0x12fff20},
-					    {0x130ffc2, 0x130ff6f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dfff1},
-					    {0x12effcc, 0x12eff10},
-					    {0x12fffcc, 0x12fff7b},
-					    {0x130ffcc, 0x130ff75},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff9e},
-					    {0x12eff3d, 0x12efff2},
-					    {0x12fff0a, 0x12fffd5},
-					    {0x130ffd7, 0x130ff7b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff4c},
-					    {0x12effae, 0x12effd4},
-					    {0x12fff47, 0x12fff30},
-					    {0x130ffe1, 0x130ff82},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dfff9},
-					    {0x12eff1e, 0x12effb5},
-					    {0x12fff85, 0x12fff8b},
-					    {0x130ffeb, 0x130ff88},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff25, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffa6},
-					    {0x12eff8f, 0x12eff97},
-					    {0x12fffc2, 0x12fffe6},
-					    {0x130fff5, 0x130ff8e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff54},
-					    {0x12eff00, 0x12eff79},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff95},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff01},
-					    {0x12eff70, 0x12eff5b},
-					    {0x12fff3d, 0x12fff9c},
-					    {0x130ff0a, 0x130ff9b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dffae},
-					    {0x12effe1, 0x12eff3c},
-					    {0x12fff7a, 0x12ffff7},
-					    {0x130ff14, 0x130ffa1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff5c},
-					    {0x12eff51, 0x12eff1e},
-					    {0x12fffb8, 0x12fff52},
-					    {0x130ff1e, 0x130ffa8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff09},
-					    {0x12effc2, 0x12eff00},
-					    {0x12ffff5, 0x12fffad},
-					    {0x130ff28, 0x130ffae},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffb6},
-					    {0x12eff33, 0x12effe1},
-					    {0x12fff33, 0x12fff07},
-					    {0x130ff33, 0x130ffb5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dff64},
-					    {0x12effa3, 0x12effc3},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffbb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff11},
-					    {0x12eff14, 0x12effa5},
-					    {0x12fffae, 0x12fffbd},
-					    {0x130ff47, 0x130ffc1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dffbe},
-					    {0x12eff85, 0x12eff86},
-					    {0x12fffeb, 0x12fff18},
-					    {0x130ff51, 0x130ffc8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dff6c},
-					    {0x12efff5, 0x12eff68},
-					    {0x12fff28, 0x12fff73},
-					    {0x130ff5c, 0x130ffce},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff19},
-					    {0x12eff66, 0x12eff4a},
-					    {0x12fff66, 0x12fffce},
-					    {0x130ff66, 0x130ffd4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dffc7},
-					    {0x12effd7, 0x12eff2b},
-					    {0x12fffa3, 0x12fff29},
-					    {0x130ff70, 0x130ffdb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff74},
-					    {0x12eff47, 0x12eff0d},
-					    {0x12fffe1, 0x12fff84},
-					    {0x130ff7a, 0x130ffe1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff21},
-					    {0x12effb8, 0x12effef},
-					    {0x12fff1e, 0x12fffde},
-					    {0x130ff85, 0x130ffe7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dffcf},
-					    {0x12eff28, 0x12effd0},
-					    {0x12fff5c, 0x12fff39},
-					    {0x130ff8f, 0x130ffee},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff7c},
-					    {0x12eff99, 0x12effb2},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fff4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff17},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff29},
-					    {0x12eff0a, 0x12eff94},
-					    {0x12fffd7, 0x12fffef},
-					    {0x130ffa3, 0x130fffa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dffd7},
-					    {0x12eff7a, 0x12eff75},
-					    {0x12fff14, 0x12fff4a},
-					    {0x130ffae, 0x130ff01},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff84},
-					    {0x12effeb, 0x12eff57},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff07},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff31},
-					    {0x12eff5c, 0x12eff39},
-					    {0x12fff8f, 0x12fff00},
-					    {0x130ffc2, 0x130ff0e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffdf},
-					    {0x12effcc, 0x12eff1a},
-					    {0x12fffcc, 0x12fff5b},
-					    {0x130ffcc, 0x130ff14},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff8c},
-					    {0x12eff3d, 0x12efffc},
-					    {0x12fff0a, 0x12fffb5},
-					    {0x130ffd7, 0x130ff1a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff3a},
-					    {0x12effae, 0x12effde},
-					    {0x12fff47, 0x12fff10},
-					    {0x130ffe1, 0x130ff21},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dffe7},
-					    {0x12eff1e, 0x12effbf},
-					    {0x12fff85, 0x12fff6b},
-					    {0x130ffeb, 0x130ff27},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff26, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff94},
-					    {0x12eff8f, 0x12effa1},
-					    {0x12fffc2, 0x12fffc6},
-					    {0x130fff5, 0x130ff2d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff42},
-					    {0x12eff00, 0x12eff83},
-					    {0x12fff00, 0x12fff21},
-					    {0x130ff00, 0x130ff34},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dffef},
-					    {0x12eff70, 0x12eff64},
-					    {0x12fff3d, 0x12fff7c},
-					    {0x130ff0a, 0x130ff3a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff9c},
-					    {0x12effe1, 0x12eff46},
-					    {0x12fff7a, 0x12fffd7},
-					    {0x130ff14, 0x130ff40},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff4a},
-					    {0x12eff51, 0x12eff28},
-					    {0x12fffb8, 0x12fff32},
-					    {0x130ff1e, 0x130ff47},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dfff7},
-					    {0x12effc2, 0x12eff09},
-					    {0x12ffff5, 0x12fff8d},
-					    {0x130ff28, 0x130ff4d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffa4},
-					    {0x12eff33, 0x12effeb},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff53},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dff52},
-					    {0x12effa3, 0x12effcd},
-					    {0x12fff70, 0x12fff42},
-					    {0x130ff3d, 0x130ff5a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dffff},
-					    {0x12eff14, 0x12effae},
-					    {0x12fffae, 0x12fff9d},
-					    {0x130ff47, 0x130ff60},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dffac},
-					    {0x12eff85, 0x12eff90},
-					    {0x12fffeb, 0x12ffff8},
-					    {0x130ff51, 0x130ff66},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dff5a},
-					    {0x12efff5, 0x12eff72},
-					    {0x12fff28, 0x12fff53},
-					    {0x130ff5c, 0x130ff6d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff07},
-					    {0x12eff66, 0x12eff54},
-					    {0x12fff66, 0x12fffae},
-					    {0x130ff66, 0x130ff73},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dffb5},
-					    {0x12effd7, 0x12eff35},
-					    {0x12fffa3, 0x12fff09},
-					    {0x130ff70, 0x130ff7a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff62},
-					    {0x12eff47, 0x12eff17},
-					    {0x12fffe1, 0x12fff64},
-					    {0x130ff7a, 0x130ff80},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff0f},
-					    {0x12effb8, 0x12efff9},
-					    {0x12fff1e, 0x12fffbe},
-					    {0x130ff85, 0x130ff86},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dffbd},
-					    {0x12eff28, 0x12effda},
-					    {0x12fff5c, 0x12fff19},
-					    {0x130ff8f, 0x130ff8d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff6a},
-					    {0x12eff99, 0x12effbc},
-					    {0x12fff99, 0x12fff74},
-					    {0x130ff99, 0x130ff93},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff17},
-					    {0x12eff0a, 0x12eff9e},
-					    {0x12fffd7, 0x12fffcf},
-					    {0x130ffa3, 0x130ff99},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dffc5},
-					    {0x12eff7a, 0x12eff7f},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff72},
-					    {0x12effeb, 0x12eff61},
-					    {0x12fff51, 0x12fff85},
-					    {0x130ffb8, 0x130ffa6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff1f},
-					    {0x12eff5c, 0x12eff43},
-					    {0x12fff8f, 0x12fffe0},
-					    {0x130ffc2, 0x130ffac},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffcd},
-					    {0x12effcc, 0x12eff24},
-					    {0x12fffcc, 0x12fff3b},
-					    {0x130ffcc, 0x130ffb3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff7a},
-					    {0x12eff3d, 0x12eff06},
-					    {0x12fff0a, 0x12fff96},
-					    {0x130ffd7, 0x130ffb9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff28},
-					    {0x12effae, 0x12effe8},
-					    {0x12fff47, 0x12ffff0},
-					    {0x130ffe1, 0x130ffbf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dffd5},
-					    {0x12eff1e, 0x12effc9},
-					    {0x12fff85, 0x12fff4b},
-					    {0x130ffeb, 0x130ffc6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff04, 0x110ff04},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff27, 0x12bff18},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff82},
-					    {0x12eff8f, 0x12effab},
-					    {0x12fffc2, 0x12fffa6},
-					    {0x130fff5, 0x130ffcc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffe4},
-					    {0x12eff00, 0x12eff29},
-					    {0x12fff00, 0x12fff41},
-					    {0x130ff00, 0x130ff9e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff26},
-					    {0x12eff14, 0x12eff53},
-					    {0x12fffae, 0x12fff05},
-					    {0x130ff07, 0x130ffa3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff68},
-					    {0x12eff28, 0x12eff7c},
-					    {0x12fff5c, 0x12fffc9},
-					    {0x130ff0f, 0x130ffa7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffaa},
-					    {0x12eff3d, 0x12effa5},
-					    {0x12fff0a, 0x12fff8d},
-					    {0x130ff17, 0x130ffac},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffec},
-					    {0x12eff51, 0x12effce},
-					    {0x12fffb8, 0x12fff51},
-					    {0x130ff1e, 0x130ffb1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff2e},
-					    {0x12eff66, 0x12efff8},
-					    {0x12fff66, 0x12fff15},
-					    {0x130ff26, 0x130ffb6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff70},
-					    {0x12eff7a, 0x12eff21},
-					    {0x12fff14, 0x12fffda},
-					    {0x130ff2e, 0x130ffba},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffb2},
-					    {0x12eff8f, 0x12eff4a},
-					    {0x12fffc2, 0x12fff9e},
-					    {0x130ff35, 0x130ffbf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dfff4},
-					    {0x12effa3, 0x12eff73},
-					    {0x12fff70, 0x12fff62},
-					    {0x130ff3d, 0x130ffc4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff36},
-					    {0x12effb8, 0x12eff9d},
-					    {0x12fff1e, 0x12fff26},
-					    {0x130ff45, 0x130ffc9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff78},
-					    {0x12effcc, 0x12effc6},
-					    {0x12fffcc, 0x12fffea},
-					    {0x130ff4c, 0x130ffcd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dffba},
-					    {0x12effe1, 0x12effef},
-					    {0x12fff7a, 0x12fffae},
-					    {0x130ff54, 0x130ffd2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dfffc},
-					    {0x12efff5, 0x12eff18},
-					    {0x12fff28, 0x12fff73},
-					    {0x130ff5c, 0x130ffd7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff3e},
-					    {0x12eff0a, 0x12eff42},
-					    {0x12fffd7, 0x12fff37},
-					    {0x130ff63, 0x130ffdc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff80},
-					    {0x12eff1e, 0x12eff6b},
-					    {0x12fff85, 0x12ffffb},
-					    {0x130ff6b, 0x130ffe0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffc2},
-					    {0x12eff33, 0x12eff94},
-					    {0x12fff33, 0x12fffbf},
-					    {0x130ff73, 0x130ffe5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff04},
-					    {0x12eff47, 0x12effbe},
-					    {0x12fffe1, 0x12fff83},
-					    {0x130ff7a, 0x130ffea},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff46},
-					    {0x12eff5c, 0x12effe7},
-					    {0x12fff8f, 0x12fff47},
-					    {0x130ff82, 0x130ffef},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff88},
-					    {0x12eff70, 0x12eff10},
-					    {0x12fff3d, 0x12fff0c},
-					    {0x130ff8a, 0x130fff4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dffca},
-					    {0x12eff85, 0x12eff39},
-					    {0x12fffeb, 0x12fffd0},
-					    {0x130ff91, 0x130fff8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff12},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff0c},
-					    {0x12eff99, 0x12eff63},
-					    {0x12fff99, 0x12fff94},
-					    {0x130ff99, 0x130fffd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff4e},
-					    {0x12effae, 0x12eff8c},
-					    {0x12fff47, 0x12fff58},
-					    {0x130ffa1, 0x130ff02},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff90},
-					    {0x12effc2, 0x12effb5},
-					    {0x12ffff5, 0x12fff1c},
-					    {0x130ffa8, 0x130ff07},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dffd2},
-					    {0x12effd7, 0x12effde},
-					    {0x12fffa3, 0x12fffe0},
-					    {0x130ffb0, 0x130ff0b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff14},
-					    {0x12effeb, 0x12eff08},
-					    {0x12fff51, 0x12fffa5},
-					    {0x130ffb8, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff56},
-					    {0x12eff00, 0x12eff31},
-					    {0x12fff00, 0x12fff69},
-					    {0x130ffc0, 0x130ff15},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff98},
-					    {0x12eff14, 0x12eff5a},
-					    {0x12fffae, 0x12fff2d},
-					    {0x130ffc7, 0x130ff1a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dffda},
-					    {0x12eff28, 0x12eff83},
-					    {0x12fff5c, 0x12ffff1},
-					    {0x130ffcf, 0x130ff1e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff1c},
-					    {0x12eff3d, 0x12effad},
-					    {0x12fff0a, 0x12fffb5},
-					    {0x130ffd7, 0x130ff23},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff5e},
-					    {0x12eff51, 0x12effd6},
-					    {0x12fffb8, 0x12fff79},
-					    {0x130ffde, 0x130ff28},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffa0},
-					    {0x12eff66, 0x12effff},
-					    {0x12fff66, 0x12fff3d},
-					    {0x130ffe6, 0x130ff2d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dffe2},
-					    {0x12eff7a, 0x12eff28},
-					    {0x12fff14, 0x12fff02},
-					    {0x130ffee, 0x130ff32},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff24},
-					    {0x12eff8f, 0x12eff52},
-					    {0x12fffc2, 0x12fffc6},
-					    {0x130fff5, 0x130ff36},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1e, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dff66},
-					    {0x12effa3, 0x12eff7b},
-					    {0x12fff70, 0x12fff8a},
-					    {0x130fffd, 0x130ff3b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dffa8},
-					    {0x12effb8, 0x12effa4},
-					    {0x12fff1e, 0x12fff4e},
-					    {0x130ff05, 0x130ff40},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffea},
-					    {0x12effcc, 0x12effcd},
-					    {0x12fffcc, 0x12fff12},
-					    {0x130ff0c, 0x130ff45},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff2c},
-					    {0x12effe1, 0x12efff7},
-					    {0x12fff7a, 0x12fffd6},
-					    {0x130ff14, 0x130ff49},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dff6e},
-					    {0x12efff5, 0x12eff20},
-					    {0x12fff28, 0x12fff9b},
-					    {0x130ff1c, 0x130ff4e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dffb0},
-					    {0x12eff0a, 0x12eff49},
-					    {0x12fffd7, 0x12fff5f},
-					    {0x130ff23, 0x130ff53},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dfff2},
-					    {0x12eff1e, 0x12eff72},
-					    {0x12fff85, 0x12fff23},
-					    {0x130ff2b, 0x130ff58},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff34},
-					    {0x12eff33, 0x12eff9c},
-					    {0x12fff33, 0x12fffe7},
-					    {0x130ff33, 0x130ff5c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff76},
-					    {0x12eff47, 0x12effc5},
-					    {0x12fffe1, 0x12fffab},
-					    {0x130ff3a, 0x130ff61},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dffb8},
-					    {0x12eff5c, 0x12effee},
-					    {0x12fff8f, 0x12fff6f},
-					    {0x130ff42, 0x130ff66},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dfffa},
-					    {0x12eff70, 0x12eff17},
-					    {0x12fff3d, 0x12fff34},
-					    {0x130ff4a, 0x130ff6b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff3c},
-					    {0x12eff85, 0x12eff41},
-					    {0x12fffeb, 0x12ffff8},
-					    {0x130ff51, 0x130ff6f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff7e},
-					    {0x12eff99, 0x12eff6a},
-					    {0x12fff99, 0x12fffbc},
-					    {0x130ff59, 0x130ff74},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffc0},
-					    {0x12effae, 0x12eff93},
-					    {0x12fff47, 0x12fff80},
-					    {0x130ff61, 0x130ff79},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff03},
-					    {0x12effc2, 0x12effbd},
-					    {0x12ffff5, 0x12fff44},
-					    {0x130ff68, 0x130ff7e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff45},
-					    {0x12effd7, 0x12effe6},
-					    {0x12fffa3, 0x12fff08},
-					    {0x130ff70, 0x130ff83},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff87},
-					    {0x12effeb, 0x12eff0f},
-					    {0x12fff51, 0x12fffcd},
-					    {0x130ff78, 0x130ff87},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dffc9},
-					    {0x12eff00, 0x12eff38},
-					    {0x12fff00, 0x12fff91},
-					    {0x130ff80, 0x130ff8c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff0b},
-					    {0x12eff14, 0x12eff62},
-					    {0x12fffae, 0x12fff55},
-					    {0x130ff87, 0x130ff91},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff4d},
-					    {0x12eff28, 0x12eff8b},
-					    {0x12fff5c, 0x12fff19},
-					    {0x130ff8f, 0x130ff96},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff8f},
-					    {0x12eff3d, 0x12effb4},
-					    {0x12fff0a, 0x12fffdd},
-					    {0x130ff97, 0x130ff9a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffd1},
-					    {0x12eff51, 0x12effdd},
-					    {0x12fffb8, 0x12fffa1},
-					    {0x130ff9e, 0x130ff9f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff13},
-					    {0x12eff66, 0x12eff07},
-					    {0x12fff66, 0x12fff66},
-					    {0x130ffa6, 0x130ffa4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff55},
-					    {0x12eff7a, 0x12eff30},
-					    {0x12fff14, 0x12fff2a},
-					    {0x130ffae, 0x130ffa9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff97},
-					    {0x12eff8f, 0x12eff59},
-					    {0x12fffc2, 0x12fffee},
-					    {0x130ffb5, 0x130ffad},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffd9},
-					    {0x12effa3, 0x12eff82},
-					    {0x12fff70, 0x12fffb2},
-					    {0x130ffbd, 0x130ffb2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff1b},
-					    {0x12effb8, 0x12effac},
-					    {0x12fff1e, 0x12fff76},
-					    {0x130ffc5, 0x130ffb7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff5d},
-					    {0x12effcc, 0x12effd5},
-					    {0x12fffcc, 0x12fff3a},
-					    {0x130ffcc, 0x130ffbc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff9f},
-					    {0x12effe1, 0x12efffe},
-					    {0x12fff7a, 0x12ffffe},
-					    {0x130ffd4, 0x130ffc0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffe1},
-					    {0x12efff5, 0x12eff27},
-					    {0x12fff28, 0x12fffc3},
-					    {0x130ffdc, 0x130ffc5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff23},
-					    {0x12eff0a, 0x12eff51},
-					    {0x12fffd7, 0x12fff87},
-					    {0x130ffe3, 0x130ffca},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff65},
-					    {0x12eff1e, 0x12eff7a},
-					    {0x12fff85, 0x12fff4b},
-					    {0x130ffeb, 0x130ffcf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffa7},
-					    {0x12eff33, 0x12effa3},
-					    {0x12fff33, 0x12fff0f},
-					    {0x130fff3, 0x130ffd4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff1f, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffe9},
-					    {0x12eff47, 0x12effcc},
-					    {0x12fffe1, 0x12fffd3},
-					    {0x130fffa, 0x130ffd8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff2b},
-					    {0x12eff5c, 0x12efff6},
-					    {0x12fff8f, 0x12fff97},
-					    {0x130ff02, 0x130ffdd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff6d},
-					    {0x12eff70, 0x12eff1f},
-					    {0x12fff3d, 0x12fff5c},
-					    {0x130ff0a, 0x130ffe2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dffaf},
-					    {0x12eff85, 0x12eff48},
-					    {0x12fffeb, 0x12fff20},
-					    {0x130ff11, 0x130ffe7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dfff1},
-					    {0x12eff99, 0x12eff71},
-					    {0x12fff99, 0x12fffe4},
-					    {0x130ff19, 0x130ffeb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff33},
-					    {0x12effae, 0x12eff9b},
-					    {0x12fff47, 0x12fffa8},
-					    {0x130ff21, 0x130fff0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff75},
-					    {0x12effc2, 0x12effc4},
-					    {0x12ffff5, 0x12fff6c},
-					    {0x130ff28, 0x130fff5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dffb7},
-					    {0x12effd7, 0x12effed},
-					    {0x12fffa3, 0x12fff30},
-					    {0x130ff30, 0x130fffa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff13},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dfff9},
-					    {0x12effeb, 0x12eff16},
-					    {0x12fff51, 0x12ffff5},
-					    {0x130ff38, 0x130fffe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff3b},
-					    {0x12eff00, 0x12eff40},
-					    {0x12fff00, 0x12fffb9},
-					    {0x130ff40, 0x130ff03},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff7d},
-					    {0x12eff14, 0x12eff69},
-					    {0x12fffae, 0x12fff7d},
-					    {0x130ff47, 0x130ff08},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dffbf},
-					    {0x12eff28, 0x12eff92},
-					    {0x12fff5c, 0x12fff41},
-					    {0x130ff4f, 0x130ff0d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff01},
-					    {0x12eff3d, 0x12effbc},
-					    {0x12fff0a, 0x12fff05},
-					    {0x130ff57, 0x130ff12},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff43},
-					    {0x12eff51, 0x12effe5},
-					    {0x12fffb8, 0x12fffc9},
-					    {0x130ff5e, 0x130ff16},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff85},
-					    {0x12eff66, 0x12eff0e},
-					    {0x12fff66, 0x12fff8e},
-					    {0x130ff66, 0x130ff1b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dffc7},
-					    {0x12eff7a, 0x12eff37},
-					    {0x12fff14, 0x12fff52},
-					    {0x130ff6e, 0x130ff20},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff09},
-					    {0x12eff8f, 0x12eff61},
-					    {0x12fffc2, 0x12fff16},
-					    {0x130ff75, 0x130ff25},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dff4b},
-					    {0x12effa3, 0x12eff8a},
-					    {0x12fff70, 0x12fffda},
-					    {0x130ff7d, 0x130ff29},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff8d},
-					    {0x12effb8, 0x12effb3},
-					    {0x12fff1e, 0x12fff9e},
-					    {0x130ff85, 0x130ff2e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffcf},
-					    {0x12effcc, 0x12effdc},
-					    {0x12fffcc, 0x12fff62},
-					    {0x130ff8c, 0x130ff33},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff11},
-					    {0x12effe1, 0x12eff06},
-					    {0x12fff7a, 0x12fff27},
-					    {0x130ff94, 0x130ff38},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dff53},
-					    {0x12efff5, 0x12eff2f},
-					    {0x12fff28, 0x12fffeb},
-					    {0x130ff9c, 0x130ff3c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff95},
-					    {0x12eff0a, 0x12eff58},
-					    {0x12fffd7, 0x12fffaf},
-					    {0x130ffa3, 0x130ff41},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dffd7},
-					    {0x12eff1e, 0x12eff81},
-					    {0x12fff85, 0x12fff73},
-					    {0x130ffab, 0x130ff46},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff19},
-					    {0x12eff33, 0x12effab},
-					    {0x12fff33, 0x12fff37},
-					    {0x130ffb3, 0x130ff4b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff5b},
-					    {0x12eff47, 0x12effd4},
-					    {0x12fffe1, 0x12ffffb},
-					    {0x130ffba, 0x130ff4f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff9d},
-					    {0x12eff5c, 0x12efffd},
-					    {0x12fff8f, 0x12fffbf},
-					    {0x130ffc2, 0x130ff54},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dffdf},
-					    {0x12eff70, 0x12eff26},
-					    {0x12fff3d, 0x12fff84},
-					    {0x130ffca, 0x130ff59},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff21},
-					    {0x12eff85, 0x12eff50},
-					    {0x12fffeb, 0x12fff48},
-					    {0x130ffd1, 0x130ff5e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff63},
-					    {0x12eff99, 0x12eff79},
-					    {0x12fff99, 0x12fff0c},
-					    {0x130ffd9, 0x130ff63},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dffa5},
-					    {0x12effae, 0x12effa2},
-					    {0x12fff47, 0x12fffd0},
-					    {0x130ffe1, 0x130ff67},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dffe8},
-					    {0x12effc2, 0x12effcb},
-					    {0x12ffff5, 0x12fff94},
-					    {0x130ffe8, 0x130ff6c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff2a},
-					    {0x12effd7, 0x12efff5},
-					    {0x12fffa3, 0x12fff58},
-					    {0x130fff0, 0x130ff71},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff20, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff6c},
-					    {0x12effeb, 0x12eff1e},
-					    {0x12fff51, 0x12fff1d},
-					    {0x130fff8, 0x130ff76},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dffae},
-					    {0x12eff00, 0x12eff47},
-					    {0x12fff00, 0x12fffe1},
-					    {0x130ff00, 0x130ff7a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dfff0},
-					    {0x12eff14, 0x12eff70},
-					    {0x12fffae, 0x12fffa5},
-					    {0x130ff07, 0x130ff7f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff32},
-					    {0x12eff28, 0x12eff9a},
-					    {0x12fff5c, 0x12fff69},
-					    {0x130ff0f, 0x130ff84},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff74},
-					    {0x12eff3d, 0x12effc3},
-					    {0x12fff0a, 0x12fff2d},
-					    {0x130ff17, 0x130ff89},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dffb6},
-					    {0x12eff51, 0x12effec},
-					    {0x12fffb8, 0x12ffff1},
-					    {0x130ff1e, 0x130ff8d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dfff8},
-					    {0x12eff66, 0x12eff15},
-					    {0x12fff66, 0x12fffb6},
-					    {0x130ff26, 0x130ff92},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff3a},
-					    {0x12eff7a, 0x12eff3f},
-					    {0x12fff14, 0x12fff7a},
-					    {0x130ff2e, 0x130ff97},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff7c},
-					    {0x12eff8f, 0x12eff68},
-					    {0x12fffc2, 0x12fff3e},
-					    {0x130ff35, 0x130ff9c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffbe},
-					    {0x12effa3, 0x12eff91},
-					    {0x12fff70, 0x12fff02},
-					    {0x130ff3d, 0x130ffa1},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff00},
-					    {0x12effb8, 0x12effbb},
-					    {0x12fff1e, 0x12fffc6},
-					    {0x130ff45, 0x130ffa5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff42},
-					    {0x12effcc, 0x12effe4},
-					    {0x12fffcc, 0x12fff8a},
-					    {0x130ff4c, 0x130ffaa},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff84},
-					    {0x12effe1, 0x12eff0d},
-					    {0x12fff7a, 0x12fff4f},
-					    {0x130ff54, 0x130ffaf},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffc6},
-					    {0x12efff5, 0x12eff36},
-					    {0x12fff28, 0x12fff13},
-					    {0x130ff5c, 0x130ffb4},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff08},
-					    {0x12eff0a, 0x12eff60},
-					    {0x12fffd7, 0x12fffd7},
-					    {0x130ff63, 0x130ffb8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff4a},
-					    {0x12eff1e, 0x12eff89},
-					    {0x12fff85, 0x12fff9b},
-					    {0x130ff6b, 0x130ffbd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff8c},
-					    {0x12eff33, 0x12effb2},
-					    {0x12fff33, 0x12fff5f},
-					    {0x130ff73, 0x130ffc2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffce},
-					    {0x12eff47, 0x12effdb},
-					    {0x12fffe1, 0x12fff23},
-					    {0x130ff7a, 0x130ffc7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff10},
-					    {0x12eff5c, 0x12eff05},
-					    {0x12fff8f, 0x12fffe8},
-					    {0x130ff82, 0x130ffcb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff52},
-					    {0x12eff70, 0x12eff2e},
-					    {0x12fff3d, 0x12fffac},
-					    {0x130ff8a, 0x130ffd0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff94},
-					    {0x12eff85, 0x12eff57},
-					    {0x12fffeb, 0x12fff70},
-					    {0x130ff91, 0x130ffd5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffd6},
-					    {0x12eff99, 0x12eff80},
-					    {0x12fff99, 0x12fff34},
-					    {0x130ff99, 0x130ffda},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff18},
-					    {0x12effae, 0x12effaa},
-					    {0x12fff47, 0x12ffff8},
-					    {0x130ffa1, 0x130ffde},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff5a},
-					    {0x12effc2, 0x12effd3},
-					    {0x12ffff5, 0x12fffbc},
-					    {0x130ffa8, 0x130ffe3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff9c},
-					    {0x12effd7, 0x12efffc},
-					    {0x12fffa3, 0x12fff80},
-					    {0x130ffb0, 0x130ffe8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffde},
-					    {0x12effeb, 0x12eff25},
-					    {0x12fff51, 0x12fff45},
-					    {0x130ffb8, 0x130ffed},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff20},
-					    {0x12eff00, 0x12eff4f},
-					    {0x12fff00, 0x12fff09},
-					    {0x130ffc0, 0x130fff2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff62},
-					    {0x12eff14, 0x12eff78},
-					    {0x12fffae, 0x12fffcd},
-					    {0x130ffc7, 0x130fff6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff14},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dffa4},
-					    {0x12eff28, 0x12effa1},
-					    {0x12fff5c, 0x12fff91},
-					    {0x130ffcf, 0x130fffb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffe6},
-					    {0x12eff3d, 0x12effca},
-					    {0x12fff0a, 0x12fff55},
-					    {0x130ffd7, 0x130ff00},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff28},
-					    {0x12eff51, 0x12efff4},
-					    {0x12fffb8, 0x12fff19},
-					    {0x130ffde, 0x130ff05},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff6a},
-					    {0x12eff66, 0x12eff1d},
-					    {0x12fff66, 0x12fffde},
-					    {0x130ffe6, 0x130ff09},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dffac},
-					    {0x12eff7a, 0x12eff46},
-					    {0x12fff14, 0x12fffa2},
-					    {0x130ffee, 0x130ff0e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffee},
-					    {0x12eff8f, 0x12eff6f},
-					    {0x12fffc2, 0x12fff66},
-					    {0x130fff5, 0x130ff13},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff21, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dff30},
-					    {0x12effa3, 0x12eff99},
-					    {0x12fff70, 0x12fff2a},
-					    {0x130fffd, 0x130ff18},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff72},
-					    {0x12effb8, 0x12effc2},
-					    {0x12fff1e, 0x12fffee},
-					    {0x130ff05, 0x130ff1c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dffb4},
-					    {0x12effcc, 0x12effeb},
-					    {0x12fffcc, 0x12fffb2},
-					    {0x130ff0c, 0x130ff21},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dfff6},
-					    {0x12effe1, 0x12eff14},
-					    {0x12fff7a, 0x12fff77},
-					    {0x130ff14, 0x130ff26},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dff38},
-					    {0x12efff5, 0x12eff3e},
-					    {0x12fff28, 0x12fff3b},
-					    {0x130ff1c, 0x130ff2b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff7a},
-					    {0x12eff0a, 0x12eff67},
-					    {0x12fffd7, 0x12fffff},
-					    {0x130ff23, 0x130ff2f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dffbc},
-					    {0x12eff1e, 0x12eff90},
-					    {0x12fff85, 0x12fffc3},
-					    {0x130ff2b, 0x130ff34},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dfffe},
-					    {0x12eff33, 0x12effb9},
-					    {0x12fff33, 0x12fff87},
-					    {0x130ff33, 0x130ff39},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff40},
-					    {0x12eff47, 0x12effe3},
-					    {0x12fffe1, 0x12fff4b},
-					    {0x130ff3a, 0x130ff3e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff82},
-					    {0x12eff5c, 0x12eff0c},
-					    {0x12fff8f, 0x12fff10},
-					    {0x130ff42, 0x130ff43},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dffc4},
-					    {0x12eff70, 0x12eff35},
-					    {0x12fff3d, 0x12fffd4},
-					    {0x130ff4a, 0x130ff47},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff06},
-					    {0x12eff85, 0x12eff5f},
-					    {0x12fffeb, 0x12fff98},
-					    {0x130ff51, 0x130ff4c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff48},
-					    {0x12eff99, 0x12eff88},
-					    {0x12fff99, 0x12fff5c},
-					    {0x130ff59, 0x130ff51},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff8b},
-					    {0x12effae, 0x12effb1},
-					    {0x12fff47, 0x12fff20},
-					    {0x130ff61, 0x130ff56},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dffcd},
-					    {0x12effc2, 0x12effda},
-					    {0x12ffff5, 0x12fffe4},
-					    {0x130ff68, 0x130ff5a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff0f},
-					    {0x12effd7, 0x12eff04},
-					    {0x12fffa3, 0x12fffa9},
-					    {0x130ff70, 0x130ff5f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff51},
-					    {0x12effeb, 0x12eff2d},
-					    {0x12fff51, 0x12fff6d},
-					    {0x130ff78, 0x130ff64},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff93},
-					    {0x12eff00, 0x12eff56},
-					    {0x12fff00, 0x12fff31},
-					    {0x130ff80, 0x130ff69},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dffd5},
-					    {0x12eff14, 0x12eff7f},
-					    {0x12fffae, 0x12ffff5},
-					    {0x130ff87, 0x130ff6d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff17},
-					    {0x12eff28, 0x12effa9},
-					    {0x12fff5c, 0x12fffb9},
-					    {0x130ff8f, 0x130ff72},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dff59},
-					    {0x12eff3d, 0x12effd2},
-					    {0x12fff0a, 0x12fff7d},
-					    {0x130ff97, 0x130ff77},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff9b},
-					    {0x12eff51, 0x12efffb},
-					    {0x12fffb8, 0x12fff41},
-					    {0x130ff9e, 0x130ff7c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dffdd},
-					    {0x12eff66, 0x12eff24},
-					    {0x12fff66, 0x12fff06},
-					    {0x130ffa6, 0x130ff81},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff1f},
-					    {0x12eff7a, 0x12eff4e},
-					    {0x12fff14, 0x12fffca},
-					    {0x130ffae, 0x130ff85},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dff61},
-					    {0x12eff8f, 0x12eff77},
-					    {0x12fffc2, 0x12fff8e},
-					    {0x130ffb5, 0x130ff8a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dffa3},
-					    {0x12effa3, 0x12effa0},
-					    {0x12fff70, 0x12fff52},
-					    {0x130ffbd, 0x130ff8f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dffe5},
-					    {0x12effb8, 0x12effc9},
-					    {0x12fff1e, 0x12fff16},
-					    {0x130ffc5, 0x130ff94},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff27},
-					    {0x12effcc, 0x12efff3},
-					    {0x12fffcc, 0x12fffda},
-					    {0x130ffcc, 0x130ff98},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dff69},
-					    {0x12effe1, 0x12eff1c},
-					    {0x12fff7a, 0x12fff9f},
-					    {0x130ffd4, 0x130ff9d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dffab},
-					    {0x12efff5, 0x12eff45},
-					    {0x12fff28, 0x12fff63},
-					    {0x130ffdc, 0x130ffa2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dffed},
-					    {0x12eff0a, 0x12eff6e},
-					    {0x12fffd7, 0x12fff27},
-					    {0x130ffe3, 0x130ffa7},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dff2f},
-					    {0x12eff1e, 0x12eff98},
-					    {0x12fff85, 0x12fffeb},
-					    {0x130ffeb, 0x130ffab},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dff71},
-					    {0x12eff33, 0x12effc1},
-					    {0x12fff33, 0x12fffaf},
-					    {0x130fff3, 0x130ffb0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff22, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dffb3},
-					    {0x12eff47, 0x12effea},
-					    {0x12fffe1, 0x12fff73},
-					    {0x130fffa, 0x130ffb5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dfff5},
-					    {0x12eff5c, 0x12eff13},
-					    {0x12fff8f, 0x12fff38},
-					    {0x130ff02, 0x130ffba},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dff37},
-					    {0x12eff70, 0x12eff3d},
-					    {0x12fff3d, 0x12ffffc},
-					    {0x130ff0a, 0x130ffbe},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dff79},
-					    {0x12eff85, 0x12eff66},
-					    {0x12fffeb, 0x12fffc0},
-					    {0x130ff11, 0x130ffc3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dffbb},
-					    {0x12eff99, 0x12eff8f},
-					    {0x12fff99, 0x12fff84},
-					    {0x130ff19, 0x130ffc8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dfffd},
-					    {0x12effae, 0x12effb8},
-					    {0x12fff47, 0x12fff48},
-					    {0x130ff21, 0x130ffcd},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dff3f},
-					    {0x12effc2, 0x12effe2},
-					    {0x12ffff5, 0x12fff0c},
-					    {0x130ff28, 0x130ffd2},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dff81},
-					    {0x12effd7, 0x12eff0b},
-					    {0x12fffa3, 0x12fffd1},
-					    {0x130ff30, 0x130ffd6},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dffc3},
-					    {0x12effeb, 0x12eff34},
-					    {0x12fff51, 0x12fff95},
-					    {0x130ff38, 0x130ffdb},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff00, 0x12dff05},
-					    {0x12eff00, 0x12eff5e},
-					    {0x12fff00, 0x12fff59},
-					    {0x130ff40, 0x130ffe0},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff7a, 0x12dff47},
-					    {0x12eff14, 0x12eff87},
-					    {0x12fffae, 0x12fff1d},
-					    {0x130ff47, 0x130ffe5},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dfff5, 0x12dff89},
-					    {0x12eff28, 0x12effb0},
-					    {0x12fff5c, 0x12fffe1},
-					    {0x130ff4f, 0x130ffe9},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff70, 0x12dffcb},
-					    {0x12eff3d, 0x12effd9},
-					    {0x12fff0a, 0x12fffa5},
-					    {0x130ff57, 0x130ffee},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffeb, 0x12dff0d},
-					    {0x12eff51, 0x12eff03},
-					    {0x12fffb8, 0x12fff6a},
-					    {0x130ff5e, 0x130fff3},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff66, 0x12dff4f},
-					    {0x12eff66, 0x12eff2c},
-					    {0x12fff66, 0x12fff2e},
-					    {0x130ff66, 0x130fff8},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff15},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffe1, 0x12dff91},
-					    {0x12eff7a, 0x12eff55},
-					    {0x12fff14, 0x12ffff2},
-					    {0x130ff6e, 0x130fffc},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff5c, 0x12dffd3},
-					    {0x12eff8f, 0x12eff7e},
-					    {0x12fffc2, 0x12fffb6},
-					    {0x130ff75, 0x130ff01},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffd7, 0x12dff15},
-					    {0x12effa3, 0x12effa8},
-					    {0x12fff70, 0x12fff7a},
-					    {0x130ff7d, 0x130ff06},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff51, 0x12dff57},
-					    {0x12effb8, 0x12effd1},
-					    {0x12fff1e, 0x12fff3e},
-					    {0x130ff85, 0x130ff0b},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffcc, 0x12dff99},
-					    {0x12effcc, 0x12efffa},
-					    {0x12fffcc, 0x12fff02},
-					    {0x130ff8c, 0x130ff10},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff47, 0x12dffdb},
-					    {0x12effe1, 0x12eff23},
-					    {0x12fff7a, 0x12fffc7},
-					    {0x130ff94, 0x130ff14},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffc2, 0x12dff1d},
-					    {0x12efff5, 0x12eff4d},
-					    {0x12fff28, 0x12fff8b},
-					    {0x130ff9c, 0x130ff19},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff3d, 0x12dff5f},
-					    {0x12eff0a, 0x12eff76},
-					    {0x12fffd7, 0x12fff4f},
-					    {0x130ffa3, 0x130ff1e},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffb8, 0x12dffa1},
-					    {0x12eff1e, 0x12eff9f},
-					    {0x12fff85, 0x12fff13},
-					    {0x130ffab, 0x130ff23},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff33, 0x12dffe3},
-					    {0x12eff33, 0x12effc8},
-					    {0x12fff33, 0x12fffd7},
-					    {0x130ffb3, 0x130ff27},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffae, 0x12dff25},
-					    {0x12eff47, 0x12efff2},
-					    {0x12fffe1, 0x12fff9b},
-					    {0x130ffba, 0x130ff2c},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff28, 0x12dff67},
-					    {0x12eff5c, 0x12eff1b},
-					    {0x12fff8f, 0x12fff60},
-					    {0x130ffc2, 0x130ff31},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dffa3, 0x12dffa9},
-					    {0x12eff70, 0x12eff44},
-					    {0x12fff3d, 0x12fff24},
-					    {0x130ffca, 0x130ff36},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff1e, 0x12dffeb},
-					    {0x12eff85, 0x12eff6d},
-					    {0x12fffeb, 0x12fffe8},
-					    {0x130ffd1, 0x130ff3a},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff99, 0x12dff2d},
-					    {0x12eff99, 0x12eff97},
-					    {0x12fff99, 0x12fffac},
-					    {0x130ffd9, 0x130ff3f},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff14, 0x12dff70},
-					    {0x12effae, 0x12effc0},
-					    {0x12fff47, 0x12fff70},
-					    {0x130ffe1, 0x130ff44},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff8f, 0x12dffb2},
-					    {0x12effc2, 0x12effe9},
-					    {0x12ffff5, 0x12fff34},
-					    {0x130ffe8, 0x130ff49},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff0a, 0x12dfff4},
-					    {0x12effd7, 0x12eff12},
-					    {0x12fffa3, 0x12ffff9},
-					    {0x130fff0, 0x130ff4d},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff23, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff85, 0x12dff36},
-					    {0x12effeb, 0x12eff3c},
-					    {0x12fff51, 0x12fffbd},
-					    {0x130fff8, 0x130ff52},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}},
-
-					   {{0x10fffff, 0x10fffff},
-					    {0x110ff03, 0x110ff03},
-					    {0x111ff10, 0x111ff10},
-					    {0x12afce4, 0x12afce4},
-					    {0x12bff24, 0x12bff16},
-					    {0x12cff08, 0x12cff10},
-					    {0x12dff01, 0x12dff78},
-					    {0x12eff00, 0x12eff65},
-					    {0x12fff00, 0x12fff81},
-					    {0x130ff00, 0x130ff57},
-					    {0x1337f0a, 0x1337f0a},
-					    {0x1347c10, 0x1347c10},
-					    {0x135ff03, 0x135ff03},
-					    {0x1427f04, 0x1427f04}}};
+// fPLL diff-mif register programming, directly indexed by frequency in MHz.
+//
+// Every frequency writes the same registers with the same masks, so only
+// the data byte is stored per frequency:
+//   scu32ia1d_DiffMifAdrMsk[reg]       = (AVMM address << 8) | mask
+//   scu8ia3d_DiffMifDat[rck][MHz][reg] = data
+// where rck 0 selects the 100 MHz REFCLK and rck 1 the 322.265625 MHz REFCLK.
+
+
+const uint32_t scu32ia1d_DiffMifAdrMsk[QUCPU_INT_NUMREG] = {
+	0x10fff, 0x110ff, 0x111ff, 0x12afc, 0x12bff, 0x12cff, 0x12dff,
+	0x12eff, 0x12fff, 0x130ff, 0x1337f, 0x1347c, 0x135ff, 0x1427f
+};
+
+const uint8_t scu8ia3d_DiffMifDat[QUCPU_INT_NUMRCK][QUCPU_INT_NUMFRQ]
+				 [QUCPU_INT_NUMREG] = {
+	{ // 100 MHz REFCLK
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //    0 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //    1 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //    2 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //    3 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //    4 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //    5 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //    6 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //    7 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //    8 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //    9 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   10 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   11 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   12 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   13 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   14 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   15 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   16 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   17 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   18 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   19 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   20 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   21 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   22 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   23 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x0f, 0x1e, 0x30, 0x04, 0x1e, 0x08, 0x01,   //   24 MHz
+		 0x00, 0x00, 0x00, 0x42, 0x30, 0x03, 0x00},
+		{0x3c, 0x78, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //   25 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x3a, 0x74, 0x30, 0xe4, 0x1e, 0x08, 0x8f,   //   26 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x38, 0x70, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //   27 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x36, 0x6c, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //   28 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x34, 0x68, 0x30, 0xe4, 0x1e, 0x08, 0x8f,   //   29 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x32, 0x64, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //   30 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x31, 0x62, 0x30, 0xe4, 0x1e, 0x08, 0x14,   //   31 MHz
+		 0xae, 0x47, 0x61, 0x0a, 0x10, 0x03, 0x04},
+		{0x2f, 0x5e, 0x30, 0xe4, 0x1e, 0x08, 0x47,   //   32 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x2e, 0x5c, 0x30, 0xe4, 0x1e, 0x08, 0xc2,   //   33 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x2d, 0x5a, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //   34 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x2b, 0x56, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //   35 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x2a, 0x54, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //   36 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x29, 0x52, 0x30, 0xe4, 0x1e, 0x08, 0x70,   //   37 MHz
+		 0x3d, 0x0a, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0x28, 0x50, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //   38 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x27, 0x4e, 0x30, 0xe4, 0x1e, 0x08, 0xb8,   //   39 MHz
+		 0x1e, 0x85, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0x26, 0x4c, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //   40 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x25, 0x4a, 0x30, 0xe4, 0x1e, 0x08, 0x70,   //   41 MHz
+		 0x3d, 0x0a, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0x24, 0x48, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //   42 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x23, 0x46, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //   43 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x23, 0x46, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //   44 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x22, 0x44, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //   45 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x21, 0x42, 0x30, 0xe4, 0x1e, 0x08, 0xc2,   //   46 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x20, 0x40, 0x30, 0xe4, 0x1e, 0x08, 0x47,   //   47 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x20, 0x40, 0x30, 0xe4, 0x1e, 0x08, 0x85,   //   48 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x1f, 0x3e, 0x30, 0xe4, 0x1e, 0x08, 0x14,   //   49 MHz
+		 0xae, 0x47, 0x61, 0x0a, 0x10, 0x03, 0x04},
+		{0x1e, 0x3c, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //   50 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x1e, 0x3c, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //   51 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x1d, 0x3a, 0x30, 0xe4, 0x1e, 0x08, 0x8f,   //   52 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x1d, 0x3a, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //   53 MHz
+		 0xa3, 0x70, 0xbd, 0x0a, 0x10, 0x03, 0x04},
+		{0x1c, 0x38, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //   54 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x1c, 0x38, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //   55 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x1b, 0x36, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //   56 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x1b, 0x36, 0x30, 0xe4, 0x1e, 0x08, 0x7a,   //   57 MHz
+		 0x14, 0xae, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0x1a, 0x34, 0x30, 0xe4, 0x1e, 0x08, 0x8f,   //   58 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x1a, 0x34, 0x30, 0xe4, 0x1e, 0x08, 0xe1,   //   59 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x19, 0x32, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //   60 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x19, 0x32, 0x30, 0xe4, 0x1e, 0x08, 0x00,   //   61 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x19, 0x32, 0x30, 0xe4, 0x1f, 0x08, 0x01,   //   62 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x18, 0x30, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //   63 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x18, 0x30, 0x30, 0xe4, 0x1e, 0x08, 0x85,   //   64 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x18, 0x30, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //   65 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x17, 0x2e, 0x30, 0xe4, 0x1e, 0x08, 0xc2,   //   66 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x17, 0x2e, 0x30, 0xe4, 0x1e, 0x08, 0x1e,   //   67 MHz
+		 0x85, 0xeb, 0xd1, 0x0a, 0x10, 0x03, 0x04},
+		{0x17, 0x2e, 0x30, 0xe4, 0x1f, 0x08, 0x7a,   //   68 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x16, 0x2c, 0x30, 0xe4, 0x1e, 0x08, 0xc2,   //   69 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x16, 0x2c, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //   70 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x16, 0x2c, 0x30, 0xe4, 0x1f, 0x08, 0xd7,   //   71 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x15, 0x2a, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //   72 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x15, 0x2a, 0x30, 0xe4, 0x1e, 0x08, 0x8f,   //   73 MHz
+		 0xc2, 0xf5, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0x15, 0x2a, 0x30, 0xe4, 0x1f, 0x08, 0x47,   //   74 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x14, 0x28, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //   75 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x14, 0x28, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //   76 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x14, 0x28, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //   77 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x14, 0x28, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //   78 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x13, 0x26, 0x30, 0xe4, 0x1e, 0x08, 0x51,   //   79 MHz
+		 0xb8, 0x1e, 0x05, 0x0a, 0x10, 0x03, 0x04},
+		{0x13, 0x26, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //   80 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x13, 0x26, 0x30, 0xe4, 0x1e, 0x08, 0x7a,   //   81 MHz
+		 0x14, 0xae, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0x13, 0x26, 0x30, 0xe4, 0x1f, 0x08, 0x8f,   //   82 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x13, 0x26, 0x30, 0xe4, 0x1f, 0x08, 0xa3,   //   83 MHz
+		 0x70, 0x3d, 0x8a, 0x0a, 0x10, 0x03, 0x04},
+		{0x12, 0x24, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //   84 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x12, 0x24, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //   85 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x12, 0x24, 0x30, 0xe4, 0x1e, 0x08, 0x5c,   //   86 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x12, 0x24, 0x30, 0xe4, 0x1f, 0x08, 0x1e,   //   87 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x12, 0x24, 0x30, 0xe4, 0x1f, 0x08, 0xe1,   //   88 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x11, 0x22, 0x30, 0xe4, 0x1e, 0x08, 0x28,   //   89 MHz
+		 0x5c, 0x8f, 0x42, 0x0a, 0x10, 0x03, 0x04},
+		{0x11, 0x22, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //   90 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x11, 0x22, 0x30, 0xe4, 0x1e, 0x08, 0x0a,   //   91 MHz
+		 0xd7, 0xa3, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x11, 0x22, 0x30, 0xe4, 0x1f, 0x08, 0x7a,   //   92 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x11, 0x22, 0x30, 0xe4, 0x1f, 0x08, 0xeb,   //   93 MHz
+		 0x51, 0xb8, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x1e, 0x08, 0x47,   //   94 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //   95 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x1e, 0x08, 0x85,   //   96 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x1f, 0x08, 0xa3,   //   97 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x1f, 0x08, 0xc2,   //   98 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x1f, 0x08, 0xe1,   //   99 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //  100 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //  101 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //  102 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //  103 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //  104 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1f, 0x08, 0x00,   //  105 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1f, 0x08, 0xcc,   //  106 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x20, 0x08, 0x99,   //  107 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //  108 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1e, 0x08, 0x51,   //  109 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //  110 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1f, 0x08, 0x47,   //  111 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1f, 0x08, 0xc2,   //  112 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1f, 0x08, 0x3d,   //  113 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1f, 0x08, 0xb8,   //  114 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x20, 0x08, 0x33,   //  115 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1e, 0x08, 0x8f,   //  116 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1e, 0x08, 0xb8,   //  117 MHz
+		 0x1e, 0x85, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1e, 0x08, 0xe1,   //  118 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1e, 0x08, 0x0a,   //  119 MHz
+		 0xd7, 0xa3, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //  120 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1f, 0x08, 0x5c,   //  121 MHz
+		 0x8f, 0xc2, 0x75, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1f, 0x08, 0x85,   //  122 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1f, 0x08, 0xae,   //  123 MHz
+		 0x47, 0xe1, 0xfa, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x20, 0x08, 0xd7,   //  124 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //  125 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //  126 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1e, 0x08, 0xae,   //  127 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1e, 0x08, 0x85,   //  128 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1e, 0x08, 0x5c,   //  129 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //  130 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1f, 0x08, 0x0a,   //  131 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1f, 0x08, 0xe1,   //  132 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1f, 0x08, 0xb8,   //  133 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x20, 0x08, 0x8f,   //  134 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x20, 0x08, 0x66,   //  135 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x20, 0x08, 0x3d,   //  136 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1e, 0x08, 0x3d,   //  137 MHz
+		 0x0a, 0xd7, 0x23, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1e, 0x08, 0xc2,   //  138 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1e, 0x08, 0x47,   //  139 MHz
+		 0xe1, 0x7a, 0x94, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //  140 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1f, 0x08, 0x51,   //  141 MHz
+		 0xb8, 0x1e, 0x05, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1f, 0x08, 0xd7,   //  142 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1f, 0x08, 0x5c,   //  143 MHz
+		 0x8f, 0xc2, 0x75, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1f, 0x08, 0xe1,   //  144 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1f, 0x08, 0x66,   //  145 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x20, 0x08, 0xeb,   //  146 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x20, 0x08, 0x70,   //  147 MHz
+		 0x3d, 0x0a, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x20, 0x08, 0xf5,   //  148 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x20, 0x08, 0x7a,   //  149 MHz
+		 0x14, 0xae, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //  150 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1e, 0x08, 0x33,   //  151 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //  152 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //  153 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //  154 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1f, 0x08, 0x01,   //  155 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //  156 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1f, 0x08, 0x66,   //  157 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1f, 0x08, 0x99,   //  158 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1f, 0x08, 0xcc,   //  159 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x20, 0x08, 0x01,   //  160 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x20, 0x08, 0x33,   //  161 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x20, 0x08, 0x66,   //  162 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x20, 0x08, 0x99,   //  163 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x20, 0x08, 0xcc,   //  164 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x21, 0x08, 0x01,   //  165 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x21, 0x08, 0x33,   //  166 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1e, 0x08, 0xf5,   //  167 MHz
+		 0x28, 0x5c, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //  168 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1e, 0x08, 0xb8,   //  169 MHz
+		 0x1e, 0x85, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //  170 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1e, 0x08, 0x7a,   //  171 MHz
+		 0x14, 0xae, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1e, 0x08, 0x5c,   //  172 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1f, 0x08, 0x3d,   //  173 MHz
+		 0x0a, 0xd7, 0x23, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1f, 0x08, 0x1e,   //  174 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1f, 0x08, 0x00,   //  175 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1f, 0x08, 0xe1,   //  176 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1f, 0x08, 0xc2,   //  177 MHz
+		 0xf5, 0x28, 0xdc, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x20, 0x08, 0xa3,   //  178 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x20, 0x08, 0x85,   //  179 MHz
+		 0xeb, 0x51, 0x38, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x20, 0x08, 0x66,   //  180 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x20, 0x08, 0x47,   //  181 MHz
+		 0xe1, 0x7a, 0x94, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x20, 0x08, 0x28,   //  182 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x20, 0x08, 0x0a,   //  183 MHz
+		 0xd7, 0xa3, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x21, 0x08, 0xeb,   //  184 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x21, 0x08, 0xcc,   //  185 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x21, 0x08, 0xae,   //  186 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x21, 0x08, 0x8f,   //  187 MHz
+		 0xc2, 0xf5, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1e, 0x08, 0x47,   //  188 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //  189 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //  190 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1e, 0x08, 0xf5,   //  191 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1e, 0x08, 0x85,   //  192 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1e, 0x08, 0x14,   //  193 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1f, 0x08, 0xa3,   //  194 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //  195 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1f, 0x08, 0xc2,   //  196 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1f, 0x08, 0x51,   //  197 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1f, 0x08, 0xe1,   //  198 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1f, 0x08, 0x70,   //  199 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x20, 0x08, 0x01,   //  200 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x20, 0x08, 0x8f,   //  201 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x20, 0x08, 0x1e,   //  202 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x20, 0x08, 0xae,   //  203 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x20, 0x08, 0x3d,   //  204 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x20, 0x08, 0xcc,   //  205 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x20, 0x08, 0x5c,   //  206 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x21, 0x08, 0xeb,   //  207 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x21, 0x08, 0x7a,   //  208 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x21, 0x08, 0x0a,   //  209 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x21, 0x08, 0x99,   //  210 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x21, 0x08, 0x28,   //  211 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x21, 0x08, 0xb8,   //  212 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x22, 0x08, 0x47,   //  213 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x22, 0x08, 0xd7,   //  214 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //  215 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //  216 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1e, 0x08, 0x14,   //  217 MHz
+		 0xae, 0x47, 0x61, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1e, 0x08, 0x51,   //  218 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1e, 0x08, 0x8f,   //  219 MHz
+		 0xc2, 0xf5, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //  220 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1e, 0x08, 0x0a,   //  221 MHz
+		 0xd7, 0xa3, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1f, 0x08, 0x47,   //  222 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1f, 0x08, 0x85,   //  223 MHz
+		 0xeb, 0x51, 0x38, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1f, 0x08, 0xc2,   //  224 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1f, 0x08, 0x00,   //  225 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1f, 0x08, 0x3d,   //  226 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1f, 0x08, 0x7a,   //  227 MHz
+		 0x14, 0xae, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1f, 0x08, 0xb8,   //  228 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x20, 0x08, 0xf5,   //  229 MHz
+		 0x28, 0x5c, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x20, 0x08, 0x33,   //  230 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x20, 0x08, 0x70,   //  231 MHz
+		 0x3d, 0x0a, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x20, 0x08, 0xae,   //  232 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x20, 0x08, 0xeb,   //  233 MHz
+		 0x51, 0xb8, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x20, 0x08, 0x28,   //  234 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x20, 0x08, 0x66,   //  235 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x21, 0x08, 0xa3,   //  236 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x21, 0x08, 0xe1,   //  237 MHz
+		 0x7a, 0x14, 0x2e, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x21, 0x08, 0x1e,   //  238 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x21, 0x08, 0x5c,   //  239 MHz
+		 0x8f, 0xc2, 0x75, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x21, 0x08, 0x99,   //  240 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x21, 0x08, 0xd7,   //  241 MHz
+		 0xa3, 0x70, 0xbd, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x21, 0x08, 0x14,   //  242 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x22, 0x08, 0x51,   //  243 MHz
+		 0xb8, 0x1e, 0x05, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x22, 0x08, 0x8f,   //  244 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x22, 0x08, 0xcc,   //  245 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x22, 0x08, 0x0a,   //  246 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x22, 0x08, 0x47,   //  247 MHz
+		 0xe1, 0x7a, 0x94, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x22, 0x08, 0x85,   //  248 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x22, 0x08, 0xc2,   //  249 MHz
+		 0xf5, 0x28, 0xdc, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //  250 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x08, 0xeb,   //  251 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //  252 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x08, 0xc2,   //  253 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x08, 0xae,   //  254 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //  255 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x08, 0x85,   //  256 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x08, 0x70,   //  257 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x08, 0x5c,   //  258 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1f, 0x08, 0x47,   //  259 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //  260 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1f, 0x08, 0x1e,   //  261 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1f, 0x08, 0x0a,   //  262 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1f, 0x08, 0xf5,   //  263 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1f, 0x08, 0xe1,   //  264 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1f, 0x08, 0xcc,   //  265 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1f, 0x08, 0xb8,   //  266 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x20, 0x08, 0xa3,   //  267 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x20, 0x08, 0x8f,   //  268 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x20, 0x08, 0x7a,   //  269 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x20, 0x08, 0x66,   //  270 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x20, 0x08, 0x51,   //  271 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x20, 0x08, 0x3d,   //  272 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x20, 0x08, 0x28,   //  273 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x20, 0x08, 0x14,   //  274 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x21, 0x08, 0x01,   //  275 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x21, 0x08, 0xeb,   //  276 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x21, 0x08, 0xd7,   //  277 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x21, 0x08, 0xc2,   //  278 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x21, 0x08, 0xae,   //  279 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x21, 0x08, 0x99,   //  280 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x21, 0x08, 0x85,   //  281 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x21, 0x08, 0x70,   //  282 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x21, 0x08, 0x5c,   //  283 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x22, 0x08, 0x47,   //  284 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x22, 0x08, 0x33,   //  285 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x22, 0x08, 0x1e,   //  286 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x22, 0x08, 0x0a,   //  287 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x22, 0x08, 0xf5,   //  288 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x22, 0x08, 0xe1,   //  289 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x22, 0x08, 0xcc,   //  290 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x22, 0x08, 0xb8,   //  291 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x23, 0x08, 0xa3,   //  292 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x23, 0x08, 0x8f,   //  293 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x23, 0x08, 0x7a,   //  294 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x23, 0x08, 0x66,   //  295 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x23, 0x08, 0x51,   //  296 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x23, 0x08, 0x3d,   //  297 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x23, 0x08, 0x28,   //  298 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x23, 0x08, 0x14,   //  299 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //  300 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //  301 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x08, 0x33,   //  302 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //  303 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //  304 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x08, 0x00,   //  305 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //  306 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x08, 0x33,   //  307 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //  308 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //  309 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x08, 0x01,   //  310 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x08, 0x99,   //  311 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //  312 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x08, 0xcc,   //  313 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x08, 0x66,   //  314 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x08, 0x00,   //  315 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x08, 0x99,   //  316 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //  317 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x08, 0xcc,   //  318 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x08, 0x66,   //  319 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x20, 0x08, 0x01,   //  320 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x20, 0x08, 0x99,   //  321 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x20, 0x08, 0x33,   //  322 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x20, 0x08, 0xcc,   //  323 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x20, 0x08, 0x66,   //  324 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x20, 0x08, 0x00,   //  325 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x20, 0x08, 0x99,   //  326 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x20, 0x08, 0x33,   //  327 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x20, 0x08, 0xcc,   //  328 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x20, 0x08, 0x66,   //  329 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x21, 0x08, 0x01,   //  330 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x21, 0x08, 0x99,   //  331 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x21, 0x08, 0x33,   //  332 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x21, 0x08, 0xcc,   //  333 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x21, 0x08, 0x66,   //  334 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x21, 0x08, 0x00,   //  335 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x21, 0x08, 0x99,   //  336 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x21, 0x08, 0x33,   //  337 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x21, 0x08, 0xcc,   //  338 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x21, 0x08, 0x66,   //  339 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x22, 0x08, 0x01,   //  340 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x22, 0x08, 0x99,   //  341 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x22, 0x08, 0x33,   //  342 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x22, 0x08, 0xcc,   //  343 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x22, 0x08, 0x66,   //  344 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x22, 0x08, 0x00,   //  345 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x22, 0x08, 0x99,   //  346 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x22, 0x08, 0x33,   //  347 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x22, 0x08, 0xcc,   //  348 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x22, 0x08, 0x66,   //  349 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x23, 0x08, 0x01,   //  350 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x23, 0x08, 0x99,   //  351 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x23, 0x08, 0x33,   //  352 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x23, 0x08, 0xcc,   //  353 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x23, 0x08, 0x66,   //  354 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x23, 0x08, 0x00,   //  355 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x23, 0x08, 0x99,   //  356 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x23, 0x08, 0x33,   //  357 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x23, 0x08, 0xcc,   //  358 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x23, 0x08, 0x66,   //  359 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x24, 0x08, 0x01,   //  360 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x24, 0x08, 0x99,   //  361 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x24, 0x08, 0x33,   //  362 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x24, 0x08, 0xcc,   //  363 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x24, 0x08, 0x66,   //  364 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x24, 0x08, 0x00,   //  365 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x24, 0x08, 0x99,   //  366 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x24, 0x08, 0x33,   //  367 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x24, 0x08, 0xcc,   //  368 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x24, 0x08, 0x66,   //  369 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x25, 0x08, 0x01,   //  370 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x25, 0x08, 0x99,   //  371 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x25, 0x08, 0x33,   //  372 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x25, 0x08, 0xcc,   //  373 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x25, 0x08, 0x66,   //  374 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //  375 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0x47,   //  376 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0x8f,   //  377 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //  378 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0x1e,   //  379 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //  380 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0xae,   //  381 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0xf5,   //  382 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0x3d,   //  383 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0x85,   //  384 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //  385 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0x14,   //  386 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x08, 0x5c,   //  387 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0xa3,   //  388 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0xeb,   //  389 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //  390 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0x7a,   //  391 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0xc2,   //  392 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0x0a,   //  393 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0x51,   //  394 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0x99,   //  395 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0xe1,   //  396 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0x28,   //  397 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0x70,   //  398 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x08, 0xb8,   //  399 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0x01,   //  400 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0x47,   //  401 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0x8f,   //  402 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0xd7,   //  403 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0x1e,   //  404 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0x66,   //  405 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0xae,   //  406 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0xf5,   //  407 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0x3d,   //  408 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0x85,   //  409 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0xcc,   //  410 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0x14,   //  411 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x08, 0x5c,   //  412 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0xa3,   //  413 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0xeb,   //  414 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0x33,   //  415 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0x7a,   //  416 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0xc2,   //  417 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0x0a,   //  418 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0x51,   //  419 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0x99,   //  420 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0xe1,   //  421 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0x28,   //  422 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0x70,   //  423 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x08, 0xb8,   //  424 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0x01,   //  425 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0x47,   //  426 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0x8f,   //  427 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0xd7,   //  428 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0x1e,   //  429 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0x66,   //  430 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0xae,   //  431 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0xf5,   //  432 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0x3d,   //  433 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0x85,   //  434 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0xcc,   //  435 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0x14,   //  436 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x08, 0x5c,   //  437 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0xa3,   //  438 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0xeb,   //  439 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0x33,   //  440 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0x7a,   //  441 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0xc2,   //  442 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0x0a,   //  443 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0x51,   //  444 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0x99,   //  445 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0xe1,   //  446 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0x28,   //  447 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0x70,   //  448 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x23, 0x08, 0xb8,   //  449 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0x01,   //  450 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0x47,   //  451 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0x8f,   //  452 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0xd7,   //  453 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0x1e,   //  454 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0x66,   //  455 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0xae,   //  456 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0xf5,   //  457 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0x3d,   //  458 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0x85,   //  459 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0xcc,   //  460 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0x14,   //  461 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x24, 0x08, 0x5c,   //  462 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0xa3,   //  463 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0xeb,   //  464 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0x33,   //  465 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0x7a,   //  466 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0xc2,   //  467 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0x0a,   //  468 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0x51,   //  469 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0x99,   //  470 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0xe1,   //  471 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0x28,   //  472 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0x70,   //  473 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x25, 0x08, 0xb8,   //  474 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0x01,   //  475 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0x47,   //  476 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0x8f,   //  477 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0xd7,   //  478 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0x1e,   //  479 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0x66,   //  480 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0xae,   //  481 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0xf5,   //  482 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0x3d,   //  483 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0x85,   //  484 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0xcc,   //  485 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0x14,   //  486 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x26, 0x08, 0x5c,   //  487 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0xa3,   //  488 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0xeb,   //  489 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0x33,   //  490 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0x7a,   //  491 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0xc2,   //  492 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0x0a,   //  493 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0x51,   //  494 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0x99,   //  495 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0xe1,   //  496 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0x28,   //  497 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0x70,   //  498 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x27, 0x08, 0xb8,   //  499 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0x01,   //  500 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0xf5,   //  501 MHz
+		 0x28, 0x5c, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0xeb,   //  502 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0xe1,   //  503 MHz
+		 0x7a, 0x14, 0x2e, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0xd7,   //  504 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0xcc,   //  505 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0xc2,   //  506 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0xb8,   //  507 MHz
+		 0x1e, 0x85, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0xae,   //  508 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0xa3,   //  509 MHz
+		 0x70, 0x3d, 0x8a, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0x99,   //  510 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0x8f,   //  511 MHz
+		 0xc2, 0xf5, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0x85,   //  512 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0x7a,   //  513 MHz
+		 0x14, 0xae, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0x70,   //  514 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0x66,   //  515 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x08, 0x5c,   //  516 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0x51,   //  517 MHz
+		 0xb8, 0x1e, 0x05, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0x47,   //  518 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0x3d,   //  519 MHz
+		 0x0a, 0xd7, 0x23, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0x33,   //  520 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0x28,   //  521 MHz
+		 0x5c, 0x8f, 0x42, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0x1e,   //  522 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0x14,   //  523 MHz
+		 0xae, 0x47, 0x61, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0x0a,   //  524 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0x00,   //  525 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0xf5,   //  526 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0xeb,   //  527 MHz
+		 0x51, 0xb8, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0xe1,   //  528 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0xd7,   //  529 MHz
+		 0xa3, 0x70, 0xbd, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0xcc,   //  530 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0xc2,   //  531 MHz
+		 0xf5, 0x28, 0xdc, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0xb8,   //  532 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1f, 0x08, 0xae,   //  533 MHz
+		 0x47, 0xe1, 0xfa, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0xa3,   //  534 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x99,   //  535 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x8f,   //  536 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x85,   //  537 MHz
+		 0xeb, 0x51, 0x38, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x7a,   //  538 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x70,   //  539 MHz
+		 0x3d, 0x0a, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x66,   //  540 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x5c,   //  541 MHz
+		 0x8f, 0xc2, 0x75, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x51,   //  542 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x47,   //  543 MHz
+		 0xe1, 0x7a, 0x94, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x3d,   //  544 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x33,   //  545 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x28,   //  546 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x1e,   //  547 MHz
+		 0x85, 0xeb, 0xd1, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x14,   //  548 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x20, 0x08, 0x0a,   //  549 MHz
+		 0xd7, 0xa3, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0x01,   //  550 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0xf5,   //  551 MHz
+		 0x28, 0x5c, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0xeb,   //  552 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0xe1,   //  553 MHz
+		 0x7a, 0x14, 0x2e, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0xd7,   //  554 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0xcc,   //  555 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0xc2,   //  556 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0xb8,   //  557 MHz
+		 0x1e, 0x85, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0xae,   //  558 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0xa3,   //  559 MHz
+		 0x70, 0x3d, 0x8a, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0x99,   //  560 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0x8f,   //  561 MHz
+		 0xc2, 0xf5, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0x85,   //  562 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0x7a,   //  563 MHz
+		 0x14, 0xae, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0x70,   //  564 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0x66,   //  565 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x21, 0x08, 0x5c,   //  566 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0x51,   //  567 MHz
+		 0xb8, 0x1e, 0x05, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0x47,   //  568 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0x3d,   //  569 MHz
+		 0x0a, 0xd7, 0x23, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0x33,   //  570 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0x28,   //  571 MHz
+		 0x5c, 0x8f, 0x42, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0x1e,   //  572 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0x14,   //  573 MHz
+		 0xae, 0x47, 0x61, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0x0a,   //  574 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0x00,   //  575 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0xf5,   //  576 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0xeb,   //  577 MHz
+		 0x51, 0xb8, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0xe1,   //  578 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0xd7,   //  579 MHz
+		 0xa3, 0x70, 0xbd, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0xcc,   //  580 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0xc2,   //  581 MHz
+		 0xf5, 0x28, 0xdc, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0xb8,   //  582 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x22, 0x08, 0xae,   //  583 MHz
+		 0x47, 0xe1, 0xfa, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0xa3,   //  584 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x99,   //  585 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x8f,   //  586 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x85,   //  587 MHz
+		 0xeb, 0x51, 0x38, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x7a,   //  588 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x70,   //  589 MHz
+		 0x3d, 0x0a, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x66,   //  590 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x5c,   //  591 MHz
+		 0x8f, 0xc2, 0x75, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x51,   //  592 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x47,   //  593 MHz
+		 0xe1, 0x7a, 0x94, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x3d,   //  594 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x33,   //  595 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x28,   //  596 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x1e,   //  597 MHz
+		 0x85, 0xeb, 0xd1, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x14,   //  598 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x23, 0x08, 0x0a,   //  599 MHz
+		 0xd7, 0xa3, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x24, 0x08, 0x01,   //  600 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0xcc,   //  601 MHz
+		 0xcc, 0xcc, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x99,   //  602 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x66,   //  603 MHz
+		 0x66, 0x66, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x33,   //  604 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x00,   //  605 MHz
+		 0x00, 0x00, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0xcc,   //  606 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x99,   //  607 MHz
+		 0x99, 0x99, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x66,   //  608 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x33,   //  609 MHz
+		 0x33, 0x33, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x00,   //  610 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0xcc,   //  611 MHz
+		 0xcc, 0xcc, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x99,   //  612 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x66,   //  613 MHz
+		 0x66, 0x66, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x33,   //  614 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x00,   //  615 MHz
+		 0x00, 0x00, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0xcc,   //  616 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x99,   //  617 MHz
+		 0x99, 0x99, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x66,   //  618 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x08, 0x33,   //  619 MHz
+		 0x33, 0x33, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x01,   //  620 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0xcc,   //  621 MHz
+		 0xcc, 0xcc, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x99,   //  622 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x66,   //  623 MHz
+		 0x66, 0x66, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x33,   //  624 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x00,   //  625 MHz
+		 0x00, 0x00, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0xcc,   //  626 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x99,   //  627 MHz
+		 0x99, 0x99, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x66,   //  628 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x33,   //  629 MHz
+		 0x33, 0x33, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x00,   //  630 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0xcc,   //  631 MHz
+		 0xcc, 0xcc, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x99,   //  632 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x66,   //  633 MHz
+		 0x66, 0x66, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x33,   //  634 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x00,   //  635 MHz
+		 0x00, 0x00, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0xcc,   //  636 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x99,   //  637 MHz
+		 0x99, 0x99, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x66,   //  638 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x08, 0x33,   //  639 MHz
+		 0x33, 0x33, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x01,   //  640 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0xcc,   //  641 MHz
+		 0xcc, 0xcc, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x99,   //  642 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x66,   //  643 MHz
+		 0x66, 0x66, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x33,   //  644 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x00,   //  645 MHz
+		 0x00, 0x00, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0xcc,   //  646 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x99,   //  647 MHz
+		 0x99, 0x99, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x66,   //  648 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x33,   //  649 MHz
+		 0x33, 0x33, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x00,   //  650 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0xcc,   //  651 MHz
+		 0xcc, 0xcc, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x99,   //  652 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x66,   //  653 MHz
+		 0x66, 0x66, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x33,   //  654 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x00,   //  655 MHz
+		 0x00, 0x00, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0xcc,   //  656 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x99,   //  657 MHz
+		 0x99, 0x99, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x66,   //  658 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x20, 0x08, 0x33,   //  659 MHz
+		 0x33, 0x33, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x01,   //  660 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0xcc,   //  661 MHz
+		 0xcc, 0xcc, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x99,   //  662 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x66,   //  663 MHz
+		 0x66, 0x66, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x33,   //  664 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x00,   //  665 MHz
+		 0x00, 0x00, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0xcc,   //  666 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x99,   //  667 MHz
+		 0x99, 0x99, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x66,   //  668 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x33,   //  669 MHz
+		 0x33, 0x33, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x00,   //  670 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0xcc,   //  671 MHz
+		 0xcc, 0xcc, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x99,   //  672 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x66,   //  673 MHz
+		 0x66, 0x66, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x33,   //  674 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x00,   //  675 MHz
+		 0x00, 0x00, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0xcc,   //  676 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x99,   //  677 MHz
+		 0x99, 0x99, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x66,   //  678 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x21, 0x08, 0x33,   //  679 MHz
+		 0x33, 0x33, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x01,   //  680 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0xcc,   //  681 MHz
+		 0xcc, 0xcc, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x99,   //  682 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x66,   //  683 MHz
+		 0x66, 0x66, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x33,   //  684 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x00,   //  685 MHz
+		 0x00, 0x00, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0xcc,   //  686 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x99,   //  687 MHz
+		 0x99, 0x99, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x66,   //  688 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x33,   //  689 MHz
+		 0x33, 0x33, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x00,   //  690 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0xcc,   //  691 MHz
+		 0xcc, 0xcc, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x99,   //  692 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x66,   //  693 MHz
+		 0x66, 0x66, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x33,   //  694 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x00,   //  695 MHz
+		 0x00, 0x00, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0xcc,   //  696 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x99,   //  697 MHz
+		 0x99, 0x99, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x66,   //  698 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x22, 0x08, 0x33,   //  699 MHz
+		 0x33, 0x33, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x01,   //  700 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0xcc,   //  701 MHz
+		 0xcc, 0xcc, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x99,   //  702 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x66,   //  703 MHz
+		 0x66, 0x66, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x33,   //  704 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x00,   //  705 MHz
+		 0x00, 0x00, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0xcc,   //  706 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x99,   //  707 MHz
+		 0x99, 0x99, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x66,   //  708 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x33,   //  709 MHz
+		 0x33, 0x33, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x00,   //  710 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0xcc,   //  711 MHz
+		 0xcc, 0xcc, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x99,   //  712 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x66,   //  713 MHz
+		 0x66, 0x66, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x33,   //  714 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x00,   //  715 MHz
+		 0x00, 0x00, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0xcc,   //  716 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x99,   //  717 MHz
+		 0x99, 0x99, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x66,   //  718 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x23, 0x08, 0x33,   //  719 MHz
+		 0x33, 0x33, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x01,   //  720 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0xcc,   //  721 MHz
+		 0xcc, 0xcc, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x99,   //  722 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x66,   //  723 MHz
+		 0x66, 0x66, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x33,   //  724 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x00,   //  725 MHz
+		 0x00, 0x00, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0xcc,   //  726 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x99,   //  727 MHz
+		 0x99, 0x99, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x66,   //  728 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x33,   //  729 MHz
+		 0x33, 0x33, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x00,   //  730 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0xcc,   //  731 MHz
+		 0xcc, 0xcc, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x99,   //  732 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x66,   //  733 MHz
+		 0x66, 0x66, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x33,   //  734 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x00,   //  735 MHz
+		 0x00, 0x00, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0xcc,   //  736 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x99,   //  737 MHz
+		 0x99, 0x99, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x66,   //  738 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x24, 0x08, 0x33,   //  739 MHz
+		 0x33, 0x33, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x25, 0x08, 0x01,   //  740 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x25, 0x08, 0xcc,   //  741 MHz
+		 0xcc, 0xcc, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x25, 0x08, 0x99,   //  742 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x25, 0x08, 0x66,   //  743 MHz
+		 0x66, 0x66, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x25, 0x08, 0x33,   //  744 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x25, 0x08, 0x00,   //  745 MHz
+		 0x00, 0x00, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x25, 0x08, 0xcc,   //  746 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x25, 0x08, 0x99,   //  747 MHz
+		 0x99, 0x99, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x25, 0x08, 0x66,   //  748 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x25, 0x08, 0x33,   //  749 MHz
+		 0x33, 0x33, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x01,   //  750 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0xa3,   //  751 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x47,   //  752 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0xeb,   //  753 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x8f,   //  754 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x33,   //  755 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0xd7,   //  756 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x7a,   //  757 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x1e,   //  758 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0xc2,   //  759 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x66,   //  760 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x0a,   //  761 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0xae,   //  762 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x51,   //  763 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0xf5,   //  764 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x99,   //  765 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x3d,   //  766 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0xe1,   //  767 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x85,   //  768 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x28,   //  769 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0xcc,   //  770 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x70,   //  771 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x14,   //  772 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0xb8,   //  773 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x08, 0x5c,   //  774 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x01,   //  775 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0xa3,   //  776 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x47,   //  777 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0xeb,   //  778 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x8f,   //  779 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x33,   //  780 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0xd7,   //  781 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x7a,   //  782 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x1e,   //  783 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0xc2,   //  784 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x66,   //  785 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x0a,   //  786 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0xae,   //  787 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x51,   //  788 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0xf5,   //  789 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x99,   //  790 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x3d,   //  791 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0xe1,   //  792 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x85,   //  793 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x28,   //  794 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0xcc,   //  795 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x70,   //  796 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x14,   //  797 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0xb8,   //  798 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x08, 0x5c,   //  799 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x01,   //  800 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0xa3,   //  801 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x47,   //  802 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0xeb,   //  803 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x8f,   //  804 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x33,   //  805 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0xd7,   //  806 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x7a,   //  807 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x1e,   //  808 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0xc2,   //  809 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x66,   //  810 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x0a,   //  811 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0xae,   //  812 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x51,   //  813 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0xf5,   //  814 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x99,   //  815 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x3d,   //  816 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0xe1,   //  817 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x85,   //  818 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x28,   //  819 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0xcc,   //  820 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x70,   //  821 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x14,   //  822 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0xb8,   //  823 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x08, 0x5c,   //  824 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x01,   //  825 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0xa3,   //  826 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x47,   //  827 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0xeb,   //  828 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x8f,   //  829 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x33,   //  830 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0xd7,   //  831 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x7a,   //  832 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x1e,   //  833 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0xc2,   //  834 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x66,   //  835 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x0a,   //  836 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0xae,   //  837 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x51,   //  838 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0xf5,   //  839 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x99,   //  840 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x3d,   //  841 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0xe1,   //  842 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x85,   //  843 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x28,   //  844 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0xcc,   //  845 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x70,   //  846 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x14,   //  847 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0xb8,   //  848 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x08, 0x5c,   //  849 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x01,   //  850 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0xa3,   //  851 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x47,   //  852 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0xeb,   //  853 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x8f,   //  854 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x33,   //  855 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0xd7,   //  856 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x7a,   //  857 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x1e,   //  858 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0xc2,   //  859 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x66,   //  860 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x0a,   //  861 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0xae,   //  862 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x51,   //  863 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0xf5,   //  864 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x99,   //  865 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x3d,   //  866 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0xe1,   //  867 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x85,   //  868 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x28,   //  869 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0xcc,   //  870 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x70,   //  871 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x14,   //  872 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0xb8,   //  873 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x08, 0x5c,   //  874 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x01,   //  875 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0xa3,   //  876 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x47,   //  877 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0xeb,   //  878 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x8f,   //  879 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x33,   //  880 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0xd7,   //  881 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x7a,   //  882 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x1e,   //  883 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0xc2,   //  884 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x66,   //  885 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x0a,   //  886 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0xae,   //  887 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x51,   //  888 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0xf5,   //  889 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x99,   //  890 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x3d,   //  891 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0xe1,   //  892 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x85,   //  893 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x28,   //  894 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0xcc,   //  895 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x70,   //  896 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x14,   //  897 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0xb8,   //  898 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x23, 0x08, 0x5c,   //  899 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x01,   //  900 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0xa3,   //  901 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x47,   //  902 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0xeb,   //  903 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x8f,   //  904 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x33,   //  905 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0xd7,   //  906 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x7a,   //  907 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x1e,   //  908 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0xc2,   //  909 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x66,   //  910 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x0a,   //  911 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0xae,   //  912 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x51,   //  913 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0xf5,   //  914 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x99,   //  915 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x3d,   //  916 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0xe1,   //  917 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x85,   //  918 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x28,   //  919 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0xcc,   //  920 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x70,   //  921 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x14,   //  922 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0xb8,   //  923 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x24, 0x08, 0x5c,   //  924 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x01,   //  925 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0xa3,   //  926 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x47,   //  927 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0xeb,   //  928 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x8f,   //  929 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x33,   //  930 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0xd7,   //  931 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x7a,   //  932 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x1e,   //  933 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0xc2,   //  934 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x66,   //  935 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x0a,   //  936 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0xae,   //  937 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x51,   //  938 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0xf5,   //  939 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x99,   //  940 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x3d,   //  941 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0xe1,   //  942 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x85,   //  943 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x28,   //  944 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0xcc,   //  945 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x70,   //  946 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x14,   //  947 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0xb8,   //  948 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x25, 0x08, 0x5c,   //  949 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x01,   //  950 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0xa3,   //  951 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x47,   //  952 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0xeb,   //  953 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x8f,   //  954 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x33,   //  955 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0xd7,   //  956 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x7a,   //  957 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x1e,   //  958 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0xc2,   //  959 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x66,   //  960 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x0a,   //  961 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0xae,   //  962 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x51,   //  963 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0xf5,   //  964 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x99,   //  965 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x3d,   //  966 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0xe1,   //  967 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x85,   //  968 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x28,   //  969 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0xcc,   //  970 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x70,   //  971 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x14,   //  972 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0xb8,   //  973 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x26, 0x08, 0x5c,   //  974 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x01,   //  975 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0xa3,   //  976 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x47,   //  977 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0xeb,   //  978 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x8f,   //  979 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x33,   //  980 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0xd7,   //  981 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x7a,   //  982 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x1e,   //  983 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0xc2,   //  984 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x66,   //  985 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x0a,   //  986 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0xae,   //  987 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x51,   //  988 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0xf5,   //  989 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x99,   //  990 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x3d,   //  991 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0xe1,   //  992 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x85,   //  993 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x28,   //  994 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0xcc,   //  995 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x70,   //  996 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x14,   //  997 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0xb8,   //  998 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x27, 0x08, 0x5c,   //  999 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x01,   // 1000 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x7a,   // 1001 MHz
+		 0x14, 0xae, 0x07, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xf5,   // 1002 MHz
+		 0x28, 0x5c, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x70,   // 1003 MHz
+		 0x3d, 0x0a, 0x17, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xeb,   // 1004 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x66,   // 1005 MHz
+		 0x66, 0x66, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xe1,   // 1006 MHz
+		 0x7a, 0x14, 0x2e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x5c,   // 1007 MHz
+		 0x8f, 0xc2, 0x35, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xd7,   // 1008 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x51,   // 1009 MHz
+		 0xb8, 0x1e, 0x45, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xcc,   // 1010 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x47,   // 1011 MHz
+		 0xe1, 0x7a, 0x54, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xc2,   // 1012 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x3d,   // 1013 MHz
+		 0x0a, 0xd7, 0x63, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xb8,   // 1014 MHz
+		 0x1e, 0x85, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x33,   // 1015 MHz
+		 0x33, 0x33, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xae,   // 1016 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x28,   // 1017 MHz
+		 0x5c, 0x8f, 0x82, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xa3,   // 1018 MHz
+		 0x70, 0x3d, 0x8a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x1e,   // 1019 MHz
+		 0x85, 0xeb, 0x91, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x99,   // 1020 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x14,   // 1021 MHz
+		 0xae, 0x47, 0xa1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x8f,   // 1022 MHz
+		 0xc2, 0xf5, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x0a,   // 1023 MHz
+		 0xd7, 0xa3, 0xb0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x85,   // 1024 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x00,   // 1025 MHz
+		 0x00, 0x00, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x7a,   // 1026 MHz
+		 0x14, 0xae, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xf5,   // 1027 MHz
+		 0x28, 0x5c, 0xcf, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x70,   // 1028 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xeb,   // 1029 MHz
+		 0x51, 0xb8, 0xde, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x66,   // 1030 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xe1,   // 1031 MHz
+		 0x7a, 0x14, 0xee, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0x5c,   // 1032 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x08, 0xd7,   // 1033 MHz
+		 0xa3, 0x70, 0xfd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x51,   // 1034 MHz
+		 0xb8, 0x1e, 0x05, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xcc,   // 1035 MHz
+		 0xcc, 0xcc, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x47,   // 1036 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xc2,   // 1037 MHz
+		 0xf5, 0x28, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x3d,   // 1038 MHz
+		 0x0a, 0xd7, 0x23, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xb8,   // 1039 MHz
+		 0x1e, 0x85, 0x2b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x33,   // 1040 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xae,   // 1041 MHz
+		 0x47, 0xe1, 0x3a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x28,   // 1042 MHz
+		 0x5c, 0x8f, 0x42, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xa3,   // 1043 MHz
+		 0x70, 0x3d, 0x4a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x1e,   // 1044 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x99,   // 1045 MHz
+		 0x99, 0x99, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x14,   // 1046 MHz
+		 0xae, 0x47, 0x61, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x8f,   // 1047 MHz
+		 0xc2, 0xf5, 0x68, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x0a,   // 1048 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x85,   // 1049 MHz
+		 0xeb, 0x51, 0x78, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x00,   // 1050 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x7a,   // 1051 MHz
+		 0x14, 0xae, 0x87, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xf5,   // 1052 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x70,   // 1053 MHz
+		 0x3d, 0x0a, 0x97, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xeb,   // 1054 MHz
+		 0x51, 0xb8, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x66,   // 1055 MHz
+		 0x66, 0x66, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xe1,   // 1056 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x5c,   // 1057 MHz
+		 0x8f, 0xc2, 0xb5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xd7,   // 1058 MHz
+		 0xa3, 0x70, 0xbd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x51,   // 1059 MHz
+		 0xb8, 0x1e, 0xc5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xcc,   // 1060 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x47,   // 1061 MHz
+		 0xe1, 0x7a, 0xd4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xc2,   // 1062 MHz
+		 0xf5, 0x28, 0xdc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x3d,   // 1063 MHz
+		 0x0a, 0xd7, 0xe3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xb8,   // 1064 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0x33,   // 1065 MHz
+		 0x33, 0x33, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1f, 0x08, 0xae,   // 1066 MHz
+		 0x47, 0xe1, 0xfa, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x28,   // 1067 MHz
+		 0x5c, 0x8f, 0x02, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0xa3,   // 1068 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x1e,   // 1069 MHz
+		 0x85, 0xeb, 0x11, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x99,   // 1070 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x14,   // 1071 MHz
+		 0xae, 0x47, 0x21, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x8f,   // 1072 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x0a,   // 1073 MHz
+		 0xd7, 0xa3, 0x30, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x85,   // 1074 MHz
+		 0xeb, 0x51, 0x38, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x00,   // 1075 MHz
+		 0x00, 0x00, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x7a,   // 1076 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0xf5,   // 1077 MHz
+		 0x28, 0x5c, 0x4f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x70,   // 1078 MHz
+		 0x3d, 0x0a, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0xeb,   // 1079 MHz
+		 0x51, 0xb8, 0x5e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x66,   // 1080 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0xe1,   // 1081 MHz
+		 0x7a, 0x14, 0x6e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x5c,   // 1082 MHz
+		 0x8f, 0xc2, 0x75, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0xd7,   // 1083 MHz
+		 0xa3, 0x70, 0x7d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x51,   // 1084 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0xcc,   // 1085 MHz
+		 0xcc, 0xcc, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x47,   // 1086 MHz
+		 0xe1, 0x7a, 0x94, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0xc2,   // 1087 MHz
+		 0xf5, 0x28, 0x9c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x3d,   // 1088 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0xb8,   // 1089 MHz
+		 0x1e, 0x85, 0xab, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x33,   // 1090 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0xae,   // 1091 MHz
+		 0x47, 0xe1, 0xba, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x28,   // 1092 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0xa3,   // 1093 MHz
+		 0x70, 0x3d, 0xca, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x1e,   // 1094 MHz
+		 0x85, 0xeb, 0xd1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x99,   // 1095 MHz
+		 0x99, 0x99, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x14,   // 1096 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x8f,   // 1097 MHz
+		 0xc2, 0xf5, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x0a,   // 1098 MHz
+		 0xd7, 0xa3, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x20, 0x08, 0x85,   // 1099 MHz
+		 0xeb, 0x51, 0xf8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x01,   // 1100 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x7a,   // 1101 MHz
+		 0x14, 0xae, 0x07, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xf5,   // 1102 MHz
+		 0x28, 0x5c, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x70,   // 1103 MHz
+		 0x3d, 0x0a, 0x17, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xeb,   // 1104 MHz
+		 0x51, 0xb8, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x66,   // 1105 MHz
+		 0x66, 0x66, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xe1,   // 1106 MHz
+		 0x7a, 0x14, 0x2e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x5c,   // 1107 MHz
+		 0x8f, 0xc2, 0x35, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xd7,   // 1108 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x51,   // 1109 MHz
+		 0xb8, 0x1e, 0x45, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xcc,   // 1110 MHz
+		 0xcc, 0xcc, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x47,   // 1111 MHz
+		 0xe1, 0x7a, 0x54, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xc2,   // 1112 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x3d,   // 1113 MHz
+		 0x0a, 0xd7, 0x63, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xb8,   // 1114 MHz
+		 0x1e, 0x85, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x33,   // 1115 MHz
+		 0x33, 0x33, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xae,   // 1116 MHz
+		 0x47, 0xe1, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x28,   // 1117 MHz
+		 0x5c, 0x8f, 0x82, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xa3,   // 1118 MHz
+		 0x70, 0x3d, 0x8a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x1e,   // 1119 MHz
+		 0x85, 0xeb, 0x91, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x99,   // 1120 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x14,   // 1121 MHz
+		 0xae, 0x47, 0xa1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x8f,   // 1122 MHz
+		 0xc2, 0xf5, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x0a,   // 1123 MHz
+		 0xd7, 0xa3, 0xb0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x85,   // 1124 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x00,   // 1125 MHz
+		 0x00, 0x00, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x7a,   // 1126 MHz
+		 0x14, 0xae, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xf5,   // 1127 MHz
+		 0x28, 0x5c, 0xcf, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x70,   // 1128 MHz
+		 0x3d, 0x0a, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xeb,   // 1129 MHz
+		 0x51, 0xb8, 0xde, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x66,   // 1130 MHz
+		 0x66, 0x66, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xe1,   // 1131 MHz
+		 0x7a, 0x14, 0xee, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0x5c,   // 1132 MHz
+		 0x8f, 0xc2, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x21, 0x08, 0xd7,   // 1133 MHz
+		 0xa3, 0x70, 0xfd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x51,   // 1134 MHz
+		 0xb8, 0x1e, 0x05, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xcc,   // 1135 MHz
+		 0xcc, 0xcc, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x47,   // 1136 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xc2,   // 1137 MHz
+		 0xf5, 0x28, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x3d,   // 1138 MHz
+		 0x0a, 0xd7, 0x23, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xb8,   // 1139 MHz
+		 0x1e, 0x85, 0x2b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x33,   // 1140 MHz
+		 0x33, 0x33, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xae,   // 1141 MHz
+		 0x47, 0xe1, 0x3a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x28,   // 1142 MHz
+		 0x5c, 0x8f, 0x42, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xa3,   // 1143 MHz
+		 0x70, 0x3d, 0x4a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x1e,   // 1144 MHz
+		 0x85, 0xeb, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x99,   // 1145 MHz
+		 0x99, 0x99, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x14,   // 1146 MHz
+		 0xae, 0x47, 0x61, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x8f,   // 1147 MHz
+		 0xc2, 0xf5, 0x68, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x0a,   // 1148 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x85,   // 1149 MHz
+		 0xeb, 0x51, 0x78, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x00,   // 1150 MHz
+		 0x00, 0x00, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x7a,   // 1151 MHz
+		 0x14, 0xae, 0x87, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xf5,   // 1152 MHz
+		 0x28, 0x5c, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x70,   // 1153 MHz
+		 0x3d, 0x0a, 0x97, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xeb,   // 1154 MHz
+		 0x51, 0xb8, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x66,   // 1155 MHz
+		 0x66, 0x66, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xe1,   // 1156 MHz
+		 0x7a, 0x14, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x5c,   // 1157 MHz
+		 0x8f, 0xc2, 0xb5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xd7,   // 1158 MHz
+		 0xa3, 0x70, 0xbd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x51,   // 1159 MHz
+		 0xb8, 0x1e, 0xc5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xcc,   // 1160 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x47,   // 1161 MHz
+		 0xe1, 0x7a, 0xd4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xc2,   // 1162 MHz
+		 0xf5, 0x28, 0xdc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x3d,   // 1163 MHz
+		 0x0a, 0xd7, 0xe3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xb8,   // 1164 MHz
+		 0x1e, 0x85, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0x33,   // 1165 MHz
+		 0x33, 0x33, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x22, 0x08, 0xae,   // 1166 MHz
+		 0x47, 0xe1, 0xfa, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x28,   // 1167 MHz
+		 0x5c, 0x8f, 0x02, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0xa3,   // 1168 MHz
+		 0x70, 0x3d, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x1e,   // 1169 MHz
+		 0x85, 0xeb, 0x11, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x99,   // 1170 MHz
+		 0x99, 0x99, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x14,   // 1171 MHz
+		 0xae, 0x47, 0x21, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x8f,   // 1172 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x0a,   // 1173 MHz
+		 0xd7, 0xa3, 0x30, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x85,   // 1174 MHz
+		 0xeb, 0x51, 0x38, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x00,   // 1175 MHz
+		 0x00, 0x00, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x7a,   // 1176 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0xf5,   // 1177 MHz
+		 0x28, 0x5c, 0x4f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x70,   // 1178 MHz
+		 0x3d, 0x0a, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0xeb,   // 1179 MHz
+		 0x51, 0xb8, 0x5e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x66,   // 1180 MHz
+		 0x66, 0x66, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0xe1,   // 1181 MHz
+		 0x7a, 0x14, 0x6e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x5c,   // 1182 MHz
+		 0x8f, 0xc2, 0x75, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0xd7,   // 1183 MHz
+		 0xa3, 0x70, 0x7d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x51,   // 1184 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0xcc,   // 1185 MHz
+		 0xcc, 0xcc, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x47,   // 1186 MHz
+		 0xe1, 0x7a, 0x94, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0xc2,   // 1187 MHz
+		 0xf5, 0x28, 0x9c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x3d,   // 1188 MHz
+		 0x0a, 0xd7, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0xb8,   // 1189 MHz
+		 0x1e, 0x85, 0xab, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x33,   // 1190 MHz
+		 0x33, 0x33, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0xae,   // 1191 MHz
+		 0x47, 0xe1, 0xba, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x28,   // 1192 MHz
+		 0x5c, 0x8f, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0xa3,   // 1193 MHz
+		 0x70, 0x3d, 0xca, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x1e,   // 1194 MHz
+		 0x85, 0xeb, 0xd1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x99,   // 1195 MHz
+		 0x99, 0x99, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x14,   // 1196 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x8f,   // 1197 MHz
+		 0xc2, 0xf5, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x0a,   // 1198 MHz
+		 0xd7, 0xa3, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x23, 0x08, 0x85,   // 1199 MHz
+		 0xeb, 0x51, 0xf8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x24, 0x08, 0x01,   // 1200 MHz
+		 0x00, 0x00, 0x00, 0x0a, 0x10, 0x03, 0x04}
+	},
+	{ // 322.265625 MHz REFCLK
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //    0 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0b, 0x16, 0x30, 0x04, 0x40, 0x18, 0x01,   //    1 MHz
+		 0x00, 0x00, 0x00, 0x46, 0x50, 0x03, 0x00},
+		{0x05, 0x0a, 0x30, 0x04, 0x0a, 0x08, 0x01,   //    2 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x30, 0x03, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //    3 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //    4 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //    5 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //    6 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //    7 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //    8 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //    9 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   10 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   11 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   12 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   13 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   14 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   15 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   16 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   17 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   18 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   19 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   20 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   21 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   22 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   23 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x0a, 0x14, 0x30, 0x04, 0x10, 0x08, 0x01,   //   24 MHz
+		 0x00, 0x00, 0x00, 0x4a, 0x40, 0x04, 0x00},
+		{0x3c, 0x78, 0x30, 0xe4, 0x19, 0x10, 0x99,   //   25 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x3a, 0x74, 0x30, 0xe4, 0x19, 0x10, 0xd3,   //   26 MHz
+		 0x72, 0x8d, 0xbc, 0x0a, 0x10, 0x03, 0x04},
+		{0x38, 0x70, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //   27 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x36, 0x6c, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //   28 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x34, 0x68, 0x30, 0xe4, 0x19, 0x10, 0xd3,   //   29 MHz
+		 0x72, 0x8d, 0xbc, 0x0a, 0x10, 0x03, 0x04},
+		{0x32, 0x64, 0x30, 0xe4, 0x19, 0x10, 0x99,   //   30 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x31, 0x62, 0x30, 0xe4, 0x19, 0x10, 0x82,   //   31 MHz
+		 0xbd, 0x9c, 0xec, 0x0a, 0x10, 0x03, 0x04},
+		{0x2f, 0x5e, 0x30, 0xe4, 0x19, 0x10, 0x36,   //   32 MHz
+		 0x86, 0x13, 0xab, 0x0a, 0x10, 0x03, 0x04},
+		{0x2e, 0x5c, 0x30, 0xe4, 0x19, 0x10, 0x5a,   //   33 MHz
+		 0x42, 0x3e, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0x2d, 0x5a, 0x30, 0xe4, 0x1a, 0x10, 0x31,   //   34 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0x2b, 0x56, 0x30, 0xe4, 0x19, 0x10, 0x5d,   //   35 MHz
+		 0x01, 0x72, 0xaf, 0x0a, 0x10, 0x03, 0x04},
+		{0x2a, 0x54, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //   36 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x29, 0x52, 0x30, 0xe4, 0x19, 0x10, 0x33,   //   37 MHz
+		 0xc7, 0xdf, 0xe3, 0x0a, 0x10, 0x03, 0x04},
+		{0x28, 0x50, 0x30, 0xe4, 0x19, 0x10, 0xa9,   //   38 MHz
+		 0x38, 0xfb, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x27, 0x4e, 0x30, 0xe4, 0x19, 0x10, 0xd0,   //   39 MHz
+		 0xb3, 0x59, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x26, 0x4c, 0x30, 0xe4, 0x19, 0x10, 0xa9,   //   40 MHz
+		 0x38, 0xfb, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x25, 0x4a, 0x30, 0xe4, 0x19, 0x10, 0x33,   //   41 MHz
+		 0xc7, 0xdf, 0xe3, 0x0a, 0x10, 0x03, 0x04},
+		{0x24, 0x48, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //   42 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x23, 0x46, 0x30, 0xe4, 0x19, 0x10, 0x5d,   //   43 MHz
+		 0x01, 0x72, 0xaf, 0x0a, 0x10, 0x03, 0x04},
+		{0x23, 0x46, 0x30, 0xe4, 0x1a, 0x10, 0xb9,   //   44 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0x22, 0x44, 0x30, 0xe4, 0x1a, 0x10, 0x31,   //   45 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0x21, 0x42, 0x30, 0xe4, 0x19, 0x10, 0x5a,   //   46 MHz
+		 0x42, 0x3e, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0x20, 0x40, 0x30, 0xe4, 0x19, 0x10, 0x36,   //   47 MHz
+		 0x86, 0x13, 0xab, 0x0a, 0x10, 0x03, 0x04},
+		{0x20, 0x40, 0x30, 0xe4, 0x1a, 0x10, 0x1c,   //   48 MHz
+		 0xeb, 0xe2, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0x1f, 0x3e, 0x30, 0xe4, 0x19, 0x10, 0x82,   //   49 MHz
+		 0xbd, 0x9c, 0xec, 0x0a, 0x10, 0x03, 0x04},
+		{0x1e, 0x3c, 0x30, 0xe4, 0x19, 0x10, 0x99,   //   50 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x1e, 0x3c, 0x30, 0xe4, 0x1a, 0x10, 0x31,   //   51 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0x1d, 0x3a, 0x30, 0xe4, 0x19, 0x10, 0xd3,   //   52 MHz
+		 0x72, 0x8d, 0xbc, 0x0a, 0x10, 0x03, 0x04},
+		{0x1d, 0x3a, 0x30, 0xe4, 0x1a, 0x10, 0x43,   //   53 MHz
+		 0x66, 0x41, 0x3b, 0x0a, 0x10, 0x03, 0x04},
+		{0x1c, 0x38, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //   54 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x1c, 0x38, 0x30, 0xe4, 0x1a, 0x10, 0xb9,   //   55 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0x1b, 0x36, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //   56 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x1b, 0x36, 0x30, 0xe4, 0x1a, 0x10, 0x91,   //   57 MHz
+		 0x5c, 0xfe, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0x1a, 0x34, 0x30, 0xe4, 0x19, 0x10, 0xd3,   //   58 MHz
+		 0x72, 0x8d, 0xbc, 0x0a, 0x10, 0x03, 0x04},
+		{0x1a, 0x34, 0x30, 0xe4, 0x1a, 0x10, 0xcd,   //   59 MHz
+		 0xf4, 0x25, 0x2e, 0x0a, 0x10, 0x03, 0x04},
+		{0x19, 0x32, 0x30, 0xe4, 0x19, 0x10, 0x99,   //   60 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x19, 0x32, 0x30, 0xe4, 0x1a, 0x10, 0x6d,   //   61 MHz
+		 0xa0, 0xd3, 0x06, 0x0a, 0x10, 0x03, 0x04},
+		{0x19, 0x32, 0x30, 0xe4, 0x1a, 0x10, 0x40,   //   62 MHz
+		 0xa7, 0x0d, 0x74, 0x0a, 0x10, 0x03, 0x04},
+		{0x18, 0x30, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //   63 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x18, 0x30, 0x30, 0xe4, 0x1a, 0x10, 0x1c,   //   64 MHz
+		 0xeb, 0xe2, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0x18, 0x30, 0x30, 0xe4, 0x1a, 0x10, 0xc8,   //   65 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0x17, 0x2e, 0x30, 0xe4, 0x19, 0x10, 0x5a,   //   66 MHz
+		 0x42, 0x3e, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0x17, 0x2e, 0x30, 0xe4, 0x1a, 0x10, 0xe0,   //   67 MHz
+		 0x52, 0xbb, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0x17, 0x2e, 0x30, 0xe4, 0x1a, 0x10, 0x65,   //   68 MHz
+		 0x63, 0x38, 0xb1, 0x0a, 0x10, 0x03, 0x04},
+		{0x16, 0x2c, 0x30, 0xe4, 0x19, 0x10, 0x5a,   //   69 MHz
+		 0x42, 0x3e, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0x16, 0x2c, 0x30, 0xe4, 0x1a, 0x10, 0xb9,   //   70 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0x16, 0x2c, 0x30, 0xe4, 0x1a, 0x10, 0x17,   //   71 MHz
+		 0x6d, 0x7b, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0x15, 0x2a, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //   72 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x15, 0x2a, 0x30, 0xe4, 0x1a, 0x10, 0xa6,   //   73 MHz
+		 0x79, 0xc7, 0x29, 0x0a, 0x10, 0x03, 0x04},
+		{0x15, 0x2a, 0x30, 0xe4, 0x1a, 0x10, 0xdd,   //   74 MHz
+		 0x93, 0x87, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x14, 0x28, 0x30, 0xe4, 0x19, 0x10, 0x99,   //   75 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x14, 0x28, 0x30, 0xe4, 0x19, 0x10, 0xa9,   //   76 MHz
+		 0x38, 0xfb, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x14, 0x28, 0x30, 0xe4, 0x1a, 0x10, 0xb9,   //   77 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0x14, 0x28, 0x30, 0xe4, 0x1a, 0x10, 0xc8,   //   78 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0x13, 0x26, 0x30, 0xe4, 0x19, 0x10, 0xc0,   //   79 MHz
+		 0x14, 0xf8, 0x9d, 0x0a, 0x10, 0x03, 0x04},
+		{0x13, 0x26, 0x30, 0xe4, 0x19, 0x10, 0xa9,   //   80 MHz
+		 0x38, 0xfb, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x13, 0x26, 0x30, 0xe4, 0x1a, 0x10, 0x91,   //   81 MHz
+		 0x5c, 0xfe, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0x13, 0x26, 0x30, 0xe4, 0x1a, 0x10, 0x7a,   //   82 MHz
+		 0x80, 0x01, 0x97, 0x0a, 0x10, 0x03, 0x04},
+		{0x13, 0x26, 0x30, 0xe4, 0x1a, 0x10, 0x62,   //   83 MHz
+		 0xa4, 0x04, 0xea, 0x0a, 0x10, 0x03, 0x04},
+		{0x12, 0x24, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //   84 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x12, 0x24, 0x30, 0xe4, 0x1a, 0x10, 0x31,   //   85 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0x12, 0x24, 0x30, 0xe4, 0x1a, 0x10, 0xf2,   //   86 MHz
+		 0xb0, 0x50, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0x12, 0x24, 0x30, 0xe4, 0x1a, 0x10, 0xb3,   //   87 MHz
+		 0x59, 0xf5, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0x12, 0x24, 0x30, 0xe4, 0x1b, 0x10, 0x75,   //   88 MHz
+		 0x02, 0x9a, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0x11, 0x22, 0x30, 0xe4, 0x19, 0x10, 0x97,   //   89 MHz
+		 0xda, 0x65, 0xd2, 0x0a, 0x10, 0x03, 0x04},
+		{0x11, 0x22, 0x30, 0xe4, 0x1a, 0x10, 0x31,   //   90 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0x11, 0x22, 0x30, 0xe4, 0x1a, 0x10, 0xcb,   //   91 MHz
+		 0x35, 0xf2, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x11, 0x22, 0x30, 0xe4, 0x1a, 0x10, 0x65,   //   92 MHz
+		 0x63, 0x38, 0xb1, 0x0a, 0x10, 0x03, 0x04},
+		{0x11, 0x22, 0x30, 0xe4, 0x1a, 0x10, 0xff,   //   93 MHz
+		 0x90, 0x7e, 0xfb, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x19, 0x10, 0x36,   //   94 MHz
+		 0x86, 0x13, 0xab, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x19, 0x10, 0xa9,   //   95 MHz
+		 0x38, 0xfb, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x1a, 0x10, 0x1c,   //   96 MHz
+		 0xeb, 0xe2, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x1a, 0x10, 0x8f,   //   97 MHz
+		 0x9d, 0xca, 0x7c, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x1a, 0x10, 0x02,   //   98 MHz
+		 0x50, 0xb2, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x10, 0x20, 0x30, 0xe4, 0x1b, 0x10, 0x75,   //   99 MHz
+		 0x02, 0x9a, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x19, 0x10, 0x99,   //  100 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x19, 0x10, 0xe5,   //  101 MHz
+		 0xd0, 0x22, 0xdb, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1a, 0x10, 0x31,   //  102 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1a, 0x10, 0x7c,   //  103 MHz
+		 0x3f, 0x35, 0x5e, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1a, 0x10, 0xc8,   //  104 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1a, 0x10, 0x14,   //  105 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1b, 0x10, 0x60,   //  106 MHz
+		 0xe5, 0xd0, 0x22, 0x0a, 0x10, 0x03, 0x04},
+		{0x0f, 0x1e, 0x30, 0xe4, 0x1b, 0x10, 0xac,   //  107 MHz
+		 0x1c, 0x5a, 0x64, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //  108 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1a, 0x10, 0x94,   //  109 MHz
+		 0x1b, 0x32, 0x0b, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1a, 0x10, 0xb9,   //  110 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1a, 0x10, 0xdd,   //  111 MHz
+		 0x93, 0x87, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1a, 0x10, 0x02,   //  112 MHz
+		 0x50, 0xb2, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1a, 0x10, 0x26,   //  113 MHz
+		 0x0c, 0xdd, 0xff, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1b, 0x10, 0x4b,   //  114 MHz
+		 0xc8, 0x07, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x0e, 0x1c, 0x30, 0xe4, 0x1b, 0x10, 0x6f,   //  115 MHz
+		 0x84, 0x32, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x19, 0x10, 0xd3,   //  116 MHz
+		 0x72, 0x8d, 0xbc, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x19, 0x10, 0xd0,   //  117 MHz
+		 0xb3, 0x59, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1a, 0x10, 0xcd,   //  118 MHz
+		 0xf4, 0x25, 0x2e, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1a, 0x10, 0xcb,   //  119 MHz
+		 0x35, 0xf2, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1a, 0x10, 0xc8,   //  120 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1a, 0x10, 0xc6,   //  121 MHz
+		 0xb7, 0x8a, 0xd8, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1b, 0x10, 0xc3,   //  122 MHz
+		 0xf8, 0x56, 0x11, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1b, 0x10, 0xc0,   //  123 MHz
+		 0x39, 0x23, 0x4a, 0x0a, 0x10, 0x03, 0x04},
+		{0x0d, 0x1a, 0x30, 0xe4, 0x1b, 0x10, 0xbe,   //  124 MHz
+		 0x7a, 0xef, 0x82, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x19, 0x10, 0x99,   //  125 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //  126 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1a, 0x10, 0x46,   //  127 MHz
+		 0x25, 0x75, 0x02, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1a, 0x10, 0x1c,   //  128 MHz
+		 0xeb, 0xe2, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1a, 0x10, 0xf2,   //  129 MHz
+		 0xb0, 0x50, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1a, 0x10, 0xc8,   //  130 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1a, 0x10, 0x9e,   //  131 MHz
+		 0x3c, 0x2c, 0xd4, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1b, 0x10, 0x75,   //  132 MHz
+		 0x02, 0x9a, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1b, 0x10, 0x4b,   //  133 MHz
+		 0xc8, 0x07, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1b, 0x10, 0x21,   //  134 MHz
+		 0x8e, 0x75, 0x71, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1b, 0x10, 0xf7,   //  135 MHz
+		 0x53, 0xe3, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0x0c, 0x18, 0x30, 0xe4, 0x1b, 0x10, 0xce,   //  136 MHz
+		 0x19, 0x51, 0xda, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x19, 0x10, 0xab,   //  137 MHz
+		 0xf7, 0x2e, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x19, 0x10, 0x5a,   //  138 MHz
+		 0x42, 0x3e, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1a, 0x10, 0x09,   //  139 MHz
+		 0x8d, 0x4d, 0x18, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1a, 0x10, 0xb9,   //  140 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1a, 0x10, 0x68,   //  141 MHz
+		 0x22, 0x6c, 0x78, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1a, 0x10, 0x17,   //  142 MHz
+		 0x6d, 0x7b, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1a, 0x10, 0xc6,   //  143 MHz
+		 0xb7, 0x8a, 0xd8, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1b, 0x10, 0x75,   //  144 MHz
+		 0x02, 0x9a, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1b, 0x10, 0x24,   //  145 MHz
+		 0x4d, 0xa9, 0x38, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1b, 0x10, 0xd3,   //  146 MHz
+		 0x97, 0xb8, 0x68, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1b, 0x10, 0x82,   //  147 MHz
+		 0xe2, 0xc7, 0x98, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1b, 0x10, 0x31,   //  148 MHz
+		 0x2d, 0xd7, 0xc8, 0x0a, 0x10, 0x03, 0x04},
+		{0x0b, 0x16, 0x30, 0xe4, 0x1b, 0x10, 0xe0,   //  149 MHz
+		 0x77, 0xe6, 0xf8, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x19, 0x10, 0x99,   //  150 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x19, 0x10, 0x21,   //  151 MHz
+		 0x69, 0x4a, 0xc5, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x19, 0x10, 0xa9,   //  152 MHz
+		 0x38, 0xfb, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1a, 0x10, 0x31,   //  153 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1a, 0x10, 0xb9,   //  154 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1a, 0x10, 0x40,   //  155 MHz
+		 0xa7, 0x0d, 0x74, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1a, 0x10, 0xc8,   //  156 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1a, 0x10, 0x50,   //  157 MHz
+		 0x46, 0x6f, 0xcb, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1a, 0x10, 0xd8,   //  158 MHz
+		 0x15, 0x20, 0xf7, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1b, 0x10, 0x60,   //  159 MHz
+		 0xe5, 0xd0, 0x22, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1b, 0x10, 0xe8,   //  160 MHz
+		 0xb4, 0x81, 0x4e, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1b, 0x10, 0x6f,   //  161 MHz
+		 0x84, 0x32, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1b, 0x10, 0xf7,   //  162 MHz
+		 0x53, 0xe3, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1b, 0x10, 0x7f,   //  163 MHz
+		 0x23, 0x94, 0xd1, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1b, 0x10, 0x07,   //  164 MHz
+		 0xf3, 0x44, 0xfd, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1c, 0x10, 0x8f,   //  165 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x0a, 0x14, 0x30, 0xe4, 0x1c, 0x10, 0x17,   //  166 MHz
+		 0x92, 0xa6, 0x54, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x19, 0x10, 0x0f,   //  167 MHz
+		 0x0b, 0xb5, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //  168 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x19, 0x10, 0xd0,   //  169 MHz
+		 0xb3, 0x59, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1a, 0x10, 0x31,   //  170 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1a, 0x10, 0x91,   //  171 MHz
+		 0x5c, 0xfe, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1a, 0x10, 0xf2,   //  172 MHz
+		 0xb0, 0x50, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1a, 0x10, 0x53,   //  173 MHz
+		 0x05, 0xa3, 0x92, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1a, 0x10, 0xb3,   //  174 MHz
+		 0x59, 0xf5, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1a, 0x10, 0x14,   //  175 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1b, 0x10, 0x75,   //  176 MHz
+		 0x02, 0x9a, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1b, 0x10, 0xd5,   //  177 MHz
+		 0x56, 0xec, 0x2f, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1b, 0x10, 0x36,   //  178 MHz
+		 0xab, 0x3e, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1b, 0x10, 0x97,   //  179 MHz
+		 0xff, 0x90, 0x7e, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1b, 0x10, 0xf7,   //  180 MHz
+		 0x53, 0xe3, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1b, 0x10, 0x58,   //  181 MHz
+		 0xa8, 0x35, 0xcd, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1b, 0x10, 0xb9,   //  182 MHz
+		 0xfc, 0x87, 0xf4, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1c, 0x10, 0x19,   //  183 MHz
+		 0x51, 0xda, 0x1b, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1c, 0x10, 0x7a,   //  184 MHz
+		 0xa5, 0x2c, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1c, 0x10, 0xdb,   //  185 MHz
+		 0xf9, 0x7e, 0x6a, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1c, 0x10, 0x3b,   //  186 MHz
+		 0x4e, 0xd1, 0x91, 0x0a, 0x10, 0x03, 0x04},
+		{0x09, 0x12, 0x30, 0xe4, 0x1c, 0x10, 0x9c,   //  187 MHz
+		 0xa2, 0x23, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x19, 0x10, 0x36,   //  188 MHz
+		 0x86, 0x13, 0xab, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //  189 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x19, 0x10, 0xa9,   //  190 MHz
+		 0x38, 0xfb, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1a, 0x10, 0xe2,   //  191 MHz
+		 0x11, 0xef, 0x13, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1a, 0x10, 0x1c,   //  192 MHz
+		 0xeb, 0xe2, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1a, 0x10, 0x55,   //  193 MHz
+		 0xc4, 0xd6, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1a, 0x10, 0x8f,   //  194 MHz
+		 0x9d, 0xca, 0x7c, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1a, 0x10, 0xc8,   //  195 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1a, 0x10, 0x02,   //  196 MHz
+		 0x50, 0xb2, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1a, 0x10, 0x3b,   //  197 MHz
+		 0x29, 0xa6, 0xe5, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1b, 0x10, 0x75,   //  198 MHz
+		 0x02, 0x9a, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1b, 0x10, 0xae,   //  199 MHz
+		 0xdb, 0x8d, 0x2b, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1b, 0x10, 0xe8,   //  200 MHz
+		 0xb4, 0x81, 0x4e, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1b, 0x10, 0x21,   //  201 MHz
+		 0x8e, 0x75, 0x71, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1b, 0x10, 0x5b,   //  202 MHz
+		 0x67, 0x69, 0x94, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1b, 0x10, 0x94,   //  203 MHz
+		 0x40, 0x5d, 0xb7, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1b, 0x10, 0xce,   //  204 MHz
+		 0x19, 0x51, 0xda, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1b, 0x10, 0x07,   //  205 MHz
+		 0xf3, 0x44, 0xfd, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1c, 0x10, 0x40,   //  206 MHz
+		 0xcc, 0x38, 0x20, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1c, 0x10, 0x7a,   //  207 MHz
+		 0xa5, 0x2c, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1c, 0x10, 0xb3,   //  208 MHz
+		 0x7e, 0x20, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1c, 0x10, 0xed,   //  209 MHz
+		 0x57, 0x14, 0x89, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1c, 0x10, 0x26,   //  210 MHz
+		 0x31, 0x08, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1c, 0x10, 0x60,   //  211 MHz
+		 0x0a, 0xfc, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1c, 0x10, 0x99,   //  212 MHz
+		 0xe3, 0xef, 0xf1, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1d, 0x10, 0xd3,   //  213 MHz
+		 0xbc, 0xe3, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x08, 0x10, 0x30, 0xe4, 0x1d, 0x10, 0x0c,   //  214 MHz
+		 0x96, 0xd7, 0x37, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x19, 0x10, 0x5d,   //  215 MHz
+		 0x01, 0x72, 0xaf, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //  216 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x19, 0x10, 0x82,   //  217 MHz
+		 0xbd, 0x9c, 0xec, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1a, 0x10, 0x94,   //  218 MHz
+		 0x1b, 0x32, 0x0b, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1a, 0x10, 0xa6,   //  219 MHz
+		 0x79, 0xc7, 0x29, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1a, 0x10, 0xb9,   //  220 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1a, 0x10, 0xcb,   //  221 MHz
+		 0x35, 0xf2, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1a, 0x10, 0xdd,   //  222 MHz
+		 0x93, 0x87, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1a, 0x10, 0xef,   //  223 MHz
+		 0xf1, 0x1c, 0xa4, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1a, 0x10, 0x02,   //  224 MHz
+		 0x50, 0xb2, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1a, 0x10, 0x14,   //  225 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1a, 0x10, 0x26,   //  226 MHz
+		 0x0c, 0xdd, 0xff, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1b, 0x10, 0x39,   //  227 MHz
+		 0x6a, 0x72, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1b, 0x10, 0x4b,   //  228 MHz
+		 0xc8, 0x07, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1b, 0x10, 0x5d,   //  229 MHz
+		 0x26, 0x9d, 0x5b, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1b, 0x10, 0x6f,   //  230 MHz
+		 0x84, 0x32, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1b, 0x10, 0x82,   //  231 MHz
+		 0xe2, 0xc7, 0x98, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1b, 0x10, 0x94,   //  232 MHz
+		 0x40, 0x5d, 0xb7, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1b, 0x10, 0xa6,   //  233 MHz
+		 0x9e, 0xf2, 0xd5, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1b, 0x10, 0xb9,   //  234 MHz
+		 0xfc, 0x87, 0xf4, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1c, 0x10, 0xcb,   //  235 MHz
+		 0x5a, 0x1d, 0x13, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1c, 0x10, 0xdd,   //  236 MHz
+		 0xb8, 0xb2, 0x31, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1c, 0x10, 0xf0,   //  237 MHz
+		 0x16, 0x48, 0x50, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1c, 0x10, 0x02,   //  238 MHz
+		 0x75, 0xdd, 0x6e, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1c, 0x10, 0x14,   //  239 MHz
+		 0xd3, 0x72, 0x8d, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1c, 0x10, 0x26,   //  240 MHz
+		 0x31, 0x08, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1c, 0x10, 0x39,   //  241 MHz
+		 0x8f, 0x9d, 0xca, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1c, 0x10, 0x4b,   //  242 MHz
+		 0xed, 0x32, 0xe9, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1d, 0x10, 0x5d,   //  243 MHz
+		 0x4b, 0xc8, 0x07, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1d, 0x10, 0x70,   //  244 MHz
+		 0xa9, 0x5d, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1d, 0x10, 0x82,   //  245 MHz
+		 0x07, 0xf3, 0x44, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1d, 0x10, 0x94,   //  246 MHz
+		 0x65, 0x88, 0x63, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1d, 0x10, 0xa6,   //  247 MHz
+		 0xc3, 0x1d, 0x82, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1d, 0x10, 0xb9,   //  248 MHz
+		 0x21, 0xb3, 0xa0, 0x0a, 0x10, 0x03, 0x04},
+		{0x07, 0x0e, 0x30, 0xe4, 0x1d, 0x10, 0xcb,   //  249 MHz
+		 0x7f, 0x48, 0xbf, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x19, 0x10, 0x99,   //  250 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x19, 0x10, 0x84,   //  251 MHz
+		 0x7c, 0xd0, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //  252 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x19, 0x10, 0x5a,   //  253 MHz
+		 0x42, 0x3e, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1a, 0x10, 0x46,   //  254 MHz
+		 0x25, 0x75, 0x02, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1a, 0x10, 0x31,   //  255 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1a, 0x10, 0x1c,   //  256 MHz
+		 0xeb, 0xe2, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1a, 0x10, 0x07,   //  257 MHz
+		 0xce, 0x19, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1a, 0x10, 0xf2,   //  258 MHz
+		 0xb0, 0x50, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1a, 0x10, 0xdd,   //  259 MHz
+		 0x93, 0x87, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1a, 0x10, 0xc8,   //  260 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1a, 0x10, 0xb3,   //  261 MHz
+		 0x59, 0xf5, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1a, 0x10, 0x9e,   //  262 MHz
+		 0x3c, 0x2c, 0xd4, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1a, 0x10, 0x8a,   //  263 MHz
+		 0x1f, 0x63, 0xee, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1b, 0x10, 0x75,   //  264 MHz
+		 0x02, 0x9a, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1b, 0x10, 0x60,   //  265 MHz
+		 0xe5, 0xd0, 0x22, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1b, 0x10, 0x4b,   //  266 MHz
+		 0xc8, 0x07, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1b, 0x10, 0x36,   //  267 MHz
+		 0xab, 0x3e, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1b, 0x10, 0x21,   //  268 MHz
+		 0x8e, 0x75, 0x71, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1b, 0x10, 0x0c,   //  269 MHz
+		 0x71, 0xac, 0x8b, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1b, 0x10, 0xf7,   //  270 MHz
+		 0x53, 0xe3, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1b, 0x10, 0xe2,   //  271 MHz
+		 0x36, 0x1a, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1b, 0x10, 0xce,   //  272 MHz
+		 0x19, 0x51, 0xda, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1b, 0x10, 0xb9,   //  273 MHz
+		 0xfc, 0x87, 0xf4, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1c, 0x10, 0xa4,   //  274 MHz
+		 0xdf, 0xbe, 0x0e, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1c, 0x10, 0x8f,   //  275 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1c, 0x10, 0x7a,   //  276 MHz
+		 0xa5, 0x2c, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1c, 0x10, 0x65,   //  277 MHz
+		 0x88, 0x63, 0x5d, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1c, 0x10, 0x50,   //  278 MHz
+		 0x6b, 0x9a, 0x77, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1c, 0x10, 0x3b,   //  279 MHz
+		 0x4e, 0xd1, 0x91, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1c, 0x10, 0x26,   //  280 MHz
+		 0x31, 0x08, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1c, 0x10, 0x12,   //  281 MHz
+		 0x14, 0x3f, 0xc6, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1c, 0x10, 0xfd,   //  282 MHz
+		 0xf6, 0x75, 0xe0, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1c, 0x10, 0xe8,   //  283 MHz
+		 0xd9, 0xac, 0xfa, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1d, 0x10, 0xd3,   //  284 MHz
+		 0xbc, 0xe3, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1d, 0x10, 0xbe,   //  285 MHz
+		 0x9f, 0x1a, 0x2f, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1d, 0x10, 0xa9,   //  286 MHz
+		 0x82, 0x51, 0x49, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1d, 0x10, 0x94,   //  287 MHz
+		 0x65, 0x88, 0x63, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1d, 0x10, 0x7f,   //  288 MHz
+		 0x48, 0xbf, 0x7d, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1d, 0x10, 0x6a,   //  289 MHz
+		 0x2b, 0xf6, 0x97, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1d, 0x10, 0x56,   //  290 MHz
+		 0x0e, 0x2d, 0xb2, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1d, 0x10, 0x41,   //  291 MHz
+		 0xf1, 0x63, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1d, 0x10, 0x2c,   //  292 MHz
+		 0xd4, 0x9a, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x10, 0x17,   //  293 MHz
+		 0xb7, 0xd1, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x10, 0x02,   //  294 MHz
+		 0x9a, 0x08, 0x1b, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x10, 0xed,   //  295 MHz
+		 0x7c, 0x3f, 0x35, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x10, 0xd8,   //  296 MHz
+		 0x5f, 0x76, 0x4f, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x10, 0xc3,   //  297 MHz
+		 0x42, 0xad, 0x69, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x10, 0xae,   //  298 MHz
+		 0x25, 0xe4, 0x83, 0x0a, 0x10, 0x03, 0x04},
+		{0x06, 0x0c, 0x30, 0xe4, 0x1e, 0x10, 0x9a,   //  299 MHz
+		 0x08, 0x1b, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x19, 0x10, 0x99,   //  300 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x19, 0x10, 0x5d,   //  301 MHz
+		 0x01, 0x72, 0xaf, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x19, 0x10, 0x21,   //  302 MHz
+		 0x69, 0x4a, 0xc5, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x19, 0x10, 0xe5,   //  303 MHz
+		 0xd0, 0x22, 0xdb, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x19, 0x10, 0xa9,   //  304 MHz
+		 0x38, 0xfb, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0x6d,   //  305 MHz
+		 0xa0, 0xd3, 0x06, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0x31,   //  306 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0xf5,   //  307 MHz
+		 0x6f, 0x84, 0x32, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0xb9,   //  308 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0x7c,   //  309 MHz
+		 0x3f, 0x35, 0x5e, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0x40,   //  310 MHz
+		 0xa7, 0x0d, 0x74, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0x04,   //  311 MHz
+		 0x0f, 0xe6, 0x89, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0xc8,   //  312 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0x8c,   //  313 MHz
+		 0xde, 0x96, 0xb5, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0x50,   //  314 MHz
+		 0x46, 0x6f, 0xcb, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0x14,   //  315 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1a, 0x10, 0xd8,   //  316 MHz
+		 0x15, 0x20, 0xf7, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0x9c,   //  317 MHz
+		 0x7d, 0xf8, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0x60,   //  318 MHz
+		 0xe5, 0xd0, 0x22, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0x24,   //  319 MHz
+		 0x4d, 0xa9, 0x38, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0xe8,   //  320 MHz
+		 0xb4, 0x81, 0x4e, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0xac,   //  321 MHz
+		 0x1c, 0x5a, 0x64, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0x6f,   //  322 MHz
+		 0x84, 0x32, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0x33,   //  323 MHz
+		 0xec, 0x0a, 0x90, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0xf7,   //  324 MHz
+		 0x53, 0xe3, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0xbb,   //  325 MHz
+		 0xbb, 0xbb, 0xbb, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0x7f,   //  326 MHz
+		 0x23, 0x94, 0xd1, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0x43,   //  327 MHz
+		 0x8b, 0x6c, 0xe7, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1b, 0x10, 0x07,   //  328 MHz
+		 0xf3, 0x44, 0xfd, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1c, 0x10, 0xcb,   //  329 MHz
+		 0x5a, 0x1d, 0x13, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1c, 0x10, 0x8f,   //  330 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1c, 0x10, 0x53,   //  331 MHz
+		 0x2a, 0xce, 0x3e, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1c, 0x10, 0x17,   //  332 MHz
+		 0x92, 0xa6, 0x54, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1c, 0x10, 0xdb,   //  333 MHz
+		 0xf9, 0x7e, 0x6a, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1c, 0x10, 0x9f,   //  334 MHz
+		 0x61, 0x57, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1c, 0x10, 0x62,   //  335 MHz
+		 0xc9, 0x2f, 0x96, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1c, 0x10, 0x26,   //  336 MHz
+		 0x31, 0x08, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1c, 0x10, 0xea,   //  337 MHz
+		 0x98, 0xe0, 0xc1, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1c, 0x10, 0xae,   //  338 MHz
+		 0x00, 0xb9, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1c, 0x10, 0x72,   //  339 MHz
+		 0x68, 0x91, 0xed, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0x36,   //  340 MHz
+		 0xd0, 0x69, 0x03, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0xfa,   //  341 MHz
+		 0x37, 0x42, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0xbe,   //  342 MHz
+		 0x9f, 0x1a, 0x2f, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0x82,   //  343 MHz
+		 0x07, 0xf3, 0x44, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0x46,   //  344 MHz
+		 0x6f, 0xcb, 0x5a, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0x0a,   //  345 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0xce,   //  346 MHz
+		 0x3e, 0x7c, 0x86, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0x92,   //  347 MHz
+		 0xa6, 0x54, 0x9c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0x56,   //  348 MHz
+		 0x0e, 0x2d, 0xb2, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0x19,   //  349 MHz
+		 0x76, 0x05, 0xc8, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0xdd,   //  350 MHz
+		 0xdd, 0xdd, 0xdd, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1d, 0x10, 0xa1,   //  351 MHz
+		 0x45, 0xb6, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0x65,   //  352 MHz
+		 0xad, 0x8e, 0x09, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0x29,   //  353 MHz
+		 0x15, 0x67, 0x1f, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0xed,   //  354 MHz
+		 0x7c, 0x3f, 0x35, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0xb1,   //  355 MHz
+		 0xe4, 0x17, 0x4b, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0x75,   //  356 MHz
+		 0x4c, 0xf0, 0x60, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0x39,   //  357 MHz
+		 0xb4, 0xc8, 0x76, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0xfd,   //  358 MHz
+		 0x1b, 0xa1, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0xc1,   //  359 MHz
+		 0x83, 0x79, 0xa2, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0x85,   //  360 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0x49,   //  361 MHz
+		 0x53, 0x2a, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0x0c,   //  362 MHz
+		 0xbb, 0x02, 0xe4, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1e, 0x10, 0xd0,   //  363 MHz
+		 0x22, 0xdb, 0xf9, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x10, 0x94,   //  364 MHz
+		 0x8a, 0xb3, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x10, 0x58,   //  365 MHz
+		 0xf2, 0x8b, 0x25, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x10, 0x1c,   //  366 MHz
+		 0x5a, 0x64, 0x3b, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x10, 0xe0,   //  367 MHz
+		 0xc1, 0x3c, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x10, 0xa4,   //  368 MHz
+		 0x29, 0x15, 0x67, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x10, 0x68,   //  369 MHz
+		 0x91, 0xed, 0x7c, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x10, 0x2c,   //  370 MHz
+		 0xf9, 0xc5, 0x92, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x10, 0xf0,   //  371 MHz
+		 0x60, 0x9e, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x10, 0xb4,   //  372 MHz
+		 0xc8, 0x76, 0xbe, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x10, 0x78,   //  373 MHz
+		 0x30, 0x4f, 0xd4, 0x0a, 0x10, 0x03, 0x04},
+		{0x05, 0x0a, 0x30, 0xe4, 0x1f, 0x10, 0x3c,   //  374 MHz
+		 0x98, 0x27, 0xea, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x19, 0x10, 0x99,   //  375 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x19, 0x10, 0x36,   //  376 MHz
+		 0x86, 0x13, 0xab, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x19, 0x10, 0xd3,   //  377 MHz
+		 0x72, 0x8d, 0xbc, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //  378 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x19, 0x10, 0x0c,   //  379 MHz
+		 0x4c, 0x81, 0xdf, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x19, 0x10, 0xa9,   //  380 MHz
+		 0x38, 0xfb, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0x46,   //  381 MHz
+		 0x25, 0x75, 0x02, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0xe2,   //  382 MHz
+		 0x11, 0xef, 0x13, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0x7f,   //  383 MHz
+		 0xfe, 0x68, 0x25, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0x1c,   //  384 MHz
+		 0xeb, 0xe2, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0xb9,   //  385 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0x55,   //  386 MHz
+		 0xc4, 0xd6, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0xf2,   //  387 MHz
+		 0xb0, 0x50, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0x8f,   //  388 MHz
+		 0x9d, 0xca, 0x7c, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0x2b,   //  389 MHz
+		 0x8a, 0x44, 0x8e, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0xc8,   //  390 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0x65,   //  391 MHz
+		 0x63, 0x38, 0xb1, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0x02,   //  392 MHz
+		 0x50, 0xb2, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0x9e,   //  393 MHz
+		 0x3c, 0x2c, 0xd4, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0x3b,   //  394 MHz
+		 0x29, 0xa6, 0xe5, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1a, 0x10, 0xd8,   //  395 MHz
+		 0x15, 0x20, 0xf7, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0x75,   //  396 MHz
+		 0x02, 0x9a, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0x11,   //  397 MHz
+		 0xef, 0x13, 0x1a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0xae,   //  398 MHz
+		 0xdb, 0x8d, 0x2b, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0x4b,   //  399 MHz
+		 0xc8, 0x07, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0xe8,   //  400 MHz
+		 0xb4, 0x81, 0x4e, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0x84,   //  401 MHz
+		 0xa1, 0xfb, 0x5f, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0x21,   //  402 MHz
+		 0x8e, 0x75, 0x71, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0xbe,   //  403 MHz
+		 0x7a, 0xef, 0x82, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0x5b,   //  404 MHz
+		 0x67, 0x69, 0x94, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0xf7,   //  405 MHz
+		 0x53, 0xe3, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0x94,   //  406 MHz
+		 0x40, 0x5d, 0xb7, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0x31,   //  407 MHz
+		 0x2d, 0xd7, 0xc8, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0xce,   //  408 MHz
+		 0x19, 0x51, 0xda, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0x6a,   //  409 MHz
+		 0x06, 0xcb, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1b, 0x10, 0x07,   //  410 MHz
+		 0xf3, 0x44, 0xfd, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0xa4,   //  411 MHz
+		 0xdf, 0xbe, 0x0e, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0x40,   //  412 MHz
+		 0xcc, 0x38, 0x20, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0xdd,   //  413 MHz
+		 0xb8, 0xb2, 0x31, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0x7a,   //  414 MHz
+		 0xa5, 0x2c, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0x17,   //  415 MHz
+		 0x92, 0xa6, 0x54, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0xb3,   //  416 MHz
+		 0x7e, 0x20, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0x50,   //  417 MHz
+		 0x6b, 0x9a, 0x77, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0xed,   //  418 MHz
+		 0x57, 0x14, 0x89, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0x8a,   //  419 MHz
+		 0x44, 0x8e, 0x9a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0x26,   //  420 MHz
+		 0x31, 0x08, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0xc3,   //  421 MHz
+		 0x1d, 0x82, 0xbd, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0x60,   //  422 MHz
+		 0x0a, 0xfc, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0xfd,   //  423 MHz
+		 0xf6, 0x75, 0xe0, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1c, 0x10, 0x99,   //  424 MHz
+		 0xe3, 0xef, 0xf1, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0x36,   //  425 MHz
+		 0xd0, 0x69, 0x03, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0xd3,   //  426 MHz
+		 0xbc, 0xe3, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0x70,   //  427 MHz
+		 0xa9, 0x5d, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0x0c,   //  428 MHz
+		 0x96, 0xd7, 0x37, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0xa9,   //  429 MHz
+		 0x82, 0x51, 0x49, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0x46,   //  430 MHz
+		 0x6f, 0xcb, 0x5a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0xe3,   //  431 MHz
+		 0x5b, 0x45, 0x6c, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0x7f,   //  432 MHz
+		 0x48, 0xbf, 0x7d, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0x1c,   //  433 MHz
+		 0x35, 0x39, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0xb9,   //  434 MHz
+		 0x21, 0xb3, 0xa0, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0x56,   //  435 MHz
+		 0x0e, 0x2d, 0xb2, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0xf2,   //  436 MHz
+		 0xfa, 0xa6, 0xc3, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0x8f,   //  437 MHz
+		 0xe7, 0x20, 0xd5, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0x2c,   //  438 MHz
+		 0xd4, 0x9a, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1d, 0x10, 0xc8,   //  439 MHz
+		 0xc0, 0x14, 0xf8, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0x65,   //  440 MHz
+		 0xad, 0x8e, 0x09, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0x02,   //  441 MHz
+		 0x9a, 0x08, 0x1b, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0x9f,   //  442 MHz
+		 0x86, 0x82, 0x2c, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0x3b,   //  443 MHz
+		 0x73, 0xfc, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0xd8,   //  444 MHz
+		 0x5f, 0x76, 0x4f, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0x75,   //  445 MHz
+		 0x4c, 0xf0, 0x60, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0x12,   //  446 MHz
+		 0x39, 0x6a, 0x72, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0xae,   //  447 MHz
+		 0x25, 0xe4, 0x83, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0x4b,   //  448 MHz
+		 0x12, 0x5e, 0x95, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0xe8,   //  449 MHz
+		 0xfe, 0xd7, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0x85,   //  450 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0x21,   //  451 MHz
+		 0xd8, 0xcb, 0xc9, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0xbe,   //  452 MHz
+		 0xc4, 0x45, 0xdb, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0x5b,   //  453 MHz
+		 0xb1, 0xbf, 0xec, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1e, 0x10, 0xf8,   //  454 MHz
+		 0x9d, 0x39, 0xfe, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0x94,   //  455 MHz
+		 0x8a, 0xb3, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0x31,   //  456 MHz
+		 0x77, 0x2d, 0x21, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0xce,   //  457 MHz
+		 0x63, 0xa7, 0x32, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0x6b,   //  458 MHz
+		 0x50, 0x21, 0x44, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0x07,   //  459 MHz
+		 0x3d, 0x9b, 0x55, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0xa4,   //  460 MHz
+		 0x29, 0x15, 0x67, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0x41,   //  461 MHz
+		 0x16, 0x8f, 0x78, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0xde,   //  462 MHz
+		 0x02, 0x09, 0x8a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0x7a,   //  463 MHz
+		 0xef, 0x82, 0x9b, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0x17,   //  464 MHz
+		 0xdc, 0xfc, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0xb4,   //  465 MHz
+		 0xc8, 0x76, 0xbe, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0x50,   //  466 MHz
+		 0xb5, 0xf0, 0xcf, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0xed,   //  467 MHz
+		 0xa1, 0x6a, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x1f, 0x10, 0x8a,   //  468 MHz
+		 0x8e, 0xe4, 0xf2, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0x27,   //  469 MHz
+		 0x7b, 0x5e, 0x04, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0xc3,   //  470 MHz
+		 0x67, 0xd8, 0x15, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0x60,   //  471 MHz
+		 0x54, 0x52, 0x27, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0xfd,   //  472 MHz
+		 0x40, 0xcc, 0x38, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0x9a,   //  473 MHz
+		 0x2d, 0x46, 0x4a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0x36,   //  474 MHz
+		 0x1a, 0xc0, 0x5b, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0xd3,   //  475 MHz
+		 0x06, 0x3a, 0x6d, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0x70,   //  476 MHz
+		 0xf3, 0xb3, 0x7e, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0x0d,   //  477 MHz
+		 0xe0, 0x2d, 0x90, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0xa9,   //  478 MHz
+		 0xcc, 0xa7, 0xa1, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0x46,   //  479 MHz
+		 0xb9, 0x21, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0xe3,   //  480 MHz
+		 0xa5, 0x9b, 0xc4, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0x80,   //  481 MHz
+		 0x92, 0x15, 0xd6, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0x1c,   //  482 MHz
+		 0x7f, 0x8f, 0xe7, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x20, 0x10, 0xb9,   //  483 MHz
+		 0x6b, 0x09, 0xf9, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0x56,   //  484 MHz
+		 0x58, 0x83, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0xf3,   //  485 MHz
+		 0x44, 0xfd, 0x1b, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0x8f,   //  486 MHz
+		 0x31, 0x77, 0x2d, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0x2c,   //  487 MHz
+		 0x1e, 0xf1, 0x3e, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0xc9,   //  488 MHz
+		 0x0a, 0x6b, 0x50, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0x65,   //  489 MHz
+		 0xf7, 0xe4, 0x61, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0x02,   //  490 MHz
+		 0xe4, 0x5e, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0x9f,   //  491 MHz
+		 0xd0, 0xd8, 0x84, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0x3c,   //  492 MHz
+		 0xbd, 0x52, 0x96, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0xd8,   //  493 MHz
+		 0xa9, 0xcc, 0xa7, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0x75,   //  494 MHz
+		 0x96, 0x46, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0x12,   //  495 MHz
+		 0x83, 0xc0, 0xca, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0xaf,   //  496 MHz
+		 0x6f, 0x3a, 0xdc, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0x4b,   //  497 MHz
+		 0x5c, 0xb4, 0xed, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x21, 0x10, 0xe8,   //  498 MHz
+		 0x48, 0x2e, 0xff, 0x0a, 0x10, 0x03, 0x04},
+		{0x04, 0x08, 0x30, 0xe4, 0x22, 0x10, 0x85,   //  499 MHz
+		 0x35, 0xa8, 0x10, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x19, 0x10, 0x99,   //  500 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x19, 0x10, 0x0f,   //  501 MHz
+		 0x0b, 0xb5, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x19, 0x10, 0x84,   //  502 MHz
+		 0x7c, 0xd0, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x19, 0x10, 0xfa,   //  503 MHz
+		 0xed, 0xeb, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x19, 0x10, 0x6f,   //  504 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x19, 0x10, 0xe5,   //  505 MHz
+		 0xd0, 0x22, 0xdb, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x19, 0x10, 0x5a,   //  506 MHz
+		 0x42, 0x3e, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x19, 0x10, 0xd0,   //  507 MHz
+		 0xb3, 0x59, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x46,   //  508 MHz
+		 0x25, 0x75, 0x02, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0xbb,   //  509 MHz
+		 0x96, 0x90, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x31,   //  510 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0xa6,   //  511 MHz
+		 0x79, 0xc7, 0x29, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x1c,   //  512 MHz
+		 0xeb, 0xe2, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x91,   //  513 MHz
+		 0x5c, 0xfe, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x07,   //  514 MHz
+		 0xce, 0x19, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x7c,   //  515 MHz
+		 0x3f, 0x35, 0x5e, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0xf2,   //  516 MHz
+		 0xb0, 0x50, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x68,   //  517 MHz
+		 0x22, 0x6c, 0x78, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0xdd,   //  518 MHz
+		 0x93, 0x87, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x53,   //  519 MHz
+		 0x05, 0xa3, 0x92, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0xc8,   //  520 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x3e,   //  521 MHz
+		 0xe8, 0xd9, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0xb3,   //  522 MHz
+		 0x59, 0xf5, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x29,   //  523 MHz
+		 0xcb, 0x10, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x9e,   //  524 MHz
+		 0x3c, 0x2c, 0xd4, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x14,   //  525 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0x8a,   //  526 MHz
+		 0x1f, 0x63, 0xee, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1a, 0x10, 0xff,   //  527 MHz
+		 0x90, 0x7e, 0xfb, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0x75,   //  528 MHz
+		 0x02, 0x9a, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0xea,   //  529 MHz
+		 0x73, 0xb5, 0x15, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0x60,   //  530 MHz
+		 0xe5, 0xd0, 0x22, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0xd5,   //  531 MHz
+		 0x56, 0xec, 0x2f, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0x4b,   //  532 MHz
+		 0xc8, 0x07, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0xc0,   //  533 MHz
+		 0x39, 0x23, 0x4a, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0x36,   //  534 MHz
+		 0xab, 0x3e, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0xac,   //  535 MHz
+		 0x1c, 0x5a, 0x64, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0x21,   //  536 MHz
+		 0x8e, 0x75, 0x71, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0x97,   //  537 MHz
+		 0xff, 0x90, 0x7e, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0x0c,   //  538 MHz
+		 0x71, 0xac, 0x8b, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0x82,   //  539 MHz
+		 0xe2, 0xc7, 0x98, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0xf7,   //  540 MHz
+		 0x53, 0xe3, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0x6d,   //  541 MHz
+		 0xc5, 0xfe, 0xb2, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0xe2,   //  542 MHz
+		 0x36, 0x1a, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0x58,   //  543 MHz
+		 0xa8, 0x35, 0xcd, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0xce,   //  544 MHz
+		 0x19, 0x51, 0xda, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0x43,   //  545 MHz
+		 0x8b, 0x6c, 0xe7, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1b, 0x10, 0xb9,   //  546 MHz
+		 0xfc, 0x87, 0xf4, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x2e,   //  547 MHz
+		 0x6e, 0xa3, 0x01, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0xa4,   //  548 MHz
+		 0xdf, 0xbe, 0x0e, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x19,   //  549 MHz
+		 0x51, 0xda, 0x1b, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x8f,   //  550 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x04,   //  551 MHz
+		 0x34, 0x11, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x7a,   //  552 MHz
+		 0xa5, 0x2c, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0xf0,   //  553 MHz
+		 0x16, 0x48, 0x50, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x65,   //  554 MHz
+		 0x88, 0x63, 0x5d, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0xdb,   //  555 MHz
+		 0xf9, 0x7e, 0x6a, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x50,   //  556 MHz
+		 0x6b, 0x9a, 0x77, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0xc6,   //  557 MHz
+		 0xdc, 0xb5, 0x84, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x3b,   //  558 MHz
+		 0x4e, 0xd1, 0x91, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0xb1,   //  559 MHz
+		 0xbf, 0xec, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x26,   //  560 MHz
+		 0x31, 0x08, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x9c,   //  561 MHz
+		 0xa2, 0x23, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x12,   //  562 MHz
+		 0x14, 0x3f, 0xc6, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x87,   //  563 MHz
+		 0x85, 0x5a, 0xd3, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0xfd,   //  564 MHz
+		 0xf6, 0x75, 0xe0, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0x72,   //  565 MHz
+		 0x68, 0x91, 0xed, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1c, 0x10, 0xe8,   //  566 MHz
+		 0xd9, 0xac, 0xfa, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0x5d,   //  567 MHz
+		 0x4b, 0xc8, 0x07, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0xd3,   //  568 MHz
+		 0xbc, 0xe3, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0x48,   //  569 MHz
+		 0x2e, 0xff, 0x21, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0xbe,   //  570 MHz
+		 0x9f, 0x1a, 0x2f, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0x34,   //  571 MHz
+		 0x11, 0x36, 0x3c, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0xa9,   //  572 MHz
+		 0x82, 0x51, 0x49, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0x1f,   //  573 MHz
+		 0xf4, 0x6c, 0x56, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0x94,   //  574 MHz
+		 0x65, 0x88, 0x63, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0x0a,   //  575 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0x7f,   //  576 MHz
+		 0x48, 0xbf, 0x7d, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0xf5,   //  577 MHz
+		 0xb9, 0xda, 0x8a, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0x6a,   //  578 MHz
+		 0x2b, 0xf6, 0x97, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0xe0,   //  579 MHz
+		 0x9c, 0x11, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0x56,   //  580 MHz
+		 0x0e, 0x2d, 0xb2, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0xcb,   //  581 MHz
+		 0x7f, 0x48, 0xbf, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0x41,   //  582 MHz
+		 0xf1, 0x63, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0xb6,   //  583 MHz
+		 0x62, 0x7f, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0x2c,   //  584 MHz
+		 0xd4, 0x9a, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1d, 0x10, 0xa1,   //  585 MHz
+		 0x45, 0xb6, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0x17,   //  586 MHz
+		 0xb7, 0xd1, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0x8c,   //  587 MHz
+		 0x28, 0xed, 0x0d, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0x02,   //  588 MHz
+		 0x9a, 0x08, 0x1b, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0x78,   //  589 MHz
+		 0x0b, 0x24, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0xed,   //  590 MHz
+		 0x7c, 0x3f, 0x35, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0x63,   //  591 MHz
+		 0xee, 0x5a, 0x42, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0xd8,   //  592 MHz
+		 0x5f, 0x76, 0x4f, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0x4e,   //  593 MHz
+		 0xd1, 0x91, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0xc3,   //  594 MHz
+		 0x42, 0xad, 0x69, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0x39,   //  595 MHz
+		 0xb4, 0xc8, 0x76, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0xae,   //  596 MHz
+		 0x25, 0xe4, 0x83, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0x24,   //  597 MHz
+		 0x97, 0xff, 0x90, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0x9a,   //  598 MHz
+		 0x08, 0x1b, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0x0f,   //  599 MHz
+		 0x7a, 0x36, 0xab, 0x0a, 0x10, 0x03, 0x04},
+		{0x03, 0x06, 0x30, 0xe4, 0x1e, 0x10, 0x85,   //  600 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x19, 0x10, 0x7b,   //  601 MHz
+		 0xcd, 0x85, 0xa4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x19, 0x10, 0x5d,   //  602 MHz
+		 0x01, 0x72, 0xaf, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x19, 0x10, 0x3f,   //  603 MHz
+		 0x35, 0x5e, 0xba, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x19, 0x10, 0x21,   //  604 MHz
+		 0x69, 0x4a, 0xc5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x19, 0x10, 0x03,   //  605 MHz
+		 0x9d, 0x36, 0xd0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x19, 0x10, 0xe5,   //  606 MHz
+		 0xd0, 0x22, 0xdb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x19, 0x10, 0xc7,   //  607 MHz
+		 0x04, 0x0f, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x19, 0x10, 0xa9,   //  608 MHz
+		 0x38, 0xfb, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x19, 0x10, 0x8b,   //  609 MHz
+		 0x6c, 0xe7, 0xfb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x6d,   //  610 MHz
+		 0xa0, 0xd3, 0x06, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x4f,   //  611 MHz
+		 0xd4, 0xbf, 0x11, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x31,   //  612 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x13,   //  613 MHz
+		 0x3c, 0x98, 0x27, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0xf5,   //  614 MHz
+		 0x6f, 0x84, 0x32, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0xd7,   //  615 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0xb9,   //  616 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x9a,   //  617 MHz
+		 0x0b, 0x49, 0x53, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x7c,   //  618 MHz
+		 0x3f, 0x35, 0x5e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x5e,   //  619 MHz
+		 0x73, 0x21, 0x69, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x40,   //  620 MHz
+		 0xa7, 0x0d, 0x74, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x22,   //  621 MHz
+		 0xdb, 0xf9, 0x7e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x04,   //  622 MHz
+		 0x0f, 0xe6, 0x89, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0xe6,   //  623 MHz
+		 0x42, 0xd2, 0x94, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0xc8,   //  624 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0xaa,   //  625 MHz
+		 0xaa, 0xaa, 0xaa, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x8c,   //  626 MHz
+		 0xde, 0x96, 0xb5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x6e,   //  627 MHz
+		 0x12, 0x83, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x50,   //  628 MHz
+		 0x46, 0x6f, 0xcb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x32,   //  629 MHz
+		 0x7a, 0x5b, 0xd6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0x14,   //  630 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0xf6,   //  631 MHz
+		 0xe1, 0x33, 0xec, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1a, 0x10, 0xd8,   //  632 MHz
+		 0x15, 0x20, 0xf7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0xba,   //  633 MHz
+		 0x49, 0x0c, 0x02, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x9c,   //  634 MHz
+		 0x7d, 0xf8, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x7e,   //  635 MHz
+		 0xb1, 0xe4, 0x17, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x60,   //  636 MHz
+		 0xe5, 0xd0, 0x22, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x42,   //  637 MHz
+		 0x19, 0xbd, 0x2d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x24,   //  638 MHz
+		 0x4d, 0xa9, 0x38, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x06,   //  639 MHz
+		 0x81, 0x95, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0xe8,   //  640 MHz
+		 0xb4, 0x81, 0x4e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0xca,   //  641 MHz
+		 0xe8, 0x6d, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0xac,   //  642 MHz
+		 0x1c, 0x5a, 0x64, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x8d,   //  643 MHz
+		 0x50, 0x46, 0x6f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x6f,   //  644 MHz
+		 0x84, 0x32, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x51,   //  645 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x33,   //  646 MHz
+		 0xec, 0x0a, 0x90, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x15,   //  647 MHz
+		 0x20, 0xf7, 0x9a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0xf7,   //  648 MHz
+		 0x53, 0xe3, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0xd9,   //  649 MHz
+		 0x87, 0xcf, 0xb0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0xbb,   //  650 MHz
+		 0xbb, 0xbb, 0xbb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x9d,   //  651 MHz
+		 0xef, 0xa7, 0xc6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x7f,   //  652 MHz
+		 0x23, 0x94, 0xd1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x61,   //  653 MHz
+		 0x57, 0x80, 0xdc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x43,   //  654 MHz
+		 0x8b, 0x6c, 0xe7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x25,   //  655 MHz
+		 0xbf, 0x58, 0xf2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1b, 0x10, 0x07,   //  656 MHz
+		 0xf3, 0x44, 0xfd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0xe9,   //  657 MHz
+		 0x26, 0x31, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0xcb,   //  658 MHz
+		 0x5a, 0x1d, 0x13, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0xad,   //  659 MHz
+		 0x8e, 0x09, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x8f,   //  660 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x71,   //  661 MHz
+		 0xf6, 0xe1, 0x33, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x53,   //  662 MHz
+		 0x2a, 0xce, 0x3e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x35,   //  663 MHz
+		 0x5e, 0xba, 0x49, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x17,   //  664 MHz
+		 0x92, 0xa6, 0x54, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0xf9,   //  665 MHz
+		 0xc5, 0x92, 0x5f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0xdb,   //  666 MHz
+		 0xf9, 0x7e, 0x6a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0xbd,   //  667 MHz
+		 0x2d, 0x6b, 0x75, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x9f,   //  668 MHz
+		 0x61, 0x57, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x81,   //  669 MHz
+		 0x95, 0x43, 0x8b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x62,   //  670 MHz
+		 0xc9, 0x2f, 0x96, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x44,   //  671 MHz
+		 0xfd, 0x1b, 0xa1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x26,   //  672 MHz
+		 0x31, 0x08, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x08,   //  673 MHz
+		 0x65, 0xf4, 0xb6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0xea,   //  674 MHz
+		 0x98, 0xe0, 0xc1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0xcc,   //  675 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0xae,   //  676 MHz
+		 0x00, 0xb9, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x90,   //  677 MHz
+		 0x34, 0xa5, 0xe2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x72,   //  678 MHz
+		 0x68, 0x91, 0xed, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1c, 0x10, 0x54,   //  679 MHz
+		 0x9c, 0x7d, 0xf8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x36,   //  680 MHz
+		 0xd0, 0x69, 0x03, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x18,   //  681 MHz
+		 0x04, 0x56, 0x0e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0xfa,   //  682 MHz
+		 0x37, 0x42, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0xdc,   //  683 MHz
+		 0x6b, 0x2e, 0x24, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0xbe,   //  684 MHz
+		 0x9f, 0x1a, 0x2f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0xa0,   //  685 MHz
+		 0xd3, 0x06, 0x3a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x82,   //  686 MHz
+		 0x07, 0xf3, 0x44, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x64,   //  687 MHz
+		 0x3b, 0xdf, 0x4f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x46,   //  688 MHz
+		 0x6f, 0xcb, 0x5a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x28,   //  689 MHz
+		 0xa3, 0xb7, 0x65, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x0a,   //  690 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0xec,   //  691 MHz
+		 0x0a, 0x90, 0x7b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0xce,   //  692 MHz
+		 0x3e, 0x7c, 0x86, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0xb0,   //  693 MHz
+		 0x72, 0x68, 0x91, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x92,   //  694 MHz
+		 0xa6, 0x54, 0x9c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x74,   //  695 MHz
+		 0xda, 0x40, 0xa7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x56,   //  696 MHz
+		 0x0e, 0x2d, 0xb2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x37,   //  697 MHz
+		 0x42, 0x19, 0xbd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x19,   //  698 MHz
+		 0x76, 0x05, 0xc8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0xfb,   //  699 MHz
+		 0xa9, 0xf1, 0xd2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0xdd,   //  700 MHz
+		 0xdd, 0xdd, 0xdd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0xbf,   //  701 MHz
+		 0x11, 0xca, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0xa1,   //  702 MHz
+		 0x45, 0xb6, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1d, 0x10, 0x83,   //  703 MHz
+		 0x79, 0xa2, 0xfe, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x65,   //  704 MHz
+		 0xad, 0x8e, 0x09, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x47,   //  705 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x29,   //  706 MHz
+		 0x15, 0x67, 0x1f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x0b,   //  707 MHz
+		 0x49, 0x53, 0x2a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0xed,   //  708 MHz
+		 0x7c, 0x3f, 0x35, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0xcf,   //  709 MHz
+		 0xb0, 0x2b, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0xb1,   //  710 MHz
+		 0xe4, 0x17, 0x4b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x93,   //  711 MHz
+		 0x18, 0x04, 0x56, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x75,   //  712 MHz
+		 0x4c, 0xf0, 0x60, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x57,   //  713 MHz
+		 0x80, 0xdc, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x39,   //  714 MHz
+		 0xb4, 0xc8, 0x76, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x1b,   //  715 MHz
+		 0xe8, 0xb4, 0x81, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0xfd,   //  716 MHz
+		 0x1b, 0xa1, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0xdf,   //  717 MHz
+		 0x4f, 0x8d, 0x97, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0xc1,   //  718 MHz
+		 0x83, 0x79, 0xa2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0xa3,   //  719 MHz
+		 0xb7, 0x65, 0xad, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x85,   //  720 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x67,   //  721 MHz
+		 0x1f, 0x3e, 0xc3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x49,   //  722 MHz
+		 0x53, 0x2a, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x2b,   //  723 MHz
+		 0x87, 0x16, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0x0c,   //  724 MHz
+		 0xbb, 0x02, 0xe4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0xee,   //  725 MHz
+		 0xee, 0xee, 0xee, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1e, 0x10, 0xd0,   //  726 MHz
+		 0x22, 0xdb, 0xf9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0xb2,   //  727 MHz
+		 0x56, 0xc7, 0x04, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x94,   //  728 MHz
+		 0x8a, 0xb3, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x76,   //  729 MHz
+		 0xbe, 0x9f, 0x1a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x58,   //  730 MHz
+		 0xf2, 0x8b, 0x25, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x3a,   //  731 MHz
+		 0x26, 0x78, 0x30, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x1c,   //  732 MHz
+		 0x5a, 0x64, 0x3b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0xfe,   //  733 MHz
+		 0x8d, 0x50, 0x46, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0xe0,   //  734 MHz
+		 0xc1, 0x3c, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0xc2,   //  735 MHz
+		 0xf5, 0x28, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0xa4,   //  736 MHz
+		 0x29, 0x15, 0x67, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x86,   //  737 MHz
+		 0x5d, 0x01, 0x72, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x68,   //  738 MHz
+		 0x91, 0xed, 0x7c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x4a,   //  739 MHz
+		 0xc5, 0xd9, 0x87, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x2c,   //  740 MHz
+		 0xf9, 0xc5, 0x92, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x0e,   //  741 MHz
+		 0x2d, 0xb2, 0x9d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0xf0,   //  742 MHz
+		 0x60, 0x9e, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0xd2,   //  743 MHz
+		 0x94, 0x8a, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0xb4,   //  744 MHz
+		 0xc8, 0x76, 0xbe, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x96,   //  745 MHz
+		 0xfc, 0x62, 0xc9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x78,   //  746 MHz
+		 0x30, 0x4f, 0xd4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x5a,   //  747 MHz
+		 0x64, 0x3b, 0xdf, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x3c,   //  748 MHz
+		 0x98, 0x27, 0xea, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x05, 0x10, 0xe4, 0x1f, 0x10, 0x1e,   //  749 MHz
+		 0xcc, 0x13, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0x99,   //  750 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0xe7,   //  751 MHz
+		 0x8f, 0x56, 0xa2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0x36,   //  752 MHz
+		 0x86, 0x13, 0xab, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0x84,   //  753 MHz
+		 0x7c, 0xd0, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0xd3,   //  754 MHz
+		 0x72, 0x8d, 0xbc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0x21,   //  755 MHz
+		 0x69, 0x4a, 0xc5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0x6f,   //  756 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0xbe,   //  757 MHz
+		 0x55, 0xc4, 0xd6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0x0c,   //  758 MHz
+		 0x4c, 0x81, 0xdf, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0x5a,   //  759 MHz
+		 0x42, 0x3e, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0xa9,   //  760 MHz
+		 0x38, 0xfb, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x19, 0x10, 0xf7,   //  761 MHz
+		 0x2e, 0xb8, 0xf9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x46,   //  762 MHz
+		 0x25, 0x75, 0x02, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x94,   //  763 MHz
+		 0x1b, 0x32, 0x0b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0xe2,   //  764 MHz
+		 0x11, 0xef, 0x13, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x31,   //  765 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x7f,   //  766 MHz
+		 0xfe, 0x68, 0x25, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0xcd,   //  767 MHz
+		 0xf4, 0x25, 0x2e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x1c,   //  768 MHz
+		 0xeb, 0xe2, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x6a,   //  769 MHz
+		 0xe1, 0x9f, 0x3f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0xb9,   //  770 MHz
+		 0xd7, 0x5c, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x07,   //  771 MHz
+		 0xce, 0x19, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x55,   //  772 MHz
+		 0xc4, 0xd6, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0xa4,   //  773 MHz
+		 0xba, 0x93, 0x62, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0xf2,   //  774 MHz
+		 0xb0, 0x50, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x40,   //  775 MHz
+		 0xa7, 0x0d, 0x74, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x8f,   //  776 MHz
+		 0x9d, 0xca, 0x7c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0xdd,   //  777 MHz
+		 0x93, 0x87, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x2b,   //  778 MHz
+		 0x8a, 0x44, 0x8e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x7a,   //  779 MHz
+		 0x80, 0x01, 0x97, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0xc8,   //  780 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x17,   //  781 MHz
+		 0x6d, 0x7b, 0xa8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x65,   //  782 MHz
+		 0x63, 0x38, 0xb1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0xb3,   //  783 MHz
+		 0x59, 0xf5, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x02,   //  784 MHz
+		 0x50, 0xb2, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x50,   //  785 MHz
+		 0x46, 0x6f, 0xcb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x9e,   //  786 MHz
+		 0x3c, 0x2c, 0xd4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0xed,   //  787 MHz
+		 0x32, 0xe9, 0xdc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x3b,   //  788 MHz
+		 0x29, 0xa6, 0xe5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x8a,   //  789 MHz
+		 0x1f, 0x63, 0xee, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0xd8,   //  790 MHz
+		 0x15, 0x20, 0xf7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1a, 0x10, 0x26,   //  791 MHz
+		 0x0c, 0xdd, 0xff, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x75,   //  792 MHz
+		 0x02, 0x9a, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0xc3,   //  793 MHz
+		 0xf8, 0x56, 0x11, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x11,   //  794 MHz
+		 0xef, 0x13, 0x1a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x60,   //  795 MHz
+		 0xe5, 0xd0, 0x22, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0xae,   //  796 MHz
+		 0xdb, 0x8d, 0x2b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0xfc,   //  797 MHz
+		 0xd1, 0x4a, 0x34, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x4b,   //  798 MHz
+		 0xc8, 0x07, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x99,   //  799 MHz
+		 0xbe, 0xc4, 0x45, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0xe8,   //  800 MHz
+		 0xb4, 0x81, 0x4e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x36,   //  801 MHz
+		 0xab, 0x3e, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x84,   //  802 MHz
+		 0xa1, 0xfb, 0x5f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0xd3,   //  803 MHz
+		 0x97, 0xb8, 0x68, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x21,   //  804 MHz
+		 0x8e, 0x75, 0x71, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x6f,   //  805 MHz
+		 0x84, 0x32, 0x7a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0xbe,   //  806 MHz
+		 0x7a, 0xef, 0x82, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x0c,   //  807 MHz
+		 0x71, 0xac, 0x8b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x5b,   //  808 MHz
+		 0x67, 0x69, 0x94, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0xa9,   //  809 MHz
+		 0x5d, 0x26, 0x9d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0xf7,   //  810 MHz
+		 0x53, 0xe3, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x46,   //  811 MHz
+		 0x4a, 0xa0, 0xae, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x94,   //  812 MHz
+		 0x40, 0x5d, 0xb7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0xe2,   //  813 MHz
+		 0x36, 0x1a, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x31,   //  814 MHz
+		 0x2d, 0xd7, 0xc8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x7f,   //  815 MHz
+		 0x23, 0x94, 0xd1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0xce,   //  816 MHz
+		 0x19, 0x51, 0xda, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x1c,   //  817 MHz
+		 0x10, 0x0e, 0xe3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x6a,   //  818 MHz
+		 0x06, 0xcb, 0xeb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0xb9,   //  819 MHz
+		 0xfc, 0x87, 0xf4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1b, 0x10, 0x07,   //  820 MHz
+		 0xf3, 0x44, 0xfd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x55,   //  821 MHz
+		 0xe9, 0x01, 0x06, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0xa4,   //  822 MHz
+		 0xdf, 0xbe, 0x0e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0xf2,   //  823 MHz
+		 0xd5, 0x7b, 0x17, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x40,   //  824 MHz
+		 0xcc, 0x38, 0x20, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x8f,   //  825 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0xdd,   //  826 MHz
+		 0xb8, 0xb2, 0x31, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x2c,   //  827 MHz
+		 0xaf, 0x6f, 0x3a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x7a,   //  828 MHz
+		 0xa5, 0x2c, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0xc8,   //  829 MHz
+		 0x9b, 0xe9, 0x4b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x17,   //  830 MHz
+		 0x92, 0xa6, 0x54, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x65,   //  831 MHz
+		 0x88, 0x63, 0x5d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0xb3,   //  832 MHz
+		 0x7e, 0x20, 0x66, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x02,   //  833 MHz
+		 0x75, 0xdd, 0x6e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x50,   //  834 MHz
+		 0x6b, 0x9a, 0x77, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x9f,   //  835 MHz
+		 0x61, 0x57, 0x80, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0xed,   //  836 MHz
+		 0x57, 0x14, 0x89, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x3b,   //  837 MHz
+		 0x4e, 0xd1, 0x91, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x8a,   //  838 MHz
+		 0x44, 0x8e, 0x9a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0xd8,   //  839 MHz
+		 0x3a, 0x4b, 0xa3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x26,   //  840 MHz
+		 0x31, 0x08, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x75,   //  841 MHz
+		 0x27, 0xc5, 0xb4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0xc3,   //  842 MHz
+		 0x1d, 0x82, 0xbd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x12,   //  843 MHz
+		 0x14, 0x3f, 0xc6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x60,   //  844 MHz
+		 0x0a, 0xfc, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0xae,   //  845 MHz
+		 0x00, 0xb9, 0xd7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0xfd,   //  846 MHz
+		 0xf6, 0x75, 0xe0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x4b,   //  847 MHz
+		 0xed, 0x32, 0xe9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0x99,   //  848 MHz
+		 0xe3, 0xef, 0xf1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1c, 0x10, 0xe8,   //  849 MHz
+		 0xd9, 0xac, 0xfa, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x36,   //  850 MHz
+		 0xd0, 0x69, 0x03, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x84,   //  851 MHz
+		 0xc6, 0x26, 0x0c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0xd3,   //  852 MHz
+		 0xbc, 0xe3, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x21,   //  853 MHz
+		 0xb3, 0xa0, 0x1d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x70,   //  854 MHz
+		 0xa9, 0x5d, 0x26, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0xbe,   //  855 MHz
+		 0x9f, 0x1a, 0x2f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x0c,   //  856 MHz
+		 0x96, 0xd7, 0x37, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x5b,   //  857 MHz
+		 0x8c, 0x94, 0x40, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0xa9,   //  858 MHz
+		 0x82, 0x51, 0x49, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0xf7,   //  859 MHz
+		 0x78, 0x0e, 0x52, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x46,   //  860 MHz
+		 0x6f, 0xcb, 0x5a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x94,   //  861 MHz
+		 0x65, 0x88, 0x63, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0xe3,   //  862 MHz
+		 0x5b, 0x45, 0x6c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x31,   //  863 MHz
+		 0x52, 0x02, 0x75, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x7f,   //  864 MHz
+		 0x48, 0xbf, 0x7d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0xce,   //  865 MHz
+		 0x3e, 0x7c, 0x86, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x1c,   //  866 MHz
+		 0x35, 0x39, 0x8f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x6a,   //  867 MHz
+		 0x2b, 0xf6, 0x97, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0xb9,   //  868 MHz
+		 0x21, 0xb3, 0xa0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x07,   //  869 MHz
+		 0x18, 0x70, 0xa9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x56,   //  870 MHz
+		 0x0e, 0x2d, 0xb2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0xa4,   //  871 MHz
+		 0x04, 0xea, 0xba, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0xf2,   //  872 MHz
+		 0xfa, 0xa6, 0xc3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x41,   //  873 MHz
+		 0xf1, 0x63, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x8f,   //  874 MHz
+		 0xe7, 0x20, 0xd5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0xdd,   //  875 MHz
+		 0xdd, 0xdd, 0xdd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x2c,   //  876 MHz
+		 0xd4, 0x9a, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0x7a,   //  877 MHz
+		 0xca, 0x57, 0xef, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1d, 0x10, 0xc8,   //  878 MHz
+		 0xc0, 0x14, 0xf8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x17,   //  879 MHz
+		 0xb7, 0xd1, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x65,   //  880 MHz
+		 0xad, 0x8e, 0x09, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0xb4,   //  881 MHz
+		 0xa3, 0x4b, 0x12, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x02,   //  882 MHz
+		 0x9a, 0x08, 0x1b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x50,   //  883 MHz
+		 0x90, 0xc5, 0x23, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x9f,   //  884 MHz
+		 0x86, 0x82, 0x2c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0xed,   //  885 MHz
+		 0x7c, 0x3f, 0x35, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x3b,   //  886 MHz
+		 0x73, 0xfc, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x8a,   //  887 MHz
+		 0x69, 0xb9, 0x46, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0xd8,   //  888 MHz
+		 0x5f, 0x76, 0x4f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x27,   //  889 MHz
+		 0x56, 0x33, 0x58, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x75,   //  890 MHz
+		 0x4c, 0xf0, 0x60, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0xc3,   //  891 MHz
+		 0x42, 0xad, 0x69, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x12,   //  892 MHz
+		 0x39, 0x6a, 0x72, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x60,   //  893 MHz
+		 0x2f, 0x27, 0x7b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0xae,   //  894 MHz
+		 0x25, 0xe4, 0x83, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0xfd,   //  895 MHz
+		 0x1b, 0xa1, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x4b,   //  896 MHz
+		 0x12, 0x5e, 0x95, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x9a,   //  897 MHz
+		 0x08, 0x1b, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0xe8,   //  898 MHz
+		 0xfe, 0xd7, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x36,   //  899 MHz
+		 0xf5, 0x94, 0xaf, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x85,   //  900 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0xd3,   //  901 MHz
+		 0xe1, 0x0e, 0xc1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x21,   //  902 MHz
+		 0xd8, 0xcb, 0xc9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x70,   //  903 MHz
+		 0xce, 0x88, 0xd2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0xbe,   //  904 MHz
+		 0xc4, 0x45, 0xdb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x0c,   //  905 MHz
+		 0xbb, 0x02, 0xe4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0x5b,   //  906 MHz
+		 0xb1, 0xbf, 0xec, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0xa9,   //  907 MHz
+		 0xa7, 0x7c, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1e, 0x10, 0xf8,   //  908 MHz
+		 0x9d, 0x39, 0xfe, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x46,   //  909 MHz
+		 0x94, 0xf6, 0x06, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x94,   //  910 MHz
+		 0x8a, 0xb3, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0xe3,   //  911 MHz
+		 0x80, 0x70, 0x18, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x31,   //  912 MHz
+		 0x77, 0x2d, 0x21, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x7f,   //  913 MHz
+		 0x6d, 0xea, 0x29, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0xce,   //  914 MHz
+		 0x63, 0xa7, 0x32, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x1c,   //  915 MHz
+		 0x5a, 0x64, 0x3b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x6b,   //  916 MHz
+		 0x50, 0x21, 0x44, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0xb9,   //  917 MHz
+		 0x46, 0xde, 0x4c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x07,   //  918 MHz
+		 0x3d, 0x9b, 0x55, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x56,   //  919 MHz
+		 0x33, 0x58, 0x5e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0xa4,   //  920 MHz
+		 0x29, 0x15, 0x67, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0xf2,   //  921 MHz
+		 0x1f, 0xd2, 0x6f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x41,   //  922 MHz
+		 0x16, 0x8f, 0x78, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x8f,   //  923 MHz
+		 0x0c, 0x4c, 0x81, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0xde,   //  924 MHz
+		 0x02, 0x09, 0x8a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x2c,   //  925 MHz
+		 0xf9, 0xc5, 0x92, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x7a,   //  926 MHz
+		 0xef, 0x82, 0x9b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0xc9,   //  927 MHz
+		 0xe5, 0x3f, 0xa4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x17,   //  928 MHz
+		 0xdc, 0xfc, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x65,   //  929 MHz
+		 0xd2, 0xb9, 0xb5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0xb4,   //  930 MHz
+		 0xc8, 0x76, 0xbe, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x02,   //  931 MHz
+		 0xbf, 0x33, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x50,   //  932 MHz
+		 0xb5, 0xf0, 0xcf, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x9f,   //  933 MHz
+		 0xab, 0xad, 0xd8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0xed,   //  934 MHz
+		 0xa1, 0x6a, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x3c,   //  935 MHz
+		 0x98, 0x27, 0xea, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0x8a,   //  936 MHz
+		 0x8e, 0xe4, 0xf2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x1f, 0x10, 0xd8,   //  937 MHz
+		 0x84, 0xa1, 0xfb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x27,   //  938 MHz
+		 0x7b, 0x5e, 0x04, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x75,   //  939 MHz
+		 0x71, 0x1b, 0x0d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0xc3,   //  940 MHz
+		 0x67, 0xd8, 0x15, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x12,   //  941 MHz
+		 0x5e, 0x95, 0x1e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x60,   //  942 MHz
+		 0x54, 0x52, 0x27, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0xaf,   //  943 MHz
+		 0x4a, 0x0f, 0x30, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0xfd,   //  944 MHz
+		 0x40, 0xcc, 0x38, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x4b,   //  945 MHz
+		 0x37, 0x89, 0x41, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x9a,   //  946 MHz
+		 0x2d, 0x46, 0x4a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0xe8,   //  947 MHz
+		 0x23, 0x03, 0x53, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x36,   //  948 MHz
+		 0x1a, 0xc0, 0x5b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x85,   //  949 MHz
+		 0x10, 0x7d, 0x64, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0xd3,   //  950 MHz
+		 0x06, 0x3a, 0x6d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x21,   //  951 MHz
+		 0xfd, 0xf6, 0x75, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x70,   //  952 MHz
+		 0xf3, 0xb3, 0x7e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0xbe,   //  953 MHz
+		 0xe9, 0x70, 0x87, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x0d,   //  954 MHz
+		 0xe0, 0x2d, 0x90, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x5b,   //  955 MHz
+		 0xd6, 0xea, 0x98, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0xa9,   //  956 MHz
+		 0xcc, 0xa7, 0xa1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0xf8,   //  957 MHz
+		 0xc2, 0x64, 0xaa, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x46,   //  958 MHz
+		 0xb9, 0x21, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x94,   //  959 MHz
+		 0xaf, 0xde, 0xbb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0xe3,   //  960 MHz
+		 0xa5, 0x9b, 0xc4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x31,   //  961 MHz
+		 0x9c, 0x58, 0xcd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x80,   //  962 MHz
+		 0x92, 0x15, 0xd6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0xce,   //  963 MHz
+		 0x88, 0xd2, 0xde, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x1c,   //  964 MHz
+		 0x7f, 0x8f, 0xe7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0x6b,   //  965 MHz
+		 0x75, 0x4c, 0xf0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x20, 0x10, 0xb9,   //  966 MHz
+		 0x6b, 0x09, 0xf9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x07,   //  967 MHz
+		 0x62, 0xc6, 0x01, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x56,   //  968 MHz
+		 0x58, 0x83, 0x0a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0xa4,   //  969 MHz
+		 0x4e, 0x40, 0x13, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0xf3,   //  970 MHz
+		 0x44, 0xfd, 0x1b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x41,   //  971 MHz
+		 0x3b, 0xba, 0x24, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x8f,   //  972 MHz
+		 0x31, 0x77, 0x2d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0xde,   //  973 MHz
+		 0x27, 0x34, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x2c,   //  974 MHz
+		 0x1e, 0xf1, 0x3e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x7a,   //  975 MHz
+		 0x14, 0xae, 0x47, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0xc9,   //  976 MHz
+		 0x0a, 0x6b, 0x50, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x17,   //  977 MHz
+		 0x01, 0x28, 0x59, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x65,   //  978 MHz
+		 0xf7, 0xe4, 0x61, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0xb4,   //  979 MHz
+		 0xed, 0xa1, 0x6a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x02,   //  980 MHz
+		 0xe4, 0x5e, 0x73, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x51,   //  981 MHz
+		 0xda, 0x1b, 0x7c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x9f,   //  982 MHz
+		 0xd0, 0xd8, 0x84, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0xed,   //  983 MHz
+		 0xc6, 0x95, 0x8d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x3c,   //  984 MHz
+		 0xbd, 0x52, 0x96, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x8a,   //  985 MHz
+		 0xb3, 0x0f, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0xd8,   //  986 MHz
+		 0xa9, 0xcc, 0xa7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x27,   //  987 MHz
+		 0xa0, 0x89, 0xb0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x75,   //  988 MHz
+		 0x96, 0x46, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0xc4,   //  989 MHz
+		 0x8c, 0x03, 0xc2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x12,   //  990 MHz
+		 0x83, 0xc0, 0xca, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x60,   //  991 MHz
+		 0x79, 0x7d, 0xd3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0xaf,   //  992 MHz
+		 0x6f, 0x3a, 0xdc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0xfd,   //  993 MHz
+		 0x65, 0xf7, 0xe4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x4b,   //  994 MHz
+		 0x5c, 0xb4, 0xed, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0x9a,   //  995 MHz
+		 0x52, 0x71, 0xf6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x21, 0x10, 0xe8,   //  996 MHz
+		 0x48, 0x2e, 0xff, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x10, 0x37,   //  997 MHz
+		 0x3f, 0xeb, 0x07, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x10, 0x85,   //  998 MHz
+		 0x35, 0xa8, 0x10, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x04, 0x10, 0xe4, 0x22, 0x10, 0xd3,   //  999 MHz
+		 0x2b, 0x65, 0x19, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0x99,   // 1000 MHz
+		 0x99, 0x99, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0x54,   // 1001 MHz
+		 0x52, 0x27, 0xa0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0x0f,   // 1002 MHz
+		 0x0b, 0xb5, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0xc9,   // 1003 MHz
+		 0xc3, 0x42, 0xad, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0x84,   // 1004 MHz
+		 0x7c, 0xd0, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0x3f,   // 1005 MHz
+		 0x35, 0x5e, 0xba, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0xfa,   // 1006 MHz
+		 0xed, 0xeb, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0xb5,   // 1007 MHz
+		 0xa6, 0x79, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0x6f,   // 1008 MHz
+		 0x5f, 0x07, 0xce, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0x2a,   // 1009 MHz
+		 0x18, 0x95, 0xd4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0xe5,   // 1010 MHz
+		 0xd0, 0x22, 0xdb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0xa0,   // 1011 MHz
+		 0x89, 0xb0, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0x5a,   // 1012 MHz
+		 0x42, 0x3e, 0xe8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0x15,   // 1013 MHz
+		 0xfb, 0xcb, 0xee, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0xd0,   // 1014 MHz
+		 0xb3, 0x59, 0xf5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x19, 0x10, 0x8b,   // 1015 MHz
+		 0x6c, 0xe7, 0xfb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x46,   // 1016 MHz
+		 0x25, 0x75, 0x02, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x00,   // 1017 MHz
+		 0xde, 0x02, 0x09, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xbb,   // 1018 MHz
+		 0x96, 0x90, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x76,   // 1019 MHz
+		 0x4f, 0x1e, 0x16, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x31,   // 1020 MHz
+		 0x08, 0xac, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xeb,   // 1021 MHz
+		 0xc0, 0x39, 0x23, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xa6,   // 1022 MHz
+		 0x79, 0xc7, 0x29, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x61,   // 1023 MHz
+		 0x32, 0x55, 0x30, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x1c,   // 1024 MHz
+		 0xeb, 0xe2, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xd7,   // 1025 MHz
+		 0xa3, 0x70, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x91,   // 1026 MHz
+		 0x5c, 0xfe, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x4c,   // 1027 MHz
+		 0x15, 0x8c, 0x4a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x07,   // 1028 MHz
+		 0xce, 0x19, 0x51, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xc2,   // 1029 MHz
+		 0x86, 0xa7, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x7c,   // 1030 MHz
+		 0x3f, 0x35, 0x5e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x37,   // 1031 MHz
+		 0xf8, 0xc2, 0x64, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xf2,   // 1032 MHz
+		 0xb0, 0x50, 0x6b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xad,   // 1033 MHz
+		 0x69, 0xde, 0x71, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x68,   // 1034 MHz
+		 0x22, 0x6c, 0x78, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x22,   // 1035 MHz
+		 0xdb, 0xf9, 0x7e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xdd,   // 1036 MHz
+		 0x93, 0x87, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x98,   // 1037 MHz
+		 0x4c, 0x15, 0x8c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x53,   // 1038 MHz
+		 0x05, 0xa3, 0x92, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x0d,   // 1039 MHz
+		 0xbe, 0x30, 0x99, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xc8,   // 1040 MHz
+		 0x76, 0xbe, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x83,   // 1041 MHz
+		 0x2f, 0x4c, 0xa6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x3e,   // 1042 MHz
+		 0xe8, 0xd9, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xf9,   // 1043 MHz
+		 0xa0, 0x67, 0xb3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xb3,   // 1044 MHz
+		 0x59, 0xf5, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x6e,   // 1045 MHz
+		 0x12, 0x83, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x29,   // 1046 MHz
+		 0xcb, 0x10, 0xc7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xe4,   // 1047 MHz
+		 0x83, 0x9e, 0xcd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x9e,   // 1048 MHz
+		 0x3c, 0x2c, 0xd4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x59,   // 1049 MHz
+		 0xf5, 0xb9, 0xda, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x14,   // 1050 MHz
+		 0xae, 0x47, 0xe1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xcf,   // 1051 MHz
+		 0x66, 0xd5, 0xe7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x8a,   // 1052 MHz
+		 0x1f, 0x63, 0xee, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0x44,   // 1053 MHz
+		 0xd8, 0xf0, 0xf4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1a, 0x10, 0xff,   // 1054 MHz
+		 0x90, 0x7e, 0xfb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xba,   // 1055 MHz
+		 0x49, 0x0c, 0x02, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x75,   // 1056 MHz
+		 0x02, 0x9a, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x2f,   // 1057 MHz
+		 0xbb, 0x27, 0x0f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xea,   // 1058 MHz
+		 0x73, 0xb5, 0x15, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xa5,   // 1059 MHz
+		 0x2c, 0x43, 0x1c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x60,   // 1060 MHz
+		 0xe5, 0xd0, 0x22, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x1b,   // 1061 MHz
+		 0x9e, 0x5e, 0x29, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xd5,   // 1062 MHz
+		 0x56, 0xec, 0x2f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x90,   // 1063 MHz
+		 0x0f, 0x7a, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x4b,   // 1064 MHz
+		 0xc8, 0x07, 0x3d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x06,   // 1065 MHz
+		 0x81, 0x95, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xc0,   // 1066 MHz
+		 0x39, 0x23, 0x4a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x7b,   // 1067 MHz
+		 0xf2, 0xb0, 0x50, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x36,   // 1068 MHz
+		 0xab, 0x3e, 0x57, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xf1,   // 1069 MHz
+		 0x63, 0xcc, 0x5d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xac,   // 1070 MHz
+		 0x1c, 0x5a, 0x64, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x66,   // 1071 MHz
+		 0xd5, 0xe7, 0x6a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x21,   // 1072 MHz
+		 0x8e, 0x75, 0x71, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xdc,   // 1073 MHz
+		 0x46, 0x03, 0x78, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x97,   // 1074 MHz
+		 0xff, 0x90, 0x7e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x51,   // 1075 MHz
+		 0xb8, 0x1e, 0x85, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x0c,   // 1076 MHz
+		 0x71, 0xac, 0x8b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xc7,   // 1077 MHz
+		 0x29, 0x3a, 0x92, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x82,   // 1078 MHz
+		 0xe2, 0xc7, 0x98, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x3d,   // 1079 MHz
+		 0x9b, 0x55, 0x9f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xf7,   // 1080 MHz
+		 0x53, 0xe3, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xb2,   // 1081 MHz
+		 0x0c, 0x71, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x6d,   // 1082 MHz
+		 0xc5, 0xfe, 0xb2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x28,   // 1083 MHz
+		 0x7e, 0x8c, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xe2,   // 1084 MHz
+		 0x36, 0x1a, 0xc0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x9d,   // 1085 MHz
+		 0xef, 0xa7, 0xc6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x58,   // 1086 MHz
+		 0xa8, 0x35, 0xcd, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x13,   // 1087 MHz
+		 0x61, 0xc3, 0xd3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xce,   // 1088 MHz
+		 0x19, 0x51, 0xda, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x88,   // 1089 MHz
+		 0xd2, 0xde, 0xe0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x43,   // 1090 MHz
+		 0x8b, 0x6c, 0xe7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xfe,   // 1091 MHz
+		 0x43, 0xfa, 0xed, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0xb9,   // 1092 MHz
+		 0xfc, 0x87, 0xf4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1b, 0x10, 0x73,   // 1093 MHz
+		 0xb5, 0x15, 0xfb, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x2e,   // 1094 MHz
+		 0x6e, 0xa3, 0x01, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xe9,   // 1095 MHz
+		 0x26, 0x31, 0x08, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xa4,   // 1096 MHz
+		 0xdf, 0xbe, 0x0e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x5f,   // 1097 MHz
+		 0x98, 0x4c, 0x15, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x19,   // 1098 MHz
+		 0x51, 0xda, 0x1b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xd4,   // 1099 MHz
+		 0x09, 0x68, 0x22, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x8f,   // 1100 MHz
+		 0xc2, 0xf5, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x4a,   // 1101 MHz
+		 0x7b, 0x83, 0x2f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x04,   // 1102 MHz
+		 0x34, 0x11, 0x36, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xbf,   // 1103 MHz
+		 0xec, 0x9e, 0x3c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x7a,   // 1104 MHz
+		 0xa5, 0x2c, 0x43, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x35,   // 1105 MHz
+		 0x5e, 0xba, 0x49, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xf0,   // 1106 MHz
+		 0x16, 0x48, 0x50, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xaa,   // 1107 MHz
+		 0xcf, 0xd5, 0x56, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x65,   // 1108 MHz
+		 0x88, 0x63, 0x5d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x20,   // 1109 MHz
+		 0x41, 0xf1, 0x63, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xdb,   // 1110 MHz
+		 0xf9, 0x7e, 0x6a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x95,   // 1111 MHz
+		 0xb2, 0x0c, 0x71, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x50,   // 1112 MHz
+		 0x6b, 0x9a, 0x77, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x0b,   // 1113 MHz
+		 0x24, 0x28, 0x7e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xc6,   // 1114 MHz
+		 0xdc, 0xb5, 0x84, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x81,   // 1115 MHz
+		 0x95, 0x43, 0x8b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x3b,   // 1116 MHz
+		 0x4e, 0xd1, 0x91, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xf6,   // 1117 MHz
+		 0x06, 0x5f, 0x98, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xb1,   // 1118 MHz
+		 0xbf, 0xec, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x6c,   // 1119 MHz
+		 0x78, 0x7a, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x26,   // 1120 MHz
+		 0x31, 0x08, 0xac, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xe1,   // 1121 MHz
+		 0xe9, 0x95, 0xb2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x9c,   // 1122 MHz
+		 0xa2, 0x23, 0xb9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x57,   // 1123 MHz
+		 0x5b, 0xb1, 0xbf, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x12,   // 1124 MHz
+		 0x14, 0x3f, 0xc6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xcc,   // 1125 MHz
+		 0xcc, 0xcc, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x87,   // 1126 MHz
+		 0x85, 0x5a, 0xd3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x42,   // 1127 MHz
+		 0x3e, 0xe8, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xfd,   // 1128 MHz
+		 0xf6, 0x75, 0xe0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xb7,   // 1129 MHz
+		 0xaf, 0x03, 0xe7, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x72,   // 1130 MHz
+		 0x68, 0x91, 0xed, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0x2d,   // 1131 MHz
+		 0x21, 0x1f, 0xf4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1c, 0x10, 0xe8,   // 1132 MHz
+		 0xd9, 0xac, 0xfa, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xa3,   // 1133 MHz
+		 0x92, 0x3a, 0x01, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x5d,   // 1134 MHz
+		 0x4b, 0xc8, 0x07, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x18,   // 1135 MHz
+		 0x04, 0x56, 0x0e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xd3,   // 1136 MHz
+		 0xbc, 0xe3, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x8e,   // 1137 MHz
+		 0x75, 0x71, 0x1b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x48,   // 1138 MHz
+		 0x2e, 0xff, 0x21, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x03,   // 1139 MHz
+		 0xe7, 0x8c, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xbe,   // 1140 MHz
+		 0x9f, 0x1a, 0x2f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x79,   // 1141 MHz
+		 0x58, 0xa8, 0x35, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x34,   // 1142 MHz
+		 0x11, 0x36, 0x3c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xee,   // 1143 MHz
+		 0xc9, 0xc3, 0x42, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xa9,   // 1144 MHz
+		 0x82, 0x51, 0x49, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x64,   // 1145 MHz
+		 0x3b, 0xdf, 0x4f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x1f,   // 1146 MHz
+		 0xf4, 0x6c, 0x56, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xd9,   // 1147 MHz
+		 0xac, 0xfa, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x94,   // 1148 MHz
+		 0x65, 0x88, 0x63, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x4f,   // 1149 MHz
+		 0x1e, 0x16, 0x6a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x0a,   // 1150 MHz
+		 0xd7, 0xa3, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xc5,   // 1151 MHz
+		 0x8f, 0x31, 0x77, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x7f,   // 1152 MHz
+		 0x48, 0xbf, 0x7d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x3a,   // 1153 MHz
+		 0x01, 0x4d, 0x84, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xf5,   // 1154 MHz
+		 0xb9, 0xda, 0x8a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xb0,   // 1155 MHz
+		 0x72, 0x68, 0x91, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x6a,   // 1156 MHz
+		 0x2b, 0xf6, 0x97, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x25,   // 1157 MHz
+		 0xe4, 0x83, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xe0,   // 1158 MHz
+		 0x9c, 0x11, 0xa5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x9b,   // 1159 MHz
+		 0x55, 0x9f, 0xab, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x56,   // 1160 MHz
+		 0x0e, 0x2d, 0xb2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x10,   // 1161 MHz
+		 0xc7, 0xba, 0xb8, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xcb,   // 1162 MHz
+		 0x7f, 0x48, 0xbf, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x86,   // 1163 MHz
+		 0x38, 0xd6, 0xc5, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x41,   // 1164 MHz
+		 0xf1, 0x63, 0xcc, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xfb,   // 1165 MHz
+		 0xa9, 0xf1, 0xd2, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xb6,   // 1166 MHz
+		 0x62, 0x7f, 0xd9, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x71,   // 1167 MHz
+		 0x1b, 0x0d, 0xe0, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x2c,   // 1168 MHz
+		 0xd4, 0x9a, 0xe6, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xe7,   // 1169 MHz
+		 0x8c, 0x28, 0xed, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0xa1,   // 1170 MHz
+		 0x45, 0xb6, 0xf3, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1d, 0x10, 0x5c,   // 1171 MHz
+		 0xfe, 0x43, 0xfa, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x17,   // 1172 MHz
+		 0xb7, 0xd1, 0x00, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0xd2,   // 1173 MHz
+		 0x6f, 0x5f, 0x07, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x8c,   // 1174 MHz
+		 0x28, 0xed, 0x0d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x47,   // 1175 MHz
+		 0xe1, 0x7a, 0x14, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x02,   // 1176 MHz
+		 0x9a, 0x08, 0x1b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0xbd,   // 1177 MHz
+		 0x52, 0x96, 0x21, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x78,   // 1178 MHz
+		 0x0b, 0x24, 0x28, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x32,   // 1179 MHz
+		 0xc4, 0xb1, 0x2e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0xed,   // 1180 MHz
+		 0x7c, 0x3f, 0x35, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0xa8,   // 1181 MHz
+		 0x35, 0xcd, 0x3b, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x63,   // 1182 MHz
+		 0xee, 0x5a, 0x42, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x1d,   // 1183 MHz
+		 0xa7, 0xe8, 0x48, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0xd8,   // 1184 MHz
+		 0x5f, 0x76, 0x4f, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x93,   // 1185 MHz
+		 0x18, 0x04, 0x56, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x4e,   // 1186 MHz
+		 0xd1, 0x91, 0x5c, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x09,   // 1187 MHz
+		 0x8a, 0x1f, 0x63, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0xc3,   // 1188 MHz
+		 0x42, 0xad, 0x69, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x7e,   // 1189 MHz
+		 0xfb, 0x3a, 0x70, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x39,   // 1190 MHz
+		 0xb4, 0xc8, 0x76, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0xf4,   // 1191 MHz
+		 0x6c, 0x56, 0x7d, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0xae,   // 1192 MHz
+		 0x25, 0xe4, 0x83, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x69,   // 1193 MHz
+		 0xde, 0x71, 0x8a, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x24,   // 1194 MHz
+		 0x97, 0xff, 0x90, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0xdf,   // 1195 MHz
+		 0x4f, 0x8d, 0x97, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x9a,   // 1196 MHz
+		 0x08, 0x1b, 0x9e, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x54,   // 1197 MHz
+		 0xc1, 0xa8, 0xa4, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x0f,   // 1198 MHz
+		 0x7a, 0x36, 0xab, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0xca,   // 1199 MHz
+		 0x32, 0xc4, 0xb1, 0x0a, 0x10, 0x03, 0x04},
+		{0xff, 0x03, 0x10, 0xe4, 0x1e, 0x10, 0x85,   // 1200 MHz
+		 0xeb, 0x51, 0xb8, 0x0a, 0x10, 0x03, 0x04}
+	}
+};
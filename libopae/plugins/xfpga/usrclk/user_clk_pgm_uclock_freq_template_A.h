@@ -24,5 +24,6 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
-extern const uint32_t scu32ia3d_DiffMifTbl[QUCPU_INT_NUMFRQ][QUCPU_INT_NUMREG]
-					  [QUCPU_INT_NUMRCK];
+extern const uint32_t scu32ia1d_DiffMifAdrMsk[QUCPU_INT_NUMREG];
+extern const uint8_t scu8ia3d_DiffMifDat[QUCPU_INT_NUMRCK][QUCPU_INT_NUMFRQ]
+					[QUCPU_INT_NUMREG];
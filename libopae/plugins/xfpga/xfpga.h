@@ -30,6 +30,7 @@
 #include <stdint.h>
 
 #include <opae/types.h>
+#include <opae/umsg.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,6 +51,11 @@ fpga_result xfpga_fpgaWriteMMIO32(fpga_handle handle, uint32_t mmio_num,
 				  uint64_t offset, uint32_t value);
 fpga_result xfpga_fpgaReadMMIO32(fpga_handle handle, uint32_t mmio_num,
 				 uint64_t offset, uint32_t *value);
+fpga_result xfpga_fpgaWriteMMIO512(fpga_handle handle, uint32_t mmio_num,
+				   uint64_t offset, const void *value);
+fpga_result xfpga_fpgaWriteMMIOBlock(fpga_handle handle, uint32_t mmio_num,
+				     uint64_t offset, const void *src,
+				     size_t len);
 fpga_result xfpga_fpgaMapMMIO(fpga_handle handle, uint32_t mmio_num,
 			      uint64_t **mmio_ptr);
 fpga_result xfpga_fpgaUnmapMMIO(fpga_handle handle, uint32_t mmio_num);
@@ -62,6 +68,9 @@ fpga_result xfpga_fpgaGetNumUmsg(fpga_handle handle, uint64_t *value);
 fpga_result xfpga_fpgaSetUmsgAttributes(fpga_handle handle, uint64_t value);
 fpga_result xfpga_fpgaTriggerUmsg(fpga_handle handle, uint64_t value);
 fpga_result xfpga_fpgaGetUmsgPtr(fpga_handle handle, uint64_t **umsg_ptr);
+fpga_result xfpga_fpgaGetUmsgDoorbell(fpga_handle handle, uint32_t first_slot,
+				      uint32_t num_slots, int flags,
+				      fpga_umsg_doorbell *doorbell);
 fpga_result xfpga_fpgaPrepareBuffer(fpga_handle handle, uint64_t len,
 				    void **buf_addr, uint64_t *wsid, int flags);
 fpga_result xfpga_fpgaReleaseBuffer(fpga_handle handle, uint64_t wsid);
@@ -72,6 +81,8 @@ fpga_result xfpga_fpgaGetOPAECVersionString(char *version_str, size_t len);
 fpga_result xfpga_fpgaGetOPAECBuildString(char *build_str, size_t len);
 fpga_result xfpga_fpgaReadError(fpga_token token, uint32_t error_num,
 				uint64_t *value);
+fpga_result xfpga_fpgaReadAllErrors(fpga_token token, uint64_t *values,
+				    uint32_t max_values, uint32_t *num_errors);
 fpga_result xfpga_fpgaClearError(fpga_token token, uint32_t error_num);
 fpga_result xfpga_fpgaClearAllErrors(fpga_token token);
 fpga_result xfpga_fpgaGetErrorInfo(fpga_token token, uint32_t error_num,
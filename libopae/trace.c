@@ -0,0 +1,448 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif // HAVE_CONFIG_H
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif // _GNU_SOURCE
+
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+
+#include <opae/trace.h>
+
+#include "safe_string/safe_string.h"
+
+#include "opae_int.h"
+#include "pluginmgr.h"
+#include "trace.h"
+
+/*
+ * Log-linear histogram: values below TRACE_SUB_COUNT get a bucket each,
+ * and every power of two above that is split into TRACE_SUB_COUNT
+ * buckets, so each bucket is at most 1/TRACE_SUB_COUNT of its value wide.
+ */
+#define TRACE_SUB_BITS 3
+#define TRACE_SUB_COUNT (1 << TRACE_SUB_BITS)
+#define TRACE_BUCKETS ((64 - TRACE_SUB_BITS + 1) * TRACE_SUB_COUNT)
+
+typedef struct _opae_trace_hist {
+	uint64_t count;
+	uint64_t errors;
+	uint64_t total_ns;
+	uint64_t min_ns;
+	uint64_t max_ns;
+	uint64_t buckets[TRACE_BUCKETS];
+} opae_trace_hist;
+
+struct _opae_trace_set {
+	opae_trace_hist *hist[OPAE_TRACE_API_COUNT];
+};
+
+#define OPAE_TRACE_NAME(__api) #__api,
+static const char *const trace_api_names[OPAE_TRACE_API_COUNT] = {
+	OPAE_TRACE_APIS(OPAE_TRACE_NAME)
+};
+#undef OPAE_TRACE_NAME
+
+int opae_trace_enabled;
+
+/* non-zero once tracing has been turned on, so there is something to dump */
+static int trace_used;
+static char trace_file[PATH_MAX];
+
+static inline int trace_bucket(uint64_t value)
+{
+	int msb;
+
+	if (value < TRACE_SUB_COUNT)
+		return (int)value;
+
+	msb = 63 - __builtin_clzll(value);
+	return (msb - TRACE_SUB_BITS + 1) * TRACE_SUB_COUNT
+	       + (int)((value >> (msb - TRACE_SUB_BITS)) & (TRACE_SUB_COUNT - 1));
+}
+
+/* largest value that falls in the given bucket */
+static uint64_t trace_bucket_limit(int bucket)
+{
+	int shift;
+	uint64_t low;
+
+	if (bucket < 2 * TRACE_SUB_COUNT)
+		return (uint64_t)bucket;
+
+	shift = bucket / TRACE_SUB_COUNT - 1;
+	low = (uint64_t)(TRACE_SUB_COUNT + bucket % TRACE_SUB_COUNT) << shift;
+	return low + (1ULL << shift) - 1;
+}
+
+static void trace_hist_reset(opae_trace_hist *h)
+{
+	memset_s(h, sizeof(*h), 0);
+	h->min_ns = UINT64_MAX;
+}
+
+/* Return *slot, allocating it first if it is still NULL. */
+static void *trace_lazy_alloc(void **slot, size_t size, int is_hist)
+{
+	void *cur = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+	void *mem;
+
+	if (cur)
+		return cur;
+
+	mem = calloc(1, size);
+	if (!mem)
+		return NULL;
+	if (is_hist)
+		trace_hist_reset((opae_trace_hist *)mem);
+
+	if (!__atomic_compare_exchange_n(slot, &cur, mem, false,
+					 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+		// another thread won the race
+		free(mem);
+		return cur;
+	}
+
+	return mem;
+}
+
+static void trace_hist_add(opae_trace_set **set, enum opae_trace_api api,
+			   fpga_result res, uint64_t elapsed_ns)
+{
+	opae_trace_set *s;
+	opae_trace_hist *h;
+	uint64_t cur;
+
+	s = trace_lazy_alloc((void **)set, sizeof(opae_trace_set), 0);
+	if (!s)
+		return;
+
+	h = trace_lazy_alloc((void **)&s->hist[api], sizeof(opae_trace_hist),
+			     1);
+	if (!h)
+		return;
+
+	__atomic_fetch_add(&h->count, 1, __ATOMIC_RELAXED);
+	if (res != FPGA_OK)
+		__atomic_fetch_add(&h->errors, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&h->total_ns, elapsed_ns, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&h->buckets[trace_bucket(elapsed_ns)], 1,
+			   __ATOMIC_RELAXED);
+
+	cur = __atomic_load_n(&h->min_ns, __ATOMIC_RELAXED);
+	while (elapsed_ns < cur
+	       && !__atomic_compare_exchange_n(&h->min_ns, &cur, elapsed_ns,
+					       true, __ATOMIC_RELAXED,
+					       __ATOMIC_RELAXED))
+		;
+
+	cur = __atomic_load_n(&h->max_ns, __ATOMIC_RELAXED);
+	while (elapsed_ns > cur
+	       && !__atomic_compare_exchange_n(&h->max_ns, &cur, elapsed_ns,
+					       true, __ATOMIC_RELAXED,
+					       __ATOMIC_RELAXED))
+		;
+}
+
+void opae_trace_record(enum opae_trace_api api, opae_trace_set **adapter_set,
+		       opae_trace_set **handle_set, fpga_result res,
+		       uint64_t elapsed_ns)
+{
+	if (adapter_set)
+		trace_hist_add(adapter_set, api, res, elapsed_ns);
+	if (handle_set)
+		trace_hist_add(handle_set, api, res, elapsed_ns);
+}
+
+void opae_trace_free_set(opae_trace_set *set)
+{
+	int i;
+
+	if (!set)
+		return;
+
+	for (i = 0; i < OPAE_TRACE_API_COUNT; ++i)
+		free(set->hist[i]);
+	free(set);
+}
+
+static void trace_hist_merge(opae_trace_hist *dst, const opae_trace_hist *src)
+{
+	int i;
+
+	dst->count += src->count;
+	dst->errors += src->errors;
+	dst->total_ns += src->total_ns;
+	if (src->min_ns < dst->min_ns)
+		dst->min_ns = src->min_ns;
+	if (src->max_ns > dst->max_ns)
+		dst->max_ns = src->max_ns;
+	for (i = 0; i < TRACE_BUCKETS; ++i)
+		dst->buckets[i] += src->buckets[i];
+}
+
+static uint64_t trace_percentile(const opae_trace_hist *h, uint64_t permille)
+{
+	uint64_t target = (h->count * permille + 999) / 1000;
+	uint64_t seen = 0;
+	uint64_t value;
+	int i;
+
+	for (i = 0; i < TRACE_BUCKETS; ++i) {
+		seen += h->buckets[i];
+		if (seen >= target)
+			break;
+	}
+
+	if (i == TRACE_BUCKETS)
+		return h->max_ns;
+
+	value = trace_bucket_limit(i);
+	if (value > h->max_ns)
+		value = h->max_ns;
+	if (value < h->min_ns)
+		value = h->min_ns;
+	return value;
+}
+
+static void trace_summarize(const opae_trace_hist *h, fpga_trace_stats *stats)
+{
+	memset_s(stats, sizeof(*stats), 0);
+
+	if (!h || !h->count)
+		return;
+
+	stats->count = h->count;
+	stats->errors = h->errors;
+	stats->total_ns = h->total_ns;
+	stats->min_ns = h->min_ns;
+	stats->max_ns = h->max_ns;
+	stats->p50_ns = trace_percentile(h, 500);
+	stats->p90_ns = trace_percentile(h, 900);
+	stats->p99_ns = trace_percentile(h, 990);
+	stats->p999_ns = trace_percentile(h, 999);
+}
+
+static int trace_api_index(const char *api_name)
+{
+	int i;
+
+	for (i = 0; i < OPAE_TRACE_API_COUNT; ++i)
+		if (!strcmp(api_name, trace_api_names[i]))
+			return i;
+
+	return -1;
+}
+
+void opae_trace_init(void)
+{
+	char *s = getenv("LIBOPAE_TRACE");
+
+	if (!s || !atoi(s))
+		return;
+
+	s = getenv("LIBOPAE_TRACE_FILE");
+	if (s && strncpy_s(trace_file, sizeof(trace_file), s,
+			   sizeof(trace_file) - 1))
+		OPAE_ERR("LIBOPAE_TRACE_FILE is too long");
+
+	fpgaTraceEnable(true);
+}
+
+void opae_trace_release(void)
+{
+	FILE *fp = stderr;
+
+	if (!__atomic_load_n(&trace_used, __ATOMIC_RELAXED))
+		return;
+
+	if (trace_file[0]) {
+		fp = fopen(trace_file, "w");
+		if (!fp) {
+			OPAE_ERR("Could not open trace file %s: %s",
+				 trace_file, strerror(errno));
+			fp = stderr;
+		}
+	}
+
+	fpgaDumpTraceStats(fp);
+
+	if (fp != stderr)
+		fclose(fp);
+}
+
+fpga_result fpgaTraceEnable(bool enable)
+{
+	if (enable)
+		__atomic_store_n(&trace_used, 1, __ATOMIC_RELAXED);
+	__atomic_store_n(&opae_trace_enabled, enable ? 1 : 0,
+			 __ATOMIC_RELAXED);
+	return FPGA_OK;
+}
+
+struct trace_sum_context {
+	int api;
+	opae_trace_hist sum;
+};
+
+static int trace_sum_adapter(const opae_api_adapter_table *adapter,
+			     void *context)
+{
+	struct trace_sum_context *ctx = (struct trace_sum_context *)context;
+
+	if (adapter->trace && adapter->trace->hist[ctx->api])
+		trace_hist_merge(&ctx->sum, adapter->trace->hist[ctx->api]);
+
+	return OPAE_ENUM_CONTINUE;
+}
+
+fpga_result fpgaGetTraceStats(fpga_handle handle, const char *api_name,
+			      fpga_trace_stats *stats)
+{
+	opae_wrapped_handle *wrapped_handle = NULL;
+	struct trace_sum_context *ctx;
+	int api;
+
+	ASSERT_NOT_NULL(api_name);
+	ASSERT_NOT_NULL(stats);
+
+	if (handle) {
+		wrapped_handle = opae_validate_wrapped_handle(handle);
+		ASSERT_NOT_NULL(wrapped_handle);
+	}
+
+	api = trace_api_index(api_name);
+	if (api < 0) {
+		OPAE_MSG("%s is not a traced API", api_name);
+		return FPGA_NOT_FOUND;
+	}
+
+	if (wrapped_handle) {
+		trace_summarize(wrapped_handle->trace
+					? wrapped_handle->trace->hist[api]
+					: NULL,
+				stats);
+		return FPGA_OK;
+	}
+
+	ctx = (struct trace_sum_context *)malloc(sizeof(*ctx));
+	if (!ctx) {
+		OPAE_ERR("malloc failed");
+		return FPGA_NO_MEMORY;
+	}
+
+	ctx->api = api;
+	trace_hist_reset(&ctx->sum);
+	opae_plugin_mgr_for_each_adapter(trace_sum_adapter, ctx);
+	trace_summarize(&ctx->sum, stats);
+
+	free(ctx);
+	return FPGA_OK;
+}
+
+static void trace_reset_set(opae_trace_set *set)
+{
+	int i;
+
+	if (!set)
+		return;
+
+	for (i = 0; i < OPAE_TRACE_API_COUNT; ++i)
+		if (set->hist[i])
+			trace_hist_reset(set->hist[i]);
+}
+
+static int trace_reset_adapter(const opae_api_adapter_table *adapter,
+			       void *context)
+{
+	UNUSED_PARAM(context);
+	trace_reset_set(adapter->trace);
+	return OPAE_ENUM_CONTINUE;
+}
+
+fpga_result fpgaResetTraceStats(fpga_handle handle)
+{
+	opae_wrapped_handle *wrapped_handle;
+
+	if (handle) {
+		wrapped_handle = opae_validate_wrapped_handle(handle);
+		ASSERT_NOT_NULL(wrapped_handle);
+		trace_reset_set(wrapped_handle->trace);
+		return FPGA_OK;
+	}
+
+	opae_plugin_mgr_for_each_adapter(trace_reset_adapter, NULL);
+	return FPGA_OK;
+}
+
+static int trace_dump_adapter(const opae_api_adapter_table *adapter,
+			      void *context)
+{
+	FILE *fp = (FILE *)context;
+	fpga_trace_stats stats;
+	int i;
+
+	if (!adapter->trace)
+		return OPAE_ENUM_CONTINUE;
+
+	fprintf(fp, "libopae API trace for %s (latencies in ns)\n",
+		adapter->plugin.path);
+	fprintf(fp, "%-32s %10s %8s %10s %10s %10s %10s %10s %10s %10s\n",
+		"API", "calls", "errors", "mean", "min", "p50", "p90", "p99",
+		"p99.9", "max");
+
+	for (i = 0; i < OPAE_TRACE_API_COUNT; ++i) {
+		trace_summarize(adapter->trace->hist[i], &stats);
+		if (!stats.count)
+			continue;
+		fprintf(fp,
+			"%-32s %10" PRIu64 " %8" PRIu64 " %10" PRIu64
+			" %10" PRIu64 " %10" PRIu64 " %10" PRIu64
+			" %10" PRIu64 " %10" PRIu64 " %10" PRIu64 "\n",
+			trace_api_names[i], stats.count, stats.errors,
+			stats.total_ns / stats.count, stats.min_ns,
+			stats.p50_ns, stats.p90_ns, stats.p99_ns,
+			stats.p999_ns, stats.max_ns);
+	}
+
+	return OPAE_ENUM_CONTINUE;
+}
+
+fpga_result fpgaDumpTraceStats(FILE *fp)
+{
+	ASSERT_NOT_NULL(fp);
+
+	opae_plugin_mgr_for_each_adapter(trace_dump_adapter, fp);
+	fflush(fp);
+
+	return FPGA_OK;
+}
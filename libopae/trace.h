@@ -0,0 +1,159 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef __OPAE_TRACE_H__
+#define __OPAE_TRACE_H__
+
+#include <stdint.h>
+#include <time.h>
+
+#include <opae/types.h>
+
+/*
+ * Every API function that the shell dispatches to a plugin.
+ */
+#define OPAE_TRACE_APIS(X)                                                     \
+	X(fpgaOpen)                                                            \
+	X(fpgaClose)                                                           \
+	X(fpgaReset)                                                           \
+	X(fpgaGetPropertiesFromHandle)                                         \
+	X(fpgaGetProperties)                                                   \
+	X(fpgaUpdateProperties)                                                \
+	X(fpgaWriteMMIO64)                                                     \
+	X(fpgaReadMMIO64)                                                      \
+	X(fpgaWriteMMIO32)                                                     \
+	X(fpgaReadMMIO32)                                                      \
+	X(fpgaWriteMMIO512)                                                    \
+	X(fpgaWriteMMIOBlock)                                                  \
+	X(fpgaMapMMIO)                                                         \
+	X(fpgaUnmapMMIO)                                                       \
+	X(fpgaEnumerate)                                                       \
+	X(fpgaCloneToken)                                                      \
+	X(fpgaDestroyToken)                                                    \
+	X(fpgaGetNumUmsg)                                                      \
+	X(fpgaSetUmsgAttributes)                                               \
+	X(fpgaTriggerUmsg)                                                     \
+	X(fpgaGetUmsgPtr)                                                      \
+	X(fpgaGetUmsgDoorbell)                                                 \
+	X(fpgaPrepareBuffer)                                                   \
+	X(fpgaReleaseBuffer)                                                   \
+	X(fpgaGetIOAddress)                                                    \
+	X(fpgaReadError)                                                       \
+	X(fpgaReadAllErrors)                                                   \
+	X(fpgaClearError)                                                      \
+	X(fpgaClearAllErrors)                                                  \
+	X(fpgaGetErrorInfo)                                                    \
+	X(fpgaCreateEventHandle)                                               \
+	X(fpgaDestroyEventHandle)                                              \
+	X(fpgaGetOSObjectFromEventHandle)                                      \
+	X(fpgaRegisterEvent)                                                   \
+	X(fpgaUnregisterEvent)                                                 \
+	X(fpgaAssignPortToInterface)                                           \
+	X(fpgaAssignToInterface)                                               \
+	X(fpgaReleaseFromInterface)                                            \
+	X(fpgaReconfigureSlot)                                                 \
+	X(fpgaTokenGetObject)                                                  \
+	X(fpgaHandleGetObject)                                                 \
+	X(fpgaObjectGetObject)                                                 \
+	X(fpgaDestroyObject)                                                   \
+	X(fpgaObjectRead)                                                      \
+	X(fpgaObjectGetSize)                                                   \
+	X(fpgaObjectRead64)                                                    \
+	X(fpgaObjectWrite64)                                                   \
+	X(fpgaSetUserClock)                                                    \
+	X(fpgaGetUserClock)                                                    \
+	X(fpgaGetNumMetrics)                                                   \
+	X(fpgaGetMetricsInfo)                                                  \
+	X(fpgaGetMetricsByIndex)                                               \
+	X(fpgaGetMetricsByName)
+
+#define OPAE_TRACE_ENUM(__api) OPAE_TRACE_##__api,
+enum opae_trace_api { OPAE_TRACE_APIS(OPAE_TRACE_ENUM) OPAE_TRACE_API_COUNT };
+#undef OPAE_TRACE_ENUM
+
+/* Per-API histograms, allocated on first use. */
+typedef struct _opae_trace_set opae_trace_set;
+
+extern int opae_trace_enabled;
+
+static inline int opae_trace_active(void)
+{
+	return __builtin_expect(
+		__atomic_load_n(&opae_trace_enabled, __ATOMIC_RELAXED), 0);
+}
+
+static inline uint64_t opae_trace_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Add one call to the adapter's histograms and, when handle_set is
+// non-NULL, to the handle's histograms.
+void opae_trace_record(enum opae_trace_api api, opae_trace_set **adapter_set,
+		       opae_trace_set **handle_set, fpga_result res,
+		       uint64_t elapsed_ns);
+
+void opae_trace_free_set(opae_trace_set *set);
+
+// Enable tracing according to LIBOPAE_TRACE and LIBOPAE_TRACE_FILE.
+void opae_trace_init(void);
+
+// Write out the statistics if tracing was ever enabled.
+void opae_trace_release(void);
+
+/*
+ * Evaluate __call, a dispatch to a plugin returning fpga_result, timing it
+ * when tracing is on.
+ */
+#define OPAE_TRACE_CALL(__api, __adapter_set, __handle_set, __call)            \
+	({                                                                     \
+		fpga_result __tres;                                            \
+		if (opae_trace_active()) {                                     \
+			uint64_t __tstart = opae_trace_now();                  \
+			__tres = (__call);                                     \
+			opae_trace_record(OPAE_TRACE_##__api, (__adapter_set), \
+					  (__handle_set), __tres,              \
+					  opae_trace_now() - __tstart);        \
+		} else {                                                       \
+			__tres = (__call);                                     \
+		}                                                              \
+		__tres;                                                        \
+	})
+
+/* Dispatch through a wrapped handle, recording against both. */
+#define OPAE_TRACE_HANDLE(__api, __wrapped_handle, ...)                        \
+	OPAE_TRACE_CALL(__api, &(__wrapped_handle)->adapter_table->trace,      \
+			&(__wrapped_handle)->trace,                            \
+			(__wrapped_handle)->adapter_table->__api(__VA_ARGS__))
+
+/* Dispatch through any other wrapper, recording against the adapter. */
+#define OPAE_TRACE_ADAPTER(__api, __adapter, ...)                              \
+	OPAE_TRACE_CALL(__api, &(__adapter)->trace, NULL,                      \
+			(__adapter)->__api(__VA_ARGS__))
+
+#endif // __OPAE_TRACE_H__
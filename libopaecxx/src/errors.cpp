@@ -49,6 +49,23 @@ uint64_t error::read_value() {
   return val;
 }
 
+error::snapshot_t error::snapshot(token::ptr_t tok) {
+  if (!tok) {
+    throw std::invalid_argument("token object is null");
+  }
+
+  snapshot_t snap;
+  uint32_t num_errors = 0;
+  ASSERT_FPGA_OK(fpgaReadAllErrors(*tok, nullptr, 0, &num_errors));
+
+  snap.values.resize(num_errors);
+  snap.timestamp = std::chrono::system_clock::now();
+  ASSERT_FPGA_OK(fpgaReadAllErrors(*tok, snap.values.data(), num_errors,
+                                   &num_errors));
+  snap.values.resize(num_errors);
+  return snap;
+}
+
 }  // end of namespace types
 }  // end of namespace fpga
 }  // end of namespace opae
@@ -0,0 +1,339 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <opae/cxx/core/event_loop.h>
+#include <opae/cxx/core/except.h>
+
+namespace opae {
+namespace fpga {
+namespace types {
+
+constexpr std::chrono::milliseconds event_loop::infinite;
+
+struct event_loop::impl {
+  typedef std::chrono::steady_clock clock;
+  typedef std::multimap<clock::time_point, wait_id> deadline_map;
+  typedef std::vector<std::pair<callback_t, status>> completion_list;
+
+  struct waiter {
+    int fd;
+    // keeps the event, and so its file descriptor, alive while waiting
+    event::ptr_t ev;
+    callback_t cb;
+    bool timed;
+    deadline_map::iterator deadline;
+  };
+
+  static const int max_events = 256;
+
+  impl() : epfd(-1), wakefd(-1), next_id(1), stopping(false) {}
+
+  ~impl() {
+    if (wakefd >= 0) close(wakefd);
+    if (epfd >= 0) close(epfd);
+  }
+
+  void wake() {
+    uint64_t one = 1;
+    if (write(wakefd, &one, sizeof(one)) < 0) {
+      // the counter is saturated, so the loop is already awake
+    }
+  }
+
+  wait_id add(int fd, event::ptr_t ev, callback_t cb,
+              std::chrono::milliseconds timeout) {
+    if (fd < 0) {
+      throw std::invalid_argument("invalid file descriptor");
+    }
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto &ids = fds[fd];
+    if (ids.empty()) {
+      struct epoll_event epev;
+      epev.events = EPOLLIN;
+      epev.data.fd = fd;
+      if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &epev)) {
+        fds.erase(fd);
+        throw exception(OPAECXX_HERE);
+      }
+    }
+
+    wait_id id = next_id++;
+    waiter &w = waiters[id];
+    w.fd = fd;
+    w.ev = ev;
+    w.cb = cb;
+    w.timed = timeout.count() >= 0;
+    if (w.timed) {
+      w.deadline = deadlines.emplace(clock::now() + timeout, id);
+    }
+    ids.push_back(id);
+    wake();
+    return id;
+  }
+
+  // Remove an outstanding wait, returning its callback. Call with lock held.
+  callback_t take(wait_id id) {
+    auto it = waiters.find(id);
+    if (it == waiters.end()) {
+      return callback_t();
+    }
+
+    waiter &w = it->second;
+    auto fit = fds.find(w.fd);
+    if (fit != fds.end()) {
+      auto &ids = fit->second;
+      for (auto i = ids.begin(); i != ids.end(); ++i) {
+        if (*i == id) {
+          ids.erase(i);
+          break;
+        }
+      }
+      if (ids.empty()) {
+        epoll_ctl(epfd, EPOLL_CTL_DEL, w.fd, nullptr);
+        fds.erase(fit);
+      }
+    }
+
+    if (w.timed) {
+      deadlines.erase(w.deadline);
+    }
+
+    callback_t cb = w.cb;
+    waiters.erase(it);
+    return cb;
+  }
+
+  // How long epoll_wait may block, honoring the nearest deadline.
+  int wait_ms(std::chrono::milliseconds timeout) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (deadlines.empty()) {
+      return timeout.count() < 0 ? -1 : static_cast<int>(timeout.count());
+    }
+
+    auto until = deadlines.begin()->first - clock::now();
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(until);
+    // round up so a deadline isn't polled for repeatedly just before it
+    // expires
+    if (ms < until) {
+      ms += std::chrono::milliseconds(1);
+    }
+    if (ms.count() < 0) {
+      ms = std::chrono::milliseconds(0);
+    }
+    if (timeout.count() >= 0 && timeout < ms) {
+      ms = timeout;
+    }
+    return static_cast<int>(ms.count());
+  }
+
+  void run_until_stopped() {
+    while (!stopping) {
+      dispatch(infinite);
+    }
+  }
+
+  std::size_t dispatch(std::chrono::milliseconds timeout) {
+    std::lock_guard<std::mutex> dispatching(dispatch_lock);
+    struct epoll_event evs[max_events];
+    int n = epoll_wait(epfd, evs, max_events, wait_ms(timeout));
+
+    completion_list done;
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      for (int i = 0; i < n; ++i) {
+        int fd = evs[i].data.fd;
+        uint64_t count = 0;
+        if (fd == wakefd) {
+          if (read(wakefd, &count, sizeof(count)) < 0) {
+            // spurious wakeup
+          }
+          continue;
+        }
+
+        if ((evs[i].events & EPOLLIN) &&
+            read(fd, &count, sizeof(count)) < 0) {
+          // not an eventfd, or already consumed: still a completion
+        }
+
+        auto fit = fds.find(fd);
+        if (fit == fds.end()) {
+          continue;
+        }
+        std::vector<wait_id> ids(fit->second);
+        for (auto id : ids) {
+          done.emplace_back(take(id), status::signaled);
+        }
+      }
+
+      auto now = clock::now();
+      while (!deadlines.empty() && deadlines.begin()->first <= now) {
+        done.emplace_back(take(deadlines.begin()->second), status::timeout);
+      }
+    }
+
+    for (auto &c : done) {
+      if (c.first) {
+        c.first(c.second);
+      }
+    }
+    return done.size();
+  }
+
+  int epfd;
+  int wakefd;
+  mutable std::mutex lock;
+  std::mutex dispatch_lock;
+  wait_id next_id;
+  std::unordered_map<wait_id, waiter> waiters;
+  std::unordered_map<int, std::vector<wait_id>> fds;
+  deadline_map deadlines;
+  std::atomic<bool> stopping;
+  std::thread thread;
+};
+
+event_loop::ptr_t event_loop::create() {
+  return event_loop::ptr_t(new event_loop());
+}
+
+event_loop::event_loop() : impl_(new impl()) {
+  impl_->epfd = epoll_create1(EPOLL_CLOEXEC);
+  if (impl_->epfd < 0) {
+    throw exception(OPAECXX_HERE);
+  }
+
+  impl_->wakefd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (impl_->wakefd < 0) {
+    throw exception(OPAECXX_HERE);
+  }
+
+  struct epoll_event epev;
+  epev.events = EPOLLIN;
+  epev.data.fd = impl_->wakefd;
+  if (epoll_ctl(impl_->epfd, EPOLL_CTL_ADD, impl_->wakefd, &epev)) {
+    throw exception(OPAECXX_HERE);
+  }
+}
+
+event_loop::~event_loop() {
+  stop();
+
+  impl::completion_list done;
+  {
+    std::lock_guard<std::mutex> guard(impl_->lock);
+    while (!impl_->waiters.empty()) {
+      done.emplace_back(impl_->take(impl_->waiters.begin()->first),
+                        status::cancelled);
+    }
+  }
+  for (auto &c : done) {
+    if (c.first) {
+      c.first(c.second);
+    }
+  }
+}
+
+event_loop::wait_id event_loop::async_wait(event::ptr_t ev, callback_t cb,
+                                           std::chrono::milliseconds timeout) {
+  if (!ev) {
+    throw std::invalid_argument("event object is null");
+  }
+  return impl_->add(ev->os_object(), ev, cb, timeout);
+}
+
+event_loop::wait_id event_loop::async_wait(int fd, callback_t cb,
+                                           std::chrono::milliseconds timeout) {
+  return impl_->add(fd, nullptr, cb, timeout);
+}
+
+std::future<event_loop::status> event_loop::wait(
+    event::ptr_t ev, std::chrono::milliseconds timeout) {
+  auto p = std::make_shared<std::promise<status>>();
+  async_wait(ev, [p](status s) { p->set_value(s); }, timeout);
+  return p->get_future();
+}
+
+bool event_loop::cancel(wait_id id) {
+  callback_t cb;
+  {
+    std::lock_guard<std::mutex> guard(impl_->lock);
+    if (impl_->waiters.find(id) == impl_->waiters.end()) {
+      return false;
+    }
+    cb = impl_->take(id);
+  }
+  if (cb) {
+    cb(status::cancelled);
+  }
+  return true;
+}
+
+std::size_t event_loop::run_once(std::chrono::milliseconds timeout) {
+  return impl_->dispatch(timeout);
+}
+
+void event_loop::run() {
+  impl_->stopping = false;
+  impl_->run_until_stopped();
+}
+
+void event_loop::start() {
+  if (impl_->thread.joinable()) {
+    return;
+  }
+  impl_->stopping = false;
+  impl_->thread = std::thread(&impl::run_until_stopped, impl_.get());
+}
+
+void event_loop::stop() {
+  impl_->stopping = true;
+  impl_->wake();
+  if (impl_->thread.joinable() &&
+      impl_->thread.get_id() != std::this_thread::get_id()) {
+    impl_->thread.join();
+  }
+}
+
+std::size_t event_loop::size() const {
+  std::lock_guard<std::mutex> guard(impl_->lock);
+  return impl_->waiters.size();
+}
+
+}  // end of namespace types
+}  // end of namespace fpga
+}  // end of namespace opae
@@ -0,0 +1,180 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#include <climits>
+#include <iterator>
+
+#include <opae/cxx/core/except.h>
+#include <opae/cxx/core/handle_pool.h>
+#include <opae/cxx/core/properties.h>
+
+namespace opae {
+namespace fpga {
+namespace types {
+
+handle_pool::lease::lease(handle_pool::ptr_t pool, uint64_t object_id,
+                          int flags, handle::ptr_t h, bool reset)
+    : pool_(pool),
+      object_id_(object_id),
+      flags_(flags),
+      handle_(h),
+      reset_(reset) {}
+
+handle_pool::lease::lease(lease &&other) noexcept
+    : pool_(std::move(other.pool_)),
+      object_id_(other.object_id_),
+      flags_(other.flags_),
+      handle_(std::move(other.handle_)),
+      reset_(other.reset_) {}
+
+handle_pool::lease &handle_pool::lease::operator=(lease &&other) noexcept {
+  if (this != &other) {
+    release();
+    pool_ = std::move(other.pool_);
+    object_id_ = other.object_id_;
+    flags_ = other.flags_;
+    handle_ = std::move(other.handle_);
+    reset_ = other.reset_;
+  }
+  return *this;
+}
+
+handle_pool::lease::~lease() { release(); }
+
+void handle_pool::lease::release() {
+  if (pool_ && handle_) {
+    pool_->put(object_id_, flags_, handle_, reset_);
+  }
+  handle_.reset();
+  pool_.reset();
+}
+
+handle_pool::ptr_t handle_pool::instance() {
+  static handle_pool::ptr_t pool(new handle_pool(4));
+  return pool;
+}
+
+handle_pool::ptr_t handle_pool::create(std::size_t max_idle) {
+  return handle_pool::ptr_t(new handle_pool(max_idle));
+}
+
+handle_pool::handle_pool(std::size_t max_idle)
+    : max_idle_(max_idle), stats_{0, 0, 0} {}
+
+handle_pool::lease handle_pool::acquire(token::ptr_t tok, int flags,
+                                        bool reset_on_release) {
+  if (!tok) {
+    throw std::invalid_argument("token object is null");
+  }
+
+  auto props = properties::get(tok);
+  uint64_t object_id = props->object_id;
+  std::vector<handle::ptr_t> closing;
+
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = idle_.find(key_t(object_id, flags));
+    if (it != idle_.end() && !it->second.empty()) {
+      handle::ptr_t h = it->second.back();
+      it->second.pop_back();
+      ++stats_.hits;
+      return lease(shared_from_this(), object_id, flags, h, reset_on_release);
+    }
+    ++stats_.misses;
+
+    // An idle handle would make the open fail with FPGA_BUSY if either it
+    // or the new one is exclusive, so give the resource back first.
+    for (it = idle_.lower_bound(key_t(object_id, INT_MIN));
+         it != idle_.end() && it->first.first == object_id; ++it) {
+      if ((flags & FPGA_OPEN_SHARED) && (it->first.second & FPGA_OPEN_SHARED)) {
+        continue;
+      }
+      stats_.discarded += it->second.size();
+      std::move(it->second.begin(), it->second.end(),
+                std::back_inserter(closing));
+      it->second.clear();
+    }
+  }
+  // the conflicting handles close here, outside the lock
+  closing.clear();
+
+  handle::ptr_t h = handle::open(tok, flags);
+  if (props->type == FPGA_ACCELERATOR) {
+    // map MMIO now so that it stays mapped while the handle is pooled
+    try {
+      h->mmio_ptr(0);
+    } catch (except &) {
+      // no MMIO to keep warm (e.g. none exposed by this AFU)
+    }
+  }
+  return lease(shared_from_this(), object_id, flags, h, reset_on_release);
+}
+
+void handle_pool::put(uint64_t object_id, int flags, handle::ptr_t h,
+                      bool reset) {
+  bool keep = h->c_type() != nullptr;
+  if (keep && reset) {
+    try {
+      h->reset();
+    } catch (except &) {
+      keep = false;
+    }
+  }
+
+  std::lock_guard<std::mutex> guard(lock_);
+  auto &handles = idle_[key_t(object_id, flags)];
+  if (keep && handles.size() < max_idle_) {
+    handles.push_back(h);
+  } else {
+    ++stats_.discarded;
+  }
+}
+
+void handle_pool::clear() {
+  std::map<key_t, std::vector<handle::ptr_t>> closing;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    closing.swap(idle_);
+  }
+  // the handles close here, outside the lock
+}
+
+std::size_t handle_pool::idle() const {
+  std::lock_guard<std::mutex> guard(lock_);
+  std::size_t count = 0;
+  for (const auto &kv : idle_) {
+    count += kv.second.size();
+  }
+  return count;
+}
+
+handle_pool::stats handle_pool::get_stats() const {
+  std::lock_guard<std::mutex> guard(lock_);
+  return stats_;
+}
+
+}  // end of namespace types
+}  // end of namespace fpga
+}  // end of namespace opae
@@ -202,15 +202,26 @@ PYBIND11_MODULE(_opae, m) {
            py::arg("slot"), py::arg("fd"), py::arg("flags") = 0)
       .def("__bool__", handle_valid, handle_doc_valid())
       .def("close", &handle::close, handle_doc_close())
-      .def("reset", &handle::reset, handle_doc_reset())
+      .def("reset", &handle::reset, handle_doc_reset(),
+           py::call_guard<py::gil_scoped_release>())
       .def("read_csr32", &handle::read_csr32, handle_doc_read_csr32(),
-           py::arg("offset"), py::arg("csr_space") = 0)
+           py::arg("offset"), py::arg("csr_space") = 0,
+           py::call_guard<py::gil_scoped_release>())
       .def("read_csr64", &handle::read_csr64, handle_doc_read_csr64(),
-           py::arg("offset"), py::arg("csr_space") = 0)
+           py::arg("offset"), py::arg("csr_space") = 0,
+           py::call_guard<py::gil_scoped_release>())
       .def("write_csr32", &handle::write_csr32, handle_doc_write_csr32(),
-           py::arg("offset"), py::arg("value"), py::arg("csr_space") = 0)
+           py::arg("offset"), py::arg("value"), py::arg("csr_space") = 0,
+           py::call_guard<py::gil_scoped_release>())
       .def("write_csr64", &handle::write_csr64, handle_doc_write_csr64(),
-           py::arg("offset"), py::arg("value"), py::arg("csr_space") = 0)
+           py::arg("offset"), py::arg("value"), py::arg("csr_space") = 0,
+           py::call_guard<py::gil_scoped_release>())
+      .def("read_csr_block", handle_read_csr_block,
+           handle_doc_read_csr_block(), py::arg("offset"), py::arg("count"),
+           py::arg("csr_space") = 0)
+      .def("write_csr_block", handle_write_csr_block,
+           handle_doc_write_csr_block(), py::arg("offset"), py::arg("values"),
+           py::arg("csr_space") = 0)
       .def("__getattr__", handle_get_sysobject, sysobject_doc_handle_get())
       .def("__getitem__", handle_get_sysobject, sysobject_doc_handle_get())
       .def("find", handle_find_sysobject, sysobject_doc_handle_find(),
@@ -219,26 +230,38 @@ PYBIND11_MODULE(_opae, m) {
   // define shared_buffer class
   m.def("allocate_shared_buffer", shared_buffer_allocate,
         shared_buffer_doc_allocate());
+  py::class_<poll_backoff> pybackoff(m, "poll_backoff", poll_backoff_doc());
+  pybackoff
+      .def(py::init<uint32_t, uint32_t, uint64_t>(), py::arg("spin_count") = 1024,
+           py::arg("yield_count") = 64, py::arg("max_sleep_usec") = 100)
+      .def_readwrite("spin_count", &poll_backoff::spin_count)
+      .def_readwrite("yield_count", &poll_backoff::yield_count)
+      .def_readwrite("max_sleep_usec", &poll_backoff::max_sleep_usec);
+  m.def("get_poll_backoff", get_poll_backoff, poll_backoff_doc_get());
+  m.def("set_poll_backoff", set_poll_backoff, poll_backoff_doc_set(),
+        py::arg("backoff"));
   py::class_<shared_buffer, shared_buffer::ptr_t> pybuffer(
       m, "shared_buffer", py::buffer_protocol(), shared_buffer_doc());
   pybuffer.def("size", &shared_buffer::size, shared_buffer_doc_size())
       .def("wsid", &shared_buffer::wsid, shared_buffer_doc_wsid())
       .def("io_address", &shared_buffer::io_address,
            shared_buffer_doc_io_address())
-      .def("fill", &shared_buffer::fill, shared_buffer_doc_fill())
+      .def("fill", &shared_buffer::fill, shared_buffer_doc_fill(),
+           py::call_guard<py::gil_scoped_release>())
       .def("poll", shared_buffer_poll<uint8_t>,
            "Poll for an 8-bit value being set at given offset",
            py::arg("offset"), py::arg("value"), py::arg("mask") = 0,
-           py::arg("timeout_usec") = 1000)
+           py::arg("timeout_usec") = 1000, py::arg("backoff") = nullptr)
       .def("poll32", shared_buffer_poll<uint32_t>,
            "Poll for a 32-bit value being set at given offset",
            py::arg("offset"), py::arg("value"), py::arg("mask") = 0,
-           py::arg("timeout_usec") = 1000)
+           py::arg("timeout_usec") = 1000, py::arg("backoff") = nullptr)
       .def("poll64", shared_buffer_poll<uint64_t>,
            "Poll for a 64-bit value being set at given offset",
            py::arg("offset"), py::arg("value"), py::arg("mask"),
-           py::arg("timeout_usec") = 1000)
-      .def("compare", &shared_buffer::compare, shared_buffer_doc_compare())
+           py::arg("timeout_usec") = 1000, py::arg("backoff") = nullptr)
+      .def("compare", &shared_buffer::compare, shared_buffer_doc_compare(),
+           py::call_guard<py::gil_scoped_release>())
       .def("copy", shared_buffer_copy, shared_buffer_doc_copy(),
            py::arg("other"), py::arg("size") = 0)
       .def_buffer([](shared_buffer &b) -> py::buffer_info {
@@ -246,6 +269,9 @@ PYBIND11_MODULE(_opae, m) {
             const_cast<uint8_t *>(b.c_type()), sizeof(uint8_t),
             py::format_descriptor<uint8_t>::format(), b.size());
       })
+      .def("array", shared_buffer_array, shared_buffer_doc_array(),
+           py::arg("dtype") = "uint8", py::arg("offset") = 0,
+           py::arg("shape") = py::none(), py::arg("strides") = py::none())
       .def("read32", &shared_buffer::read<uint32_t>, shared_buffer_doc_read32())
       .def("read64", &shared_buffer::read<uint64_t>, shared_buffer_doc_read64())
       .def("write32", &shared_buffer::write<uint32_t>,
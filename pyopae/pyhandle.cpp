@@ -76,6 +76,9 @@ void handle_reconfigure(handle::ptr_t handle, uint32_t slot, py::object file,
   }
   // PyFile_IncUseCount(obj);
   // is fd object already holding a reference count while in this function?
+  // Reading the GBS and programming the slot can take a while; let other
+  // Python threads run in the meantime.
+  py::gil_scoped_release release;
   fseek(fp, 0L, SEEK_END);
   size_t size = ftell(fp);
   fseek(fp, 0L, SEEK_SET);
@@ -173,3 +176,49 @@ const char *handle_doc_write_csr64() {
       csr_space: The CSR space to write from. Default is 0.
   )opaedoc";
 }
+
+const char *handle_doc_read_csr_block() {
+  return R"opaedoc(
+    Read a contiguous range of 64-bit CSRs into a NumPy array.
+    Args:
+      offset: The offset of the first register.
+      count: The number of 64-bit registers to read.
+      csr_space: The CSR space to read from. Default is 0.
+  )opaedoc";
+}
+
+py::array_t<uint64_t> handle_read_csr_block(handle::ptr_t handle,
+                                            uint64_t offset, size_t count,
+                                            uint32_t csr_space) {
+  py::array_t<uint64_t> values(count);
+  uint64_t *data = values.mutable_data();
+  {
+    py::gil_scoped_release release;
+    for (size_t i = 0; i < count; ++i) {
+      data[i] = handle->read_csr64(offset + i * sizeof(uint64_t), csr_space);
+    }
+  }
+  return values;
+}
+
+const char *handle_doc_write_csr_block() {
+  return R"opaedoc(
+    Write the values of a NumPy array to a contiguous range of 64-bit CSRs.
+    Args:
+      offset: The offset of the first register.
+      values: The array of 64-bit values to write, one per register.
+      csr_space: The CSR space to write to. Default is 0.
+  )opaedoc";
+}
+
+void handle_write_csr_block(
+    handle::ptr_t handle, uint64_t offset,
+    py::array_t<uint64_t, py::array::c_style | py::array::forcecast> values,
+    uint32_t csr_space) {
+  const uint64_t *data = values.data();
+  size_t count = values.size();
+  py::gil_scoped_release release;
+  for (size_t i = 0; i < count; ++i) {
+    handle->write_csr64(offset + i * sizeof(uint64_t), data[i], csr_space);
+  }
+}
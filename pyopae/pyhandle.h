@@ -27,6 +27,7 @@
 #include <Python.h>
 
 #include <opae/cxx/core/handle.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
 const char *handle_doc_open();
@@ -51,4 +52,14 @@ const char *handle_doc_read_csr32();
 const char *handle_doc_read_csr64();
 const char *handle_doc_write_csr32();
 const char *handle_doc_write_csr64();
+const char *handle_doc_read_csr_block();
+pybind11::array_t<uint64_t> handle_read_csr_block(
+    opae::fpga::types::handle::ptr_t handle, uint64_t offset, size_t count,
+    uint32_t csr_space = 0);
+const char *handle_doc_write_csr_block();
+void handle_write_csr_block(
+    opae::fpga::types::handle::ptr_t handle, uint64_t offset,
+    pybind11::array_t<uint64_t, pybind11::array::c_style |
+                                    pybind11::array::forcecast> values,
+    uint32_t csr_space = 0);
 
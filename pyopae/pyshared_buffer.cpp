@@ -25,12 +25,54 @@
 // POSSIBILITY OF SUCH DAMAGE.
 #include "pyshared_buffer.h"
 #include <opae/cxx/core/handle.h>
+#include <mutex>
 #include "pycontext.h"
 
 namespace py = pybind11;
 using opae::fpga::types::shared_buffer;
 using opae::fpga::types::handle;
 
+static std::mutex poll_backoff_lock;
+static poll_backoff default_poll_backoff;
+
+const char *poll_backoff_doc() {
+  return R"opaedoc(
+    poll_backoff controls how shared_buffer.poll waits for a value.
+    The poll loop spins (using the PAUSE instruction where available)
+    for spin_count iterations, then yields the processor for yield_count
+    iterations and finally sleeps, doubling the sleep interval each time
+    up to max_sleep_usec microseconds.
+    Args:
+      spin_count: Number of busy-wait iterations. Default is 1024.
+      yield_count: Number of iterations that yield the processor.
+                   Default is 64.
+      max_sleep_usec: Upper bound for the sleep interval in microseconds.
+                      Default is 100.
+  )opaedoc";
+}
+
+const char *poll_backoff_doc_get() {
+  return R"opaedoc(
+    Get the poll_backoff used by shared_buffer.poll when none is given.
+  )opaedoc";
+}
+
+poll_backoff get_poll_backoff() {
+  std::lock_guard<std::mutex> guard(poll_backoff_lock);
+  return default_poll_backoff;
+}
+
+const char *poll_backoff_doc_set() {
+  return R"opaedoc(
+    Set the poll_backoff used by shared_buffer.poll when none is given.
+  )opaedoc";
+}
+
+void set_poll_backoff(const poll_backoff &backoff) {
+  std::lock_guard<std::mutex> guard(poll_backoff_lock);
+  default_poll_backoff = backoff;
+}
+
 const char *shared_buffer_doc() {
   return R"opaedoc(
     shared_buffer represents a system memory buffer that can be shared with the accelerator.
@@ -135,6 +177,100 @@ py::list shared_buffer_getslice(shared_buffer::ptr_t buf, py::slice slice) {
   return list;
 }
 
+const char *shared_buffer_doc_array() {
+  return R"opaedoc(
+    Get a NumPy array that views the buffer memory without copying it.
+    Args:
+      dtype: The NumPy data type of the array elements. Default is uint8.
+      offset: The byte offset into the buffer of the first element.
+              Default is 0.
+      shape: The shape of the array. By default the array is
+             one-dimensional and covers the rest of the buffer.
+      strides: The strides of the array in bytes. By default the array
+               is C-contiguous.
+
+    NOTE: The array keeps the shared_buffer object alive, but its memory
+    becomes invalid once the handle that owns the buffer is closed.
+  )opaedoc";
+}
+
+py::array shared_buffer_array(shared_buffer::ptr_t buf, py::object dtype,
+                              size_t offset, py::object shape,
+                              py::object strides) {
+  auto dt = py::dtype::from_args(dtype);
+  size_t itemsize = dt.itemsize();
+  if (offset > buf->size()) {
+    throw std::invalid_argument("offset is beyond the end of the buffer");
+  }
+
+  std::vector<ssize_t> dims;
+  if (shape.is_none()) {
+    dims.push_back((buf->size() - offset) / itemsize);
+  } else if (py::isinstance<py::int_>(shape)) {
+    dims.push_back(shape.cast<ssize_t>());
+  } else {
+    dims = shape.cast<std::vector<ssize_t>>();
+  }
+
+  for (auto d : dims) {
+    if (d < 0) {
+      throw std::invalid_argument("shape and strides must not be negative");
+    }
+  }
+
+  std::vector<ssize_t> steps;
+  if (strides.is_none()) {
+    steps.resize(dims.size());
+    ssize_t step = itemsize;
+    for (size_t i = dims.size(); i > 0; --i) {
+      steps[i - 1] = step;
+      // A wrapped step only matters if the array is non-empty, in which
+      // case the extent check below rejects it anyway.
+      if (__builtin_mul_overflow(step, dims[i - 1], &step)) {
+        step = 0;
+      }
+    }
+  } else if (py::isinstance<py::int_>(strides)) {
+    steps.push_back(strides.cast<ssize_t>());
+  } else {
+    steps = strides.cast<std::vector<ssize_t>>();
+  }
+
+  if (steps.size() != dims.size()) {
+    throw std::invalid_argument("shape and strides must have the same length");
+  }
+
+  // Make sure the last element addressed by the view is inside the buffer.
+  // dims and steps come from the caller, so every step of the computation is
+  // checked for overflow.
+  size_t extent = itemsize;
+  bool overflow = false;
+  for (size_t i = 0; i < dims.size(); ++i) {
+    if (steps[i] < 0) {
+      throw std::invalid_argument("shape and strides must not be negative");
+    }
+    if (!dims[i]) {
+      extent = 0;
+      overflow = false;
+      break;
+    }
+    size_t span = 0;
+    overflow = overflow ||
+               __builtin_mul_overflow(static_cast<size_t>(dims[i] - 1),
+                                      static_cast<size_t>(steps[i]), &span) ||
+               __builtin_add_overflow(extent, span, &extent);
+  }
+  if (overflow) {
+    throw std::invalid_argument("array view size overflows");
+  }
+  if (extent > buf->size() - offset) {
+    throw std::invalid_argument("array view exceeds the buffer size");
+  }
+
+  auto ptr = const_cast<uint8_t *>(buf->c_type()) + offset;
+  return py::array(dt, dims, steps, ptr, py::cast(buf));
+}
+
 const char *shared_buffer_doc_read32() {
   return R"opaedoc(
     Cast the memory at the given offset into a 32-bit integer
@@ -170,6 +306,7 @@ void shared_buffer_copy(shared_buffer::ptr_t self, shared_buffer::ptr_t other,
   uint8_t *src = const_cast<uint8_t *>(self->c_type());
   uint8_t *dst = const_cast<uint8_t *>(other->c_type());
 
+  py::gil_scoped_release release;
   std::copy(src, src + (size ? size : self->size()), dst);
 }
 
@@ -26,8 +26,11 @@
 #pragma once
 #include <Python.h>
 #include <opae/cxx/core/shared_buffer.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <algorithm>
 #include <chrono>
+#include <thread>
 #include "pyhandle.h"
 
 const char *shared_buffer_doc();
@@ -57,6 +60,11 @@ const char *shared_buffer_doc_getslice();
 pybind11::list shared_buffer_getslice(
     opae::fpga::types::shared_buffer::ptr_t buf, pybind11::slice slice);
 
+const char *shared_buffer_doc_array();
+pybind11::array shared_buffer_array(
+    opae::fpga::types::shared_buffer::ptr_t buf, pybind11::object dtype,
+    size_t offset, pybind11::object shape, pybind11::object strides);
+
 const char *shared_buffer_doc_read32();
 const char *shared_buffer_doc_read64();
 const char *shared_buffer_doc_write32();
@@ -69,23 +77,73 @@ const char *shared_buffer_doc_split();
 std::vector<opae::fpga::types::shared_buffer::ptr_t> shared_buffer_split(
     opae::fpga::types::shared_buffer::ptr_t buf, pybind11::args args);
 
+const char *poll_backoff_doc();
+
+/// Controls how shared_buffer.poll waits between reads of the buffer.
+/// The poll loop first spins (issuing a PAUSE instruction on x86) for
+/// spin_count iterations, then yields the processor for yield_count
+/// iterations, and finally sleeps with an exponentially growing interval
+/// starting at one microsecond and capped at max_sleep_usec.
+struct poll_backoff {
+  poll_backoff(uint32_t spin = 1024, uint32_t yield = 64,
+               uint64_t max_sleep = 100)
+      : spin_count(spin), yield_count(yield), max_sleep_usec(max_sleep) {}
+
+  uint32_t spin_count;
+  uint32_t yield_count;
+  uint64_t max_sleep_usec;
+};
+
+const char *poll_backoff_doc_get();
+poll_backoff get_poll_backoff();
+
+const char *poll_backoff_doc_set();
+void set_poll_backoff(const poll_backoff &backoff);
+
+inline void poll_cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#endif
+}
+
 template <typename T>
 bool shared_buffer_poll(opae::fpga::types::shared_buffer::ptr_t self,
                         size_t offset, T value, T mask = 0,
-                        uint64_t timeout_usec = 1000) {
+                        uint64_t timeout_usec = 1000,
+                        const poll_backoff *backoff = nullptr) {
   using hrc = std::chrono::high_resolution_clock;
   auto ptr = self->c_type();
-  auto begin = hrc::now();
-  std::chrono::microseconds timeout(timeout_usec);
+  poll_backoff policy = backoff ? *backoff : get_poll_backoff();
   if (!mask) {
     mask = ~mask;
   }
 
+  // The GIL is released for the duration of the wait so that other
+  // Python threads (e.g. ones consuming results) can run.
+  pybind11::gil_scoped_release release;
+  auto begin = hrc::now();
+  std::chrono::microseconds timeout(timeout_usec);
+  std::chrono::microseconds sleep_time(1);
+  std::chrono::microseconds max_sleep(
+      std::max<uint64_t>(policy.max_sleep_usec, 1));
+  uint64_t iteration = 0;
+
   while ((*reinterpret_cast<volatile T *>(ptr + offset) & mask) != value) {
-    if (std::chrono::duration_cast<std::chrono::microseconds>(
-            hrc::now() - begin) >= timeout) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        hrc::now() - begin);
+    if (elapsed >= timeout) {
       return false;
     }
+    if (iteration < policy.spin_count) {
+      poll_cpu_relax();
+    } else if (iteration <
+               uint64_t(policy.spin_count) + policy.yield_count) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(std::min(sleep_time, timeout - elapsed));
+      sleep_time = std::min(sleep_time * 2, max_sleep);
+    }
+    ++iteration;
   }
   return true;
 }
@@ -0,0 +1,697 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file mmio_latency.c
+ * @brief Characterizes MMIO access latency and throughput.
+ *
+ * Each access type is timed individually with the time stamp counter,
+ * and the sample prints the latency distribution (min, percentiles, max)
+ * together with the bulk throughput of an untimed loop. Accesses are
+ * made in two modes:
+ *
+ *  - api: fpgaReadMMIO32/64() and fpgaWriteMMIO32/64()
+ *  - ptr: loads and stores through the pointer returned by fpgaMapMMIO()
+ *
+ * so the difference between the two is the cost of the library layers.
+ * 512-bit writes are measured through fpgaWriteMMIO512() and, when the CPU
+ * supports AVX-512, as single stores through the mapped pointer. Every test
+ * is repeated with 1, 2, 4, ... threads up to --threads, all sharing one
+ * handle. Thread t is pinned to core --cpu + t.
+ *
+ * The sample requires a native loopback mode (NLB) test image to be loaded on
+ * the FPGA; accesses go to the NLB scratchpad register unless --offset is
+ * given. A 512-bit write at the scratchpad would also overwrite the NLB DSM,
+ * buffer address, line count and control registers that follow it, so the
+ * 512-bit tests only run when --offset names a 64-byte scratch region.
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#include <immintrin.h>
+#define HAVE_TSC 1
+#endif
+
+#include <uuid/uuid.h>
+#include <opae/fpga.h>
+
+/* NLB0 AFU_ID */
+#define NLB0_AFUID "D8424DC4-A4A3-C413-F89E-433683F9040B"
+
+#define CSR_SCRATCHPAD0 0x0100
+
+#define MAX_THREADS 64
+
+/*
+ * macro to check return codes, print error message, and goto cleanup label
+ * NOTE: this changes the program flow (uses goto)!
+ */
+#define ON_ERR_GOTO(res, label, desc)              \
+	do {                                       \
+		if ((res) != FPGA_OK) {            \
+			print_err((desc), (res));  \
+			goto label;                \
+		}                                  \
+	} while (0)
+
+void print_err(const char *s, fpga_result res)
+{
+	fprintf(stderr, "Error %s: %s\n", s, fpgaErrStr(res));
+}
+
+#define MODE_API 0x1
+#define MODE_PTR 0x2
+
+/*
+ * Global configuration, set during parse_args()
+ * */
+struct config {
+	struct target {
+		int bus;
+	} target;
+	uint64_t iterations;
+	uint32_t threads;
+	int cpu;
+	uint64_t offset;
+	bool offset_set;
+	int modes;
+}
+
+config = {
+	.target = {
+		.bus = -1,
+	},
+	.iterations = 100000,
+	.threads = 1,
+	.cpu = 0,
+	.offset = CSR_SCRATCHPAD0,
+	.offset_set = false,
+	.modes = MODE_API | MODE_PTR
+};
+
+#define GETOPT_STRING "B:i:t:c:o:m:"
+fpga_result parse_args(int argc, char *argv[])
+{
+	struct option longopts[] = {
+		{ "bus",        required_argument, NULL, 'B' },
+		{ "iterations", required_argument, NULL, 'i' },
+		{ "threads",    required_argument, NULL, 't' },
+		{ "cpu",        required_argument, NULL, 'c' },
+		{ "offset",     required_argument, NULL, 'o' },
+		{ "mode",       required_argument, NULL, 'm' },
+		{ NULL,         0,                 NULL,  0  }
+	};
+
+	int getopt_ret;
+	int option_index;
+	char *endptr = NULL;
+
+	while (-1 != (getopt_ret = getopt_long(argc, argv, GETOPT_STRING,
+						longopts, &option_index))) {
+		const char *tmp_optarg = optarg;
+
+		if ((optarg) && ('=' == *tmp_optarg))
+			++tmp_optarg;
+
+		if (NULL == tmp_optarg)
+			return FPGA_EXCEPTION;
+		endptr = NULL;
+
+		switch (getopt_ret) {
+		case 'B': /* bus */
+			config.target.bus = (int) strtoul(tmp_optarg, &endptr, 0);
+			if (*endptr) {
+				fprintf(stderr, "invalid bus: %s\n", tmp_optarg);
+				return FPGA_EXCEPTION;
+			}
+			break;
+		case 'i':
+			config.iterations = strtoull(tmp_optarg, &endptr, 0);
+			if (!config.iterations || *endptr) {
+				fprintf(stderr, "invalid iterations: %s\n",
+					tmp_optarg);
+				return FPGA_EXCEPTION;
+			}
+			break;
+		case 't':
+			config.threads = (uint32_t) strtoul(tmp_optarg,
+							    &endptr, 0);
+			if (!config.threads || config.threads > MAX_THREADS ||
+			    *endptr) {
+				fprintf(stderr, "invalid threads: %s\n",
+					tmp_optarg);
+				return FPGA_EXCEPTION;
+			}
+			break;
+		case 'c': /* first cpu to pin to, -1 to not pin */
+			config.cpu = (int) strtol(tmp_optarg, &endptr, 0);
+			if (config.cpu < -1 || *endptr) {
+				fprintf(stderr, "invalid cpu: %s\n", tmp_optarg);
+				return FPGA_EXCEPTION;
+			}
+			break;
+		case 'o':
+			config.offset = strtoull(tmp_optarg, &endptr, 0);
+			if ((config.offset % sizeof(uint64_t)) || *endptr) {
+				fprintf(stderr, "invalid offset: %s\n",
+					tmp_optarg);
+				return FPGA_EXCEPTION;
+			}
+			config.offset_set = true;
+			break;
+		case 'm':
+			if (!strcmp(tmp_optarg, "api")) {
+				config.modes = MODE_API;
+			} else if (!strcmp(tmp_optarg, "ptr")) {
+				config.modes = MODE_PTR;
+			} else if (!strcmp(tmp_optarg, "all")) {
+				config.modes = MODE_API | MODE_PTR;
+			} else {
+				fprintf(stderr, "invalid mode: %s\n",
+					tmp_optarg);
+				return FPGA_EXCEPTION;
+			}
+			break;
+
+		default: /* invalid option */
+			fprintf(stderr, "Invalid cmdline option \n");
+			return FPGA_EXCEPTION;
+		}
+	}
+
+	return FPGA_OK;
+}
+
+fpga_result find_fpga(fpga_guid afu_guid,
+		      fpga_token *accelerator_token,
+		      uint32_t *num_matches_accelerators)
+{
+	fpga_properties filter = NULL;
+	fpga_result res1;
+	fpga_result res2 = FPGA_OK;
+
+	res1 = fpgaGetProperties(NULL, &filter);
+	ON_ERR_GOTO(res1, out, "creating properties object");
+
+	res1 = fpgaPropertiesSetObjectType(filter, FPGA_ACCELERATOR);
+	ON_ERR_GOTO(res1, out_destroy, "setting object type");
+
+	res1 = fpgaPropertiesSetGUID(filter, afu_guid);
+	ON_ERR_GOTO(res1, out_destroy, "setting GUID");
+
+	if (-1 != config.target.bus) {
+		res1 = fpgaPropertiesSetBus(filter, config.target.bus);
+		ON_ERR_GOTO(res1, out_destroy, "setting bus");
+	}
+
+	res1 = fpgaEnumerate(&filter, 1, accelerator_token, 1,
+			     num_matches_accelerators);
+	ON_ERR_GOTO(res1, out_destroy, "enumerating accelerators");
+
+out_destroy:
+	res2 = fpgaDestroyProperties(&filter);
+	ON_ERR_GOTO(res2, out, "destroying properties object");
+out:
+	return res1 != FPGA_OK ? res1 : res2;
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * Time stamps. On x86 the TSC is read with the usual fences so that the
+ * timed access can not be moved out of the measured window; elsewhere the
+ * monotonic clock is used.
+ */
+#ifdef HAVE_TSC
+static inline uint64_t ticks_begin(void)
+{
+	_mm_lfence();
+	return __rdtsc();
+}
+
+static inline uint64_t ticks_end(void)
+{
+	unsigned int aux;
+	uint64_t t = __rdtscp(&aux);
+
+	_mm_lfence();
+	return t;
+}
+
+static int have_avx512(void)
+{
+	return __builtin_cpu_supports("avx512f");
+}
+
+__attribute__((target("avx512f")))
+static void store512(volatile void *dst, const void *src)
+{
+	_mm512_store_si512((void *) dst, _mm512_loadu_si512(src));
+	_mm_sfence();
+}
+#else
+#define ticks_begin now_ns
+#define ticks_end now_ns
+
+static int have_avx512(void)
+{
+	return 0;
+}
+
+static void store512(volatile void *dst, const void *src)
+{
+	(void) dst;
+	(void) src;
+}
+#endif
+
+/* ticks per nanosecond */
+static double tick_rate = 1.0;
+
+static void calibrate_ticks(void)
+{
+#ifdef HAVE_TSC
+	struct timespec delay = { .tv_sec = 0, .tv_nsec = 50000000 };
+	uint64_t ns = now_ns();
+	uint64_t t = ticks_begin();
+
+	nanosleep(&delay, NULL);
+	tick_rate = (double) (ticks_end() - t) / (now_ns() - ns);
+#endif
+}
+
+enum access_test {
+	API_RD32,
+	API_RD64,
+	API_WR32,
+	API_WR64,
+	API_WR512,
+	PTR_RD32,
+	PTR_RD64,
+	PTR_WR32,
+	PTR_WR64,
+	PTR_WR512,
+	TIMER,
+	NUM_TESTS
+};
+
+static const struct {
+	const char *name;
+	int mode;
+	uint32_t bytes;
+} tests[NUM_TESTS] = {
+	[API_RD32]  = { "api read 32",   MODE_API, 4 },
+	[API_RD64]  = { "api read 64",   MODE_API, 8 },
+	[API_WR32]  = { "api write 32",  MODE_API, 4 },
+	[API_WR64]  = { "api write 64",  MODE_API, 8 },
+	[API_WR512] = { "api write 512", MODE_API, 64 },
+	[PTR_RD32]  = { "ptr read 32",   MODE_PTR, 4 },
+	[PTR_RD64]  = { "ptr read 64",   MODE_PTR, 8 },
+	[PTR_WR32]  = { "ptr write 32",  MODE_PTR, 4 },
+	[PTR_WR64]  = { "ptr write 64",  MODE_PTR, 8 },
+	[PTR_WR512] = { "ptr write 512", MODE_PTR, 64 },
+	[TIMER]     = { "timer overhead", 0, 0 },
+};
+
+/* releases the workers together, or tells them to give up */
+struct start_gate {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	int go;
+	int abort;
+};
+
+struct worker {
+	pthread_t thread;
+	int cpu;
+	enum access_test test;
+	fpga_handle handle;
+	uint8_t *mmio;
+	struct start_gate *gate;
+	uint64_t *samples;   /* per-access latency, in ticks */
+	uint64_t bulk_ticks; /* untimed loop over all iterations */
+	fpga_result res;
+};
+
+/*
+ * Runs body config.iterations times, first timing each access into
+ * w->samples and then timing the loop as a whole for the throughput.
+ */
+#define ACCESS_LOOP(w, body)                                         \
+	do {                                                         \
+		uint64_t i_;                                         \
+		uint64_t t_;                                         \
+		for (i_ = 0; i_ < config.iterations; ++i_) {         \
+			t_ = ticks_begin();                          \
+			body;                                        \
+			(w)->samples[i_] = ticks_end() - t_;         \
+		}                                                    \
+		t_ = ticks_begin();                                  \
+		for (i_ = 0; i_ < config.iterations; ++i_) {         \
+			body;                                        \
+		}                                                    \
+		(w)->bulk_ticks = ticks_end() - t_;                  \
+	} while (0)
+
+static void *worker_thread(void *arg)
+{
+	struct worker *w = (struct worker *) arg;
+	fpga_handle h = w->handle;
+	uint64_t off = config.offset;
+	volatile uint32_t *p32 = (volatile uint32_t *) (w->mmio + off);
+	volatile uint64_t *p64 = (volatile uint64_t *) (w->mmio + off);
+	uint64_t line[8] __attribute__((aligned(64))) = { 0 };
+	uint32_t v32 = 0;
+	uint64_t v64 = 0;
+	fpga_result r;
+	fpga_result res = FPGA_OK;
+	int abort;
+
+	if (w->cpu >= 0) {
+		cpu_set_t set;
+
+		CPU_ZERO(&set);
+		CPU_SET(w->cpu, &set);
+		if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set))
+			fprintf(stderr, "warning: failed to pin to cpu %d\n",
+				w->cpu);
+	}
+
+	pthread_mutex_lock(&w->gate->lock);
+	while (!w->gate->go && !w->gate->abort)
+		pthread_cond_wait(&w->gate->cond, &w->gate->lock);
+	abort = w->gate->abort;
+	pthread_mutex_unlock(&w->gate->lock);
+
+	if (abort) {
+		w->res = FPGA_EXCEPTION;
+		return NULL;
+	}
+
+	switch (w->test) {
+	case API_RD32:
+		ACCESS_LOOP(w, r = fpgaReadMMIO32(h, 0, off, &v32);
+			    if (r) res = r);
+		break;
+	case API_RD64:
+		ACCESS_LOOP(w, r = fpgaReadMMIO64(h, 0, off, &v64);
+			    if (r) res = r);
+		break;
+	case API_WR32:
+		ACCESS_LOOP(w, r = fpgaWriteMMIO32(h, 0, off, v32++);
+			    if (r) res = r);
+		break;
+	case API_WR64:
+		ACCESS_LOOP(w, r = fpgaWriteMMIO64(h, 0, off, v64++);
+			    if (r) res = r);
+		break;
+	case API_WR512:
+		ACCESS_LOOP(w, line[0]++;
+			    r = fpgaWriteMMIO512(h, 0, off, line);
+			    if (r) res = r);
+		break;
+	case PTR_RD32:
+		ACCESS_LOOP(w, v32 += *p32);
+		break;
+	case PTR_RD64:
+		ACCESS_LOOP(w, v64 += *p64);
+		break;
+	case PTR_WR32:
+		ACCESS_LOOP(w, *p32 = v32++);
+		break;
+	case PTR_WR64:
+		ACCESS_LOOP(w, *p64 = v64++);
+		break;
+	case PTR_WR512:
+		ACCESS_LOOP(w, line[0]++; store512(p64, line));
+		break;
+	case TIMER:
+	default:
+		ACCESS_LOOP(w, (void) 0);
+		break;
+	}
+
+	w->res = res;
+	return NULL;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *) a;
+	uint64_t y = *(const uint64_t *) b;
+
+	return x < y ? -1 : x > y;
+}
+
+static double percentile_ns(const uint64_t *sorted, uint64_t n, double q)
+{
+	return sorted[(uint64_t) (q * (n - 1))] / tick_rate;
+}
+
+static void print_header(void)
+{
+	printf("%-16s %3s %8s %8s %8s %8s %8s %8s %10s\n",
+	       "test", "thr", "min", "p50", "p90", "p99", "p99.9", "max",
+	       "MB/s");
+}
+
+/* Merges the workers' samples and prints one line of results. */
+static fpga_result report(enum access_test test, struct worker *workers,
+			  uint32_t threads)
+{
+	uint64_t n = config.iterations * threads;
+	uint64_t *all = malloc(n * sizeof(uint64_t));
+	uint64_t bulk = 0;
+	double mbps = 0.0;
+	uint32_t t;
+
+	if (!all)
+		return FPGA_NO_MEMORY;
+
+	for (t = 0; t < threads; ++t) {
+		memcpy(all + t * config.iterations, workers[t].samples,
+		       config.iterations * sizeof(uint64_t));
+		if (workers[t].bulk_ticks > bulk)
+			bulk = workers[t].bulk_ticks;
+	}
+	qsort(all, n, sizeof(uint64_t), cmp_u64);
+
+	/* bytes per microsecond == MB/s */
+	if (bulk)
+		mbps = (double) tests[test].bytes * n /
+		       (bulk / tick_rate / 1000.0);
+
+	printf("%-16s %3u %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f %10.1f\n",
+	       tests[test].name, threads,
+	       all[0] / tick_rate,
+	       percentile_ns(all, n, 0.50),
+	       percentile_ns(all, n, 0.90),
+	       percentile_ns(all, n, 0.99),
+	       percentile_ns(all, n, 0.999),
+	       all[n - 1] / tick_rate,
+	       mbps);
+
+	free(all);
+	return FPGA_OK;
+}
+
+static fpga_result run_test(enum access_test test, fpga_handle handle,
+			    uint8_t *mmio, uint32_t threads)
+{
+	struct worker workers[MAX_THREADS];
+	struct start_gate gate = {
+		.lock = PTHREAD_MUTEX_INITIALIZER,
+		.cond = PTHREAD_COND_INITIALIZER,
+		.go = 0,
+		.abort = 0
+	};
+	fpga_result res = FPGA_OK;
+	uint32_t started;
+	uint32_t t;
+
+	memset(workers, 0, sizeof(workers));
+	for (t = 0; t < threads; ++t) {
+		workers[t].samples = malloc(config.iterations *
+					    sizeof(uint64_t));
+		if (!workers[t].samples) {
+			res = FPGA_NO_MEMORY;
+			goto out_free;
+		}
+	}
+
+	for (started = 0; started < threads; ++started) {
+		struct worker *w = &workers[started];
+
+		w->cpu = config.cpu < 0 ? -1 : config.cpu + (int) started;
+		w->test = test;
+		w->handle = handle;
+		w->mmio = mmio;
+		w->gate = &gate;
+		if (pthread_create(&w->thread, NULL, worker_thread, w)) {
+			res = FPGA_EXCEPTION;
+			break;
+		}
+	}
+
+	pthread_mutex_lock(&gate.lock);
+	if (started < threads)
+		gate.abort = 1;
+	else
+		gate.go = 1;
+	pthread_cond_broadcast(&gate.cond);
+	pthread_mutex_unlock(&gate.lock);
+
+	for (t = 0; t < started; ++t) {
+		pthread_join(workers[t].thread, NULL);
+		if (workers[t].res != FPGA_OK)
+			res = workers[t].res;
+	}
+
+	if (res == FPGA_OK)
+		res = report(test, workers, threads);
+
+out_free:
+	for (t = 0; t < threads; ++t)
+		free(workers[t].samples);
+	return res;
+}
+
+int main(int argc, char *argv[])
+{
+	fpga_token         accelerator_token;
+	fpga_handle        accelerator_handle;
+	fpga_guid          guid;
+	uint32_t           num_matches_accelerators = 0;
+	uint64_t           *mmio = NULL;
+	uint32_t           threads;
+	int                test;
+	fpga_result        res1 = FPGA_OK;
+	fpga_result        res2 = FPGA_OK;
+
+	res1 = parse_args(argc, argv);
+	ON_ERR_GOTO(res1, out_exit, "parsing arguments");
+
+	if (uuid_parse(NLB0_AFUID, guid) < 0)
+		res1 = FPGA_EXCEPTION;
+	ON_ERR_GOTO(res1, out_exit, "parsing guid");
+
+	res1 = find_fpga(guid, &accelerator_token, &num_matches_accelerators);
+	ON_ERR_GOTO(res1, out_exit, "finding FPGA accelerator");
+
+	if (num_matches_accelerators <= 0)
+		res1 = FPGA_NOT_FOUND;
+	ON_ERR_GOTO(res1, out_exit, "no matching accelerator");
+
+	/* shared, so that the threads may use the handle concurrently */
+	res1 = fpgaOpen(accelerator_token, &accelerator_handle,
+			FPGA_OPEN_SHARED);
+	ON_ERR_GOTO(res1, out_destroy_tok, "opening accelerator");
+
+	res1 = fpgaMapMMIO(accelerator_handle, 0, &mmio);
+	ON_ERR_GOTO(res1, out_close, "mapping MMIO space");
+
+	calibrate_ticks();
+	printf("%" PRIu64 " accesses per thread at offset 0x%" PRIx64
+	       ", latency in ns (%.3f ticks/ns)\n",
+	       config.iterations, config.offset, tick_rate);
+	print_header();
+
+	res1 = run_test(TIMER, accelerator_handle, (uint8_t *) mmio, 1);
+	ON_ERR_GOTO(res1, out_unmap, "timing the timer");
+
+	for (test = 0; test < TIMER; ++test) {
+		if (!(tests[test].mode & config.modes))
+			continue;
+
+		if ((test == API_WR512 || test == PTR_WR512) &&
+		    !config.offset_set) {
+			printf("%-16s skipped: needs --offset of a 64-byte "
+			       "scratch region\n", tests[test].name);
+			continue;
+		}
+
+		if (test == API_WR512 && config.offset % 64) {
+			printf("%-16s skipped: offset is not 64-byte aligned\n",
+			       tests[test].name);
+			continue;
+		}
+
+		if (test == PTR_WR512 &&
+		    (!have_avx512() || config.offset % 64)) {
+			printf("%-16s skipped: %s\n", tests[test].name,
+			       have_avx512() ? "offset is not 64-byte aligned" :
+			       "no AVX-512 support");
+			continue;
+		}
+
+		for (threads = 1; ; threads *= 2) {
+			if (threads > config.threads)
+				threads = config.threads;
+			res1 = run_test((enum access_test) test,
+					accelerator_handle, (uint8_t *) mmio,
+					threads);
+			ON_ERR_GOTO(res1, out_unmap, tests[test].name);
+			if (threads == config.threads)
+				break;
+		}
+	}
+
+	/* Unmap MMIO space */
+out_unmap:
+	res2 = fpgaUnmapMMIO(accelerator_handle, 0);
+	ON_ERR_GOTO(res2, out_close, "unmapping MMIO space");
+
+	/* Release accelerator */
+out_close:
+	res2 = fpgaClose(accelerator_handle);
+	ON_ERR_GOTO(res2, out_destroy_tok, "closing accelerator");
+
+	/* Destroy token */
+out_destroy_tok:
+	res2 = fpgaDestroyToken(&accelerator_token);
+	ON_ERR_GOTO(res2, out_exit, "destroying token");
+
+out_exit:
+	return res1 != FPGA_OK ? res1 : res2;
+}
@@ -0,0 +1,359 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file umsg_latency.c
+ * @brief Compares the host-side cost of the OPAE doorbell mechanisms.
+ *
+ * The sample times three ways of notifying an accelerator:
+ *
+ *  - fpgaTriggerUmsg(), which validates and locks the handle on every call
+ *  - fpgaRingUmsgDoorbell(), using a doorbell from fpgaGetUmsgDoorbell()
+ *  - fpgaWriteMMIO64() to an AFU CSR
+ *
+ * The doorbell is also rung concurrently from several threads, spread over
+ * several UMsg slots, to show its behavior with many producers.
+ *
+ * The sample requires a native loopback mode (NLB) test image to be loaded on
+ * the FPGA; the MMIO doorbell is written to the NLB scratchpad register.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <time.h>
+
+#include <uuid/uuid.h>
+#include <opae/fpga.h>
+
+/* NLB0 AFU_ID */
+#define NLB0_AFUID "D8424DC4-A4A3-C413-F89E-433683F9040B"
+
+#define CSR_SCRATCHPAD0 0x0100
+
+#define MAX_THREADS 64
+
+/*
+ * macro to check return codes, print error message, and goto cleanup label
+ * NOTE: this changes the program flow (uses goto)!
+ */
+#define ON_ERR_GOTO(res, label, desc)              \
+	do {                                       \
+		if ((res) != FPGA_OK) {            \
+			print_err((desc), (res));  \
+			goto label;                \
+		}                                  \
+	} while (0)
+
+void print_err(const char *s, fpga_result res)
+{
+	fprintf(stderr, "Error %s: %s\n", s, fpgaErrStr(res));
+}
+
+/*
+ * Global configuration, set during parse_args()
+ * */
+struct config {
+	struct target {
+		int bus;
+	} target;
+	int open_flags;
+	uint64_t iterations;
+	uint32_t threads;
+	int fence;
+}
+
+config = {
+	.target = {
+		.bus = -1,
+	},
+	.open_flags = 0,
+	.iterations = 1000000,
+	.threads = 4,
+	.fence = 0
+};
+
+#define GETOPT_STRING "B:si:t:f"
+fpga_result parse_args(int argc, char *argv[])
+{
+	struct option longopts[] = {
+		{ "bus",        required_argument, NULL, 'B' },
+		{ "shared",     no_argument,       NULL, 's' },
+		{ "iterations", required_argument, NULL, 'i' },
+		{ "threads",    required_argument, NULL, 't' },
+		{ "fence",      no_argument,       NULL, 'f' },
+		{ NULL,         0,                 NULL,  0  }
+	};
+
+	int getopt_ret;
+	int option_index;
+	char *endptr = NULL;
+
+	while (-1 != (getopt_ret = getopt_long(argc, argv, GETOPT_STRING,
+						longopts, &option_index))) {
+		const char *tmp_optarg = optarg;
+
+		if ((optarg) && ('=' == *tmp_optarg))
+			++tmp_optarg;
+
+		switch (getopt_ret) {
+		case 'B': /* bus */
+			if (NULL == tmp_optarg)
+				return FPGA_EXCEPTION;
+			endptr = NULL;
+			config.target.bus = (int) strtoul(tmp_optarg, &endptr, 0);
+			if (endptr != tmp_optarg + strnlen(tmp_optarg, 100)) {
+				fprintf(stderr, "invalid bus: %s\n", tmp_optarg);
+				return FPGA_EXCEPTION;
+			}
+			break;
+		case 's':
+			config.open_flags |= FPGA_OPEN_SHARED;
+			break;
+		case 'i':
+			if (NULL == tmp_optarg)
+				return FPGA_EXCEPTION;
+			endptr = NULL;
+			config.iterations = strtoull(tmp_optarg, &endptr, 0);
+			if (!config.iterations || *endptr) {
+				fprintf(stderr, "invalid iterations: %s\n",
+					tmp_optarg);
+				return FPGA_EXCEPTION;
+			}
+			break;
+		case 't':
+			if (NULL == tmp_optarg)
+				return FPGA_EXCEPTION;
+			endptr = NULL;
+			config.threads = (uint32_t) strtoul(tmp_optarg,
+							    &endptr, 0);
+			if (!config.threads || config.threads > MAX_THREADS ||
+			    *endptr) {
+				fprintf(stderr, "invalid threads: %s\n",
+					tmp_optarg);
+				return FPGA_EXCEPTION;
+			}
+			break;
+		case 'f':
+			config.fence = 1;
+			break;
+
+		default: /* invalid option */
+			fprintf(stderr, "Invalid cmdline option \n");
+			return FPGA_EXCEPTION;
+		}
+	}
+
+	return FPGA_OK;
+}
+
+fpga_result find_fpga(fpga_guid afu_guid,
+		      fpga_token *accelerator_token,
+		      uint32_t *num_matches_accelerators)
+{
+	fpga_properties filter = NULL;
+	fpga_result res1;
+	fpga_result res2 = FPGA_OK;
+
+	res1 = fpgaGetProperties(NULL, &filter);
+	ON_ERR_GOTO(res1, out, "creating properties object");
+
+	res1 = fpgaPropertiesSetObjectType(filter, FPGA_ACCELERATOR);
+	ON_ERR_GOTO(res1, out_destroy, "setting object type");
+
+	res1 = fpgaPropertiesSetGUID(filter, afu_guid);
+	ON_ERR_GOTO(res1, out_destroy, "setting GUID");
+
+	if (-1 != config.target.bus) {
+		res1 = fpgaPropertiesSetBus(filter, config.target.bus);
+		ON_ERR_GOTO(res1, out_destroy, "setting bus");
+	}
+
+	res1 = fpgaEnumerate(&filter, 1, accelerator_token, 1,
+			     num_matches_accelerators);
+	ON_ERR_GOTO(res1, out_destroy, "enumerating accelerators");
+
+out_destroy:
+	res2 = fpgaDestroyProperties(&filter);
+	ON_ERR_GOTO(res2, out, "destroying properties object");
+out:
+	return res1 != FPGA_OK ? res1 : res2;
+}
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void report(const char *what, uint64_t elapsed, uint64_t ops)
+{
+	printf("%-32s %10.1f ns/op  (%" PRIu64 " ops)\n",
+	       what, (double) elapsed / ops, ops);
+}
+
+struct producer {
+	pthread_t thread;
+	fpga_umsg_doorbell *doorbell;
+	uint64_t elapsed;
+};
+
+static void *producer_thread(void *arg)
+{
+	struct producer *p = (struct producer *) arg;
+	uint64_t i;
+	uint64_t start;
+
+	start = now_ns();
+	for (i = 0; i < config.iterations; ++i)
+		fpgaRingUmsgDoorbell(p->doorbell, i);
+	p->elapsed = now_ns() - start;
+
+	return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+	fpga_token         accelerator_token;
+	fpga_handle        accelerator_handle;
+	fpga_guid          guid;
+	uint32_t           num_matches_accelerators = 0;
+	uint64_t           num_umsg = 0;
+	uint64_t           i;
+	uint64_t           start;
+	uint32_t           t;
+	uint32_t           slots;
+	int                db_flags;
+	fpga_umsg_doorbell doorbell;
+	struct producer    producers[MAX_THREADS];
+	fpga_result        res1 = FPGA_OK;
+	fpga_result        res2 = FPGA_OK;
+
+	res1 = parse_args(argc, argv);
+	ON_ERR_GOTO(res1, out_exit, "parsing arguments");
+
+	if (uuid_parse(NLB0_AFUID, guid) < 0)
+		res1 = FPGA_EXCEPTION;
+	ON_ERR_GOTO(res1, out_exit, "parsing guid");
+
+	res1 = find_fpga(guid, &accelerator_token, &num_matches_accelerators);
+	ON_ERR_GOTO(res1, out_exit, "finding FPGA accelerator");
+
+	if (num_matches_accelerators <= 0)
+		res1 = FPGA_NOT_FOUND;
+	ON_ERR_GOTO(res1, out_exit, "no matching accelerator");
+
+	res1 = fpgaOpen(accelerator_token, &accelerator_handle,
+			config.open_flags);
+	ON_ERR_GOTO(res1, out_destroy_tok, "opening accelerator");
+
+	res1 = fpgaMapMMIO(accelerator_handle, 0, NULL);
+	ON_ERR_GOTO(res1, out_close, "mapping MMIO space");
+
+	res1 = fpgaGetNumUmsg(accelerator_handle, &num_umsg);
+	ON_ERR_GOTO(res1, out_unmap, "getting number of UMsgs");
+
+	res1 = fpgaSetUmsgAttributes(accelerator_handle, 0);
+	ON_ERR_GOTO(res1, out_unmap, "disabling UMsg hints");
+
+	db_flags = config.fence ? FPGA_UMSG_DOORBELL_FENCE : 0;
+
+	/* fpgaTriggerUmsg() */
+	res1 = fpgaTriggerUmsg(accelerator_handle, 0);
+	ON_ERR_GOTO(res1, out_unmap, "triggering UMsg");
+
+	start = now_ns();
+	for (i = 0; i < config.iterations; ++i)
+		fpgaTriggerUmsg(accelerator_handle, i);
+	report("fpgaTriggerUmsg", now_ns() - start, config.iterations);
+
+	/* single-slot doorbell */
+	res1 = fpgaGetUmsgDoorbell(accelerator_handle, 0, 1, db_flags,
+				   &doorbell);
+	ON_ERR_GOTO(res1, out_unmap, "getting UMsg doorbell");
+
+	start = now_ns();
+	for (i = 0; i < config.iterations; ++i)
+		fpgaRingUmsgDoorbell(&doorbell, i);
+	report("fpgaRingUmsgDoorbell", now_ns() - start, config.iterations);
+
+	/* MMIO doorbell */
+	start = now_ns();
+	for (i = 0; i < config.iterations; ++i)
+		fpgaWriteMMIO64(accelerator_handle, 0, CSR_SCRATCHPAD0, i);
+	report("fpgaWriteMMIO64", now_ns() - start, config.iterations);
+
+	/* many producers, one UMsg slot per thread where available */
+	slots = config.threads < num_umsg ?
+		config.threads : (uint32_t) num_umsg;
+	res1 = fpgaGetUmsgDoorbell(accelerator_handle, 0, slots, db_flags,
+				   &doorbell);
+	ON_ERR_GOTO(res1, out_unmap, "getting UMsg doorbell");
+
+	for (t = 0; t < config.threads; ++t) {
+		producers[t].doorbell = &doorbell;
+		producers[t].elapsed = 0;
+		if (pthread_create(&producers[t].thread, NULL,
+				   producer_thread, &producers[t])) {
+			res1 = FPGA_EXCEPTION;
+			break;
+		}
+	}
+
+	for (i = 0; i < t; ++i)
+		pthread_join(producers[i].thread, NULL);
+	ON_ERR_GOTO(res1, out_unmap, "creating producer threads");
+
+	for (start = 0, t = 0; t < config.threads; ++t)
+		start += producers[t].elapsed;
+	printf("%u threads over %u slots:\n", config.threads, slots);
+	report("  fpgaRingUmsgDoorbell", start / config.threads,
+	       config.iterations);
+
+	/* Unmap MMIO space */
+out_unmap:
+	res2 = fpgaUnmapMMIO(accelerator_handle, 0);
+	ON_ERR_GOTO(res2, out_close, "unmapping MMIO space");
+
+	/* Release accelerator */
+out_close:
+	res2 = fpgaClose(accelerator_handle);
+	ON_ERR_GOTO(res2, out_destroy_tok, "closing accelerator");
+
+	/* Destroy token */
+out_destroy_tok:
+	res2 = fpgaDestroyToken(&accelerator_token);
+	ON_ERR_GOTO(res2, out_exit, "destroying token");
+
+out_exit:
+	return res1 != FPGA_OK ? res1 : res2;
+}
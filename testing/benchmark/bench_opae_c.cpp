@@ -0,0 +1,311 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmarks for the libopae hot paths, run against the mock
+// sysfs/ioctl layer so that they need no hardware. Run from the build
+// directory (where the mock sysfs tarballs live), for example:
+//
+//   ./bin/bench_opae_c --benchmark_filter=MMIO
+//
+// The platform defaults to the first mock platform and can be chosen with
+// OPAE_BENCH_PLATFORM=<key>.
+
+#include <opae/fpga.h>
+#include <benchmark/benchmark.h>
+
+#include <cstdarg>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <linux/ioctl.h>
+
+#include "test_system.h"
+#include "fpga-dfl.h"
+#include "intel-fpga.h"
+
+using namespace opae::testing;
+
+static int mmio_ioctl(mock_object *m, int request, va_list argp) {
+  UNUSED_PARAM(m);
+  UNUSED_PARAM(request);
+  struct fpga_port_region_info *rinfo =
+      va_arg(argp, struct fpga_port_region_info *);
+  if (!rinfo || rinfo->argsz != sizeof(*rinfo) || rinfo->index > 1 ||
+      rinfo->padding != 0) {
+    errno = EINVAL;
+    return -1;
+  }
+  rinfo->flags = FPGA_REGION_READ | FPGA_REGION_WRITE | FPGA_REGION_MMAP;
+  rinfo->size = 0x40000;
+  rinfo->offset = 0;
+  errno = 0;
+  return 0;
+}
+
+namespace {
+
+const int max_tokens = 16;
+
+// Shared state set up once in main(), before any benchmark runs.
+struct bench_env {
+  fpga_properties accel_filter = nullptr;
+  fpga_properties device_filter = nullptr;
+  fpga_token accel_token = nullptr;
+  fpga_token device_token = nullptr;
+  fpga_handle accel = nullptr;
+  fpga_handle device = nullptr;
+  fpga_object ports_num = nullptr;
+} env;
+
+#define BENCH_CHECK(state, expr)                        \
+  do {                                                  \
+    fpga_result r_ = (expr);                            \
+    if (r_ != FPGA_OK) {                                \
+      (state).SkipWithError(#expr " failed");           \
+      return;                                           \
+    }                                                   \
+  } while (0)
+
+}  // end of anonymous namespace
+
+static void BM_Enumerate(benchmark::State &state) {
+  fpga_token tokens[max_tokens];
+  uint32_t matches = 0;
+  for (auto _ : state) {
+    BENCH_CHECK(state, fpgaEnumerate(&env.accel_filter, 1, tokens,
+                                     max_tokens, &matches));
+    for (uint32_t i = 0; i < matches && i < max_tokens; ++i) {
+      fpgaDestroyToken(&tokens[i]);
+    }
+  }
+}
+BENCHMARK(BM_Enumerate)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_GetProperties(benchmark::State &state) {
+  for (auto _ : state) {
+    fpga_properties props = nullptr;
+    BENCH_CHECK(state, fpgaGetProperties(env.accel_token, &props));
+    fpgaDestroyProperties(&props);
+  }
+}
+BENCHMARK(BM_GetProperties)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_UpdateProperties(benchmark::State &state) {
+  fpga_properties props = nullptr;
+  BENCH_CHECK(state, fpgaGetProperties(nullptr, &props));
+  for (auto _ : state) {
+    BENCH_CHECK(state, fpgaUpdateProperties(env.accel_token, props));
+  }
+  fpgaDestroyProperties(&props);
+}
+BENCHMARK(BM_UpdateProperties)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_OpenClose(benchmark::State &state) {
+  for (auto _ : state) {
+    fpga_handle h = nullptr;
+    BENCH_CHECK(state, fpgaOpen(env.accel_token, &h, FPGA_OPEN_SHARED));
+    BENCH_CHECK(state, fpgaClose(h));
+  }
+}
+BENCHMARK(BM_OpenClose)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_PrepareReleaseBuffer(benchmark::State &state) {
+  uint64_t len = static_cast<uint64_t>(state.range(0));
+  for (auto _ : state) {
+    void *buf = nullptr;
+    uint64_t wsid = 0;
+    BENCH_CHECK(state, fpgaPrepareBuffer(env.accel, len, &buf, &wsid, 0));
+    BENCH_CHECK(state, fpgaReleaseBuffer(env.accel, wsid));
+  }
+  state.SetBytesProcessed(state.iterations() * len);
+}
+BENCHMARK(BM_PrepareReleaseBuffer)->Arg(4096)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_ReadMMIO64(benchmark::State &state) {
+  uint64_t value = 0;
+  uint64_t offset = 8 * static_cast<uint64_t>(state.thread_index());
+  for (auto _ : state) {
+    BENCH_CHECK(state, fpgaReadMMIO64(env.accel, 0, offset, &value));
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(BM_ReadMMIO64)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_WriteMMIO64(benchmark::State &state) {
+  uint64_t offset = 0x1000 + 8 * static_cast<uint64_t>(state.thread_index());
+  uint64_t value = 0;
+  for (auto _ : state) {
+    BENCH_CHECK(state, fpgaWriteMMIO64(env.accel, 0, offset, value++));
+  }
+}
+BENCHMARK(BM_WriteMMIO64)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_WriteMMIO512(benchmark::State &state) {
+  alignas(64) uint64_t line[8] = {0};
+  uint64_t offset = 0x2000 + 64 * static_cast<uint64_t>(state.thread_index());
+  for (auto _ : state) {
+    line[0]++;
+    BENCH_CHECK(state, fpgaWriteMMIO512(env.accel, 0, offset, line));
+  }
+  state.SetBytesProcessed(state.iterations() * sizeof(line));
+}
+BENCHMARK(BM_WriteMMIO512)->ThreadRange(1, 8)->UseRealTime();
+
+// A 32-byte block, the size of a DMA descriptor.
+static void BM_WriteMMIOBlock(benchmark::State &state) {
+  uint64_t desc[4] = {0};
+  for (auto _ : state) {
+    desc[0]++;
+    BENCH_CHECK(state, fpgaWriteMMIOBlock(env.accel, 0, 0x3000, desc,
+                                          sizeof(desc)));
+  }
+  state.SetBytesProcessed(state.iterations() * sizeof(desc));
+}
+BENCHMARK(BM_WriteMMIOBlock);
+
+static void BM_ReadMMIO32(benchmark::State &state) {
+  uint32_t value = 0;
+  for (auto _ : state) {
+    BENCH_CHECK(state, fpgaReadMMIO32(env.accel, 0, 0, &value));
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(BM_ReadMMIO32);
+
+static void BM_ObjectRead64(benchmark::State &state) {
+  int flags = static_cast<int>(state.range(0));
+  uint64_t value = 0;
+  for (auto _ : state) {
+    BENCH_CHECK(state, fpgaObjectRead64(env.ports_num, &value, flags));
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(BM_ObjectRead64)
+    ->Arg(0)
+    ->Arg(FPGA_OBJECT_SYNC)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+static void BM_TokenGetObject(benchmark::State &state) {
+  for (auto _ : state) {
+    fpga_object obj = nullptr;
+    BENCH_CHECK(state, fpgaTokenGetObject(env.device_token, "ports_num",
+                                          &obj, 0));
+    fpgaDestroyObject(&obj);
+  }
+}
+BENCHMARK(BM_TokenGetObject)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_GetNumMetrics(benchmark::State &state) {
+  uint64_t num = 0;
+  for (auto _ : state) {
+    BENCH_CHECK(state, fpgaGetNumMetrics(env.device, &num));
+    benchmark::DoNotOptimize(num);
+  }
+}
+BENCHMARK(BM_GetNumMetrics);
+
+static void BM_GetMetricsInfo(benchmark::State &state) {
+  uint64_t num = 0;
+  BENCH_CHECK(state, fpgaGetNumMetrics(env.device, &num));
+  std::vector<fpga_metric_info> info(num);
+  for (auto _ : state) {
+    BENCH_CHECK(state, fpgaGetMetricsInfo(env.device, info.data(), &num));
+  }
+}
+BENCHMARK(BM_GetMetricsInfo);
+
+static bool enumerate_one(fpga_objtype type, uint16_t device_id,
+                          fpga_properties *filter, fpga_token *tok) {
+  uint32_t matches = 0;
+  return fpgaGetProperties(nullptr, filter) == FPGA_OK &&
+         fpgaPropertiesSetObjectType(*filter, type) == FPGA_OK &&
+         fpgaPropertiesSetDeviceID(*filter, device_id) == FPGA_OK &&
+         fpgaEnumerate(filter, 1, tok, 1, &matches) == FPGA_OK &&
+         matches > 0;
+}
+
+static bool setup(const std::string &key) {
+  if (!test_platform::exists(key)) {
+    std::cerr << "unknown mock platform: " << key << "\n";
+    return false;
+  }
+  auto platform = test_platform::get(key);
+  auto system = test_system::instance();
+  system->initialize();
+  system->prepare_syfs(platform);
+  system->register_ioctl_handler(FPGA_PORT_GET_REGION_INFO, mmio_ioctl);
+  system->register_ioctl_handler(DFL_FPGA_PORT_GET_REGION_INFO, mmio_ioctl);
+
+  uint64_t *mmio = nullptr;
+  uint16_t device_id =
+      static_cast<uint16_t>(platform.devices[0].device_id);
+  if (fpgaInitialize(nullptr) != FPGA_OK ||
+      !enumerate_one(FPGA_ACCELERATOR, device_id, &env.accel_filter,
+                     &env.accel_token) ||
+      !enumerate_one(FPGA_DEVICE, device_id, &env.device_filter,
+                     &env.device_token) ||
+      fpgaOpen(env.accel_token, &env.accel, FPGA_OPEN_SHARED) != FPGA_OK ||
+      fpgaOpen(env.device_token, &env.device, FPGA_OPEN_SHARED) != FPGA_OK ||
+      fpgaMapMMIO(env.accel, 0, &mmio) != FPGA_OK ||
+      fpgaTokenGetObject(env.device_token, "ports_num", &env.ports_num,
+                         0) != FPGA_OK) {
+    std::cerr << "failed to set up mock platform " << key << "\n";
+    return false;
+  }
+  return true;
+}
+
+static void teardown() {
+  if (env.ports_num) fpgaDestroyObject(&env.ports_num);
+  if (env.device) fpgaClose(env.device);
+  if (env.accel) fpgaClose(env.accel);
+  if (env.device_token) fpgaDestroyToken(&env.device_token);
+  if (env.accel_token) fpgaDestroyToken(&env.accel_token);
+  if (env.device_filter) fpgaDestroyProperties(&env.device_filter);
+  if (env.accel_filter) fpgaDestroyProperties(&env.accel_filter);
+  fpgaFinalize();
+  test_system::instance()->finalize();
+}
+
+int main(int argc, char **argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+
+  const char *key = getenv("OPAE_BENCH_PLATFORM");
+  std::string platform = key ? key : test_platform::mock_platforms()[0];
+  int res = 1;
+  if (setup(platform)) {
+    benchmark::RunSpecifiedBenchmarks();
+    res = 0;
+  }
+  teardown();
+  return res;
+}
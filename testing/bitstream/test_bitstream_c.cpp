@@ -43,6 +43,8 @@ fpga_result read_bitstream(const char *filename, opae_bitstream_info *info);
 #include <config.h>
 #include <opae/fpga.h>
 
+#include <fcntl.h>
+#include <sys/stat.h>
 #include <fstream>
 #include <vector>
 
@@ -266,6 +268,106 @@ TEST_P(bitstream_c_p, load_unload) {
   opae_unload_bitstream(&info);
 }
 
+/**
+ * @test       cache_load
+ * @brief      Test: opae_bitstream_cache_load
+ * @details    When a gbs file is loaded through the bitstream cache,<br>
+ *             loading it again returns the same bitstream info,<br>
+ *             as does loading a copy of it under another name.<br>
+ */
+TEST_P(bitstream_c_p, cache_load) {
+  opae_bitstream_cache *cache = nullptr;
+  const opae_bitstream_info *info1 = nullptr;
+  const opae_bitstream_info *info2 = nullptr;
+  char copy_gbs[20];
+
+  ASSERT_EQ(opae_bitstream_cache_create(&cache), FPGA_OK);
+  ASSERT_EQ(opae_bitstream_cache_load(cache, tmpnull_gbs_, &info1), FPGA_OK);
+  ASSERT_NE(info1, nullptr);
+  EXPECT_EQ(info1->data_len, null_gbs_.size() + 4096);
+  EXPECT_EQ(memcmp(info1->data, null_gbs_.data(), null_gbs_.size()), 0);
+
+  EXPECT_EQ(opae_bitstream_cache_load(cache, tmpnull_gbs_, &info2), FPGA_OK);
+  EXPECT_EQ(info1, info2);
+
+  strcpy(copy_gbs, "tmpcopy-XXXXXX.gbs");
+  close(mkstemps(copy_gbs, 4));
+  std::ifstream src(tmpnull_gbs_, std::ios::binary);
+  std::ofstream dst(copy_gbs, std::ios::binary);
+  dst << src.rdbuf();
+  dst.close();
+
+  info2 = nullptr;
+  EXPECT_EQ(opae_bitstream_cache_load(cache, copy_gbs, &info2), FPGA_OK);
+  EXPECT_EQ(info1, info2);
+  unlink(copy_gbs);
+
+  opae_bitstream_cache_destroy(cache);
+}
+
+/**
+ * @test       cache_load_copies
+ * @brief      Test: opae_bitstream_cache_load
+ * @details    When two files with the same content are loaded in turn,<br>
+ *             they share one bitstream info,<br>
+ *             and each keeps its own lookup key, so a file whose size<br>
+ *             and modification time are unchanged is not read again.<br>
+ */
+TEST_P(bitstream_c_p, cache_load_copies) {
+  opae_bitstream_cache *cache = nullptr;
+  const opae_bitstream_info *info1 = nullptr;
+  const opae_bitstream_info *info2 = nullptr;
+  struct stat st;
+  char copy_gbs[20];
+
+  strcpy(copy_gbs, "tmpcopy-XXXXXX.gbs");
+  close(mkstemps(copy_gbs, 4));
+  std::ifstream src(tmpnull_gbs_, std::ios::binary);
+  std::ofstream dst(copy_gbs, std::ios::binary);
+  dst << src.rdbuf();
+  dst.close();
+
+  ASSERT_EQ(opae_bitstream_cache_create(&cache), FPGA_OK);
+  ASSERT_EQ(opae_bitstream_cache_load(cache, tmpnull_gbs_, &info1), FPGA_OK);
+  ASSERT_EQ(opae_bitstream_cache_load(cache, copy_gbs, &info2), FPGA_OK);
+  EXPECT_EQ(info1, info2);
+
+  // Rewrite the first file in place, keeping its size and timestamp. Had
+  // loading the copy displaced its key, it would be reread here.
+  ASSERT_EQ(stat(tmpnull_gbs_, &st), 0);
+  std::fstream gbs(tmpnull_gbs_, std::ios::in|std::ios::out|std::ios::binary);
+  gbs.seekp(st.st_size - 1);
+  gbs.put('x');
+  gbs.close();
+  struct timespec times[2] = { st.st_atim, st.st_mtim };
+  ASSERT_EQ(utimensat(AT_FDCWD, tmpnull_gbs_, times, 0), 0);
+
+  info2 = nullptr;
+  EXPECT_EQ(opae_bitstream_cache_load(cache, tmpnull_gbs_, &info2), FPGA_OK);
+  EXPECT_EQ(info1, info2);
+
+  unlink(copy_gbs);
+  opae_bitstream_cache_destroy(cache);
+}
+
+/**
+ * @test       cache_load_err
+ * @brief      Test: opae_bitstream_cache_load
+ * @details    When the gbs file does not exist,<br>
+ *             opae_bitstream_cache_load returns FPGA_EXCEPTION.<br>
+ */
+TEST_P(bitstream_c_p, cache_load_err) {
+  opae_bitstream_cache *cache = nullptr;
+  const opae_bitstream_info *info = nullptr;
+
+  ASSERT_EQ(opae_bitstream_cache_create(&cache), FPGA_OK);
+  EXPECT_EQ(opae_bitstream_cache_load(cache, "/doesnt/exist", &info),
+            FPGA_EXCEPTION);
+  EXPECT_EQ(opae_bitstream_cache_load(nullptr, tmpnull_gbs_, &info),
+            FPGA_INVALID_PARAM);
+  opae_bitstream_cache_destroy(cache);
+}
+
 /**
  * @test       string_err
  * @brief      Test: string_to_guid
@@ -49,6 +49,7 @@ struct config {
     int socket;
   } target;
   char *filename;
+  bool all;
 };
 extern struct config config;
 
@@ -79,6 +80,8 @@ int print_interface_id(fpga_guid actual_interface_id);
 
 int find_fpga(fpga_guid interface_id, fpga_token *fpga);
 
+int program_all(struct bitstream_info *info, int *num_failed);
+
 int program_bitstream(fpga_token token, uint32_t slot_num,
                       struct bitstream_info *info, int flags);
 
@@ -130,6 +133,11 @@ fpga_guid test_guid = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
 #include <cstring>
 #include <errno.h>
 #include <unistd.h>
+#include <cstdarg>
+#include <mutex>
+#include <set>
+#include <linux/ioctl.h>
+#include "intel-fpga.h"
 using namespace opae::testing;
 
 class fpgaconf_c_p : public ::testing::TestWithParam<std::string> {
@@ -674,6 +682,44 @@ TEST_P(fpgaconf_c_p, main1) {
   EXPECT_EQ(fpgaconf_main(11, argv), 0);
 }
 
+/**
+ * @test       main_all
+ * @brief      Test: fpgaconf_main
+ * @details    When the command params are valid and include --all,<br>
+ *             fpgaconf_main loads the bitstream, programs every<br>
+ *             matching device, and returns 0.<br>
+ */
+TEST_P(fpgaconf_c_p, main_all) {
+  char zero[20];
+  char one[20];
+  char two[20];
+  char three[20];
+  strcpy(zero, "fpgaconf");
+  strcpy(one, "-n");
+  strcpy(two, "--all");
+  strcpy(three, tmp_gbs_);
+
+  char *argv[] = { zero, one, two, three };
+
+  EXPECT_EQ(fpgaconf_main(4, argv), 0);
+  EXPECT_TRUE(config.all);
+}
+
+/**
+ * @test       program_all0
+ * @brief      Test: program_all
+ * @details    When no device matches the interface id of the bitstream,<br>
+ *             program_all returns 0 and reports no failures.<br>
+ */
+TEST_P(fpgaconf_c_p, program_all0) {
+  struct bitstream_info info;
+  int num_failed = -1;
+  memset(&info, 0, sizeof(info));
+  memcpy(info.interface_id, test_guid, sizeof(fpga_guid));
+  EXPECT_EQ(program_all(&info, &num_failed), 0);
+  EXPECT_EQ(num_failed, 0);
+}
+
 /**
  * @test       main2
  * @brief      Test: fpgaconf_main
@@ -1267,9 +1313,59 @@ INSTANTIATE_TEST_CASE_P(fpgaconf_c, fpgaconf_c_p,
                         ::testing::ValuesIn(test_platform::platforms({"skx-p"})));
 
 
+static std::mutex pr_lock;
+static std::set<std::string> pr_devices;
+static std::string pr_fail;
+
+// Record which FPGA was programmed, failing the PR for pr_fail.
+static int fme_port_pr(mock_object *m, int request, va_list argp) {
+  UNUSED_PARAM(request);
+  auto pr = va_arg(argp, struct fpga_fme_port_pr *);
+  if (pr->argsz != sizeof(*pr)) {
+    errno = EINVAL;
+    return -1;
+  }
+  std::lock_guard<std::mutex> guard(pr_lock);
+  pr_devices.insert(m->sysclass());
+  if (m->sysclass() == pr_fail) {
+    errno = EIO;
+    return -1;
+  }
+  return 0;
+}
+
 class fpgaconf_c_mock_p : public fpgaconf_c_p{
   protected:
     fpgaconf_c_mock_p(){}
+
+  // Clone the FPGA at 0000:5e:00.0 as a second one at 0000:5f:00.0,
+  // and record the PR ioctls made to either of them.
+  void add_second_fpga() {
+    std::string root = system_->get_root();
+    std::string cmd = "cd " + root + " && "
+      "cp -a sys/devices/pci0000:5e/0000:5e:00.0 "
+            "sys/devices/pci0000:5e/0000:5f:00.0 && "
+      "(cd sys/devices/pci0000:5e/0000:5f:00.0/fpga && "
+      " mv intel-fpga-dev.0 intel-fpga-dev.1 && cd intel-fpga-dev.1 && "
+      " mv intel-fpga-fme.0 intel-fpga-fme.1 && "
+      " mv intel-fpga-port.0 intel-fpga-port.1 && "
+      " ln -sfn ../../../0000:5f:00.0 device && "
+      " echo 245:1 > intel-fpga-fme.1/dev && "
+      " echo 244:1 > intel-fpga-port.1/dev) && "
+      "ln -s ../../devices/pci0000:5e/0000:5f:00.0/fpga/intel-fpga-dev.1 "
+            "sys/class/fpga/intel-fpga-dev.1 && "
+      "cp dev/intel-fpga-fme.0 dev/intel-fpga-fme.1 && "
+      "cp dev/intel-fpga-port.0 dev/intel-fpga-port.1";
+    ASSERT_EQ(std::system(cmd.c_str()), 0);
+
+    // the plugin discovers devices when it is initialized
+    fpgaFinalize();
+    ASSERT_EQ(fpgaInitialize(NULL), FPGA_OK);
+
+    pr_devices.clear();
+    pr_fail.clear();
+    system_->register_ioctl_handler(FPGA_FME_PORT_PR, fme_port_pr);
+  }
 };
 
 /**
@@ -1418,6 +1514,64 @@ TEST_P(fpgaconf_c_mock_p, prog_bs2) {
   EXPECT_EQ(fpgaDestroyToken(&tok), FPGA_OK);
 }
 
+/**
+ * @test       program_all1
+ * @brief      Test: program_all
+ * @details    When two FPGAs match the interface id of the bitstream,<br>
+ *             program_all programs both of them,<br>
+ *             and returns 2 with no failures.<br>
+ */
+TEST_P(fpgaconf_c_mock_p, program_all1) {
+  add_second_fpga();
+
+  struct bitstream_info info;
+  ASSERT_EQ(read_bitstream(tmp_gbs_, &info), 0);
+
+  int num_failed = -1;
+  EXPECT_EQ(program_all(&info, &num_failed), 2);
+  EXPECT_EQ(num_failed, 0);
+  EXPECT_EQ(pr_devices, std::set<std::string>({
+                            "/sys/class/fpga/intel-fpga-dev.0",
+                            "/sys/class/fpga/intel-fpga-dev.1"}));
+
+  free(info.data);
+}
+
+/**
+ * @test       program_all2
+ * @brief      Test: program_all, fpgaconf_main
+ * @details    When two FPGAs match the interface id of the bitstream,<br>
+ *             and programming one of them fails,<br>
+ *             program_all still programs the other one,<br>
+ *             and reports one failure,<br>
+ *             and fpgaconf_main --all returns 5.<br>
+ */
+TEST_P(fpgaconf_c_mock_p, program_all2) {
+  add_second_fpga();
+  pr_fail = "/sys/class/fpga/intel-fpga-dev.1";
+
+  struct bitstream_info info;
+  ASSERT_EQ(read_bitstream(tmp_gbs_, &info), 0);
+
+  int num_failed = -1;
+  EXPECT_EQ(program_all(&info, &num_failed), 2);
+  EXPECT_EQ(num_failed, 1);
+  EXPECT_EQ(pr_devices.size(), 2);
+  free(info.data);
+
+  char zero[20];
+  char one[20];
+  char two[20];
+  strcpy(zero, "fpgaconf");
+  strcpy(one, "--all");
+  strcpy(two, tmp_gbs_);
+
+  char *argv[] = { zero, one, two };
+
+  optind = 0;
+  EXPECT_EQ(fpgaconf_main(3, argv), 5);
+}
+
 INSTANTIATE_TEST_CASE_P(fpgaconf_c, fpgaconf_c_mock_p,
                         ::testing::ValuesIn(test_platform::mock_platforms({"skx-p"})));
 
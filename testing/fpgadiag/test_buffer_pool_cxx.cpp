@@ -0,0 +1,217 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "buffer_pool.h"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <map>
+#include <thread>
+#include <vector>
+
+using namespace intel::fpga;
+using opae::fpga::types::shared_buffer;
+
+// The pool only looks at the address, size and IO address of the buffer it
+// carves up, so plain host memory stands in for a pinned buffer here.
+class buffer_pool_cxx : public ::testing::Test {
+ protected:
+  buffer_pool_cxx() : mem_(nullptr) {}
+
+  virtual void SetUp() override {
+    mem_ = static_cast<uint8_t *>(aligned_alloc(MB(2), MB(64)));
+    ASSERT_NE(mem_, nullptr);
+    parent_.reset(new split_buffer(nullptr, MB(64), mem_, 1, 0x40000000));
+    pool_.reset(new buffer_pool(parent_));
+  }
+
+  virtual void TearDown() override {
+    pool_.reset();
+    parent_.reset();
+    free(mem_);
+  }
+
+  uint8_t *mem_;
+  shared_buffer::ptr_t parent_;
+  buffer_pool::ptr_t pool_;
+};
+
+/**
+ * @test       alignment
+ * @brief      Test: buffer_pool::allocate_buffer
+ * @details    When allocate_buffer is called with a power-of-two
+ *             alignment,<br>
+ *             then both the virtual and the IO address of the buffer
+ *             are aligned to it,<br>
+ *             and the IO address is at the same offset into the pool
+ *             as the virtual address.<br>
+ */
+TEST_F(buffer_pool_cxx, alignment) {
+  std::vector<shared_buffer::ptr_t> buffers;
+  for (std::size_t align : {CL(1), KB(4), KB(64), MB(2)}) {
+    for (std::size_t size : {1, 100, KB(5)}) {
+      auto b = pool_->allocate_buffer(size, align);
+      ASSERT_NE(b, nullptr);
+      EXPECT_EQ(b->size(), size);
+      EXPECT_EQ(reinterpret_cast<uintptr_t>(b->c_type()) % align, 0);
+      EXPECT_EQ(b->io_address() % align, 0);
+      EXPECT_EQ(b->io_address() - parent_->io_address(),
+                static_cast<uint64_t>(b->c_type() - parent_->c_type()));
+      buffers.push_back(b);
+    }
+  }
+}
+
+/**
+ * @test       no_overlap
+ * @brief      Test: buffer_pool::allocate_buffer
+ * @details    When allocate_buffer is called until the pool is full,<br>
+ *             then every buffer lies within the parent buffer,<br>
+ *             and no two buffers overlap.<br>
+ */
+TEST_F(buffer_pool_cxx, no_overlap) {
+  std::vector<shared_buffer::ptr_t> buffers;
+  std::map<uintptr_t, std::size_t> ranges;
+  for (std::size_t i = 0;; ++i) {
+    auto b = pool_->allocate_buffer(100 + i * 4099, i % 3 ? CL(1) : MB(2));
+    if (!b) {
+      break;
+    }
+    ASSERT_GE(b->c_type(), parent_->c_type());
+    ASSERT_LE(b->c_type() + b->size(), parent_->c_type() + parent_->size());
+    ranges[reinterpret_cast<uintptr_t>(b->c_type())] = b->size();
+    buffers.push_back(b);
+  }
+  ASSERT_GT(buffers.size(), 1);
+  ASSERT_EQ(ranges.size(), buffers.size());
+
+  uintptr_t end = 0;
+  for (const auto &r : ranges) {
+    EXPECT_GE(r.first, end);
+    end = r.first + r.second;
+  }
+}
+
+/**
+ * @test       coalesce
+ * @brief      Test: buffer_pool::allocate_buffer, buffer_pool::get_stats
+ * @details    When every buffer allocated from the pool is released,<br>
+ *             then nothing is in use,<br>
+ *             and each arena has coalesced back into one free block,<br>
+ *             so an arena-sized buffer can be allocated again.<br>
+ */
+TEST_F(buffer_pool_cxx, coalesce) {
+  auto s = pool_->get_stats();
+  auto arena_size = s.largest_free;
+  ASSERT_EQ(s.total, MB(64));
+  ASSERT_GT(arena_size, 0);
+
+  std::vector<shared_buffer::ptr_t> buffers;
+  for (std::size_t i = 0; i < 1000; ++i) {
+    auto b = pool_->allocate_buffer(KB(1) * (1 + i % 37));
+    ASSERT_NE(b, nullptr);
+    buffers.push_back(b);
+  }
+  s = pool_->get_stats();
+  EXPECT_GT(s.in_use, 0);
+  EXPECT_EQ(s.allocations, 1000);
+
+  // release in an order that leaves holes until the very end
+  for (std::size_t i = 0; i < buffers.size(); i += 2) {
+    buffers[i].reset();
+  }
+  buffers.clear();
+
+  s = pool_->get_stats();
+  EXPECT_EQ(s.in_use, 0);
+  EXPECT_EQ(s.requested, 0);
+  EXPECT_EQ(s.largest_free, arena_size);
+  EXPECT_EQ(s.free(), s.total);
+  EXPECT_NE(pool_->allocate_buffer(arena_size), nullptr);
+}
+
+/**
+ * @test       concurrent
+ * @brief      Test: buffer_pool::allocate_buffer
+ * @details    When several threads allocate and release buffers at
+ *             the same time,<br>
+ *             then every allocation succeeds,<br>
+ *             and the pool is empty and fully coalesced afterwards.<br>
+ */
+TEST_F(buffer_pool_cxx, concurrent) {
+  auto arena_size = pool_->get_stats().largest_free;
+  std::vector<std::thread> threads;
+  std::vector<uint64_t> failed(8, 0);
+  for (std::size_t t = 0; t < failed.size(); ++t) {
+    threads.emplace_back([this, t, &failed] {
+      for (std::size_t i = 0; i < 1000; ++i) {
+        auto b = pool_->allocate_buffer(KB(4) * (1 + i % 7));
+        if (!b) {
+          failed[t]++;
+        }
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  for (auto f : failed) {
+    EXPECT_EQ(f, 0);
+  }
+  auto s = pool_->get_stats();
+  EXPECT_EQ(s.in_use, 0);
+  EXPECT_EQ(s.largest_free, arena_size);
+  EXPECT_EQ(s.allocations, 8000);
+}
+
+/**
+ * @test       invalid
+ * @brief      Test: buffer_pool::allocate_buffer
+ * @details    When allocate_buffer is called with a size of zero,<br>
+ *             an alignment that is not a power of two,<br>
+ *             or a size larger than any arena,<br>
+ *             then it returns a null pointer,<br>
+ *             and each call is counted as a failure.<br>
+ */
+TEST_F(buffer_pool_cxx, invalid) {
+  EXPECT_EQ(pool_->allocate_buffer(0), nullptr);
+  EXPECT_EQ(pool_->allocate_buffer(KB(4), 3 * CL(1)), nullptr);
+  EXPECT_EQ(pool_->allocate_buffer(MB(64)), nullptr);
+  EXPECT_EQ(pool_->get_stats().failures, 3);
+}
+
+/**
+ * @test       null_buffer
+ * @brief      Test: buffer_pool::buffer_pool
+ * @details    When a buffer_pool is constructed without a buffer,<br>
+ *             then allocate_buffer always returns a null pointer.<br>
+ */
+TEST(buffer_pool_cxx_null, null_buffer) {
+  buffer_pool pool(nullptr);
+  EXPECT_EQ(pool.allocate_buffer(KB(4)), nullptr);
+  EXPECT_EQ(pool.get_stats().total, 0);
+}
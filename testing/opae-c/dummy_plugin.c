@@ -165,6 +165,8 @@ int __attribute__((visibility("default"))) opae_plugin_configure(opae_api_adapte
 	adapter->fpgaReadMMIO64 = NULL;
 	adapter->fpgaWriteMMIO32 = NULL;
 	adapter->fpgaReadMMIO32 = NULL;
+	adapter->fpgaWriteMMIO512 = NULL;
+	adapter->fpgaWriteMMIOBlock = NULL;
 	adapter->fpgaMapMMIO = NULL;
 	adapter->fpgaUnmapMMIO = NULL;
 	adapter->fpgaCloneToken = NULL;
@@ -172,6 +174,7 @@ int __attribute__((visibility("default"))) opae_plugin_configure(opae_api_adapte
 	adapter->fpgaSetUmsgAttributes = NULL;
 	adapter->fpgaTriggerUmsg = NULL;
 	adapter->fpgaGetUmsgPtr = NULL;
+	adapter->fpgaGetUmsgDoorbell = NULL;
 	adapter->fpgaPrepareBuffer = NULL;
 	adapter->fpgaReleaseBuffer = NULL;
 	adapter->fpgaGetIOAddress = NULL;
@@ -181,6 +184,7 @@ int __attribute__((visibility("default"))) opae_plugin_configure(opae_api_adapte
 	*adapter->fpgaGetOPAECBuildString = NULL;
 	*/
 	adapter->fpgaReadError = NULL;
+	adapter->fpgaReadAllErrors = NULL;
 	adapter->fpgaClearError = NULL;
 	adapter->fpgaClearAllErrors = NULL;
 	adapter->fpgaGetErrorInfo = NULL;
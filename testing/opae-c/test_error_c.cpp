@@ -99,6 +99,34 @@ TEST_P(error_c_p, read) {
   EXPECT_EQ(val, 0);
 }
 
+/**
+ * @test       read_all
+ * @brief      Test: fpgaReadAllErrors
+ * @details    When fpgaReadAllErrors is called with a NULL values array,<br>
+ *             it returns the number of error registers.<br>
+ *             When called with an array, it retrieves the same values<br>
+ *             as fpgaReadError, and the fn returns FPGA_OK.<br>
+ */
+TEST_P(error_c_p, read_all) {
+  uint32_t num_errors = 0;
+  ASSERT_EQ(fpgaReadAllErrors(tokens_[0], nullptr, 0, &num_errors), FPGA_OK);
+  ASSERT_EQ(num_errors, platform_.devices[0].port_num_errors);
+
+  std::vector<uint64_t> values(num_errors, 0xdeadbeefdecafbad);
+  uint32_t n = 0;
+  ASSERT_EQ(fpgaReadAllErrors(tokens_[0], values.data(), num_errors, &n),
+            FPGA_OK);
+  EXPECT_EQ(n, num_errors);
+  for (uint32_t i = 0; i < num_errors; ++i) {
+    uint64_t val = 0;
+    EXPECT_EQ(fpgaReadError(tokens_[0], i, &val), FPGA_OK);
+    EXPECT_EQ(values[i], val);
+  }
+
+  EXPECT_EQ(fpgaReadAllErrors(tokens_[0], nullptr, 1, &n),
+            FPGA_INVALID_PARAM);
+}
+
 /**
  * @test       get_info
  * @brief      Test: fpgaGetErrorInfo
@@ -35,13 +35,20 @@ void opae_release(void);
 }
 
 #include <config.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include <opae/fpga.h>
 
 #include <array>
 #include <cstdlib>
+#include <fstream>
+#include <iterator>
 #include <map>
 #include <memory>
+#include <regex>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include "gtest/gtest.h"
 #include "test_system.h"
@@ -166,3 +173,146 @@ TEST(init, log_file) {
   unlink("opae_log.log");
 }
 
+
+static std::string read_log(const char *path) {
+  std::ifstream log(path);
+  return std::string(std::istreambuf_iterator<char>(log),
+                     std::istreambuf_iterator<char>());
+}
+
+/**
+ * @test       log_async
+ *
+ * @brief      When LIBOPAE_LOG_ASYNC is set, messages are queued and
+ *             written by the background logger. Each line is the message
+ *             the synchronous logger would have written, prefixed with
+ *             the time it was logged as "[sec.usec] ".
+ */
+TEST(init, log_async) {
+  ASSERT_EQ(0, putenv((char*)"LIBOPAE_LOG=1"));
+  ASSERT_EQ(0, putenv((char*)"LIBOPAE_LOG_ASYNC=1"));
+  ASSERT_EQ(0, putenv((char*)"LIBOPAE_LOGFILE=opae_async_log.log"));
+  opae_init();
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([t]() {
+      for (int i = 0; i < 8; ++i) {
+        OPAE_MSG("async %d/%d %s %5.2f 0x%lx %c%%", t, i, "str", 3.14159,
+                 0xabcUL, 'z');
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+  opae_release();
+
+  std::string log = read_log("opae_async_log.log");
+  EXPECT_NE(std::string::npos,
+            log.find("async 3/7 str  3.14 0xabc z%"));
+  const std::regex prefix("^\\[[0-9]+\\.[0-9]{6}\\] .*async [0-3]/[0-7] .*");
+  std::istringstream lines(log);
+  std::string line;
+  size_t count = 0;
+  while (std::getline(lines, line)) {
+    if (line.find("async ") != std::string::npos) {
+      EXPECT_TRUE(std::regex_match(line, prefix)) << line;
+      ++count;
+    }
+  }
+  EXPECT_EQ(32, count);
+
+  EXPECT_EQ(0, unsetenv("LIBOPAE_LOGFILE"));
+  EXPECT_EQ(0, unsetenv("LIBOPAE_LOG_ASYNC"));
+  EXPECT_EQ(0, unsetenv("LIBOPAE_LOG"));
+  unlink("opae_async_log.log");
+}
+
+static size_t count_of(const std::string &log, const std::string &msg) {
+  size_t count = 0;
+  for (size_t pos = log.find(msg); pos != std::string::npos;
+       pos = log.find(msg, pos + 1)) {
+    ++count;
+  }
+  return count;
+}
+
+/**
+ * @test       log_async_fork
+ *
+ * @brief      When a process using the asynchronous logger forks, the
+ *             child gets a logger thread of its own, so its messages
+ *             are written without an explicit flush, and releasing the
+ *             library in the child doesn't hang. Messages queued before
+ *             the fork are written exactly once.
+ */
+TEST(init, log_async_fork) {
+  ASSERT_EQ(0, putenv((char*)"LIBOPAE_LOG=1"));
+  ASSERT_EQ(0, putenv((char*)"LIBOPAE_LOG_ASYNC=1"));
+  ASSERT_EQ(0, putenv((char*)"LIBOPAE_LOGFILE=opae_async_fork.log"));
+  opae_init();
+
+  OPAE_MSG("before fork");
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (!pid) {
+    OPAE_MSG("child flushed by its logger");
+    usleep(200000);
+    std::string log = read_log("opae_async_fork.log");
+    OPAE_MSG("child flushed on release");
+    opae_release();
+    _exit(log.find("child flushed by its logger") == std::string::npos);
+  }
+
+  int status = 0;
+  ASSERT_EQ(pid, waitpid(pid, &status, 0));
+  EXPECT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(0, WEXITSTATUS(status));
+  opae_release();
+
+  std::string log = read_log("opae_async_fork.log");
+  EXPECT_EQ(1, count_of(log, "before fork"));
+  EXPECT_EQ(1, count_of(log, "child flushed by its logger"));
+  EXPECT_EQ(1, count_of(log, "child flushed on release"));
+
+  EXPECT_EQ(0, unsetenv("LIBOPAE_LOGFILE"));
+  EXPECT_EQ(0, unsetenv("LIBOPAE_LOG_ASYNC"));
+  EXPECT_EQ(0, unsetenv("LIBOPAE_LOG"));
+  unlink("opae_async_fork.log");
+}
+
+/**
+ * @test       log_async_rate
+ *
+ * @brief      When LIBOPAE_LOG_RATE is set, messages from a single
+ *             call site beyond that rate are suppressed.
+ */
+TEST(init, log_async_rate) {
+  ASSERT_EQ(0, putenv((char*)"LIBOPAE_LOG=1"));
+  ASSERT_EQ(0, putenv((char*)"LIBOPAE_LOG_ASYNC=1"));
+  ASSERT_EQ(0, putenv((char*)"LIBOPAE_LOG_RATE=5"));
+  ASSERT_EQ(0, putenv((char*)"LIBOPAE_LOGFILE=opae_async_rate.log"));
+  opae_init();
+
+  for (int i = 0; i < 100; ++i) {
+    OPAE_MSG("rate limited message %d", i);
+  }
+  opae_release();
+
+  std::string log = read_log("opae_async_rate.log");
+  size_t count = 0;
+  for (size_t pos = log.find("rate limited message");
+       pos != std::string::npos;
+       pos = log.find("rate limited message", pos + 1)) {
+    ++count;
+  }
+  EXPECT_GE(count, 5);
+  EXPECT_LE(count, 10);
+
+  EXPECT_EQ(0, unsetenv("LIBOPAE_LOGFILE"));
+  EXPECT_EQ(0, unsetenv("LIBOPAE_LOG_RATE"));
+  EXPECT_EQ(0, unsetenv("LIBOPAE_LOG_ASYNC"));
+  EXPECT_EQ(0, unsetenv("LIBOPAE_LOG"));
+  unlink("opae_async_rate.log");
+}
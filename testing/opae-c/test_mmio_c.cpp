@@ -177,5 +177,98 @@ TEST_P(mmio_c_p, mmio32) {
   EXPECT_EQ(val_written, val_read);
 }
 
+/**
+ * @test       mmio512
+ * @brief      Test: fpgaWriteMMIO512
+ * @details    Write 64 bytes with fpgaWriteMMIO512,<br>
+ *             read them back with fpgaReadMMIO64.<br>
+ *             Values written should equal values read.<br>
+ */
+TEST_P(mmio_c_p, mmio512) {
+  uint64_t val_written[8];
+  for (uint64_t i = 0; i < 8; ++i) {
+    val_written[i] = 0xdeadbeef00000000 | i;
+  }
+  EXPECT_EQ(fpgaWriteMMIO512(accel_, which_mmio_,
+                             CSR_SCRATCHPAD0, val_written), FPGA_OK);
+  for (uint64_t i = 0; i < 8; ++i) {
+    uint64_t val_read = 0;
+    EXPECT_EQ(fpgaReadMMIO64(accel_, which_mmio_,
+                             CSR_SCRATCHPAD0 + i * 8, &val_read), FPGA_OK);
+    EXPECT_EQ(val_written[i], val_read);
+  }
+}
+
+/**
+ * @test       mmio512_neg
+ * @brief      Test: fpgaWriteMMIO512
+ * @details    When the offset is not 64-byte aligned or the value is NULL,<br>
+ *             fpgaWriteMMIO512 returns FPGA_INVALID_PARAM.<br>
+ */
+TEST_P(mmio_c_p, mmio512_neg) {
+  uint64_t value[8] = {0};
+  EXPECT_EQ(fpgaWriteMMIO512(accel_, which_mmio_,
+                             CSR_SCRATCHPAD0 + 8, value), FPGA_INVALID_PARAM);
+  EXPECT_EQ(fpgaWriteMMIO512(accel_, which_mmio_,
+                             CSR_SCRATCHPAD0, nullptr), FPGA_INVALID_PARAM);
+}
+
+/**
+ * @test       mmio_block
+ * @brief      Test: fpgaWriteMMIOBlock
+ * @details    Write a block that starts and ends off a 64-byte boundary<br>
+ *             with fpgaWriteMMIOBlock, read it back with fpgaReadMMIO64.<br>
+ *             Values written should equal values read, and the<br>
+ *             neighboring registers are untouched.<br>
+ */
+TEST_P(mmio_c_p, mmio_block) {
+  const uint64_t base = CSR_SCRATCHPAD0 + 8;
+  std::array<uint64_t, 19> val_written;
+  for (size_t i = 0; i < val_written.size(); ++i) {
+    val_written[i] = 0xc0cac01a00000000 | i;
+  }
+  const uint64_t guard = 0x5a5a5a5a5a5a5a5a;
+  const uint64_t end = base + val_written.size() * 8;
+  EXPECT_EQ(fpgaWriteMMIO64(accel_, which_mmio_, base - 8, guard), FPGA_OK);
+  EXPECT_EQ(fpgaWriteMMIO64(accel_, which_mmio_, end, guard), FPGA_OK);
+
+  EXPECT_EQ(fpgaWriteMMIOBlock(accel_, which_mmio_, base, val_written.data(),
+                               val_written.size() * 8), FPGA_OK);
+  for (size_t i = 0; i < val_written.size(); ++i) {
+    uint64_t val_read = 0;
+    EXPECT_EQ(fpgaReadMMIO64(accel_, which_mmio_,
+                             base + i * 8, &val_read), FPGA_OK);
+    EXPECT_EQ(val_written[i], val_read);
+  }
+
+  uint64_t val_read = 0;
+  EXPECT_EQ(fpgaReadMMIO64(accel_, which_mmio_, base - 8, &val_read), FPGA_OK);
+  EXPECT_EQ(guard, val_read);
+  EXPECT_EQ(fpgaReadMMIO64(accel_, which_mmio_, end, &val_read), FPGA_OK);
+  EXPECT_EQ(guard, val_read);
+}
+
+/**
+ * @test       mmio_block_neg
+ * @brief      Test: fpgaWriteMMIOBlock
+ * @details    When the offset or length is not a multiple of 8,<br>
+ *             the source is NULL or the block runs past the end of<br>
+ *             the MMIO space, fpgaWriteMMIOBlock returns<br>
+ *             FPGA_INVALID_PARAM. An empty block is a no-op.<br>
+ */
+TEST_P(mmio_c_p, mmio_block_neg) {
+  uint64_t value[8] = {0};
+  EXPECT_EQ(fpgaWriteMMIOBlock(accel_, which_mmio_, CSR_SCRATCHPAD0 + 4,
+                               value, sizeof(value)), FPGA_INVALID_PARAM);
+  EXPECT_EQ(fpgaWriteMMIOBlock(accel_, which_mmio_, CSR_SCRATCHPAD0,
+                               value, 12), FPGA_INVALID_PARAM);
+  EXPECT_EQ(fpgaWriteMMIOBlock(accel_, which_mmio_, CSR_SCRATCHPAD0,
+                               nullptr, sizeof(value)), FPGA_INVALID_PARAM);
+  EXPECT_EQ(fpgaWriteMMIOBlock(accel_, which_mmio_, 0x40000 - 32,
+                               value, sizeof(value)), FPGA_INVALID_PARAM);
+  EXPECT_EQ(fpgaWriteMMIOBlock(accel_, which_mmio_, CSR_SCRATCHPAD0,
+                               value, 0), FPGA_OK);
+}
+
 INSTANTIATE_TEST_CASE_P(mmio_c, mmio_c_p,
                         ::testing::ValuesIn(test_platform::platforms({})));
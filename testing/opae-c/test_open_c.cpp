@@ -95,5 +95,40 @@ TEST_P(open_c_p, mallocfails) {
     EXPECT_EQ(accel_, nullptr);
 }
 
+/**
+ * @test       stale_handle
+ * @brief      Given a handle that has been closed,<br>
+ *             when it is passed to another API call,<br>
+ *             then the call fails with FPGA_INVALID_PARAM,<br>
+ *             even after its slot has been reused by a new handle.
+ */
+TEST_P(open_c_p, stale_handle) {
+    fpga_handle stale = nullptr;
+    ASSERT_EQ(fpgaOpen(tokens_[0], &stale, 0), FPGA_OK);
+    ASSERT_EQ(fpgaClose(stale), FPGA_OK);
+    EXPECT_EQ(fpgaReset(stale), FPGA_INVALID_PARAM);
+    EXPECT_EQ(fpgaClose(stale), FPGA_INVALID_PARAM);
+
+    ASSERT_EQ(fpgaOpen(tokens_[0], &accel_, 0), FPGA_OK);
+    EXPECT_NE(accel_, stale);
+    EXPECT_EQ(fpgaReset(stale), FPGA_INVALID_PARAM);
+    EXPECT_EQ(fpgaReset(accel_), FPGA_OK);
+    EXPECT_EQ(fpgaClose(accel_), FPGA_OK);
+}
+
+/**
+ * @test       stale_token
+ * @brief      Given a token that has been destroyed,<br>
+ *             when it is passed to fpgaOpen,<br>
+ *             then the call fails with FPGA_INVALID_PARAM.
+ */
+TEST_P(open_c_p, stale_token) {
+    fpga_token stale = tokens_[0];
+    ASSERT_EQ(fpgaDestroyToken(&tokens_[0]), FPGA_OK);
+    tokens_[0] = nullptr;
+    EXPECT_EQ(fpgaOpen(stale, &accel_, 0), FPGA_INVALID_PARAM);
+    EXPECT_EQ(fpgaDestroyToken(&stale), FPGA_INVALID_PARAM);
+}
+
 INSTANTIATE_TEST_CASE_P(open_c, open_c_p, 
                         ::testing::ValuesIn(test_platform::mock_platforms({})));
@@ -0,0 +1,231 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+extern "C" {
+
+#include <json-c/json.h>
+#include <uuid/uuid.h>
+#include "opae_int.h"
+
+}
+
+#include <opae/fpga.h>
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_system.h"
+
+using namespace opae::testing;
+
+class trace_c_p : public ::testing::TestWithParam<std::string> {
+ protected:
+  trace_c_p() : tokens_{{nullptr, nullptr}} {}
+
+  virtual void SetUp() override {
+    ASSERT_TRUE(test_platform::exists(GetParam()));
+    platform_ = test_platform::get(GetParam());
+    system_ = test_system::instance();
+    system_->initialize();
+    system_->prepare_syfs(platform_);
+
+    filter_ = nullptr;
+    ASSERT_EQ(fpgaInitialize(NULL), FPGA_OK);
+    ASSERT_EQ(fpgaGetProperties(nullptr, &filter_), FPGA_OK);
+    ASSERT_EQ(fpgaPropertiesSetObjectType(filter_, FPGA_ACCELERATOR), FPGA_OK);
+    num_matches_ = 0;
+    ASSERT_EQ(fpgaEnumerate(&filter_, 1, tokens_.data(), tokens_.size(),
+                            &num_matches_), FPGA_OK);
+    EXPECT_GT(num_matches_, 0);
+    accel_ = nullptr;
+    ASSERT_EQ(fpgaOpen(tokens_[0], &accel_, 0), FPGA_OK);
+    EXPECT_EQ(fpgaResetTraceStats(nullptr), FPGA_OK);
+  }
+
+  virtual void TearDown() override {
+    EXPECT_EQ(fpgaTraceEnable(false), FPGA_OK);
+    EXPECT_EQ(fpgaDestroyProperties(&filter_), FPGA_OK);
+    if (accel_) {
+        EXPECT_EQ(fpgaClose(accel_), FPGA_OK);
+        accel_ = nullptr;
+    }
+    for (auto &t : tokens_) {
+      if (t) {
+        EXPECT_EQ(fpgaDestroyToken(&t), FPGA_OK);
+        t = nullptr;
+      }
+    }
+    fpgaFinalize();
+    system_->finalize();
+  }
+
+  std::array<fpga_token, 2> tokens_;
+  fpga_properties filter_;
+  fpga_handle accel_;
+  test_platform platform_;
+  uint32_t num_matches_;
+  test_system *system_;
+};
+
+/**
+ * @test       disabled
+ * @brief      Given tracing is off,<br>
+ *             when calls are made through a handle,<br>
+ *             then nothing is recorded.
+ */
+TEST_P(trace_c_p, disabled) {
+  fpga_trace_stats stats;
+  EXPECT_EQ(fpgaReset(accel_), FPGA_OK);
+  EXPECT_EQ(fpgaGetTraceStats(accel_, "fpgaReset", &stats), FPGA_OK);
+  EXPECT_EQ(stats.count, 0);
+  EXPECT_EQ(fpgaGetTraceStats(nullptr, "fpgaReset", &stats), FPGA_OK);
+  EXPECT_EQ(stats.count, 0);
+}
+
+/**
+ * @test       handle_stats
+ * @brief      Given tracing is on,<br>
+ *             when calls are made through a handle,<br>
+ *             then they are counted against the handle and its plugin,<br>
+ *             and the percentiles lie between the extremes.
+ */
+TEST_P(trace_c_p, handle_stats) {
+  const uint64_t calls = 50;
+  fpga_trace_stats stats;
+  ASSERT_EQ(fpgaTraceEnable(true), FPGA_OK);
+  for (uint64_t i = 0; i < calls; ++i) {
+    EXPECT_EQ(fpgaReset(accel_), FPGA_OK);
+  }
+
+  ASSERT_EQ(fpgaGetTraceStats(accel_, "fpgaReset", &stats), FPGA_OK);
+  EXPECT_EQ(stats.count, calls);
+  EXPECT_EQ(stats.errors, 0);
+  EXPECT_LE(stats.min_ns, stats.p50_ns);
+  EXPECT_LE(stats.p50_ns, stats.p90_ns);
+  EXPECT_LE(stats.p90_ns, stats.p99_ns);
+  EXPECT_LE(stats.p99_ns, stats.p999_ns);
+  EXPECT_LE(stats.p999_ns, stats.max_ns);
+  EXPECT_GE(stats.total_ns, stats.max_ns);
+
+  ASSERT_EQ(fpgaGetTraceStats(nullptr, "fpgaReset", &stats), FPGA_OK);
+  EXPECT_EQ(stats.count, calls);
+
+  ASSERT_EQ(fpgaGetTraceStats(accel_, "fpgaReadMMIO64", &stats), FPGA_OK);
+  EXPECT_EQ(stats.count, 0);
+}
+
+/**
+ * @test       event_stats
+ * @brief      Given tracing is on,<br>
+ *             when events are registered and unregistered on a handle,<br>
+ *             then the calls are counted against the handle.
+ */
+TEST_P(trace_c_p, event_stats) {
+  fpga_event_handle eh = nullptr;
+  fpga_trace_stats stats;
+  ASSERT_EQ(fpgaCreateEventHandle(&eh), FPGA_OK);
+  ASSERT_EQ(fpgaTraceEnable(true), FPGA_OK);
+
+  auto res = fpgaRegisterEvent(accel_, FPGA_EVENT_ERROR, eh, 0);
+  ASSERT_EQ(fpgaGetTraceStats(accel_, "fpgaRegisterEvent", &stats), FPGA_OK);
+  EXPECT_EQ(stats.count, 1);
+  EXPECT_EQ(stats.errors, res == FPGA_OK ? 0 : 1);
+
+  if (res == FPGA_OK) {
+    EXPECT_EQ(fpgaUnregisterEvent(accel_, FPGA_EVENT_ERROR, eh), FPGA_OK);
+    ASSERT_EQ(fpgaGetTraceStats(accel_, "fpgaUnregisterEvent", &stats),
+              FPGA_OK);
+    EXPECT_EQ(stats.count, 1);
+  }
+  EXPECT_EQ(fpgaDestroyEventHandle(&eh), FPGA_OK);
+}
+
+/**
+ * @test       reset
+ * @brief      When fpgaResetTraceStats is called,<br>
+ *             then the recorded calls are discarded.
+ */
+TEST_P(trace_c_p, reset) {
+  fpga_trace_stats stats;
+  ASSERT_EQ(fpgaTraceEnable(true), FPGA_OK);
+  EXPECT_EQ(fpgaReset(accel_), FPGA_OK);
+
+  EXPECT_EQ(fpgaResetTraceStats(accel_), FPGA_OK);
+  ASSERT_EQ(fpgaGetTraceStats(accel_, "fpgaReset", &stats), FPGA_OK);
+  EXPECT_EQ(stats.count, 0);
+  ASSERT_EQ(fpgaGetTraceStats(nullptr, "fpgaReset", &stats), FPGA_OK);
+  EXPECT_EQ(stats.count, 1);
+
+  EXPECT_EQ(fpgaResetTraceStats(nullptr), FPGA_OK);
+  ASSERT_EQ(fpgaGetTraceStats(nullptr, "fpgaReset", &stats), FPGA_OK);
+  EXPECT_EQ(stats.count, 0);
+}
+
+/**
+ * @test       invalid
+ * @brief      When fpgaGetTraceStats is given an unknown API name,<br>
+ *             then it returns FPGA_NOT_FOUND,<br>
+ *             and NULL parameters give FPGA_INVALID_PARAM.
+ */
+TEST_P(trace_c_p, invalid) {
+  fpga_trace_stats stats;
+  EXPECT_EQ(fpgaGetTraceStats(accel_, "fpgaNoSuchCall", &stats),
+            FPGA_NOT_FOUND);
+  EXPECT_EQ(fpgaGetTraceStats(accel_, nullptr, &stats), FPGA_INVALID_PARAM);
+  EXPECT_EQ(fpgaGetTraceStats(accel_, "fpgaReset", nullptr),
+            FPGA_INVALID_PARAM);
+  EXPECT_EQ(fpgaDumpTraceStats(nullptr), FPGA_INVALID_PARAM);
+}
+
+/**
+ * @test       dump
+ * @brief      When fpgaDumpTraceStats is called,<br>
+ *             then each traced API appears in the output.
+ */
+TEST_P(trace_c_p, dump) {
+  char buf[4096] = { 0 };
+  ASSERT_EQ(fpgaTraceEnable(true), FPGA_OK);
+  EXPECT_EQ(fpgaReset(accel_), FPGA_OK);
+
+  FILE *fp = tmpfile();
+  ASSERT_NE(fp, nullptr);
+  EXPECT_EQ(fpgaDumpTraceStats(fp), FPGA_OK);
+  rewind(fp);
+  size_t len = fread(buf, 1, sizeof(buf) - 1, fp);
+  fclose(fp);
+
+  std::string out(buf, len);
+  EXPECT_NE(out.find("fpgaReset"), std::string::npos);
+  EXPECT_EQ(out.find("fpgaReadMMIO64"), std::string::npos);
+}
+
+INSTANTIATE_TEST_CASE_P(trace_c, trace_c_p,
+                        ::testing::ValuesIn(test_platform::platforms({})));
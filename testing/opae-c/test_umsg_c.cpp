@@ -35,6 +35,7 @@ extern "C" {
 #include <opae/fpga.h>
 #include "intel-fpga.h"
 #include <linux/ioctl.h>
+#include <unistd.h>
 
 #include <array>
 #include <cstdlib>
@@ -232,6 +233,45 @@ TEST_P(umsg_c_mock_p, get_ptr) {
   EXPECT_EQ(fpgaSetUmsgAttributes(dev_, disable), FPGA_OK);
 }
 
+/**
+ * @test       doorbell
+ * @brief      Test: fpgaGetUmsgDoorbell, fpgaRingUmsgDoorbell
+ * @details    When fpgaGetUmsgDoorbell is called with a valid slot range,<br>
+ *             then the fn returns FPGA_OK and the doorbell covers<br>
+ *             the requested slots of the UMsg buffer,<br>
+ *             and ringing it round-robins over those slots.<br>
+ *             When the slot range is empty or out of range,<br>
+ *             then the fn returns FPGA_INVALID_PARAM.<br>
+ *             Like get_ptr, the valid case needs the UMsg buffer,<br>
+ *             which is backed by hugepages.<br>
+ */
+TEST_P(umsg_c_mock_p, doorbell) {
+  uint64_t num = 0;
+  uint64_t *umsg_ptr = nullptr;
+  fpga_umsg_doorbell db;
+  ASSERT_EQ(fpgaGetNumUmsg(dev_, &num), FPGA_OK);
+
+  EXPECT_EQ(fpgaGetUmsgDoorbell(dev_, 0, 0, 0, &db), FPGA_INVALID_PARAM);
+  EXPECT_EQ(fpgaGetUmsgDoorbell(dev_, num, 1, 0, &db), FPGA_INVALID_PARAM);
+  EXPECT_EQ(fpgaGetUmsgDoorbell(dev_, 0, num + 1, 0, &db),
+            FPGA_INVALID_PARAM);
+  EXPECT_EQ(fpgaGetUmsgDoorbell(dev_, 0, 1, 0, nullptr), FPGA_INVALID_PARAM);
+
+  ASSERT_EQ(fpgaGetUmsgPtr(dev_, &umsg_ptr), FPGA_OK);
+
+  uint64_t stride = sysconf(_SC_PAGESIZE) / sizeof(uint64_t);
+  ASSERT_EQ(fpgaGetUmsgDoorbell(dev_, 1, 2, FPGA_UMSG_DOORBELL_FENCE, &db),
+            FPGA_OK);
+  EXPECT_EQ(db.base, umsg_ptr + stride);
+  EXPECT_EQ(db.num_slots, 2);
+
+  fpgaRingUmsgDoorbell(&db, 0xa);
+  fpgaRingUmsgDoorbell(&db, 0xb);
+  fpgaRingUmsgDoorbell(&db, 0xc);
+  EXPECT_EQ(umsg_ptr[stride], 0xc);
+  EXPECT_EQ(umsg_ptr[2 * stride], 0xb);
+}
+
 INSTANTIATE_TEST_CASE_P(umsg_c, umsg_c_mock_p, 
                         ::testing::ValuesIn(test_platform::mock_platforms({ "skx-p"})));
 
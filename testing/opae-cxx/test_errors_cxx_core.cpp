@@ -90,6 +90,26 @@ TEST_P(errors_cxx_core, get_error) {
   }
 }
 
+/**
+ * @test snapshot
+ * Given an OPAE resource token<br>
+ * When I call error::snapshot() with that token<br>
+ * Then I get one value per error register
+ * And each value matches what error::read_value() returns
+ */
+TEST_P(errors_cxx_core, snapshot) {
+  for (auto &t : tokens_) {
+    auto props = properties::get(t);
+    ASSERT_NE(props, nullptr);
+    auto snap = error::snapshot(t);
+    ASSERT_EQ(snap.values.size(), static_cast<uint32_t>(props->num_errors));
+    for (uint32_t i = 0; i < snap.values.size(); ++i) {
+      EXPECT_EQ(snap.values[i], error::get(t, i)->read_value());
+    }
+  }
+  ASSERT_THROW(error::snapshot(nullptr), std::invalid_argument);
+}
+
 /**
  * @test get_errors
  * Given an OPAE resource token<br>
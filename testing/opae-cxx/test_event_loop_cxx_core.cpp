@@ -0,0 +1,270 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_system.h"
+#include "fpgad_control.h"
+#include <opae/cxx/core/event_loop.h>
+#include <opae/cxx/core/events.h>
+#include <opae/cxx/core/token.h>
+#include <opae/cxx/core/handle.h>
+#include <opae/cxx/core/properties.h>
+
+using namespace opae::testing;
+using namespace opae::fpga::types;
+using std::chrono::milliseconds;
+
+static void signal_fd(int fd) {
+  uint64_t one = 1;
+  ASSERT_EQ(write(fd, &one, sizeof(one)), (ssize_t)sizeof(one));
+}
+
+/**
+ * @test signaled
+ * Given an event_loop and an eventfd<br>
+ * When I wait on the fd and then signal it<br>
+ * Then run_once completes the wait with status::signaled<br>
+ * And the wait is no longer outstanding<br>
+ */
+TEST(event_loop_cxx_core, signaled) {
+  auto loop = event_loop::create();
+  int fd = eventfd(0, EFD_NONBLOCK);
+  ASSERT_GE(fd, 0);
+
+  event_loop::status result = event_loop::status::cancelled;
+  int calls = 0;
+  loop->async_wait(fd, [&](event_loop::status s) {
+    result = s;
+    ++calls;
+  });
+  EXPECT_EQ(loop->size(), 1);
+
+  signal_fd(fd);
+  while (calls == 0) {
+    loop->run_once(milliseconds(100));
+  }
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(result, event_loop::status::signaled);
+  EXPECT_EQ(loop->size(), 0);
+  close(fd);
+}
+
+/**
+ * @test timeout
+ * Given an event_loop and an eventfd that is never signaled<br>
+ * When I wait on the fd with a timeout<br>
+ * Then the wait completes with status::timeout<br>
+ * And not before the timeout expired<br>
+ */
+TEST(event_loop_cxx_core, timeout) {
+  auto loop = event_loop::create();
+  int fd = eventfd(0, EFD_NONBLOCK);
+  ASSERT_GE(fd, 0);
+
+  loop->start();
+  auto begin = std::chrono::steady_clock::now();
+  auto f = std::make_shared<std::promise<event_loop::status>>();
+  loop->async_wait(fd, [f](event_loop::status s) { f->set_value(s); },
+                   milliseconds(20));
+  auto fut = f->get_future();
+  ASSERT_EQ(fut.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+  EXPECT_EQ(fut.get(), event_loop::status::timeout);
+  EXPECT_GE(std::chrono::steady_clock::now() - begin, milliseconds(20));
+  loop->stop();
+  close(fd);
+}
+
+/**
+ * @test cancel
+ * Given an outstanding wait on an event_loop<br>
+ * When I cancel it<br>
+ * Then its callback sees status::cancelled<br>
+ * And cancelling it again returns false<br>
+ */
+TEST(event_loop_cxx_core, cancel) {
+  auto loop = event_loop::create();
+  int fd = eventfd(0, EFD_NONBLOCK);
+  ASSERT_GE(fd, 0);
+
+  event_loop::status result = event_loop::status::signaled;
+  auto id = loop->async_wait(fd, [&](event_loop::status s) { result = s; });
+  EXPECT_TRUE(loop->cancel(id));
+  EXPECT_EQ(result, event_loop::status::cancelled);
+  EXPECT_FALSE(loop->cancel(id));
+  EXPECT_EQ(loop->size(), 0);
+  close(fd);
+}
+
+/**
+ * @test many_fds
+ * Given an event_loop running in the background<br>
+ * When I wait on a thousand eventfds, with two waits on each<br>
+ * And signal all of them from another thread<br>
+ * Then every wait completes exactly once with status::signaled<br>
+ */
+TEST(event_loop_cxx_core, many_fds) {
+  const int count = 1000;
+  auto loop = event_loop::create();
+  std::vector<int> fds;
+  std::atomic<int> signaled(0);
+  std::atomic<int> other(0);
+  for (int i = 0; i < count; ++i) {
+    int fd = eventfd(0, EFD_NONBLOCK);
+    ASSERT_GE(fd, 0);
+    fds.push_back(fd);
+    for (int j = 0; j < 2; ++j) {
+      loop->async_wait(fd, [&](event_loop::status s) {
+        if (s == event_loop::status::signaled) {
+          ++signaled;
+        } else {
+          ++other;
+        }
+      }, milliseconds(10000));
+    }
+  }
+  EXPECT_EQ(loop->size(), 2 * count);
+
+  loop->start();
+  std::thread t([&fds]() {
+    for (auto fd : fds) {
+      signal_fd(fd);
+    }
+  });
+  t.join();
+
+  auto begin = std::chrono::steady_clock::now();
+  while (signaled < 2 * count &&
+         std::chrono::steady_clock::now() - begin < std::chrono::seconds(5)) {
+    std::this_thread::sleep_for(milliseconds(1));
+  }
+  loop->stop();
+  EXPECT_EQ(signaled, 2 * count);
+  EXPECT_EQ(other, 0);
+  EXPECT_EQ(loop->size(), 0);
+  for (auto fd : fds) {
+    close(fd);
+  }
+}
+
+/**
+ * @test destroy_cancels
+ * Given an event_loop with an outstanding wait<br>
+ * When the event_loop is destroyed<br>
+ * Then the wait's callback sees status::cancelled<br>
+ */
+TEST(event_loop_cxx_core, destroy_cancels) {
+  int fd = eventfd(0, EFD_NONBLOCK);
+  ASSERT_GE(fd, 0);
+  event_loop::status result = event_loop::status::signaled;
+  {
+    auto loop = event_loop::create();
+    loop->async_wait(fd, [&](event_loop::status s) { result = s; });
+  }
+  EXPECT_EQ(result, event_loop::status::cancelled);
+  close(fd);
+}
+
+/**
+ * @test invalid
+ * Given an event_loop<br>
+ * When I wait on a null event or a negative file descriptor<br>
+ * Then std::invalid_argument is thrown<br>
+ */
+TEST(event_loop_cxx_core, invalid) {
+  auto loop = event_loop::create();
+  EXPECT_THROW(loop->wait(nullptr), std::invalid_argument);
+  EXPECT_THROW(loop->async_wait(-1, [](event_loop::status) {}),
+               std::invalid_argument);
+  EXPECT_EQ(loop->size(), 0);
+}
+
+class event_loop_cxx_core_p : public ::testing::TestWithParam<std::string>,
+                              public fpgad_control {
+ protected:
+  event_loop_cxx_core_p() : handle_(nullptr) {}
+
+  virtual void SetUp() override {
+    ASSERT_TRUE(test_platform::exists(GetParam()));
+    platform_ = test_platform::get(GetParam());
+    system_ = test_system::instance();
+    system_->initialize();
+    system_->prepare_syfs(platform_);
+
+    ASSERT_EQ(fpgaInitialize(nullptr), FPGA_OK);
+
+    properties::ptr_t props = properties::get(FPGA_ACCELERATOR);
+    props->device_id = platform_.devices[0].device_id;
+
+    tokens_ = token::enumerate({props});
+    ASSERT_TRUE(tokens_.size() > 0);
+
+    handle_ = handle::open(tokens_[0], 0);
+    ASSERT_NE(nullptr, handle_.get());
+
+    fpgad_start();
+  }
+
+  virtual void TearDown() override {
+    fpgad_stop();
+    handle_.reset();
+    ASSERT_NO_THROW(tokens_.clear());
+    fpgaFinalize();
+    system_->finalize();
+  }
+
+  std::vector<token::ptr_t> tokens_;
+  handle::ptr_t handle_;
+  test_platform platform_;
+  test_system *system_;
+};
+
+/**
+ * @test error_event_future
+ * Given an error event registered on an open accelerator<br>
+ * And an event_loop running in the background<br>
+ * When I wait on the event through a future with a timeout<br>
+ * And no error occurs<br>
+ * Then the future holds status::timeout<br>
+ */
+TEST_P(event_loop_cxx_core_p, error_event_future) {
+  event::ptr_t ev;
+  ASSERT_NO_THROW(ev = event::register_event(handle_, FPGA_EVENT_ERROR));
+  auto loop = event_loop::create();
+  loop->start();
+  auto fut = loop->wait(ev, milliseconds(10));
+  ASSERT_EQ(fut.wait_for(std::chrono::seconds(2)), std::future_status::ready);
+  EXPECT_EQ(fut.get(), event_loop::status::timeout);
+  loop->stop();
+}
+
+INSTANTIATE_TEST_CASE_P(event_loop, event_loop_cxx_core_p,
+                        ::testing::ValuesIn(test_platform::keys(true)));
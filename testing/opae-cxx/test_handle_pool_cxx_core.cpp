@@ -0,0 +1,239 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <opae/cxx/core/handle_pool.h>
+#include <opae/cxx/core/properties.h>
+#include <opae/cxx/core/token.h>
+#include "gtest/gtest.h"
+#include "test_system.h"
+
+#include <linux/ioctl.h>
+#include <cstdarg>
+#include "fpga-dfl.h"
+#include "intel-fpga.h"
+
+using namespace opae::testing;
+using namespace opae::fpga::types;
+
+static int mmio_ioctl(mock_object *m, int request, va_list argp) {
+  int retval = -1;
+  errno = EINVAL;
+  UNUSED_PARAM(m);
+  UNUSED_PARAM(request);
+  struct fpga_port_region_info *rinfo =
+      va_arg(argp, struct fpga_port_region_info *);
+  if (!rinfo) {
+    FPGA_MSG("rinfo is NULL");
+    goto out_EINVAL;
+  }
+  if (rinfo->argsz != sizeof(*rinfo)) {
+    FPGA_MSG("wrong structure size");
+    goto out_EINVAL;
+  }
+  if (rinfo->index > 1) {
+    FPGA_MSG("unsupported MMIO index");
+    goto out_EINVAL;
+  }
+  if (rinfo->padding != 0) {
+    FPGA_MSG("unsupported padding");
+    goto out_EINVAL;
+  }
+  rinfo->flags = FPGA_REGION_READ | FPGA_REGION_WRITE | FPGA_REGION_MMAP;
+  rinfo->size = 0x40000;
+  rinfo->offset = 0;
+  retval = 0;
+  errno = 0;
+out:
+  return retval;
+
+out_EINVAL:
+  retval = -1;
+  errno = EINVAL;
+  goto out;
+}
+
+class handle_pool_cxx_core : public ::testing::TestWithParam<std::string> {
+ protected:
+  handle_pool_cxx_core() {}
+
+  virtual void SetUp() override {
+    ASSERT_TRUE(test_platform::exists(GetParam()));
+    platform_ = test_platform::get(GetParam());
+    system_ = test_system::instance();
+    system_->initialize();
+    system_->prepare_syfs(platform_);
+
+    ASSERT_EQ(fpgaInitialize(nullptr), FPGA_OK);
+
+    tokens_ = token::enumerate({properties::get(FPGA_ACCELERATOR)});
+    ASSERT_TRUE(tokens_.size() > 0);
+
+    system_->register_ioctl_handler(FPGA_PORT_GET_REGION_INFO, mmio_ioctl);
+    system_->register_ioctl_handler(DFL_FPGA_PORT_GET_REGION_INFO, mmio_ioctl);
+  }
+
+  virtual void TearDown() override {
+    tokens_.clear();
+    fpgaFinalize();
+    system_->finalize();
+  }
+
+  std::vector<token::ptr_t> tokens_;
+  test_platform platform_;
+  test_system *system_;
+};
+
+/**
+ * @test reuse
+ * Given a handle_pool<br>
+ * When I acquire a lease on an accelerator and release it<br>
+ * And acquire the same accelerator again from a fresh enumeration<br>
+ * Then I get the same, still open, handle back<br>
+ * And the pool counts one miss and one hit<br>
+ */
+TEST_P(handle_pool_cxx_core, reuse) {
+  auto pool = handle_pool::create();
+  fpga_handle first = nullptr;
+  {
+    auto l = pool->acquire(tokens_[0]);
+    ASSERT_TRUE(static_cast<bool>(l));
+    first = l->c_type();
+    ASSERT_NE(nullptr, first);
+  }
+  EXPECT_EQ(pool->idle(), 1);
+
+  auto tokens = token::enumerate({properties::get(FPGA_ACCELERATOR)});
+  ASSERT_GT(tokens.size(), 0);
+  auto l = pool->acquire(tokens[0]);
+  EXPECT_EQ(l->c_type(), first);
+  EXPECT_EQ(pool->idle(), 0);
+  EXPECT_NO_THROW(l->read_csr64(0));
+
+  auto stats = pool->get_stats();
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.hits, 1);
+}
+
+/**
+ * @test concurrent_leases
+ * Given a handle_pool<br>
+ * When I hold two shared leases on the same accelerator at once<br>
+ * Then they use different handles<br>
+ * And both handles are pooled once the leases are released<br>
+ * And an exclusive acquire closes the idle shared handles first<br>
+ * And a shared acquire closes the idle exclusive handle first<br>
+ */
+TEST_P(handle_pool_cxx_core, concurrent_leases) {
+  auto pool = handle_pool::create();
+  {
+    auto a = pool->acquire(tokens_[0], FPGA_OPEN_SHARED);
+    auto b = pool->acquire(tokens_[0], FPGA_OPEN_SHARED);
+    EXPECT_NE(a->c_type(), b->c_type());
+  }
+  EXPECT_EQ(pool->idle(), 2);
+
+  // a different flags value is a different pool entry, and an exclusive
+  // open can't succeed while the shared handles are still open
+  {
+    auto c = pool->acquire(tokens_[0], 0);
+    EXPECT_EQ(pool->idle(), 0);
+    EXPECT_EQ(pool->get_stats().misses, 3);
+    EXPECT_EQ(pool->get_stats().discarded, 2);
+  }
+  EXPECT_EQ(pool->idle(), 1);
+
+  auto d = pool->acquire(tokens_[0], FPGA_OPEN_SHARED);
+  EXPECT_EQ(pool->idle(), 0);
+  EXPECT_EQ(pool->get_stats().misses, 4);
+  EXPECT_EQ(pool->get_stats().discarded, 3);
+}
+
+/**
+ * @test max_idle
+ * Given a handle_pool that keeps one idle handle per resource<br>
+ * When I release two leases on the same accelerator<br>
+ * Then one handle is kept and the other is closed<br>
+ */
+TEST_P(handle_pool_cxx_core, max_idle) {
+  auto pool = handle_pool::create(1);
+  {
+    auto a = pool->acquire(tokens_[0], FPGA_OPEN_SHARED);
+    auto b = pool->acquire(tokens_[0], FPGA_OPEN_SHARED);
+  }
+  EXPECT_EQ(pool->idle(), 1);
+  EXPECT_EQ(pool->get_stats().discarded, 1);
+}
+
+/**
+ * @test release_and_move
+ * Given a lease on an accelerator<br>
+ * When I move it to another lease and call release()<br>
+ * Then the moved-from lease is empty<br>
+ * And the handle is back in the pool<br>
+ * And clear() closes it<br>
+ */
+TEST_P(handle_pool_cxx_core, release_and_move) {
+  auto pool = handle_pool::create();
+  auto a = pool->acquire(tokens_[0]);
+  handle_pool::lease b(std::move(a));
+  EXPECT_FALSE(static_cast<bool>(a));
+  ASSERT_TRUE(static_cast<bool>(b));
+  b.release();
+  EXPECT_FALSE(static_cast<bool>(b));
+  EXPECT_EQ(pool->idle(), 1);
+  pool->clear();
+  EXPECT_EQ(pool->idle(), 0);
+}
+
+/**
+ * @test closed_handle
+ * Given a lease on an accelerator<br>
+ * When the leased handle is closed before the lease is released<br>
+ * Then the handle is not returned to the pool<br>
+ */
+TEST_P(handle_pool_cxx_core, closed_handle) {
+  auto pool = handle_pool::create();
+  {
+    auto l = pool->acquire(tokens_[0]);
+    EXPECT_EQ(l->close(), FPGA_OK);
+  }
+  EXPECT_EQ(pool->idle(), 0);
+  EXPECT_EQ(pool->get_stats().discarded, 1);
+}
+
+/**
+ * @test null_token
+ * Given a handle_pool<br>
+ * When I acquire a lease with a null token<br>
+ * Then std::invalid_argument is thrown<br>
+ */
+TEST_P(handle_pool_cxx_core, null_token) {
+  auto pool = handle_pool::create();
+  EXPECT_THROW(pool->acquire(nullptr), std::invalid_argument);
+}
+
+INSTANTIATE_TEST_CASE_P(handle_pool, handle_pool_cxx_core,
+                        ::testing::ValuesIn(test_platform::keys(true)));
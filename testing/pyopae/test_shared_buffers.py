@@ -25,6 +25,13 @@
 # POSSIBILITY OF SUCH DAMAGE.
 import struct
 import sys
+import threading
+import time
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
 
 # pylint: disable=E0602, E0603
 
@@ -84,3 +91,69 @@ class TestSharedBuffer(unittest.TestCase):
         assert buff.size() == 0
         assert buff.wsid() == 0
 
+
+    def test_poll_releases_gil(self):
+        with opae.fpga.open(self.toks[0]) as h:
+            buff = opae.fpga.allocate_shared_buffer(h, 4096)
+            buff.fill(0)
+
+            def writer():
+                time.sleep(0.01)
+                buff.write64(0xc0c0cafe, 64)
+
+            thr = threading.Thread(target=writer)
+            thr.start()
+            assert buff.poll64(64, 0xc0c0cafe, 0, timeout_usec=5000000)
+            thr.join()
+
+    def test_poll_backoff(self):
+        backoff = opae.fpga.poll_backoff(spin_count=8, yield_count=2,
+                                         max_sleep_usec=50)
+        assert backoff.spin_count == 8
+        assert backoff.yield_count == 2
+        assert backoff.max_sleep_usec == 50
+        default = opae.fpga.get_poll_backoff()
+        opae.fpga.set_poll_backoff(backoff)
+        assert opae.fpga.get_poll_backoff().spin_count == 8
+        opae.fpga.set_poll_backoff(default)
+        with opae.fpga.open(self.toks[0]) as h:
+            buff = opae.fpga.allocate_shared_buffer(h, 4096)
+            buff.fill(0)
+            assert not buff.poll32(0, 1, timeout_usec=2000, backoff=backoff)
+            buff.write32(1, 0)
+            assert buff.poll32(0, 1, timeout_usec=2000, backoff=backoff)
+
+    @unittest.skipIf(numpy is None, "numpy is not available")
+    def test_array_view(self):
+        with opae.fpga.open(self.toks[0]) as h:
+            buff = opae.fpga.allocate_shared_buffer(h, 4096)
+            buff.fill(0)
+            arr = buff.array(numpy.uint64)
+            assert arr.dtype == numpy.uint64
+            assert arr.shape == (512,)
+            arr[1] = 0xdecafbad
+            assert buff.read64(8) == 0xdecafbad
+            buff.write32(0x1234, 64)
+            view = buff.array('uint32', offset=64, shape=(4, 4))
+            assert view.shape == (4, 4)
+            assert view[0][0] == 0x1234
+            col = buff.array('uint32', offset=64, shape=(4,), strides=(16,))
+            assert list(col) == list(view[:, 0])
+            with self.assertRaises(ValueError):
+                buff.array('uint64', offset=4088, shape=(2,))
+            # extents that wrap around must not pass the size check
+            with self.assertRaises(ValueError):
+                buff.array('uint64', shape=(5,), strides=(2**62,))
+            with self.assertRaises(ValueError):
+                buff.array('uint8', shape=(2**40, 2**40, 2**40))
+
+    @unittest.skipIf(numpy is None, "numpy is not available")
+    def test_csr_block(self):
+        with opae.fpga.open(self.toks[0]) as h:
+            values = numpy.arange(0x100, 0x108, dtype=numpy.uint64)
+            h.write_csr_block(0x100, values)
+            for i in range(8):
+                assert h.read_csr64(0x100 + i * 8) == 0x100 + i
+            block = h.read_csr_block(0x100, 8)
+            assert block.dtype == numpy.uint64
+            assert (block == values).all()
@@ -32,8 +32,11 @@ extern "C" {
 
 #include <opae/error.h>
 #include <props.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <fstream>
 #include <string>
+#include <vector>
 #include "gtest/gtest.h"
 #include "test_system.h"
 #include "types_int.h"
@@ -118,11 +121,7 @@ class error_c_mock_p : public ::testing::TestWithParam<std::string> {
   }
 
   void free_error_list(struct error_list *p) {
-    while (p) {
-      struct error_list *q = p->next;
-      free(p);
-      p = q;
-    }
+    ::free_error_list(p);
   }
 
   fpga_properties filter_;
@@ -596,6 +595,60 @@ TEST_P(error_c_mock_p, error_12) {
   EXPECT_EQ(FPGA_INVALID_PARAM, xfpga_fpgaClearAllErrors(parent));
 }
 
+/**
+ * @test       error_14
+ * @brief      When passed a valid PORT token,
+ *             xfpga_fpgaReadAllErrors() returns the same values as
+ *             xfpga_fpgaReadError(), honors max_values, sees
+ *             updates to the error registers on subsequent calls,
+ *             and reopens a cached descriptor that fails to read.
+ */
+TEST_P(error_c_mock_p, error_14) {
+  fpga_token t = &fake_port_token_;
+  uint32_t n = 0;
+
+  std::string errpath = sysfs_port + "/errors";
+  build_error_list(errpath.c_str(), &fake_port_token_.errors);
+
+  ASSERT_EQ(FPGA_OK, xfpga_fpgaReadAllErrors(t, nullptr, 0, &n));
+  ASSERT_GT(n, 1);
+
+  std::vector<uint64_t> values(n);
+  uint32_t total = 0;
+  ASSERT_EQ(FPGA_OK, xfpga_fpgaReadAllErrors(t, values.data(), n, &total));
+  EXPECT_EQ(total, n);
+  for (uint32_t i = 0; i < n; i++) {
+    uint64_t val = 0;
+    EXPECT_EQ(FPGA_OK, xfpga_fpgaReadError(t, i, &val));
+    EXPECT_EQ(values[i], val);
+  }
+
+  // values are read through cached fds; make sure they aren't stale
+  ASSERT_EQ(FPGA_OK, sysfs_write_u64(fake_port_token_.errors->error_file,
+                                     0x42));
+  values.assign(n, 0);
+  ASSERT_EQ(FPGA_OK, xfpga_fpgaReadAllErrors(t, values.data(), 1, &total));
+  EXPECT_EQ(total, n);
+  EXPECT_EQ(values[0], 0x42);
+  EXPECT_EQ(values[1], 0);
+
+  // a descriptor that can no longer be read is replaced
+  int bad = open("/dev/null", O_WRONLY);
+  ASSERT_GE(bad, 0);
+  close(fake_port_token_.errors->fd);
+  fake_port_token_.errors->fd = bad;
+  values.assign(n, 0);
+  ASSERT_EQ(FPGA_OK, xfpga_fpgaReadAllErrors(t, values.data(), 1, &total));
+  EXPECT_EQ(values[0], 0x42);
+  ASSERT_EQ(FPGA_OK, xfpga_fpgaReadAllErrors(t, values.data(), 1, &total));
+  EXPECT_EQ(values[0], 0x42);
+
+  EXPECT_EQ(FPGA_INVALID_PARAM, xfpga_fpgaReadAllErrors(t, nullptr, 1, &n));
+  fake_port_token_.magic = FPGA_INVALID_MAGIC;
+  EXPECT_EQ(FPGA_INVALID_PARAM,
+            xfpga_fpgaReadAllErrors(t, values.data(), n, &total));
+}
+
 INSTANTIATE_TEST_CASE_P(error_c, error_c_mock_p,
                         ::testing::ValuesIn(test_platform::mock_platforms({ "skx-p","dcp-rc" })));
 
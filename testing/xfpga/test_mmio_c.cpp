@@ -34,6 +34,7 @@
 #include <opae/mmio.h>
 #include <sys/mman.h>
 #include <cstdarg>
+#include <cstring>
 #include <linux/ioctl.h>
 
 #include "xfpga.h"
@@ -47,6 +48,7 @@
 extern "C" {
 int xfpga_plugin_initialize(void);
 int xfpga_plugin_finalize(void);
+void mmio_copy(volatile uint8_t *dst, const uint8_t *src, size_t len);
 }
 
 using namespace opae::testing;
@@ -413,4 +415,131 @@ TEST_P (mmio_c_p, test_neg_read_write_64) {
 }
 
 
+/**
+* @test       mmio_c_p
+* @brief      Test: test_mmio_write_512
+* @details    When the parameters are valid and the drivers are loaded:
+*             xfpga_fpgaWriteMMIO512 must write 64 bytes at the given
+*             MMIO offset. It must fail for an offset that is not 64-byte
+*             aligned, an out-of-region offset and a NULL value.
+*
+*/
+TEST_P (mmio_c_p, test_mmio_write_512) {
+  uint64_t* mmio_ptr = NULL;
+  uint64_t value[8];
+
+  for (uint64_t i = 0; i < 8; ++i) {
+    value[i] = 0x0123456789abcdef + i;
+  }
+
+#ifndef BUILD_ASE
+  EXPECT_EQ(FPGA_OK, xfpga_fpgaMapMMIO(handle_, 0, &mmio_ptr));
+  EXPECT_NE(mmio_ptr,nullptr);
+#endif
+
+  EXPECT_EQ(FPGA_OK, xfpga_fpgaWriteMMIO512(handle_, 0, CSR_SCRATCHPAD0, value));
+  for (uint64_t i = 0; i < 8; ++i) {
+    uint64_t read_value = 0;
+    EXPECT_EQ(FPGA_OK, xfpga_fpgaReadMMIO64(handle_, 0, CSR_SCRATCHPAD0 + i * 8,
+                                            &read_value));
+    EXPECT_EQ(value[i], read_value);
+  }
+
+  EXPECT_EQ(FPGA_INVALID_PARAM,
+            xfpga_fpgaWriteMMIO512(handle_, 0, CSR_SCRATCHPAD0 + 32, value));
+  EXPECT_EQ(FPGA_INVALID_PARAM,
+            xfpga_fpgaWriteMMIO512(handle_, 0, MMIO_OUT_REGION_ADDRESS, value));
+  EXPECT_EQ(FPGA_INVALID_PARAM,
+            xfpga_fpgaWriteMMIO512(handle_, 0, CSR_SCRATCHPAD0, nullptr));
+  EXPECT_EQ(FPGA_INVALID_PARAM,
+            xfpga_fpgaWriteMMIO512(NULL, 0, CSR_SCRATCHPAD0, value));
+
+#ifndef BUILD_ASE
+  EXPECT_EQ(FPGA_OK, xfpga_fpgaUnmapMMIO(handle_, 0));
+#endif
+}
+
+/**
+* @test       mmio_c_p
+* @brief      Test: test_mmio_write_block
+* @details    When the parameters are valid and the drivers are loaded:
+*             xfpga_fpgaWriteMMIOBlock must write the whole block at the
+*             given MMIO offset. It must fail for a misaligned offset or
+*             length, and for a block that runs past the end of the region.
+*
+*/
+TEST_P (mmio_c_p, test_mmio_write_block) {
+  uint64_t* mmio_ptr = NULL;
+  uint64_t value[24];
+
+  for (uint64_t i = 0; i < 24; ++i) {
+    value[i] = 0xfeedf00d00000000 | i;
+  }
+
+#ifndef BUILD_ASE
+  EXPECT_EQ(FPGA_OK, xfpga_fpgaMapMMIO(handle_, 0, &mmio_ptr));
+  EXPECT_NE(mmio_ptr,nullptr);
+#endif
+
+  EXPECT_EQ(FPGA_OK, xfpga_fpgaWriteMMIOBlock(handle_, 0, CSR_SCRATCHPAD0 + 24,
+                                              value, sizeof(value)));
+  for (uint64_t i = 0; i < 24; ++i) {
+    uint64_t read_value = 0;
+    EXPECT_EQ(FPGA_OK, xfpga_fpgaReadMMIO64(handle_, 0,
+                                            CSR_SCRATCHPAD0 + 24 + i * 8,
+                                            &read_value));
+    EXPECT_EQ(value[i], read_value);
+  }
+
+  EXPECT_EQ(FPGA_INVALID_PARAM,
+            xfpga_fpgaWriteMMIOBlock(handle_, 0, CSR_SCRATCHPAD0 + 1,
+                                     value, sizeof(value)));
+  EXPECT_EQ(FPGA_INVALID_PARAM,
+            xfpga_fpgaWriteMMIOBlock(handle_, 0, CSR_SCRATCHPAD0, value, 20));
+  EXPECT_EQ(FPGA_INVALID_PARAM,
+            xfpga_fpgaWriteMMIOBlock(handle_, 0, 0x40000 - 64,
+                                     value, sizeof(value)));
+  EXPECT_EQ(FPGA_INVALID_PARAM,
+            xfpga_fpgaWriteMMIOBlock(handle_, 0, CSR_SCRATCHPAD0,
+                                     value, ~(size_t)7));
+
+#ifndef BUILD_ASE
+  EXPECT_EQ(FPGA_OK, xfpga_fpgaUnmapMMIO(handle_, 0));
+#endif
+}
+
+
 INSTANTIATE_TEST_CASE_P(mmio_c, mmio_c_p, ::testing::ValuesIn(test_platform::keys(true)));
+
+/**
+* @test       mmio_copy
+* @brief      Test: mmio_copy
+* @details    For every 8-byte aligned destination within a cache line and
+*             a range of lengths, mmio_copy copies exactly the requested
+*             bytes, whichever store widths the CPU supports.
+*
+*/
+TEST(mmio_copy, alignments) {
+  alignas(64) uint8_t dst[512];
+  uint8_t src[256 + 8];
+
+  for (size_t i = 0; i < sizeof(src); ++i) {
+    src[i] = static_cast<uint8_t>(i * 7 + 1);
+  }
+
+  for (size_t off = 0; off < 64; off += 8) {
+    for (size_t len = 0; len <= 256; len += 8) {
+      memset(dst, 0xa5, sizeof(dst));
+      // an unaligned source must work, too
+      mmio_copy(dst + off, src + 4, len);
+      EXPECT_EQ(0, memcmp(dst + off, src + 4, len))
+          << "offset " << off << " length " << len;
+      for (size_t i = 0; i < off; ++i) {
+        ASSERT_EQ(0xa5, dst[i]);
+      }
+      for (size_t i = off + len; i < sizeof(dst); ++i) {
+        ASSERT_EQ(0xa5, dst[i]);
+      }
+    }
+  }
+}
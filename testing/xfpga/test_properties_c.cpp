@@ -25,6 +25,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 #include <opae/fpga.h>
 #include <algorithm>
+#include <fstream>
 #include "gtest/gtest.h"
 #include "test_system.h"
 #include "types_int.h"
@@ -35,7 +36,7 @@
 extern "C" {
 int xfpga_plugin_initialize(void);
 int xfpga_plugin_finalize(void);
-
+void token_invalidate_props(void);
 }
 using namespace opae::testing;
 
@@ -214,6 +215,49 @@ TEST_P(properties_c_p, valid_gets) {
   EXPECT_EQ(objtype, FPGA_DEVICE);
 }
 
+/**
+ * @test       cached_guid
+ *
+ * @brief      When the AFU GUID changes in sysfs after the properties
+ *             of its token have been read, as it does when another
+ *             process reprograms the slot, the next update returns the
+ *             new GUID, and enumerating by the new GUID finds the token
+ *             with properties that agree.
+ */
+TEST_P(properties_c_p, cached_guid) {
+  fpga_guid first, second;
+  auto _token = static_cast<_fpga_token *>(tokens_accel_[0]);
+
+  ASSERT_EQ(xfpga_fpgaGetProperties(tokens_accel_[0], &prop_), FPGA_OK);
+  ASSERT_EQ(fpgaPropertiesGetGUID(prop_, &first), FPGA_OK);
+
+  std::string afu_id = system_->get_sysfs_path(
+      std::string(_token->sysfspath) + "/" + FPGA_SYSFS_AFU_GUID);
+  std::ofstream(afu_id) << "00000000000000000000000000000001" << std::endl;
+
+  ASSERT_EQ(xfpga_fpgaUpdateProperties(tokens_accel_[0], prop_), FPGA_OK);
+  ASSERT_EQ(fpgaPropertiesGetGUID(prop_, &second), FPGA_OK);
+  EXPECT_NE(memcmp(first, second, sizeof(fpga_guid)), 0);
+  EXPECT_EQ(second[15], 1);
+
+  fpga_token tok = nullptr;
+  uint32_t matches = 0;
+  ASSERT_EQ(fpgaClearProperties(filter_accel_), FPGA_OK);
+  ASSERT_EQ(fpgaPropertiesSetObjectType(filter_accel_, FPGA_ACCELERATOR),
+            FPGA_OK);
+  ASSERT_EQ(fpgaPropertiesSetGUID(filter_accel_, second), FPGA_OK);
+  ASSERT_EQ(xfpga_fpgaEnumerate(&filter_accel_, 1, &tok, 1, &matches),
+            FPGA_OK);
+  ASSERT_EQ(matches, 1);
+
+  fpga_properties props = nullptr;
+  ASSERT_EQ(xfpga_fpgaGetProperties(tok, &props), FPGA_OK);
+  ASSERT_EQ(fpgaPropertiesGetGUID(props, &first), FPGA_OK);
+  EXPECT_EQ(memcmp(first, second, sizeof(fpga_guid)), 0);
+  EXPECT_EQ(fpgaDestroyProperties(&props), FPGA_OK);
+  EXPECT_EQ(xfpga_fpgaDestroyToken(&tok), FPGA_OK);
+}
+
 INSTANTIATE_TEST_CASE_P(properties_c, properties_c_p,
                         ::testing::ValuesIn(test_platform::keys(true)));
 
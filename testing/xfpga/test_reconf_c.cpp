@@ -26,6 +26,7 @@
 #include "gtest/gtest.h"
 #include "test_system.h"
 #include "test_utils.h"
+#include <unistd.h>
 
 extern "C" {
 #include <bitstream_int.h>
@@ -41,10 +42,12 @@ extern "C" {
 }
 
 extern "C" {
-fpga_result open_accel(fpga_handle handle, fpga_handle *accel);
+fpga_result open_accel(fpga_handle handle, int *accel_fd);
 fpga_result clear_port_errors(fpga_handle handle);
 fpga_result validate_bitstream(fpga_handle, const uint8_t *bitstream, 
                                size_t bitstream_len, int *header_len);
+bool lookup_gbs_metadata(const uint8_t *bitstream, size_t bitstream_len,
+                         int *header_len, struct gbs_metadata *metadata);
 int xfpga_plugin_initialize(void);
 int xfpga_plugin_finalize(void);
 }
@@ -291,19 +294,24 @@ TEST_P(reconf_c, fpga_reconf_slot) {
 */
 TEST_P(reconf_c, open_accel_01) {
   fpga_result result;
-  fpga_handle accel = nullptr;
+  int accel_fd = -1;
 
   ASSERT_EQ(FPGA_OK, xfpga_fpgaOpen(tokens_[0], &handle_, 0));
 
   // Null handle
-  result = open_accel(NULL, &accel);
+  result = open_accel(NULL, &accel_fd);
+  EXPECT_EQ(result, FPGA_INVALID_PARAM);
+
+  // Null output
+  result = open_accel(handle_, NULL);
   EXPECT_EQ(result, FPGA_INVALID_PARAM);
 
   // Valid handle
-  result = open_accel(handle_, &accel);
+  result = open_accel(handle_, &accel_fd);
   EXPECT_EQ(result, FPGA_OK);
+  ASSERT_GE(accel_fd, 0);
 
-  EXPECT_EQ(xfpga_fpgaClose(accel), FPGA_OK);
+  EXPECT_EQ(close(accel_fd), 0);
 
   // Invalid object type
   struct _fpga_handle *handle = (struct _fpga_handle *)handle_;
@@ -311,7 +319,7 @@ TEST_P(reconf_c, open_accel_01) {
 
   handle->token = NULL;
 
-  result = open_accel(handle_, &accel);
+  result = open_accel(handle_, &accel_fd);
   EXPECT_EQ(result, FPGA_INVALID_PARAM);
 
   handle->token = token;
@@ -327,7 +335,7 @@ TEST_P(reconf_c, open_accel_02) {
   fpga_properties filter_accel = nullptr;
   std::array<fpga_token, 2> tokens_accel = {{nullptr,nullptr}};
   fpga_handle handle_accel = nullptr;
-  fpga_handle accel = nullptr;
+  int accel_fd = -1;
   uint32_t num_matches_accel;
 
   ASSERT_EQ(FPGA_OK, xfpga_fpgaOpen(tokens_[0], &handle_, 0));
@@ -342,10 +350,10 @@ TEST_P(reconf_c, open_accel_02) {
 
   EXPECT_NE(handle_, nullptr);
   EXPECT_NE(handle_accel, nullptr);
-  auto result = open_accel(handle_accel, &accel);
+  auto result = open_accel(handle_accel, &accel_fd);
   EXPECT_EQ(result, FPGA_BUSY);
 
-  EXPECT_EQ(accel, nullptr);
+  EXPECT_EQ(accel_fd, -1);
   EXPECT_EQ(fpgaDestroyProperties(&filter_accel), FPGA_OK);
   EXPECT_EQ(xfpga_fpgaClose(handle_accel), FPGA_OK);
   for (auto &t : tokens_accel) {
@@ -376,6 +384,25 @@ TEST_P(reconf_c, validate_bitstream) {
   EXPECT_EQ(FPGA_EXCEPTION, result);
 }
 
+/**
+* @test    open_accel
+* @brief   Tests: open_accel_03
+* @details An FME handle resolves its port device at open time,
+*          and open_accel returns FPGA_BUSY when it has none.
+*/
+TEST_P(reconf_c, open_accel_03) {
+  int accel_fd = -1;
+
+  ASSERT_EQ(FPGA_OK, xfpga_fpgaOpen(tokens_[0], &handle_, 0));
+
+  struct _fpga_handle *handle = (struct _fpga_handle *)handle_;
+  EXPECT_NE(strstr(handle->port_devpath, "/dev/"), nullptr);
+
+  handle->port_devpath[0] = '\0';
+  EXPECT_EQ(open_accel(handle_, &accel_fd), FPGA_BUSY);
+  EXPECT_EQ(accel_fd, -1);
+}
+
 INSTANTIATE_TEST_CASE_P(reconf, reconf_c,
                         ::testing::ValuesIn(test_platform::platforms({})));
 
@@ -477,6 +504,36 @@ TEST_P(reconf_c_mock_p, fpga_reconf_slot) {
   EXPECT_EQ(result, FPGA_OK);
 }
 
+/**
+ * @test    fpga_reconf_slot_cached
+ * @brief   Tests: fpgaReconfigureSlot
+ * @details When a bitstream has been programmed once,<br>
+ *          its validated metadata is remembered,<br>
+ *          and programming it again returns FPGA_OK.<br>
+ *          A bitstream with different metadata is not found.<br>
+ */
+TEST_P(reconf_c_mock_p, fpga_reconf_slot_cached) {
+  struct gbs_metadata metadata;
+  int header_len = 0;
+
+  ASSERT_EQ(xfpga_fpgaReconfigureSlot(handle_, 0, bitstream_valid_.data(),
+                                      bitstream_valid_.size(), 0), FPGA_OK);
+  EXPECT_TRUE(lookup_gbs_metadata(bitstream_valid_.data(),
+                                  bitstream_valid_.size(),
+                                  &header_len, &metadata));
+  EXPECT_EQ(header_len, get_bitstream_header_len(bitstream_valid_.data()));
+  EXPECT_EQ(metadata.afu_image.magic_num, 488605312);
+
+  EXPECT_EQ(xfpga_fpgaReconfigureSlot(handle_, 0, bitstream_valid_.data(),
+                                      bitstream_valid_.size(), 0), FPGA_OK);
+
+  // change the first byte of the json metadata
+  std::vector<uint8_t> other = bitstream_valid_;
+  other[20] ^= 0x20;
+  EXPECT_FALSE(lookup_gbs_metadata(other.data(), other.size(),
+                                   &header_len, &metadata));
+}
+
 /**
  * @test    fpga_reconf_slot_einval
  * @brief   Tests: fpgaReconfigureSlot
@@ -37,6 +37,7 @@ fpga_result sysfs_get_slots(int, int, uint32_t *);
 fpga_result sysfs_get_bitstream_id(int, int, uint64_t *);
 fpga_result sysfs_sbdf_from_path(const char *, int *, int *, int *, int *);
 fpga_result opae_glob_path(char *);
+void opae_glob_cache_invalidate(void);
 fpga_result make_sysfs_group(char *, const char *, fpga_object *, int,
                              fpga_handle);
 ssize_t eintr_write(int, void *, size_t);
@@ -600,6 +601,85 @@ class sysfs_c_mock_p : public sysfs_c_p {
   sysfs_c_mock_p() {}
 };
 
+/**
+ * @test    glob_cache
+ * @details Given a glob pattern resolved once by opae_glob_path,
+ *          resolving it again gives the same path, a cached path that
+ *          disappears is not returned, and the pattern resolves again
+ *          once the path is back or the cache is invalidated.
+ */
+TEST_P(sysfs_c_mock_p, glob_cache) {
+  _fpga_token *tok = static_cast<_fpga_token *>(tokens_[0]);
+  std::string pattern = std::string(tok->sysfspath) + "/err*s";
+  std::string expected = std::string(tok->sysfspath) + "/errors";
+  char path[SYSFS_PATH_MAX] = {0};
+
+  strncpy(path, pattern.c_str(), SYSFS_PATH_MAX - 1);
+  ASSERT_EQ(opae_glob_path(path), FPGA_OK);
+  EXPECT_EQ(std::string(path), expected);
+
+  strncpy(path, pattern.c_str(), SYSFS_PATH_MAX - 1);
+  ASSERT_EQ(opae_glob_path(path), FPGA_OK);
+  EXPECT_EQ(std::string(path), expected);
+
+  auto real = system_->get_sysfs_path(expected);
+  ASSERT_EQ(rename(real.c_str(), (real + "_moved").c_str()), 0);
+  strncpy(path, pattern.c_str(), SYSFS_PATH_MAX - 1);
+  EXPECT_EQ(opae_glob_path(path), FPGA_NOT_FOUND);
+  ASSERT_EQ(rename((real + "_moved").c_str(), real.c_str()), 0);
+
+  strncpy(path, pattern.c_str(), SYSFS_PATH_MAX - 1);
+  ASSERT_EQ(opae_glob_path(path), FPGA_OK);
+  EXPECT_EQ(std::string(path), expected);
+
+  opae_glob_cache_invalidate();
+  strncpy(path, pattern.c_str(), SYSFS_PATH_MAX - 1);
+  ASSERT_EQ(opae_glob_path(path), FPGA_OK);
+  EXPECT_EQ(std::string(path), expected);
+}
+
+/**
+ * @test    glob_cache_enumerate
+ * @details Given a glob pattern cached by opae_glob_path,
+ *          when a new sysfs entry that sorts first starts matching it,
+ *          the cached path is still returned until xfpga_fpgaEnumerate
+ *          runs, after which the pattern resolves to the new entry.
+ */
+TEST_P(sysfs_c_mock_p, glob_cache_enumerate) {
+  _fpga_token *tok = static_cast<_fpga_token *>(tokens_[0]);
+  std::string pattern = std::string(tok->sysfspath) + "/err*s";
+  std::string expected = std::string(tok->sysfspath) + "/errors";
+  std::string added = std::string(tok->sysfspath) + "/erraas";
+  char path[SYSFS_PATH_MAX] = {0};
+
+  strncpy(path, pattern.c_str(), SYSFS_PATH_MAX - 1);
+  ASSERT_EQ(opae_glob_path(path), FPGA_OK);
+  EXPECT_EQ(std::string(path), expected);
+
+  auto real = system_->get_sysfs_path(added);
+  ASSERT_EQ(mkdir(real.c_str(), 0755), 0);
+
+  strncpy(path, pattern.c_str(), SYSFS_PATH_MAX - 1);
+  ASSERT_EQ(opae_glob_path(path), FPGA_OK);
+  EXPECT_EQ(std::string(path), expected);
+
+  std::array<fpga_token, 2> tokens = {{nullptr, nullptr}};
+  uint32_t matches = 0;
+  ASSERT_EQ(xfpga_fpgaEnumerate(&filter_, 1, tokens.data(), tokens.size(),
+                                &matches), FPGA_OK);
+  for (auto &t : tokens) {
+    if (t) {
+      EXPECT_EQ(xfpga_fpgaDestroyToken(&t), FPGA_OK);
+    }
+  }
+
+  strncpy(path, pattern.c_str(), SYSFS_PATH_MAX - 1);
+  ASSERT_EQ(opae_glob_path(path), FPGA_OK);
+  EXPECT_EQ(std::string(path), added);
+
+  EXPECT_EQ(rmdir(real.c_str()), 0);
+}
+
 /**
  * @test    make_sysfs_group
  * @details
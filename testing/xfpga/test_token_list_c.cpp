@@ -27,10 +27,13 @@
 
 extern "C" {
 #include "token_list_int.h"
+#include "error_int.h"
 int xfpga_plugin_initialize(void);
 int xfpga_plugin_finalize(void);
 }
 
+#include <thread>
+#include <vector>
 #include "gtest/gtest.h"
 #include "sysfs_int.h"
 #include "test_system.h"
@@ -151,5 +154,41 @@ TEST_P(token_list_c_p, invalid_paths) {
   ASSERT_EQ(fme, nullptr);
 }
 
+TEST_P(token_list_c_p, lazy_errors) {
+  auto port = token_add(sysfs_port.c_str(), dev_port.c_str());
+  ASSERT_NE(port, nullptr);
+  EXPECT_EQ(port->errors, nullptr);
+
+  // a clone made before the list is built finds it in the registry
+  struct _fpga_token clone = *port;
+  auto errors = token_get_errors(&clone);
+  struct error_list *expected = nullptr;
+  std::string errpath = sysfs_port + "/errors";
+  auto num_errors = build_error_list(errpath.c_str(), &expected);
+  free_error_list(expected);
+  EXPECT_EQ(errors != nullptr, num_errors > 0);
+  EXPECT_EQ(port->errors, errors);
+  EXPECT_EQ(token_get_errors(port), errors);
+}
+
+TEST_P(token_list_c_p, concurrent_add) {
+  std::vector<std::thread> threads;
+  std::vector<_fpga_token *> ports(8, nullptr);
+
+  for (size_t i = 0; i < ports.size(); ++i) {
+    threads.emplace_back([this, &ports, i] {
+      ports[i] = token_add(sysfs_port.c_str(), dev_port.c_str());
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  ASSERT_NE(ports[0], nullptr);
+  for (auto p : ports) {
+    EXPECT_EQ(p, ports[0]);
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(token_list_c, token_list_c_p,
                         ::testing::ValuesIn(test_platform::keys(true)));
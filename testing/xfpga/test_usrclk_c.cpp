@@ -38,6 +38,9 @@ extern "C" {
 #endif
 
 
+#include <chrono>
+#include <fstream>
+#include <unistd.h>
 #include "gtest/gtest.h"
 #include "types_int.h"
 #include "test_system.h"
@@ -47,6 +50,7 @@ extern "C" {
 extern "C" {
 int xfpga_plugin_initialize(void);
 int xfpga_plugin_finalize(void);
+extern struct QUCPU_Uclock gQUCPU_Uclock;
 }
 
 
@@ -196,6 +200,70 @@ TEST(usrclk_c, fi_run_initz) {
   EXPECT_EQ(-1, fi_RunInitz(NULL));
 }
 
+/**
+* @test    diffmif_table
+* @brief   Tests: scu32ia1d_DiffMifAdrMsk, scu8ia3d_DiffMifDat
+* @details The fPLL tables are indexed by REFCLK and frequency in MHz,
+*          and hold the register writes of the original diff mif.
+*/
+TEST(usrclk_c, diffmif_table) {
+  EXPECT_EQ(0x10fffu, scu32ia1d_DiffMifAdrMsk[0]);
+  EXPECT_EQ(0x1427fu, scu32ia1d_DiffMifAdrMsk[QUCPU_INT_NUMREG - 1]);
+
+  // 100 MHz REFCLK, 0 MHz
+  EXPECT_EQ(0x0f, scu8ia3d_DiffMifDat[0][0][0]);
+  EXPECT_EQ(0x42, scu8ia3d_DiffMifDat[0][0][10]);
+  // 322.265625 MHz REFCLK, 1200 MHz
+  EXPECT_EQ(0xb8, scu8ia3d_DiffMifDat[1][QUCPU_INT_NUMFRQ_FRAC_END][9]);
+  EXPECT_EQ(0x04, scu8ia3d_DiffMifDat[1][QUCPU_INT_NUMFRQ_FRAC_END][13]);
+}
+
+class usrclk_poll_c : public ::testing::Test {
+ protected:
+  usrclk_poll_c() {}
+
+  virtual void SetUp() override {
+    strncpy(tmpdir_, "/tmp/usrclk-XXXXXX", sizeof(tmpdir_));
+    ASSERT_NE(mkdtemp(tmpdir_), nullptr);
+    sts0_ = std::string(tmpdir_) + "/userclk_freqsts";
+    memcpy(saved_path_, gQUCPU_Uclock.sysfs_path, sizeof(saved_path_));
+  }
+
+  virtual void TearDown() override {
+    // fi_PollSts0 reads through the global; don't leave it pointing here
+    memcpy(gQUCPU_Uclock.sysfs_path, saved_path_, sizeof(saved_path_));
+    unlink(sts0_.c_str());
+    rmdir(tmpdir_);
+  }
+
+  char tmpdir_[32];
+  char saved_path_[sizeof(gQUCPU_Uclock.sysfs_path)];
+  std::string sts0_;
+};
+
+/**
+* @test    fi_poll_sts0
+* @brief   Tests: fi_PollSts0
+* @details fi_PollSts0 returns 0 with the status as soon as the masked
+*          status matches, and 1 once the timeout expires.
+*/
+TEST_F(usrclk_poll_c, fi_poll_sts0) {
+  std::ofstream(sts0_) << "0x2000000000000000\n";
+
+  strncpy(gQUCPU_Uclock.sysfs_path, tmpdir_, sizeof(gQUCPU_Uclock.sysfs_path) - 1);
+
+  uint64_t status = 0;
+  EXPECT_EQ(0, fi_PollSts0(QUCPU_UI64_STS_0_BSY_b61, QUCPU_UI64_STS_0_BSY_b61,
+                           1000000, &status));
+  EXPECT_EQ(0x2000000000000000u, status);
+
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(1, fi_PollSts0(QUCPU_UI64_STS_0_BSY_b61, 0, 5000000, &status));
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_GE(elapsed, std::chrono::milliseconds(5));
+  EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+}
+
 /**
 * @test    fpga_set_user_clock
 * @brief   Tests: fpgaSetUserClock
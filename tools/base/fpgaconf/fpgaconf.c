@@ -35,6 +35,7 @@
  * Features:
  *   * Auto-discovery of compatible slots for supplied bitstream
  *   * Dry-run mode ("what would happen if...?")
+ *   * Programming of all compatible slots in parallel
  */
 #define _GNU_SOURCE
 #include <errno.h>
@@ -43,6 +44,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <pthread.h>
+#include <time.h>
 #include <sys/stat.h>
 
 #include "safe_string/safe_string.h"
@@ -81,12 +84,14 @@ struct config {
 		int socket;
 	} target;
 	char *filename;
+	bool all;
 } config = {.verbosity = 0,
 	    .dry_run = false,
 	    .mode = NORMAL,
 	    .flags = 0,
 	    .target = {.segment = -1, .bus = -1, .device = -1, .function = -1, .socket = -1},
-	    .filename = NULL };
+	    .filename = NULL,
+	    .all = false };
 
 struct bitstream_info {
 	char *filename;
@@ -209,11 +214,12 @@ void help(void)
 	       "Usage:\n"
 	       //"        fpgaconf [-hvnAIQ] [-B <bus>] [-D <device>] [-F
 	       //<function>] [-S <socket-id>] <gbs>\n"
-	       "        fpgaconf [-hvn] [-B <bus>] [-D <device>] [-F <function>] [-S <socket-id>] <gbs>\n"
+	       "        fpgaconf [-hvna] [-B <bus>] [-D <device>] [-F <function>] [-S <socket-id>] <gbs>\n"
 	       "\n"
 	       "                -h,--help           Print this help\n"
 	       "                -v,--verbose        Increase verbosity\n"
 	       "                -n,--dry-run        Don't actually perform actions\n"
+	       "                -a,--all            Program all matching slots in parallel\n"
 	       "                --force             Don't try to open accelerator resource\n"
 	       "                --segment           Set target segment number\n"
 	       "                -B,--bus            Set target bus number\n"
@@ -237,13 +243,14 @@ void help(void)
  * Parse command line arguments
  * TODO: uncomment options as they are implemented
  */
-#define GETOPT_STRING ":hvnB:D:F:S:AIQ"
+#define GETOPT_STRING ":hvnaB:D:F:S:AIQ"
 int parse_args(int argc, char *argv[])
 {
 	struct option longopts[] = {
 		{"help",      no_argument,       NULL, 'h'},
 		{"verbose",   no_argument,       NULL, 'v'},
 		{"dry-run",   no_argument,       NULL, 'n'},
+		{"all",       no_argument,       NULL, 'a'},
 		{"segment",   required_argument, NULL, 0xe},
 		{"bus",       required_argument, NULL, 'B'},
 		{"device",    required_argument, NULL, 'D'},
@@ -281,6 +288,10 @@ int parse_args(int argc, char *argv[])
 			config.dry_run = true;
 			break;
 
+		case 'a': /* all */
+			config.all = true;
+			break;
+
 		case 0xf: /* force */
 			config.flags |= FPGA_RECONF_FORCE;
 			break;
@@ -604,11 +615,11 @@ out_close:
 }
 
 /*
- * Find first FPGA matching the interface ID of the GBS
+ * Find up to max_fpgas FPGAs matching the interface ID of the GBS
  *
  * @returns the total number of FPGAs matching the interface ID
  */
-int find_fpga(fpga_guid interface_id, fpga_token *fpga)
+int find_fpgas(fpga_guid interface_id, fpga_token *fpgas, uint32_t max_fpgas)
 {
 	fpga_properties filter = NULL;
 	uint32_t num_matches;
@@ -650,7 +661,7 @@ int find_fpga(fpga_guid interface_id, fpga_token *fpga)
 		ON_ERR_GOTO(res, out_destroy, "setting socket id");
 	}
 
-	res = fpgaEnumerate(&filter, 1, fpga, 1, &num_matches);
+	res = fpgaEnumerate(&filter, 1, fpgas, max_fpgas, &num_matches);
 	ON_ERR_GOTO(res, out_destroy, "enumerating FPGAs");
 
 	if (num_matches > 0) {
@@ -666,6 +677,16 @@ out_err:
 	return retval;
 }
 
+/*
+ * Find first FPGA matching the interface ID of the GBS
+ *
+ * @returns the total number of FPGAs matching the interface ID
+ */
+int find_fpga(fpga_guid interface_id, fpga_token *fpga)
+{
+	return find_fpgas(interface_id, fpga, 1);
+}
+
 int program_bitstream(fpga_token token, uint32_t slot_num,
 		      struct bitstream_info *info, int flags)
 {
@@ -698,6 +719,134 @@ out_err:
 }
 
 
+/*
+ * Programming job for one FPGA when programming all matching slots
+ */
+struct program_job {
+	pthread_t thread;
+	fpga_token token;
+	struct bitstream_info *info;
+	char name[32];
+	int result;
+	double seconds;
+};
+
+void *program_worker(void *arg)
+{
+	struct program_job *job = (struct program_job *)arg;
+	struct timespec start;
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	job->result = program_bitstream(job->token, 0, job->info,
+					config.flags);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	job->seconds = (double)(end.tv_sec - start.tv_sec) +
+		       (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+	return NULL;
+}
+
+void get_fpga_name(fpga_token token, char *name, size_t len)
+{
+	fpga_properties props = NULL;
+	uint16_t segment = 0;
+	uint8_t bus = 0;
+	uint8_t device = 0;
+	uint8_t function = 0;
+
+	if (fpgaGetProperties(token, &props) == FPGA_OK) {
+		fpgaPropertiesGetSegment(props, &segment);
+		fpgaPropertiesGetBus(props, &bus);
+		fpgaPropertiesGetDevice(props, &device);
+		fpgaPropertiesGetFunction(props, &function);
+		fpgaDestroyProperties(&props);
+	}
+
+	snprintf(name, len, "%04x:%02x:%02x.%d",
+		 segment, bus, device, function);
+}
+
+/*
+ * Program all FPGAs matching the interface ID of the GBS, one thread per
+ * FPGA, all sharing the bitstream image in info
+ *
+ * @returns the total number of FPGAs matching the interface ID, or -1 on
+ *          error. The number of FPGAs that failed to program is returned
+ *          in num_failed.
+ */
+int program_all(struct bitstream_info *info, int *num_failed)
+{
+	struct program_job *jobs = NULL;
+	fpga_token *tokens = NULL;
+	int num_fpgas;
+	int res;
+	int i;
+
+	*num_failed = 0;
+
+	num_fpgas = find_fpgas(info->interface_id, NULL, 0);
+	if (num_fpgas <= 0)
+		return num_fpgas;
+
+	tokens = (fpga_token *)calloc(num_fpgas, sizeof(fpga_token));
+	jobs = (struct program_job *)calloc(num_fpgas,
+					    sizeof(struct program_job));
+	if (!tokens || !jobs) {
+		perror("calloc");
+		num_fpgas = -1;
+		goto out_free;
+	}
+
+	res = find_fpgas(info->interface_id, tokens, num_fpgas);
+	if (res <= 0) {
+		num_fpgas = res;
+		goto out_free;
+	}
+	if (res < num_fpgas)
+		num_fpgas = res;
+
+	for (i = 0 ; i < num_fpgas ; ++i) {
+		jobs[i].token = tokens[i];
+		jobs[i].info = info;
+		get_fpga_name(tokens[i], jobs[i].name, sizeof(jobs[i].name));
+
+		if (pthread_create(&jobs[i].thread, NULL,
+				   program_worker, &jobs[i])) {
+			// no thread for this FPGA - program it inline
+			jobs[i].thread = pthread_self();
+			program_worker(&jobs[i]);
+		}
+	}
+
+	for (i = 0 ; i < num_fpgas ; ++i) {
+		if (!pthread_equal(jobs[i].thread, pthread_self()))
+			pthread_join(jobs[i].thread, NULL);
+	}
+
+	for (i = 0 ; i < num_fpgas ; ++i) {
+		if (jobs[i].result < 0)
+			++*num_failed;
+		printf("%s: %s in %.3f s\n", jobs[i].name,
+		       jobs[i].result < 0 ? "FAILED" : "programmed",
+		       jobs[i].seconds);
+	}
+
+	printf("Programmed %d of %d FPGAs\n",
+	       num_fpgas - *num_failed, num_fpgas);
+
+out_free:
+	if (tokens) {
+		for (i = 0 ; i < num_fpgas ; ++i) {
+			if (tokens[i])
+				fpgaDestroyToken(&tokens[i]);
+		}
+		free(tokens);
+	}
+	free(jobs);
+	return num_fpgas;
+}
+
 int main(int argc, char *argv[])
 {
 	int res;
@@ -724,6 +873,26 @@ int main(int argc, char *argv[])
 		goto out_exit;
 	}
 
+	if (config.all) {
+		int num_failed = 0;
+
+		print_msg(1, "Programming all suitable slots");
+		res = program_all(&info, &num_failed);
+		if (res < 0) {
+			retval = 3;
+		} else if (res == 0) {
+			fprintf(stderr, "No suitable slots found.\n");
+			retval = 4;
+			if (config.verbosity > 0)
+				print_interface_id(info.interface_id);
+		} else if (num_failed > 0) {
+			retval = 5;
+		} else {
+			print_msg(1, "Done");
+		}
+		goto out_free;
+	}
+
 	/* find suitable slot */
 	print_msg(1, "Looking for slot");
 	res = find_fpga(info.interface_id, &token);
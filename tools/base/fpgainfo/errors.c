@@ -313,6 +313,8 @@ static void print_errors_info(fpga_token token, fpga_properties props,
 	fpga_objtype objtype;
 	const char *const *error_string = NULL;
 	int size = 0;
+	uint64_t *error_values = NULL;
+	uint32_t num_read = 0;
 
 	if ((NULL == errinfos) || (0 == num_errors)) {
 		return;
@@ -324,6 +326,24 @@ static void print_errors_info(fpga_token token, fpga_properties props,
 		}
 	}
 
+	error_values = (uint64_t *)calloc(num_errors, sizeof(*error_values));
+	if (!error_values) {
+		OPAE_ERR("Error allocating memory");
+		return;
+	}
+
+	// Read all registers at once so the values are consistent
+	res = fpgaReadAllErrors(token, error_values, num_errors, &num_read);
+	if (FPGA_NOT_SUPPORTED == res) {
+		// Older plugins only read one register at a time
+		for (i = 0; i < (int)num_errors; i++) {
+			res = fpgaReadError(token, i, &error_values[i]);
+			fpgainfo_print_err("reading error", res);
+		}
+	} else {
+		fpgainfo_print_err("reading errors", res);
+	}
+
 	res = fpgaPropertiesGetObjectType(props, &objtype);
 	fpgainfo_print_err("reading objtype from properties", res);
 
@@ -333,10 +353,7 @@ static void print_errors_info(fpga_token token, fpga_properties props,
 		fpgainfo_print_common("//****** FME ERRORS ******//", props);
 
 		for (i = 0; i < (int)num_errors; i++) {
-			uint64_t error_value = 0;
-
-			res = fpgaReadError(token, i, &error_value);
-			fpgainfo_print_err("reading error for FME", res);
+			uint64_t error_value = error_values[i];
 
 			printf("%-29s : 0x%" PRIX64 "\n", errinfos[i].name,
 			       error_value);
@@ -388,9 +405,7 @@ static void print_errors_info(fpga_token token, fpga_properties props,
 		fpgainfo_print_common("//****** PORT ERRORS ******//", props);
 
 		for (i = 0; i < (int)num_errors; i++) {
-			uint64_t error_value = 0;
-			res = fpgaReadError(token, i, &error_value);
-			fpgainfo_print_err("reading error for PORT", res);
+			uint64_t error_value = error_values[i];
 
 			printf("%-29s : 0x%" PRIX64 "\n", errinfos[i].name,
 			       error_value);
@@ -417,6 +432,8 @@ static void print_errors_info(fpga_token token, fpga_properties props,
 			}
 		}
 	}
+
+	free(error_values);
 }
 
 fpga_result errors_command(fpga_token *tokens, int num_tokens, int argc,
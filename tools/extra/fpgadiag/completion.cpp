@@ -0,0 +1,207 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <algorithm>
+#include <cerrno>
+#include <poll.h>
+#include <unistd.h>
+#include "completion.h"
+
+using namespace opae::fpga::types;
+using namespace std::chrono;
+
+namespace intel
+{
+namespace fpga
+{
+namespace diag
+{
+
+constexpr microseconds completion_monitor::max_backoff;
+
+completion_monitor::ptr_t completion_monitor::instance()
+{
+    static ptr_t monitor(new completion_monitor());
+    return monitor;
+}
+
+completion_monitor::completion_monitor()
+: stop_(false)
+, poller_(&completion_monitor::poll_loop, this)
+{
+}
+
+completion_monitor::~completion_monitor()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    poller_.join();
+}
+
+completion_monitor::result completion_monitor::wait(shared_buffer::ptr_t buffer,
+                                                    std::size_t offset,
+                                                    uint32_t mask,
+                                                    uint32_t value,
+                                                    microseconds timeout,
+                                                    event::ptr_t irq)
+{
+    waiter w;
+    w.buffer = buffer;
+    w.offset = offset;
+    w.mask = mask;
+    w.value = value;
+    w.start = high_resolution_clock::now();
+    w.deadline = w.start + timeout;
+    w.done = false;
+    w.complete = false;
+
+    if (irq)
+    {
+        return wait_interrupt(w, irq);
+    }
+    return wait_poller(w);
+}
+
+completion_monitor::result completion_monitor::wait_poller(waiter & w)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiters_.push_back(&w);
+    work_cv_.notify_one();
+    done_cv_.wait(lock, [&w]{ return w.done; });
+    return result{ w.complete, duration_cast<microseconds>(w.end - w.start) };
+}
+
+completion_monitor::result completion_monitor::wait_interrupt(waiter & w, event::ptr_t irq)
+{
+    struct pollfd pfd;
+    pfd.fd = irq->os_object();
+    pfd.events = POLLIN;
+    microseconds backoff(0);
+
+    while (true)
+    {
+        if ((w.buffer->read<uint32_t>(w.offset) & w.mask) == w.value)
+        {
+            w.end = high_resolution_clock::now();
+            return result{ true, duration_cast<microseconds>(w.end - w.start) };
+        }
+
+        auto now = high_resolution_clock::now();
+        if (now >= w.deadline)
+        {
+            return result{ false, duration_cast<microseconds>(now - w.start) };
+        }
+
+        // Never block longer than the shared poller would back off, so a
+        // lost or late interrupt costs no more than polling does.
+        backoff = backoff.count() ? std::min(backoff * 2, max_backoff) : microseconds(1);
+        auto timeout = std::min(backoff, duration_cast<microseconds>(w.deadline - now) + microseconds(1));
+        struct timespec ts;
+        ts.tv_sec = 0;
+        ts.tv_nsec = duration_cast<nanoseconds>(timeout).count();
+        int res = ::ppoll(&pfd, 1, &ts, nullptr);
+        if (res < 0 && errno != EINTR)
+        {
+            // the event is unusable, let the shared poller finish the wait
+            return wait_poller(w);
+        }
+
+        if (res > 0 && (pfd.revents & POLLIN))
+        {
+            uint64_t count = 0;
+            if (::read(pfd.fd, &count, sizeof(count)) < 0)
+            {
+                return wait_poller(w);
+            }
+            backoff = microseconds(0);
+        }
+    }
+}
+
+void completion_monitor::poll_loop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    microseconds backoff(0);
+
+    while (!stop_)
+    {
+        if (waiters_.empty())
+        {
+            backoff = microseconds(0);
+            work_cv_.wait(lock, [this]{ return stop_ || !waiters_.empty(); });
+            continue;
+        }
+
+        bool progress = false;
+        auto now = high_resolution_clock::now();
+        for (auto it = waiters_.begin(); it != waiters_.end(); )
+        {
+            waiter * w = *it;
+            bool complete = (w->buffer->read<uint32_t>(w->offset) & w->mask) == w->value;
+            if (complete || now >= w->deadline)
+            {
+                w->complete = complete;
+                w->end = complete ? high_resolution_clock::now() : now;
+                w->done = true;
+                it = waiters_.erase(it);
+                progress = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        if (progress)
+        {
+            // completions tend to arrive in bursts (the muxed apps all
+            // started together), so re-check straight away
+            done_cv_.notify_all();
+            backoff = microseconds(0);
+            continue;
+        }
+
+        backoff = backoff.count() ? std::min(backoff * 2, max_backoff) : microseconds(1);
+        // a new waiter cuts the back-off short
+        work_cv_.wait_for(lock, backoff);
+    }
+
+    // wake anybody still waiting so they don't block forever
+    for (auto w : waiters_)
+    {
+        w->done = true;
+        w->end = high_resolution_clock::now();
+    }
+    waiters_.clear();
+    done_cv_.notify_all();
+}
+
+} // end of namespace diag
+} // end of namespace fpga
+} // end of namespace intel
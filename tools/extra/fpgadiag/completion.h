@@ -0,0 +1,121 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <opae/cxx/core/events.h>
+#include <opae/cxx/core/shared_buffer.h>
+
+namespace intel
+{
+namespace fpga
+{
+namespace diag
+{
+
+/// @brief Waits for AFU runs to signal completion through a DSM word.
+///
+/// If the caller supplies an interrupt event, the waiting thread blocks
+/// on the event's file descriptor and checks the DSM word each time the
+/// interrupt fires, or after the same back-off the poller uses below if
+/// it doesn't. The AFU must be configured to raise the interrupt on
+/// completion. Otherwise the wait is serviced by one poller thread
+/// shared by every waiter in the process (for example all apps run by
+/// fpgamux). The poller re-checks back to back while completions keep
+/// arriving and backs off exponentially, up to max_backoff, while
+/// nothing completes, so idle waits stay cheap without quantizing the
+/// measured completion time.
+class completion_monitor
+{
+public:
+    typedef std::shared_ptr<completion_monitor> ptr_t;
+
+    struct result
+    {
+        bool complete;
+        std::chrono::microseconds elapsed;
+    };
+
+    /// @brief The poller shared by all waiters in this process.
+    static ptr_t instance();
+
+    completion_monitor();
+    ~completion_monitor();
+
+    /// @brief Wait until (buffer[offset] & mask) == value.
+    ///
+    /// @param buffer  The DSM buffer written by the AFU.
+    /// @param offset  Byte offset of the completion word.
+    /// @param mask    Bits of the completion word to test.
+    /// @param value   Expected value of the masked bits.
+    /// @param timeout Give up after this long.
+    /// @param irq     Optional interrupt event raised by the AFU on
+    ///                completion.
+    ///
+    /// @return Whether the run completed, and how long it took to
+    ///         observe the completion.
+    result wait(opae::fpga::types::shared_buffer::ptr_t buffer,
+                std::size_t offset, uint32_t mask, uint32_t value,
+                std::chrono::microseconds timeout,
+                opae::fpga::types::event::ptr_t irq = nullptr);
+
+    static constexpr std::chrono::microseconds max_backoff{64};
+
+private:
+    struct waiter
+    {
+        opae::fpga::types::shared_buffer::ptr_t buffer;
+        std::size_t offset;
+        uint32_t mask;
+        uint32_t value;
+        std::chrono::high_resolution_clock::time_point start;
+        std::chrono::high_resolution_clock::time_point deadline;
+        std::chrono::high_resolution_clock::time_point end;
+        bool done;
+        bool complete;
+    };
+
+    result wait_poller(waiter & w);
+    result wait_interrupt(waiter & w, opae::fpga::types::event::ptr_t irq);
+    void poll_loop();
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    std::list<waiter *> waiters_;
+    bool stop_;
+    std::thread poller_;
+};
+
+} // end of namespace diag
+} // end of namespace fpga
+} // end of namespace intel
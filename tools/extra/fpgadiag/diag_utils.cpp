@@ -23,8 +23,16 @@
 // CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
+#include <fstream>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
 #include "diag_utils.h"
 
+#ifndef MPOL_BIND
+#define MPOL_BIND 2
+#endif
+
 using namespace opae::fpga::types;
 
 namespace intel
@@ -100,5 +108,89 @@ uint64_t * umsg_get_ptr(handle::ptr_t h)
     return NULL;
 }
 
+int numa_node(const std::string & policy, token::ptr_t tok)
+{
+    if (policy.empty() || policy == "none")
+    {
+        return -1;
+    }
+
+    if (policy == "local")
+    {
+        auto props = properties::get(tok);
+        uint8_t socket_id = 0;
+        if (props->socket_id.get_value(socket_id) != FPGA_OK)
+        {
+            return -1;
+        }
+        return socket_id;
+    }
+
+    try
+    {
+        return std::stoi(policy);
+    }
+    catch(std::exception &)
+    {
+        return -1;
+    }
+}
+
+bool numa_bind(int node)
+{
+    const int max_nodes = 1024;
+    if (node < 0 || node >= max_nodes)
+    {
+        return false;
+    }
+
+    std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string ranges;
+    if (!(cpulist >> ranges))
+    {
+        return false;
+    }
+
+    // cpulist is a comma separated list of cpus and cpu ranges, e.g. 0-27,56-83
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    std::size_t pos = 0;
+    while (pos < ranges.size())
+    {
+        auto comma = ranges.find(',', pos);
+        auto range = ranges.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+        auto dash = range.find('-');
+        try
+        {
+            int first = std::stoi(range.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu)
+            {
+                CPU_SET(cpu, &cpus);
+            }
+        }
+        catch(std::exception &)
+        {
+            return false;
+        }
+        if (comma == std::string::npos)
+        {
+            break;
+        }
+        pos = comma + 1;
+    }
+
+    if (sched_setaffinity(0, sizeof(cpus), &cpus))
+    {
+        return false;
+    }
+
+    // Buffers are populated by the thread that prepares them, so binding
+    // this thread's memory policy places them on the node as well.
+    unsigned long nodemask[max_nodes / (8 * sizeof(unsigned long))] = { 0 };
+    nodemask[node / (8 * sizeof(unsigned long))] |= 1UL << (node % (8 * sizeof(unsigned long)));
+    return syscall(SYS_set_mempolicy, MPOL_BIND, nodemask, max_nodes + 1) == 0;
+}
+
 } // end of namespace fpga
 } // end of namespace intel
@@ -133,6 +133,21 @@ bool umsg_set_mask(opae::fpga::types::handle::ptr_t h, uint64_t mask);
 
 uint64_t * umsg_get_ptr(opae::fpga::types::handle::ptr_t h);
 
+/// @brief Resolve a NUMA placement policy for an accelerator.
+///
+/// @param policy One of "none", "local" (the node of the accelerator's
+///               socket_id) or a NUMA node number.
+/// @param tok    The accelerator token.
+///
+/// @return The NUMA node to bind to, or -1 for no binding.
+int numa_node(const std::string & policy, opae::fpga::types::token::ptr_t tok);
+
+/// @brief Bind the calling thread, and memory it allocates from now on,
+/// to a NUMA node.
+///
+/// @return true on success.
+bool numa_bind(int node);
+
 
 } // end of namespace fpga
 } // end of namespace intel
@@ -29,6 +29,7 @@
 #include "option_map.h"
 #include <opae/cxx/core/handle.h>
 #include <opae/cxx/core/shared_buffer.h>
+#include <chrono>
 #include <thread>
 #include <future>
 
@@ -82,6 +83,17 @@ public:
 
     virtual opae::fpga::types::shared_buffer::ptr_t dsm() const = 0;
     virtual uint64_t cachelines()    const  = 0;
+    virtual uint32_t clock_frequency() const
+    {
+        return 0;
+    }
+
+    /// @brief Total time spent waiting for the AFU to report completion
+    ///        during the last run
+    virtual std::chrono::microseconds completion_time() const
+    {
+        return std::chrono::microseconds(0);
+    }
 
 private:
     std::string name_;
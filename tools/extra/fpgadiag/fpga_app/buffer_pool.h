@@ -24,7 +24,12 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 #pragma once
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <mutex>
+#include <thread>
+#include <vector>
 #include "fpga_common.h"
 #include <opae/cxx/core/shared_buffer.h>
 #include "diag_utils.h"
@@ -34,56 +39,324 @@ namespace intel
 namespace fpga
 {
 
+/// @brief Sub-allocates pinned memory out of one large shared_buffer.
+///
+/// The backing buffer is split into a few power-of-two arenas, each managed
+/// by a binary buddy allocator with its own lock, so threads allocating
+/// concurrently rarely contend. Blocks are returned to their arena (and
+/// coalesced with their buddies) when the last reference to the buffer
+/// handed out goes away.
 class buffer_pool
 {
 public:
     typedef std::shared_ptr<buffer_pool> ptr_t;
 
-    buffer_pool(opae::fpga::types::shared_buffer::ptr_t buffer)
+    struct stats
+    {
+        std::size_t total = 0;
+        std::size_t in_use = 0;
+        std::size_t requested = 0;
+        std::size_t largest_free = 0;
+        uint64_t    allocations = 0;
+        uint64_t    failures = 0;
+
+        std::size_t free() const
+        {
+            return total - in_use;
+        }
+
+        /// @brief Internal fragmentation: bytes lost to rounding requests
+        /// up to a block size, as a fraction of the bytes in use.
+        double internal_fragmentation() const
+        {
+            return in_use ? 1.0 - static_cast<double>(requested) / in_use : 0.0;
+        }
+
+        /// @brief External fragmentation: how much of the free space can
+        /// not be handed out as one block.
+        double external_fragmentation() const
+        {
+            return free() ? 1.0 - static_cast<double>(largest_free) / free() : 0.0;
+        }
+    };
+
+    buffer_pool(opae::fpga::types::shared_buffer::ptr_t buffer,
+                std::size_t min_block = KB(4),
+                std::size_t arenas = 4)
     : buffer_(buffer)
-    , addr_offset_(0)
-    , io_address_offset_(0)
+    , min_block_(next_pow2(std::max<std::size_t>(min_block, CL(1))))
+    , base_align_(0)
     {
-        if (buffer)
+        if (!buffer_)
         {
-            addr_offset_ = const_cast<uint8_t*>(buffer->c_type());
-            io_address_offset_ = buffer->io_address();
+            return;
         }
-    }
 
+        auto virt = reinterpret_cast<uintptr_t>(buffer_->c_type());
+        auto iova = buffer_->io_address();
+        // the largest power of two both base addresses are aligned to
+        auto bits = static_cast<uint64_t>(virt) | iova;
+        base_align_ = bits ? static_cast<std::size_t>(bits & (~bits + 1)) : ~std::size_t(0);
+
+        // Carve out the largest power-of-two arenas that fit, but never
+        // let them get so small that a 2MB buffer could not be had.
+        arenas = std::max<std::size_t>(arenas, 1);
+        std::size_t arena_size = prev_pow2(buffer_->size() / arenas);
+        while (arenas > 1 && arena_size < std::max<std::size_t>(MB(2), min_block_))
+        {
+            arena_size = prev_pow2(buffer_->size() / --arenas);
+        }
 
-    opae::fpga::types::shared_buffer::ptr_t allocate_buffer(std::size_t size)
+        if (arena_size < min_block_)
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i < arenas; ++i)
+        {
+            arenas_.push_back(std::make_shared<arena>(i * arena_size, arena_size, min_block_));
+        }
+    }
+
+    /// @brief Allocate a sub-buffer.
+    ///
+    /// @param size      The number of bytes needed.
+    /// @param alignment The required alignment of both the virtual and IO
+    ///                  addresses, e.g. CL(1), KB(4) or MB(2).
+    ///
+    /// @return The sub-buffer, or a null pointer if the pool can't satisfy
+    ///         the request.
+    opae::fpga::types::shared_buffer::ptr_t allocate_buffer(std::size_t size,
+                                                            std::size_t alignment = CL(1))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
         opae::fpga::types::shared_buffer::ptr_t buffer(0);
-        // round up to next multiple of 4MB
-        auto next_size = size;
-        if (next_size % MB(4) != 0)
+        if (arenas_.empty() || size == 0 ||
+            (alignment & (alignment - 1)) != 0 || alignment > base_align_)
         {
-            next_size = (size/MB(4) + 1)*MB(4);
+            failures_++;
+            return buffer;
         }
 
-        if (!buffer_ || addr_offset_ + next_size > buffer_->c_type() + buffer_->size())
+        std::size_t block = next_pow2(std::max(size, std::max(alignment, min_block_)));
+
+        // start at a different arena for each thread so that concurrent
+        // allocations mostly take different locks
+        auto first = thread_arena();
+        for (std::size_t i = 0; i < arenas_.size(); ++i)
         {
-            // TODO: Log some sort of error or throw an exception?
-            // but for now return a null buffer
+            auto a = arenas_[(first + i) % arenas_.size()];
+            std::size_t offset = 0;
+            if (!a->allocate(block, size, offset))
+            {
+                continue;
+            }
+
+            auto virt = const_cast<uint8_t*>(buffer_->c_type()) + offset;
+            auto iova = buffer_->io_address() + offset;
+            buffer.reset(new split_buffer(buffer_, size, virt, buffer_->wsid(), iova),
+                         [a, offset, size](opae::fpga::types::shared_buffer *p)
+                         {
+                             delete p;
+                             a->release(offset, size);
+                         });
             return buffer;
         }
-        buffer.reset(new split_buffer(buffer_, next_size, addr_offset_, buffer_->wsid(), io_address_offset_));
-        addr_offset_ += next_size;
-        io_address_offset_ += next_size;
+
+        failures_++;
         return buffer;
     }
 
+    stats get_stats() const
+    {
+        stats s;
+        for (const auto & a : arenas_)
+        {
+            a->add_stats(s);
+        }
+        s.failures += failures_;
+        return s;
+    }
+
 private:
-    opae::fpga::types::shared_buffer::ptr_t buffer_;
-    uint8_t          *addr_offset_;
-    uint64_t          io_address_offset_;
-    size_t size_;
-    std::mutex        mutex_;
+    class arena
+    {
+    public:
+        arena(std::size_t offset, std::size_t size, std::size_t min_block)
+        : offset_(offset)
+        , min_shift_(log2(min_block))
+        , max_order_(log2(size) - min_shift_)
+        , order_(size / min_block, 0)
+        , is_free_(size / min_block, 0)
+        , next_(size / min_block, -1)
+        , prev_(size / min_block, -1)
+        , heads_(max_order_ + 1, -1)
+        , in_use_(0)
+        , requested_(0)
+        , allocations_(0)
+        {
+            push(0, max_order_);
+        }
+
+        bool allocate(std::size_t block, std::size_t size, std::size_t & offset)
+        {
+            auto order = log2(block) - min_shift_;
+            if (order > max_order_)
+            {
+                return false;
+            }
 
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto k = order;
+            while (k <= max_order_ && heads_[k] < 0)
+            {
+                ++k;
+            }
+            if (k > max_order_)
+            {
+                return false;
+            }
+
+            int32_t idx = heads_[k];
+            unlink(idx, k);
+            // split, keeping the lower half and freeing the upper one
+            while (k > order)
+            {
+                --k;
+                push(idx + (1 << k), k);
+            }
+            order_[idx] = static_cast<uint8_t>(order);
+
+            in_use_ += block;
+            requested_ += size;
+            allocations_++;
+            offset = offset_ + (static_cast<std::size_t>(idx) << min_shift_);
+            return true;
+        }
+
+        void release(std::size_t offset, std::size_t size)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            int32_t idx = static_cast<int32_t>((offset - offset_) >> min_shift_);
+            uint32_t k = order_[idx];
+            in_use_ -= std::size_t(1) << (k + min_shift_);
+            requested_ -= size;
+
+            // coalesce with free buddies of the same order
+            while (k < max_order_)
+            {
+                int32_t buddy = idx ^ (1 << k);
+                if (!is_free_[buddy] || order_[buddy] != k)
+                {
+                    break;
+                }
+                unlink(buddy, k);
+                idx = std::min(idx, buddy);
+                ++k;
+            }
+            push(idx, k);
+        }
+
+        void add_stats(stats & s) const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            s.total += std::size_t(1) << (max_order_ + min_shift_);
+            s.in_use += in_use_;
+            s.requested += requested_;
+            s.allocations += allocations_;
+            for (uint32_t k = max_order_ + 1; k-- > 0; )
+            {
+                if (heads_[k] >= 0)
+                {
+                    s.largest_free = std::max(s.largest_free,
+                                              std::size_t(1) << (k + min_shift_));
+                    break;
+                }
+            }
+        }
+
+    private:
+        void push(int32_t idx, uint32_t k)
+        {
+            order_[idx] = static_cast<uint8_t>(k);
+            is_free_[idx] = 1;
+            prev_[idx] = -1;
+            next_[idx] = heads_[k];
+            if (heads_[k] >= 0)
+            {
+                prev_[heads_[k]] = idx;
+            }
+            heads_[k] = idx;
+        }
+
+        void unlink(int32_t idx, uint32_t k)
+        {
+            is_free_[idx] = 0;
+            if (prev_[idx] >= 0)
+            {
+                next_[prev_[idx]] = next_[idx];
+            }
+            else
+            {
+                heads_[k] = next_[idx];
+            }
+            if (next_[idx] >= 0)
+            {
+                prev_[next_[idx]] = prev_[idx];
+            }
+        }
+
+        std::size_t            offset_;
+        uint32_t               min_shift_;
+        uint32_t               max_order_;
+        // per min_block: the order of the block starting there, whether
+        // it's free, and its links in the free list for that order
+        std::vector<uint8_t>   order_;
+        std::vector<uint8_t>   is_free_;
+        std::vector<int32_t>   next_;
+        std::vector<int32_t>   prev_;
+        std::vector<int32_t>   heads_;
+        std::size_t            in_use_;
+        std::size_t            requested_;
+        uint64_t               allocations_;
+        mutable std::mutex     mutex_;
+    };
+
+    static uint32_t log2(std::size_t v)
+    {
+        uint32_t r = 0;
+        while (v >>= 1)
+        {
+            ++r;
+        }
+        return r;
+    }
+
+    static std::size_t next_pow2(std::size_t v)
+    {
+        std::size_t p = 1;
+        while (p < v)
+        {
+            p <<= 1;
+        }
+        return p;
+    }
+
+    static std::size_t prev_pow2(std::size_t v)
+    {
+        return v ? std::size_t(1) << log2(v) : 0;
+    }
+
+    std::size_t thread_arena() const
+    {
+        return std::hash<std::thread::id>()(std::this_thread::get_id());
+    }
+
+    opae::fpga::types::shared_buffer::ptr_t buffer_;
+    std::size_t                             min_block_;
+    std::size_t                             base_align_;
+    std::vector<std::shared_ptr<arena>>     arenas_;
+    std::atomic<uint64_t>                   failures_{0};
 };
 
 } // end of namespace fpga
 } // end of namespace intel
-
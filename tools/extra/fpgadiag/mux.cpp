@@ -28,6 +28,10 @@
 #include <map>
 #include <typeindex>
 #include <chrono>
+#include <condition_variable>
+#include <future>
+#include <iomanip>
+#include <mutex>
 #include "nlb0.h"
 #include "nlb3.h"
 #include "nlb7.h"
@@ -213,7 +217,6 @@ int main(int argc, char* argv[])
     std::string target = "fpga";
     opts.get_value("target", target);
     bool shared = target == "fpga";
-    std::map<std::string, std::future<bool>> futures;
     std::map<std::string, test_result>       results;
     std::map<std::string, shared_buffer::ptr_t> dsm_list;
     size_t instance = 0;
@@ -241,31 +244,59 @@ int main(int argc, char* argv[])
         if (!app->disabled() && app->setup())
         {
             results[app->name()] = test_result::incomplete;
-            futures[app->name()] = app->run_async();
             dsm_list[app->name()] = app->dsm();
         }
     }
 
+    // Each app signals its own completion, so results are collected as soon
+    // as they are ready instead of at the next tick of a polling loop.
+    using hrc = std::chrono::high_resolution_clock;
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
     std::map<std::string, test_result>::size_type complete = 0;
-    dsm_tuple tpl;
-    while(complete < results.size())
+    std::map<std::string, std::chrono::microseconds> run_times;
+    std::vector<std::future<void>> runners;
+    for (auto app : apps)
     {
-        complete = 0;
-        for(auto & kv : results)
+        if (results.find(app->name()) == results.end())
+        {
+            continue;
+        }
+        run_times[app->name()] = std::chrono::microseconds(0);
+        runners.push_back(std::async(std::launch::async, [&, app]()
         {
-            if (kv.second == test_result::incomplete &&
-                futures[kv.first].valid() &&
-                futures[kv.first].wait_for(std::chrono::milliseconds(10)) == std::future_status::ready)
+            auto begin = hrc::now();
+            bool passed = false;
+            try
             {
-                results[kv.first] = futures[kv.first].get() ? test_result::pass : test_result::fail;
-                tpl += dsm_tuple(dsm_list[kv.first]);
-                complete++;
+                passed = app->run();
             }
-            else if(kv.second != test_result::incomplete)
+            catch(std::exception & ex)
             {
-                complete++;
+                log.error(app->name()) << "run failed: " << ex.what() << std::endl;
             }
-        }
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(hrc::now() - begin);
+            std::lock_guard<std::mutex> lock(done_mutex);
+            results[app->name()] = passed ? test_result::pass : test_result::fail;
+            run_times[app->name()] = elapsed;
+            ++complete;
+            done_cv.notify_one();
+        }));
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(done_mutex);
+        done_cv.wait(lock, [&]{ return complete == runners.size(); });
+    }
+    for (auto & r : runners)
+    {
+        r.wait();
+    }
+
+    dsm_tuple tpl;
+    for (auto & kv : results)
+    {
+        tpl += dsm_tuple(dsm_list[kv.first]);
     }
 
     uint64_t cachelines = 0;
@@ -290,6 +321,31 @@ int main(int argc, char* argv[])
                                              suppress_header,
                                              csv_format);
 
+    // time-to-completion per app, in microseconds
+    for (auto app : apps)
+    {
+        auto it = results.find(app->name());
+        if (it == results.end())
+        {
+            continue;
+        }
+        const char * result = it->second == test_result::pass ? "pass" : "fail";
+        if (csv_format)
+        {
+            std::cout << app->name() << "," << result << ","
+                      << run_times[app->name()].count() << ","
+                      << app->completion_time().count() << std::endl;
+        }
+        else
+        {
+            std::cout << std::left << std::setw(16) << app->name() << " "
+                      << std::setw(4) << result << " "
+                      << "run " << run_times[app->name()].count() << " us, "
+                      << "completion " << app->completion_time().count() << " us"
+                      << std::endl;
+        }
+    }
+
     for(auto & kv : results)
     {
         if (kv.second != test_result::pass)
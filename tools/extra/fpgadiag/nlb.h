@@ -102,6 +102,7 @@ enum class nlb0_ctl : uint32_t
     write_vh0    = 0x40000,
     write_vh1    = 0x60000,
     write_vr     = 0x80000,
+    intr_test    = 0x20000000,	//Interrupt when the test completes (interrupt_testmode)
     wrfence_va   = 0x0,
     wrfence_vl0  = 0x40000000,
     wrfence_vh0  = 0x80000000,
@@ -169,6 +170,7 @@ enum class nlb3_ctl : uint32_t
     write_vh0    = 0x40000,
     write_vh1    = 0x60000,
     write_vr     = 0x80000,
+    intr_test    = 0x20000000,	//Interrupt when the test completes (interrupt_testmode)
     wrfence_va   = 0x0,
     wrfence_vl0  = 0x40000000,
     wrfence_vh0  = 0x80000000,
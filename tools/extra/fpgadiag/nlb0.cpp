@@ -28,6 +28,7 @@
 #include "fpga_app/fpga_common.h"
 #include "nlb_stats.h"
 #include "diag_utils.h"
+#include "completion.h"
 #include <chrono>
 #include <thread>
 #include <unistd.h>
@@ -61,6 +62,7 @@ nlb0::nlb0()
 , csv_format_(false)
 , suppress_stats_(false)
 , cachelines_(0)
+, completion_time_(0)
 {
     options_.add_option<bool>("help",                'h', option::no_argument,   "Show help", false);
     options_.add_option<std::string>("config",       'c', option::with_argument, "Path to test config file", config_);
@@ -89,6 +91,9 @@ nlb0::nlb0()
     options_.add_option<bool>("suppress-hdr",             option::no_argument,   "Suppress column headers", suppress_header_);
     options_.add_option<bool>("csv",                 'V', option::no_argument,   "Comma separated value format", csv_format_);
     options_.add_option<bool>("suppress-stats",           option::no_argument,   "Show stas at end", suppress_stats_);
+    options_.add_option<bool>("interrupt",                option::no_argument,   "Wait on the AFU interrupt for test completion instead of polling the DSM", false);
+    options_.add_option<uint32_t>("ports",                option::with_argument, "Number of matching accelerators to test concurrently (0 for all)", 1);
+    options_.add_option<std::string>("numa-node",         option::with_argument, "Bind test threads and buffers to a NUMA node: one of {none, local, <node>}", "none");
 }
 
 nlb0::~nlb0()
@@ -326,11 +331,28 @@ bool nlb0::setup()
         log_.error("nlb0") << "failed to allocate DSM workspace." << std::endl;
         return false;
     }
+
+    bool interrupt = false;
+    irq_.reset();
+    if (options_.get_value<bool>("interrupt", interrupt) && interrupt)
+    {
+        try
+        {
+            irq_ = event::register_event(accelerator_, event::type_t::interrupt);
+            cfg_ |= nlb0_ctl::intr_test;
+        }
+        catch(std::exception & ex)
+        {
+            log_.warn("nlb0") << "AFU interrupt unavailable, polling the DSM instead: "
+                              << ex.what() << std::endl;
+        }
+    }
     return true;
 }
 
 bool nlb0::run()
 {
+    completion_time_ = microseconds(0);
     auto fme_token = get_parent_token(accelerator_);
     shared_buffer::ptr_t inout; // shared workspace, if possible
     shared_buffer::ptr_t inp;   // input workspace
@@ -421,8 +443,10 @@ bool nlb0::run()
             std::this_thread::sleep_for(cont_timeout_);
             // stop the device
             accelerator_->write_csr32(static_cast<uint32_t>(nlb0_csr::ctl), 7);
-            if (!buffer_wait(dsm_, static_cast<size_t>(nlb0_dsm::test_complete),
-                           std::chrono::microseconds(10), dsm_timeout_, 0x1, 1))
+            auto done = completion_monitor::instance()->wait(dsm_,
+                        static_cast<size_t>(nlb0_dsm::test_complete), 0x1, 1, dsm_timeout_, irq_);
+            completion_time_ += done.elapsed;
+            if (!done.complete)
             {
                 log_.error("nlb0") << "test timeout at "
                                    << i << " cachelines." << std::endl;
@@ -431,8 +455,10 @@ bool nlb0::run()
         }
         else
         {
-            if (!buffer_wait(dsm_, static_cast<size_t>(nlb0_dsm::test_complete),
-                        std::chrono::microseconds(10), dsm_timeout_, 0x1, 1))
+            auto done = completion_monitor::instance()->wait(dsm_,
+                        static_cast<size_t>(nlb0_dsm::test_complete), 0x1, 1, dsm_timeout_, irq_);
+            completion_time_ += done.elapsed;
+            if (!done.complete)
             {
                 log_.error("nlb0") << "test timeout at "
                                    << i << " cachelines." << std::endl;
@@ -472,9 +498,10 @@ bool nlb0::run()
             return false;
         }
 
-        // Wait for the AFU's read/write traffic to complete. Give up after 100
-        // tries.
+        // Wait for the AFU's read/write traffic to complete. Back off from 1us
+        // to 1ms between checks and give up after 100 tries.
         uint32_t afu_traffic_trips = 0;
+        std::chrono::microseconds drain_backoff(1);
         while (afu_traffic_trips < 100)
         {
             // CSR_STATUS1 holds two 32 bit values: num pending reads and writes.
@@ -486,7 +513,8 @@ bool nlb0::run()
             }
 
             afu_traffic_trips += 1;
-            usleep(1000);
+            std::this_thread::sleep_for(drain_backoff);
+            drain_backoff = std::min(drain_backoff * 2, std::chrono::microseconds(1000));
         }
     }
     // put the tuple back into the dsm buffer
@@ -30,6 +30,7 @@
 #include "fpga_app/accelerator_app.h"
 #include "csr.h"
 #include "log.h"
+#include <opae/cxx/core/events.h>
 #include <chrono>
 
 namespace intel
@@ -58,6 +59,8 @@ public:
     virtual bool                       run()                  override;
     virtual opae::fpga::types::shared_buffer::ptr_t          dsm()            const override { return dsm_; }
     virtual uint64_t                   cachelines()     const override { return cachelines_; }
+    virtual uint32_t                   clock_frequency() const override { return frequency_; }
+    virtual std::chrono::microseconds  completion_time() const override { return completion_time_; }
 
     void show_help(std::ostream &os);
 
@@ -89,6 +92,8 @@ private:
     bool csv_format_;
     bool suppress_stats_;
     uint64_t cachelines_;
+    std::chrono::microseconds completion_time_;
+    opae::fpga::types::event::ptr_t irq_;
 };
 
 } // end of namespace diag
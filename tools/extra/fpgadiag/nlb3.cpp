@@ -32,6 +32,7 @@
 #include <chrono>
 #include <thread>
 #include "diag_utils.h"
+#include "completion.h"
 #include <unistd.h>
 
 using namespace opae::fpga::types;
@@ -65,6 +66,7 @@ nlb3::nlb3()
 , suppress_stats_(false)
 , dsm_timeout_(FPGA_DSM_TIMEOUT)
 , cachelines_(0)
+, completion_time_(0)
 {
     options_.add_option<bool>("help",                'h', option::no_argument,   "Show help", false);
     options_.add_option<std::string>("config",       'c', option::with_argument, "Path to test config file", config_);
@@ -99,6 +101,9 @@ nlb3::nlb3()
     options_.add_option<bool>("suppress-hdr",             option::no_argument,   "Suppress column headers", suppress_header_);
     options_.add_option<bool>("csv",                 'V', option::no_argument,   "Comma separated value format", csv_format_);
     options_.add_option<bool>("suppress-stats",           option::no_argument,   "Show stas at end", suppress_stats_);
+    options_.add_option<bool>("interrupt",                option::no_argument,   "Wait on the AFU interrupt for test completion instead of polling the DSM", false);
+    options_.add_option<uint32_t>("ports",                option::with_argument, "Number of matching accelerators to test concurrently (0 for all)", 1);
+    options_.add_option<std::string>("numa-node",         option::with_argument, "Bind test threads and buffers to a NUMA node: one of {none, local, <node>}", "none");
 }
 
 nlb3::~nlb3()
@@ -414,11 +419,28 @@ bool nlb3::setup()
         log_.error("nlb3") << "failed to allocate DSM workspace." << std::endl;
         return false;
     }
+
+    bool interrupt = false;
+    irq_.reset();
+    if (options_.get_value<bool>("interrupt", interrupt) && interrupt)
+    {
+        try
+        {
+            irq_ = event::register_event(accelerator_, event::type_t::interrupt);
+            cfg_ |= nlb3_ctl::intr_test;
+        }
+        catch(std::exception & ex)
+        {
+            log_.warn("nlb3") << "AFU interrupt unavailable, polling the DSM instead: "
+                              << ex.what() << std::endl;
+        }
+    }
     return true;
 }
 
 bool nlb3::run()
 {
+    completion_time_ = microseconds(0);
     auto fme_token = get_parent_token(accelerator_);
     shared_buffer::ptr_t ice;
     shared_buffer::ptr_t inout; // shared workspace, if possible
@@ -574,8 +596,10 @@ bool nlb3::run()
             std::this_thread::sleep_for(cont_timeout_);
             // stop the device
             accelerator_->write_csr32(static_cast<uint32_t>(nlb3_csr::ctl), 7);
-            if (!buffer_wait(dsm_, static_cast<size_t>(nlb3_dsm::test_complete),
-                        std::chrono::microseconds(10), dsm_timeout_, 0x1, 1))
+            auto done = completion_monitor::instance()->wait(dsm_,
+                        static_cast<size_t>(nlb3_dsm::test_complete), 0x1, 1, dsm_timeout_, irq_);
+            completion_time_ += done.elapsed;
+            if (!done.complete)
             {
                 log_.error("nlb3") << "test timeout at "
                                    << i << " cachelines." << std::endl;
@@ -584,8 +608,10 @@ bool nlb3::run()
         }
         else
         {
-            if (!buffer_wait(dsm_, static_cast<size_t>(nlb3_dsm::test_complete),
-                        std::chrono::microseconds(10), dsm_timeout_, 0x1, 1))
+            auto done = completion_monitor::instance()->wait(dsm_,
+                        static_cast<size_t>(nlb3_dsm::test_complete), 0x1, 1, dsm_timeout_, irq_);
+            completion_time_ += done.elapsed;
+            if (!done.complete)
             {
                 log_.error("nlb3") << "test timeout at "
                                    << i << " cachelines." << std::endl;
@@ -617,9 +643,10 @@ bool nlb3::run()
             dsm_tpl += dsm_tuple(dsm_);
         }
 
-        // Wait for the AFU's read/write traffic to complete. Give up after 100
-        // tries.
+        // Wait for the AFU's read/write traffic to complete. Back off from 1us
+        // to 1ms between checks and give up after 100 tries.
         uint32_t afu_traffic_trips = 0;
+        std::chrono::microseconds drain_backoff(1);
         while (afu_traffic_trips < 100)
         {
             // CSR_STATUS1 holds two 32 bit values: num pending reads and writes.
@@ -631,7 +658,8 @@ bool nlb3::run()
             }
 
             afu_traffic_trips += 1;
-            usleep(1000);
+            std::this_thread::sleep_for(drain_backoff);
+            drain_backoff = std::min(drain_backoff * 2, std::chrono::microseconds(1000));
         }
     }
     dsm_tpl.put(dsm_);
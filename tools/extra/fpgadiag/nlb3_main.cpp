@@ -31,6 +31,7 @@
 #include "option.h"
 #include "option_parser.h"
 #include "diag_utils.h"
+#include "nlb_runner.h"
 #include <opae/cxx/core/token.h>
 #include <opae/cxx/core/handle.h>
 
@@ -82,17 +83,8 @@ int main(int argc, char* argv[])
     auto accelerator_list = token::enumerate({ props });
     if (accelerator_list.size() >= 1)
     {
-        token::ptr_t accelerator_tok = accelerator_list[0];
-        auto h = handle::open(accelerator_tok, (shared ? FPGA_OPEN_SHARED: 0));
-        nlb.assign(h);
-        if (nlb.setup())
-        {
-            return nlb.run() ? 0 : 3;
-        }
-        else
-        {
-            std::cerr << "Error: configuration failed." << std::endl;
-        }
+        return run_nlb(nlb, []{ return accelerator_app::ptr_t(new nlb3()); },
+                       accelerator_list, shared);
     }
     else
     {
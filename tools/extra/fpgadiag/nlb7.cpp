@@ -91,6 +91,8 @@ nlb7::nlb7()
     options_.add_option<bool>("suppress-hdr",             option::no_argument,   "Suppress column headers", suppress_headers_);
     options_.add_option<bool>("csv",                 'V', option::no_argument,   "Comma separated value format", csv_format_);
     options_.add_option<bool>("suppress-stats",           option::no_argument,   "Show stas at end", suppress_stats_);
+    options_.add_option<uint32_t>("ports",                option::with_argument, "Number of matching accelerators to test concurrently (0 for all)", 1);
+    options_.add_option<std::string>("numa-node",         option::with_argument, "Bind test threads and buffers to a NUMA node: one of {none, local, <node>}", "none");
 }
 
 nlb7::~nlb7()
@@ -422,6 +424,7 @@ bool nlb7::run()
     accelerator_->write_csr32(static_cast<uint32_t>(nlb7_csr::cfg), cfg_.value());
 
     uint32_t sz = CL(begin_);
+    dsm_tuple dsm_tpl;
     auto fme_token = get_parent_token(accelerator_);
     // Read perf counters.
     fpga_cache_counters  start_cache_ctrs  = fpga_cache_counters(fme_token);
@@ -621,14 +624,22 @@ bool nlb7::run()
             break;
         }
 
-        std::cout << intel::fpga::nlb::nlb_stats(dsm_,
-                                                 sz/CL(1),
-                                                 end_cache_ctrs - start_cache_ctrs,
-                                                 end_fabric_ctrs - start_fabric_ctrs,
-                                                 frequency_,
-                                                 false,
-                                                 suppress_headers_,
-                                                 csv_format_);
+        if (!suppress_stats_)
+        {
+            std::cout << intel::fpga::nlb::nlb_stats(dsm_,
+                                                     sz/CL(1),
+                                                     end_cache_ctrs - start_cache_ctrs,
+                                                     end_fabric_ctrs - start_fabric_ctrs,
+                                                     frequency_,
+                                                     false,
+                                                     suppress_headers_,
+                                                     csv_format_);
+        }
+        else
+        {
+            // accumulate the dsm stats of each iteration
+            dsm_tpl += dsm_tuple(dsm_);
+        }
 
         // Save Perf Monitors
         start_cache_ctrs  = end_cache_ctrs;
@@ -641,6 +652,12 @@ bool nlb7::run()
 
     accelerator_->reset();
 
+    if (suppress_stats_)
+    {
+        // put the accumulated stats into the dsm buffer
+        dsm_tpl.put(dsm_);
+    }
+
     dsm_.reset();
 
     return res;
@@ -58,6 +58,7 @@ public:
     virtual bool                       run();
     virtual opae::fpga::types::shared_buffer::ptr_t          dsm()            const override { return dsm_; }
     virtual uint64_t                   cachelines()     const override { return cachelines_; }
+    virtual uint32_t                   clock_frequency() const override { return frequency_; }
 
     void show_help(std::ostream &os);
 
@@ -0,0 +1,377 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <opae/cxx/core/handle.h>
+#include <opae/cxx/core/properties.h>
+#include "fpga_app/fpga_common.h"
+#include "nlb_runner.h"
+#include "nlb_stats.h"
+#include "diag_utils.h"
+
+using namespace opae::fpga::types;
+using namespace intel::fpga::nlb;
+using namespace intel::utils;
+
+namespace intel
+{
+namespace fpga
+{
+namespace diag
+{
+
+namespace
+{
+
+class start_barrier
+{
+public:
+    explicit start_barrier(size_t count)
+    : count_(count)
+    {
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (--count_ == 0)
+        {
+            cv_.notify_all();
+        }
+        else
+        {
+            cv_.wait(lock, [this]{ return count_ == 0; });
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t count_;
+};
+
+struct port_run
+{
+    std::string name;
+    int node = -1;
+    bool setup = false;
+    bool passed = false;
+    uint32_t clock_freq = 0;
+    uint64_t cachelines = 0;
+    shared_buffer::ptr_t dsm;
+};
+
+std::string port_name(token::ptr_t tok)
+{
+    auto props = properties::get(tok);
+    uint8_t bus = 0, device = 0, function = 0;
+    props->bus.get_value(bus);
+    props->device.get_value(device);
+    props->function.get_value(function);
+
+    std::ostringstream oss;
+    oss << std::hex << std::setfill('0')
+        << std::setw(2) << static_cast<uint32_t>(bus) << ':'
+        << std::setw(2) << static_cast<uint32_t>(device) << '.'
+        << static_cast<uint32_t>(function);
+    return oss.str();
+}
+
+double bandwidth(uint64_t count, uint64_t ticks, uint32_t clock_freq)
+{
+    if (ticks == 0)
+    {
+        return 0.0;
+    }
+    const double giga = 1000.0 * 1000.0 * 1000.0;
+    return (static_cast<double>(count) * CL(1) * clock_freq) / ticks / giga;
+}
+
+uint64_t run_ticks(dsm_tuple & dsm, bool cont)
+{
+    uint64_t penalty = dsm.start_overhead();
+    if (!cont)
+    {
+        penalty += dsm.end_overhead();
+    }
+    return dsm.raw_ticks() > penalty ? dsm.raw_ticks() - penalty : 0;
+}
+
+void run_port(accelerator_app::ptr_t app,
+              token::ptr_t tok,
+              bool shared,
+              std::mutex & setup_mutex,
+              start_barrier & barrier,
+              port_run & result)
+{
+    // Bind before setup so that the buffers setup allocates land on the
+    // same node as the thread driving them.
+    if (result.node >= 0 && !numa_bind(result.node))
+    {
+        std::cerr << "Warning: " << result.name << ": failed to bind to NUMA node "
+                  << result.node << std::endl;
+    }
+
+    try
+    {
+        std::lock_guard<std::mutex> lock(setup_mutex);
+        auto h = handle::open(tok, (shared ? FPGA_OPEN_SHARED : 0));
+        app->assign(h);
+        result.setup = app->setup();
+        result.dsm = app->dsm();
+    }
+    catch(std::exception & ex)
+    {
+        std::cerr << "Error: " << result.name << ": " << ex.what() << std::endl;
+    }
+
+    if (!result.setup)
+    {
+        std::cerr << "Error: " << result.name << ": configuration failed." << std::endl;
+    }
+
+    // Every port waits here, set up or not, so the rest are not stranded.
+    barrier.wait();
+
+    if (!result.setup)
+    {
+        return;
+    }
+
+    try
+    {
+        result.passed = app->run();
+        result.clock_freq = app->clock_frequency();
+        result.cachelines = app->cachelines();
+    }
+    catch(std::exception & ex)
+    {
+        std::cerr << "Error: " << result.name << ": " << ex.what() << std::endl;
+    }
+}
+
+void print_results(std::ostream & os,
+                   const std::vector<port_run> & results,
+                   bool cont,
+                   bool csv,
+                   bool header)
+{
+    double total_rd = 0.0, total_wr = 0.0;
+    uint64_t total_cls = 0, total_rds = 0, total_wrs = 0;
+
+    if (header)
+    {
+        if (csv)
+        {
+            os << "Port,NUMA node,Cachelines,Read_Count,Write_Count,"
+               << "'Rd BW (GB/s)','Wr BW (GB/s)',Result" << std::endl;
+        }
+        else
+        {
+            os << std::setw(12) << "Port"        << ' '
+               << std::setw(10) << "NUMA node"   << ' '
+               << std::setw(12) << "Cachelines"  << ' '
+               << std::setw(12) << "Read_Count"  << ' '
+               << std::setw(12) << "Write_Count" << ' '
+               << std::setw(14) << "Rd BW (GB/s)" << ' '
+               << std::setw(14) << "Wr BW (GB/s)" << ' '
+               << std::setw(8)  << "Result"      << std::endl;
+        }
+    }
+
+    auto print_row = [&os, csv](const std::string & name,
+                                const std::string & node,
+                                uint64_t cls,
+                                uint64_t rds,
+                                uint64_t wrs,
+                                double rd_bw,
+                                double wr_bw,
+                                const std::string & result)
+    {
+        std::ostringstream rd, wr;
+        rd.precision(3);
+        rd.setf(std::ios::fixed, std::ios::floatfield);
+        rd << rd_bw;
+        wr.precision(3);
+        wr.setf(std::ios::fixed, std::ios::floatfield);
+        wr << wr_bw;
+
+        if (csv)
+        {
+            os << name << ',' << node << ',' << cls << ',' << rds << ','
+               << wrs << ',' << rd.str() << ',' << wr.str() << ',' << result
+               << std::endl;
+        }
+        else
+        {
+            os << std::setw(12) << name     << ' '
+               << std::setw(10) << node     << ' '
+               << std::setw(12) << cls      << ' '
+               << std::setw(12) << rds      << ' '
+               << std::setw(12) << wrs      << ' '
+               << std::setw(14) << rd.str() << ' '
+               << std::setw(14) << wr.str() << ' '
+               << std::setw(8)  << result   << std::endl;
+        }
+    };
+
+    for (const auto & r : results)
+    {
+        uint64_t rds = 0, wrs = 0;
+        double rd_bw = 0.0, wr_bw = 0.0;
+        if (r.setup && r.dsm)
+        {
+            dsm_tuple dsm(r.dsm);
+            auto ticks = run_ticks(dsm, cont);
+            rds = dsm.num_reads();
+            wrs = dsm.num_writes();
+            rd_bw = bandwidth(rds, ticks, r.clock_freq);
+            wr_bw = bandwidth(wrs, ticks, r.clock_freq);
+        }
+        total_cls += r.cachelines;
+        total_rds += rds;
+        total_wrs += wrs;
+        total_rd += rd_bw;
+        total_wr += wr_bw;
+
+        print_row(r.name,
+                  r.node < 0 ? std::string("-") : std::to_string(r.node),
+                  r.cachelines, rds, wrs, rd_bw, wr_bw,
+                  !r.setup ? "SETUP" : (r.passed ? "PASS" : "FAIL"));
+    }
+
+    print_row("Aggregate", "-", total_cls, total_rds, total_wrs,
+              total_rd, total_wr, "");
+}
+
+} // end of anonymous namespace
+
+int run_nlb(accelerator_app & app,
+            std::function<accelerator_app::ptr_t()> make_app,
+            const std::vector<token::ptr_t> & tokens,
+            bool shared)
+{
+    option_map & opts = app.get_options();
+    uint32_t count = 1;
+    opts.get_value<uint32_t>("ports", count);
+    std::string numa = "none";
+    opts.get_value<std::string>("numa-node", numa);
+
+    if (count == 0 || count > tokens.size())
+    {
+        count = tokens.size();
+    }
+
+    if (count <= 1)
+    {
+        int node = numa_node(numa, tokens[0]);
+        if (node >= 0 && !numa_bind(node))
+        {
+            std::cerr << "Warning: failed to bind to NUMA node " << node << std::endl;
+        }
+
+        auto h = handle::open(tokens[0], (shared ? FPGA_OPEN_SHARED: 0));
+        app.assign(h);
+        if (app.setup())
+        {
+            return app.run() ? 0 : 3;
+        }
+        std::cerr << "Error: configuration failed." << std::endl;
+        return 102;
+    }
+
+    // Per-iteration stats from several ports would interleave, so the
+    // tests accumulate them in their dsm and we report once at the end.
+    auto suppress_stats = opts.find("suppress-stats");
+    if (suppress_stats)
+    {
+        *suppress_stats = true;
+    }
+
+    std::vector<accelerator_app::ptr_t> apps;
+    std::vector<port_run> results(count);
+    apps.push_back(accelerator_app::ptr_t(&app, [](accelerator_app *){}));
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (i > 0)
+        {
+            apps.push_back(make_app());
+            // The option objects are shared, so every instance sees the
+            // command line that the first one parsed.
+            apps[i]->get_options() = opts;
+        }
+        results[i].name = port_name(tokens[i]);
+        results[i].node = numa_node(numa, tokens[i]);
+    }
+
+    std::mutex setup_mutex;
+    start_barrier barrier(count);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        threads.emplace_back(run_port,
+                             apps[i],
+                             tokens[i],
+                             shared,
+                             std::ref(setup_mutex),
+                             std::ref(barrier),
+                             std::ref(results[i]));
+    }
+
+    for (auto & t : threads)
+    {
+        t.join();
+    }
+
+    bool cont = false, csv = false, suppress_hdr = false;
+    opts.get_value<bool>("cont", cont);
+    opts.get_value<bool>("csv", csv);
+    opts.get_value<bool>("suppress-hdr", suppress_hdr);
+    print_results(std::cout, results, cont, csv, !suppress_hdr);
+
+    int res = 0;
+    for (const auto & r : results)
+    {
+        if (!r.setup)
+        {
+            return 102;
+        }
+        if (!r.passed)
+        {
+            res = 3;
+        }
+    }
+    return res;
+}
+
+} // end of namespace diag
+} // end of namespace fpga
+} // end of namespace intel
@@ -0,0 +1,64 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+#include <functional>
+#include <vector>
+#include <opae/cxx/core/token.h>
+#include "fpga_app/accelerator_app.h"
+
+namespace intel
+{
+namespace fpga
+{
+namespace diag
+{
+
+/// @brief Run an nlb test on one or more matching accelerators.
+///
+/// With --ports=1 (the default) the test runs on the first token in the
+/// calling thread, as it always has. Otherwise each selected accelerator
+/// gets its own instance of the test, made with make_app and sharing
+/// app's options, and its own thread. Every thread sets up first and
+/// then waits on a barrier, so all the ports start their traffic
+/// together. Per-port and aggregate bandwidth are reported at the end.
+/// With --numa-node, each thread and the buffers it allocates are bound
+/// to the given NUMA node, or to the accelerator's own socket for "local".
+///
+/// @param app      The test instance that parsed the command line.
+/// @param make_app Creates more instances of the same test.
+/// @param tokens   The matching accelerator tokens.
+/// @param shared   Whether to open the accelerators in shared mode.
+///
+/// @return 0 on success, 3 if a test failed, or 102 if setup failed.
+int run_nlb(accelerator_app & app,
+            std::function<accelerator_app::ptr_t()> make_app,
+            const std::vector<opae::fpga::types::token::ptr_t> & tokens,
+            bool shared);
+
+} // end of namespace diag
+} // end of namespace fpga
+} // end of namespace intel
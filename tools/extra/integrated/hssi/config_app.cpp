@@ -32,6 +32,7 @@
 #include "utils.h"
 #include "fme.h"
 #include "mmio_stream.h"
+#include "mailbox.h"
 #include <chrono>
 #include <thread>
 
@@ -675,22 +676,56 @@ size_t config_app::parse_registers(const std::vector<std::vector<std::string>> &
 
 size_t config_app::load(eq_register registers[], size_t size)
 {
+    using hrc = std::chrono::high_resolution_clock;
+
     size_t loaded = 0;
+    size_t skipped = 0;
+    auto przone = std::dynamic_pointer_cast<hssi_przone>(przone_);
+    uint64_t przone_count = przone ? przone->transactions() : 0;
+    uint32_t cmd_count = hssi_cmd_count_;
+    auto begin = hrc::now();
+
+    // runs of consecutive PR zone writes are queued and issued as one batch
+    mailbox_batch batch(przone_);
+    size_t batch_start = 0;
+    auto flush = [&]()
+    {
+        if (batch.size() == 0)
+        {
+            return;
+        }
+        loaded += batch.execute();
+        for (size_t j = 0; j < batch.size(); ++j)
+        {
+            if (!batch.commands()[j].ok)
+            {
+                report_load_error(batch_start + j, registers[batch_start + j]);
+            }
+        }
+        batch.clear();
+    };
+
     for (size_t i = 0; i < size; ++i)
     {
         const eq_register & reg = registers[i];
+        if (reg.type != eq_register_type::przone)
+        {
+            flush();
+        }
+
+        bool ok = true;
         switch(reg.type)
         {
             case eq_register_type::fpga_rx:
             case eq_register_type::fpga_tx:
-                xcvr_write(reg.channel_lane, reg.address, reg.value);
+                ok = xcvr_write(reg.channel_lane, reg.address, reg.value);
                 break;
 
             case eq_register_type::retimer_rx:
             case eq_register_type::retimer_tx:
                 if (!c_header_)
                 {
-                    retimer_write(reg.device, reg.channel_lane, reg.address, reg.value);
+                    ok = retimer_write(reg.device, reg.channel_lane, reg.address, reg.value);
                 }
                 break;
             case eq_register_type::hssi_mode:
@@ -699,13 +734,13 @@ size_t config_app::load(eq_register registers[], size_t size)
                     header_stream_ << "// GOTO MODE:  "
                                    << print_hex<uint32_t>(reg.value) << std::endl;
                 }
-                hssi_soft_cmd(nios_cmd::change_hssi_mode, std::vector<uint32_t>{ reg.value  });
-                hssi_soft_cmd(nios_cmd::hssi_init, std::vector<uint32_t>{ reg.value  });
+                ok = hssi_soft_cmd(nios_cmd::change_hssi_mode, std::vector<uint32_t>{ reg.value  }) &&
+                     hssi_soft_cmd(nios_cmd::hssi_init, std::vector<uint32_t>{ reg.value  });
                 break;
             case eq_register_type::mdio:
                 if (!c_header_)
                 {
-                    mdio_->write(reg.channel_lane, reg.device, reg.address, reg.value);
+                    ok = mdio_->write(reg.channel_lane, reg.device, reg.address, reg.value);
                     std::cerr << "// MDIO Write Device: " << print_hex<uint8_t>(reg.channel_lane) << " "
                      << "port:" << " " << print_hex<uint8_t>(reg.device) << " "
                      << "reg:" << " " << print_hex<uint16_t>(reg.address) << " "
@@ -715,15 +750,57 @@ size_t config_app::load(eq_register registers[], size_t size)
             case eq_register_type::przone:
                 if (!c_header_)
                 {
-                    przone_->write(reg.address, reg.value);
+                    if (batch.size() == 0)
+                    {
+                        batch_start = i;
+                    }
+                    batch.write(reg.address, reg.value);
+                    continue;
                 }
                 break;
-            default: break;
+            default:
+                ++skipped;
+                continue;
+        }
+
+        if (ok)
+        {
+            ++loaded;
+        }
+        else
+        {
+            report_load_error(i, reg);
         }
     }
+    flush();
+
+    if (!c_header_)
+    {
+        auto usec = std::chrono::duration_cast<std::chrono::microseconds>(hrc::now() - begin).count();
+        uint64_t transactions = hssi_cmd_count_ - cmd_count;
+        if (przone)
+        {
+            transactions += przone->transactions() - przone_count;
+        }
+        double rate = usec > 0 ? transactions * 1E6 / usec : 0.0;
+        std::cerr << "Loaded " << loaded << " of " << size - skipped << " registers: "
+                  << transactions << " mailbox transactions in "
+                  << usec << " us (" << static_cast<uint64_t>(rate)
+                  << " transactions/sec)" << std::endl;
+    }
     return loaded;
 }
 
+void config_app::report_load_error(size_t index, const eq_register & reg)
+{
+    auto it = register_type_str_map.find(reg.type);
+    std::cerr << "Error loading register " << index << ": "
+              << (it != register_type_str_map.end() ? it->second : "UNKNOWN") << ","
+              << reg.channel_lane << "," << reg.device << ","
+              << print_hex<uint32_t>(reg.address) << ","
+              << print_hex<uint32_t>(reg.value) << std::endl;
+}
+
 bool config_app::hssi_soft_cmd(uint32_t nios_func, std::vector<uint32_t> args)
 {
     uint32_t junk;
@@ -1144,41 +1221,22 @@ bool config_app::retimer_read(uint32_t device_addr, uint8_t channel, uint32_t ad
 
 bool config_app::wait_for_ack(config_app::ack_t response, uint32_t timeout_usec, uint32_t * duration)
 {
-    using hrc = std::chrono::high_resolution_clock;
-    using std::chrono::microseconds;
-    auto begin  = hrc::now();
     static const uint32_t ack_bit = 32;
 
     uint64_t value = response == ack_t::ack ? 0 : 0xFFFF;
     // write a little lambda to check the value basked on response type we are
     // waiting on
-    auto check_ack = [response](uint64_t v) -> bool
-    {
-        return response == ack_t::ack ?  (v & (1UL << ack_bit)) : (~v & (1UL << ack_bit));
-    };
-
-    bool timedout = false;
-    while (!timedout)
+    auto check_ack = [this, response, &value]() -> poll_status
     {
-        auto delta = hrc::now() - begin;
-
-        if (mmio_->read_mmio64(stat_, value) && check_ack(value))
+        if (!mmio_->read_mmio64(stat_, value))
         {
-            if (duration)
-            {
-                *duration = std::chrono::duration_cast<microseconds>(delta).count();
-            }
-
-            return true;
+            return poll_status::pending;
         }
+        bool acked = response == ack_t::ack ? (value & (1UL << ack_bit)) : (~value & (1UL << ack_bit));
+        return acked ? poll_status::ready : poll_status::pending;
+    };
 
-        std::this_thread::sleep_for(microseconds(10));
-        timedout = delta > microseconds(timeout_usec);
-    }
-    return false;
-
-
-
+    return spin_poll(check_ack, timeout_usec, duration);
 }
 
 bool config_app::hssi_ack()
@@ -1199,6 +1257,7 @@ bool config_app::hssi_ack()
     {
         return false;
     }
+    ++hssi_cmd_count_;
     return true;
 
 }
@@ -147,6 +147,8 @@ private:
     /// @return true if the routine completed successfully, false if any of the waits timed out
     bool hssi_ack();
 
+    void report_load_error(std::size_t index, const eq_register & reg);
+
     bool do_load         (const intel::utils::cmd_handler::cmd_vector_t & cmd);
     bool do_dump         (const intel::utils::cmd_handler::cmd_vector_t & cmd);
     bool do_read         (const intel::utils::cmd_handler::cmd_vector_t & cmd);
@@ -25,8 +25,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 #include "hssi_przone.h"
 #include "hssi_msg.h"
-#include <chrono>
-#include <thread>
+#include "mailbox.h"
 
 namespace intel
 {
@@ -38,12 +37,13 @@ namespace hssi
 using namespace intel::fpga;
 using namespace intel::fpga::hssi::controller;
 using namespace std;
-using namespace std::chrono;
 
 hssi_przone::hssi_przone(mmio::ptr_t mmio, uint32_t ctrl, uint32_t stat)
 : mmio_(mmio)
 , ctrl_(ctrl)
 , stat_(stat)
+, spin_usec_(default_spin_usec)
+, transactions_(0)
 {
 }
 
@@ -121,29 +121,17 @@ bool hssi_przone::wait_for_ack(ack_t response, uint32_t timeout_usec, uint32_t *
     uint64_t value = response == ack_t::ack ? 0 : 0xFFFF;
     // write a little lambda to check the value based on response type we are
     // waiting on
-    auto check_ack = [response](uint64_t v) -> bool
+    auto check_ack = [this, response, &value]() -> poll_status
     {
-        return response == ack_t::ack ?  (v & (1UL << ack_bit)) : (~v & (1UL << ack_bit));
-    };
-
-    auto begin  = high_resolution_clock::now();
-    auto delta = high_resolution_clock::now() - begin;
-    while (delta < microseconds(timeout_usec))
-    {
-        if (mmio_->read_mmio64(static_cast<uint32_t>(stat_), value) && check_ack(value))
+        if (!mmio_->read_mmio64(static_cast<uint32_t>(stat_), value))
         {
-            if (duration)
-            {
-                *duration = duration_cast<microseconds>(delta).count();
-            }
-
-            return true;
+            return poll_status::pending;
         }
+        bool acked = response == ack_t::ack ? (value & (1UL << ack_bit)) : (~value & (1UL << ack_bit));
+        return acked ? poll_status::ready : poll_status::pending;
+    };
 
-        std::this_thread::sleep_for(microseconds(10));
-        delta = high_resolution_clock::now() - begin;
-    }
-    return false;
+    return spin_poll(check_ack, timeout_usec, duration, spin_usec_);
 }
 
 bool hssi_przone::hssi_ack(uint32_t timeout_usec, uint32_t * duration)
@@ -157,9 +145,13 @@ bool hssi_przone::hssi_ack(uint32_t timeout_usec, uint32_t * duration)
     {
         return false;
     }
+    ++transactions_;
     return true;
 }
 
+void hssi_przone::set_spin_usec(uint32_t spin_usec) { spin_usec_ = spin_usec; }
+uint64_t hssi_przone::transactions() const { return transactions_; }
+
 uint32_t hssi_przone::get_ctrl() const { return ctrl_; }
 uint32_t hssi_przone::get_stat() const { return stat_; }
 
@@ -67,6 +67,13 @@ public:
     bool hssi_ack(uint32_t timeout_usec = 1000, uint32_t * duration = 0);
     bool wait_for_ack(ack_t response, uint32_t timeout_usec = 1000, uint32_t * duration = 0);
 
+    /// @brief Set how long wait_for_ack busy-polls HSSI_STAT before it
+    ///        starts sleeping between reads
+    void set_spin_usec(uint32_t spin_usec);
+
+    /// @brief Number of completed mailbox transactions (ack/nack handshakes)
+    uint64_t transactions() const;
+
     uint32_t get_ctrl() const;
     uint32_t get_stat() const;
     mmio::ptr_t get_mmio() const;
@@ -74,10 +81,13 @@ public:
 private:
 
     static const uint32_t ack_bit = 32;
+    static const uint32_t default_spin_usec = 50;
 
     mmio::ptr_t mmio_;
     uint32_t ctrl_;
     uint32_t stat_;
+    uint32_t spin_usec_;
+    uint64_t transactions_;
 
 };
 
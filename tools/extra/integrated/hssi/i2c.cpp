@@ -24,9 +24,8 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 #include "i2c.h"
+#include "mailbox.h"
 #include <iostream>
-#include <chrono>
-#include <thread>
 
 namespace intel
 {
@@ -36,7 +35,6 @@ namespace hssi
 {
 
 using namespace std;
-using namespace std::chrono;
 
 i2c::i2c(przone_interface::ptr_t przone, size_t byte_addr_size)
 : przone_(przone)
@@ -131,32 +129,30 @@ bool i2c::write(uint32_t instance, uint32_t device_addr, uint32_t byte_addr, uin
 
 bool i2c::wait_for_i2c_tx(uint32_t timeout_usec)
 {
-    auto begin  = high_resolution_clock::now();
     uint32_t stat;
-    while (true)
+    bool failed = false;
+    auto check_tx = [this, &stat, &failed]() -> poll_status
     {
-        auto delta = high_resolution_clock::now() - begin;
-        if (delta >= microseconds(timeout_usec))
-        {
-            log_.warn() << "Timed out waiting for I2C TX to stop" << std::endl;
-            return false;
-        }
-
         if (!przone_->read(i2c_reg_stat_rddata, stat))
         {
             std::cerr << "ERROR: Waiting for i2c ready" << std::endl;
-            return false;
+            failed = true;
+            return poll_status::error;
         }
 
-        if (~stat & i2c_stat_tx)
-        {
-            return true;
-        }
-        else
+        return (~stat & i2c_stat_tx) ? poll_status::ready : poll_status::pending;
+    };
+
+    if (!spin_poll(check_tx, timeout_usec))
+    {
+        if (failed)
         {
-            std::this_thread::sleep_for(microseconds(10));
+            return false;
         }
+        log_.warn() << "Timed out waiting for I2C TX to stop" << std::endl;
+        return false;
     }
+    return true;
 }
 
 } // end of namespace hssi
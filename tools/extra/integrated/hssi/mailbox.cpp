@@ -0,0 +1,93 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#include "mailbox.h"
+
+namespace intel
+{
+namespace fpga
+{
+namespace hssi
+{
+
+using namespace std::chrono;
+
+mailbox_batch::mailbox_batch(przone_interface::ptr_t przone)
+: przone_(przone)
+, completed_(0)
+, elapsed_(0)
+{
+}
+
+void mailbox_batch::read(uint32_t address)
+{
+    commands_.push_back(command{ op::read, address, 0, false });
+}
+
+void mailbox_batch::write(uint32_t address, uint32_t value)
+{
+    commands_.push_back(command{ op::write, address, value, false });
+}
+
+std::size_t mailbox_batch::execute(bool stop_on_error)
+{
+    completed_ = 0;
+    auto begin = high_resolution_clock::now();
+    for (auto & cmd : commands_)
+    {
+        cmd.ok = cmd.type == op::read ? przone_->read(cmd.address, cmd.value)
+                                      : przone_->write(cmd.address, cmd.value);
+        if (cmd.ok)
+        {
+            ++completed_;
+        }
+        else if (stop_on_error)
+        {
+            break;
+        }
+    }
+    elapsed_ = duration_cast<microseconds>(high_resolution_clock::now() - begin);
+    return completed_;
+}
+
+void mailbox_batch::clear()
+{
+    commands_.clear();
+    completed_ = 0;
+    elapsed_ = microseconds(0);
+}
+
+double mailbox_batch::rate() const
+{
+    if (elapsed_.count() == 0)
+    {
+        return 0.0;
+    }
+    return completed_ * 1E6 / elapsed_.count();
+}
+
+} // end of namespace hssi
+} // end of namespace fpga
+} // end of namespace intel
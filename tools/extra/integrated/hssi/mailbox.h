@@ -0,0 +1,152 @@
+// Copyright(c) 2019, Intel Corporation
+//
+// Redistribution  and  use  in source  and  binary  forms,  with  or  without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of  source code  must retain the  above copyright notice,
+//   this list of conditions and the following disclaimer.
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// * Neither the name  of Intel Corporation  nor the names of its contributors
+//   may be used to  endorse or promote  products derived  from this  software
+//   without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,  BUT NOT LIMITED TO,  THE
+// IMPLIED WARRANTIES OF  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED.  IN NO EVENT  SHALL THE COPYRIGHT OWNER  OR CONTRIBUTORS BE
+// LIABLE  FOR  ANY  DIRECT,  INDIRECT,  INCIDENTAL,  SPECIAL,  EXEMPLARY,  OR
+// CONSEQUENTIAL  DAMAGES  (INCLUDING,  BUT  NOT LIMITED  TO,  PROCUREMENT  OF
+// SUBSTITUTE GOODS OR SERVICES;  LOSS OF USE,  DATA, OR PROFITS;  OR BUSINESS
+// INTERRUPTION)  HOWEVER CAUSED  AND ON ANY THEORY  OF LIABILITY,  WHETHER IN
+// CONTRACT,  STRICT LIABILITY,  OR TORT  (INCLUDING NEGLIGENCE  OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "przone.h"
+
+namespace intel
+{
+namespace fpga
+{
+namespace hssi
+{
+
+enum class poll_status : uint8_t
+{
+    pending = 0,
+    ready,
+    error
+};
+
+/// @brief Poll a completion condition, re-checking it back to back for the
+///        first spin_usec microseconds and falling back to sleep_usec sleeps
+///        afterwards. Mailbox round trips usually complete within a few
+///        microseconds, well under the scheduler's sleep granularity.
+///
+/// @param[in] check Callable returning a poll_status
+/// @param[in] timeout_usec The number of microseconds at which this times out
+/// @param[out] duration Optional output variable set to the time it took the
+///             condition to become ready
+/// @param[in] spin_usec Length of the busy-poll window
+/// @param[in] sleep_usec Sleep between checks once the spin window expires
+///
+/// @return true if the condition became ready before the timeout
+template<typename Check>
+bool spin_poll(Check check,
+               uint32_t timeout_usec,
+               uint32_t * duration = nullptr,
+               uint32_t spin_usec = 50,
+               uint32_t sleep_usec = 10)
+{
+    using hrc = std::chrono::high_resolution_clock;
+    using std::chrono::microseconds;
+
+    auto begin = hrc::now();
+    while (true)
+    {
+        auto delta = hrc::now() - begin;
+        switch (check())
+        {
+            case poll_status::ready:
+                if (duration)
+                {
+                    *duration = std::chrono::duration_cast<microseconds>(delta).count();
+                }
+                return true;
+            case poll_status::error:
+                return false;
+            default:
+                break;
+        }
+
+        if (delta >= microseconds(timeout_usec))
+        {
+            return false;
+        }
+
+        if (delta >= microseconds(spin_usec))
+        {
+            std::this_thread::sleep_for(microseconds(sleep_usec));
+        }
+    }
+}
+
+/// @brief Queue of PR zone mailbox reads and writes that are issued back to
+///        back in a single pass, recording the status of each command and
+///        the achieved transaction rate.
+class mailbox_batch
+{
+public:
+    enum class op : uint8_t
+    {
+        read = 0,
+        write
+    };
+
+    struct command
+    {
+        op       type;
+        uint32_t address;
+        uint32_t value;
+        bool     ok;
+    };
+
+    mailbox_batch(przone_interface::ptr_t przone);
+
+    void read(uint32_t address);
+    void write(uint32_t address, uint32_t value);
+
+    /// @brief Issue all queued commands in order
+    ///
+    /// @param[in] stop_on_error Skip the remaining commands after a failure
+    ///
+    /// @return The number of commands that completed successfully
+    std::size_t execute(bool stop_on_error = false);
+
+    void clear();
+
+    const std::vector<command> & commands() const { return commands_; }
+    std::size_t size() const { return commands_.size(); }
+    std::size_t completed() const { return completed_; }
+
+    /// @brief Time spent in the last execute call
+    std::chrono::microseconds elapsed() const { return elapsed_; }
+
+    /// @brief Completed commands per second over the last execute call
+    double rate() const;
+
+private:
+    przone_interface::ptr_t przone_;
+    std::vector<command> commands_;
+    std::size_t completed_;
+    std::chrono::microseconds elapsed_;
+};
+
+} // end of namespace hssi
+} // end of namespace fpga
+} // end of namespace intel
@@ -24,6 +24,7 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,  EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 #include "mdio.h"
+#include "mailbox.h"
 #include <iostream>
 #include <chrono>
 #include <thread>
@@ -92,32 +93,30 @@ bool mdio::read(uint8_t device_addr, uint8_t port_addr, uint16_t reg_addr, uint3
 
 bool mdio::wait_for_mdio_tx(uint32_t timeout_usec)
 {
-    auto begin  = high_resolution_clock::now();
     uint32_t stat;
-    while (true)
+    bool failed = false;
+    auto check_tx = [this, &stat, &failed]() -> poll_status
     {
-        auto delta = high_resolution_clock::now() - begin;
-        if (delta >= microseconds(timeout_usec))
-        {
-            log_.warn() << "Timed out waiting for MDIO TX to stop" << std::endl;
-            return false;
-        }
-
         if (!przone_->read(mdio_ctrl_reg, stat))
         {
             std::cerr << "ERROR: Waiting for MDIO ready" << std::endl;
-            return false;
+            failed = true;
+            return poll_status::error;
         }
 
-        if ((~stat & mdio_write) && (~stat & mdio_read))
-        {
-            return true;
-        }
-        else
+        return ((~stat & mdio_write) && (~stat & mdio_read)) ? poll_status::ready : poll_status::pending;
+    };
+
+    if (!spin_poll(check_tx, timeout_usec))
+    {
+        if (failed)
         {
-            std::this_thread::sleep_for(microseconds(10));
+            return false;
         }
+        log_.warn() << "Timed out waiting for MDIO TX to stop" << std::endl;
+        return false;
     }
+    return true;
 }
 
 } // end of namespace hssi
@@ -77,30 +77,27 @@ static uint64_t _fpga_dma_feature_next(uint64_t dfh)
 	return (dfh >> AFU_DFH_NEXT_OFFSET) & 0xffffff;
 }
 
-// copy bytes to MMIO
+// copy bytes to MMIO. The last quadword holds the descriptor's control
+// word (and its go bit), so it is written on its own after a fence.
 static fpga_result _copy_to_mmio(fpga_handle afc_handle, uint64_t mmio_dst, uint64_t *host_src, int len)
 {
-	int i = 0;
 	fpga_result res = FPGA_OK;
+	int head = len - QWORD_BYTES;
 	//mmio requires 8 byte alignment
-	if (len % QWORD_BYTES != 0)
+	if (len < QWORD_BYTES || len % QWORD_BYTES != 0)
 		return FPGA_INVALID_PARAM;
 	if (mmio_dst % QWORD_BYTES != 0)
 		return FPGA_INVALID_PARAM;
 
-	uint64_t dev_addr = mmio_dst;
-	uint64_t *host_addr = host_src;
-
-	for (i = 0; i < len/QWORD_BYTES; i++) {
-		res = fpgaWriteMMIO64(afc_handle, 0, dev_addr, *host_addr);
+	if (head > 0) {
+		res = fpgaWriteMMIOBlock(afc_handle, 0, mmio_dst, host_src, head);
 		if (res != FPGA_OK)
 			return res;
-
-		host_addr += 1;
-		dev_addr += QWORD_BYTES;
+		__sync_synchronize();
 	}
 
-	return FPGA_OK;
+	return fpgaWriteMMIO64(afc_handle, 0, mmio_dst + head,
+			       host_src[head / QWORD_BYTES]);
 }
 
 